@@ -0,0 +1,118 @@
+/**
+ * @file Protocol.hpp
+ * @brief Wire format shared by the fleet agent and the collector in the MCP server example
+ *
+ * @details An agent opens one stream (TCP or a Unix socket) to the collector
+ * and writes length-prefixed frames:
+ *
+ *   u32 length (little-endian, counts everything after itself)
+ *   u8  kind   (FrameKind)
+ *   ... BEVE payload
+ *
+ * The first frame is a Hello naming the host. It is followed by a full
+ * snapshot (a delta with no base version), then by deltas against the
+ * previous frame. A collector that can't apply a delta simply closes the
+ * connection; the agent reconnects and starts over with a full snapshot,
+ * so neither side needs a reply channel.
+ *
+ * An agent with nothing new to report still sends an empty delta every
+ * KEEPALIVE_INTERVAL. The collector closes connections that stay silent for
+ * IDLE_TIMEOUT, so half-open sessions (an agent host that lost power, a
+ * dropped NAT mapping) don't linger as connected.
+ */
+
+#pragma once
+
+#include <bit>     // std::endian
+#include <chrono>  // std::chrono::seconds
+#include <cstring> // std::memcpy
+
+#include <Drac++/Core/Snapshot.hpp>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+namespace fleet {
+  using namespace draconis::utils::types;
+
+  inline constexpr u8 PROTOCOL_VERSION = 1;
+
+  /// Frames larger than this are treated as a protocol error.
+  inline constexpr u32 MAX_FRAME_BYTES = 16 * 1024 * 1024;
+
+  inline constexpr usize FRAME_HEADER_BYTES = sizeof(u32);
+
+  /// Longest an agent goes without sending a frame.
+  inline constexpr std::chrono::seconds KEEPALIVE_INTERVAL { 30 };
+
+  /// How long the collector waits for the next frame before dropping the connection.
+  inline constexpr std::chrono::seconds IDLE_TIMEOUT = 4 * KEEPALIVE_INTERVAL;
+
+  enum class FrameKind : u8 {
+    Hello = 'H',
+    Delta = 'D',
+  };
+
+  struct Hello {
+    u8     protocolVersion = PROTOCOL_VERSION;
+    String hostId;
+  };
+
+  /**
+   * @brief Append one frame carrying `payload` to `out`
+   */
+  inline auto AppendFrame(const FrameKind kind, const StringView payload, String& out) -> Unit {
+    static_assert(std::endian::native == std::endian::little, "Frame lengths are written in host byte order");
+
+    const u32 length = static_cast<u32>(payload.size() + 1);
+
+    Array<char, FRAME_HEADER_BYTES> header {};
+    std::memcpy(header.data(), &length, sizeof(length));
+
+    out.append(header.data(), header.size());
+    out += static_cast<char>(kind);
+    out += payload;
+  }
+
+  /**
+   * @brief Decode the length prefix of a frame
+   */
+  inline auto ReadFrameLength(const Array<char, FRAME_HEADER_BYTES>& header) -> Result<u32> {
+    using enum draconis::utils::error::DracErrorCode;
+
+    u32 length = 0;
+    std::memcpy(&length, header.data(), sizeof(length));
+
+    if (length == 0 || length > MAX_FRAME_BYTES)
+      ERR_FMT(CorruptedData, "Invalid frame length {}", length);
+
+    return length;
+  }
+
+  /**
+   * @brief Where the collector listens: "unix:/path/to/socket" or "host:port"
+   */
+  struct Endpoint {
+    bool   local = false; ///< Unix socket at `host`, instead of TCP
+    String host;
+    String port;
+  };
+
+  inline auto ParseEndpoint(const StringView text) -> Result<Endpoint> {
+    using enum draconis::utils::error::DracErrorCode;
+
+    if (text.starts_with("unix:")) {
+      if (text.size() == 5)
+        ERR(InvalidArgument, "Missing socket path after 'unix:'");
+
+      return Endpoint { .local = true, .host = String(text.substr(5)), .port = {} };
+    }
+
+    const usize colon = text.rfind(':');
+
+    if (colon == StringView::npos || colon + 1 == text.size())
+      ERR_FMT(InvalidArgument, "Expected 'host:port' or 'unix:/path', got '{}'", text);
+
+    return Endpoint { .local = false, .host = String(text.substr(0, colon)), .port = String(text.substr(colon + 1)) };
+  }
+} // namespace fleet
@@ -0,0 +1,224 @@
+/**
+ * @file agent.cpp
+ * @brief Draconis++ fleet agent example
+ *
+ * Keeps a background SnapshotService and ships its state to a collector
+ * (the MCP server example started with --fleet-listen): a full snapshot on
+ * every connect, then one delta per interval when something has changed, and
+ * an empty one as a keepalive when nothing has for a while.
+ *
+ *   fleet_agent <host:port | unix:/path> [--interval SECONDS] [--id NAME]
+ */
+
+#include <algorithm>                      // std::min
+#include <asio/connect.hpp>               // asio::connect
+#include <asio/io_context.hpp>            // asio::io_context
+#include <asio/ip/host_name.hpp>          // asio::ip::host_name
+#include <asio/ip/tcp.hpp>                // asio::ip::tcp
+#include <asio/local/stream_protocol.hpp> // asio::local::stream_protocol
+#include <asio/write.hpp>                 // asio::write
+#include <atomic>                         // std::atomic
+#include <charconv>                       // std::from_chars
+#include <chrono>                         // std::chrono::{seconds, steady_clock}
+#include <csignal>                        // SIGINT, SIGTERM, std::signal
+#include <cstdlib>                        // EXIT_FAILURE, EXIT_SUCCESS
+#include <iostream>                       // std::cerr
+#include <thread>                         // std::this_thread::sleep_for
+
+#include <Drac++/Core/Snapshot.hpp>
+
+#include <Drac++/Utils/CacheManager.hpp>
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Logging.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "Protocol.hpp"
+
+using namespace draconis::utils::types;
+using namespace draconis::core::system;
+using enum draconis::utils::error::DracErrorCode;
+
+namespace {
+  std::atomic<bool> Stopping = false;
+
+  struct Options {
+    fleet::Endpoint      collector;
+    String               hostId;
+    std::chrono::seconds interval { 60 };
+  };
+
+  auto ParseOptions(const i32 argc, char* argv[]) -> Result<Options> {
+    if (argc < 2)
+      ERR(InvalidArgument, "Usage: fleet_agent <host:port | unix:/path> [--interval SECONDS] [--id NAME]");
+
+    Result<fleet::Endpoint> endpoint = fleet::ParseEndpoint(argv[1]);
+
+    if (!endpoint)
+      return Err(endpoint.error());
+
+    Options options { .collector = std::move(*endpoint), .hostId = asio::ip::host_name() };
+
+    for (i32 i = 2; i + 1 < argc; i += 2) {
+      const StringView flag  = argv[i];
+      const StringView value = argv[i + 1];
+
+      if (flag == "--interval") {
+        i64 seconds = 0;
+
+        if (std::from_chars(value.data(), value.data() + value.size(), seconds).ec != std::errc {} || seconds <= 0)
+          ERR_FMT(InvalidArgument, "Invalid interval '{}'", value);
+
+        options.interval = std::chrono::seconds(seconds);
+      } else if (flag == "--id")
+        options.hostId = String(value);
+      else
+        ERR_FMT(InvalidArgument, "Unknown option '{}'", flag);
+    }
+
+    return options;
+  }
+
+  // Sleeps in short slices so a shutdown signal is noticed promptly.
+  auto SleepFor(const std::chrono::seconds duration) -> Unit {
+    const std::chrono::steady_clock::time_point until = std::chrono::steady_clock::now() + duration;
+
+    while (!Stopping && std::chrono::steady_clock::now() < until)
+      std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  }
+
+  template <typename Socket>
+  auto SendFrame(Socket& socket, const fleet::FrameKind kind, const StringView payload, String& buffer) -> Result<> {
+    buffer.clear();
+    fleet::AppendFrame(kind, payload, buffer);
+
+    asio::error_code errc;
+    asio::write(socket, asio::buffer(buffer), errc);
+
+    if (errc)
+      ERR_FMT(NetworkError, "Failed to send frame: {}", errc.message());
+
+    return {};
+  }
+
+  template <typename Socket>
+  auto SendDelta(Socket& socket, const SnapshotDelta& delta, String& payload, String& frame) -> Result<> {
+    payload.clear();
+
+    if (Result<> written = WriteSnapshotDelta(delta, payload); !written)
+      return written;
+
+    return SendFrame(socket, fleet::FrameKind::Delta, payload, frame);
+  }
+
+  // One connection's worth of work; returns once the connection fails or we're stopping.
+  template <typename Socket>
+  auto RunSession(Socket& socket, SnapshotService& snapshots, const Options& options) -> Result<> {
+    String payload, frame;
+
+    if (glz::error_ctx errc = glz::write_beve(fleet::Hello { .hostId = options.hostId }, payload); errc)
+      ERR_FMT(InternalError, "Failed to encode hello: {}", glz::format_error(errc, payload));
+
+    if (Result<> sent = SendFrame(socket, fleet::FrameKind::Hello, payload, frame); !sent)
+      return sent;
+
+    using Clock = std::chrono::steady_clock;
+
+    SharedPointer<const SystemSnapshot> lastSent = snapshots.current();
+
+    if (Result<> sent = SendDelta(socket, Diff(*lastSent), payload, frame); !sent)
+      return sent;
+
+    Clock::time_point lastDelta = Clock::now();
+    Clock::time_point lastFrame = lastDelta;
+
+    while (!Stopping) {
+      SleepFor(std::min(options.interval, fleet::KEEPALIVE_INTERVAL));
+
+      const Clock::time_point now = Clock::now();
+
+      SharedPointer<const SystemSnapshot> latest = snapshots.current();
+
+      if (latest->version != lastSent->version && now - lastDelta >= options.interval) {
+        if (Result<> sent = SendDelta(socket, Diff(*lastSent, *latest), payload, frame); !sent)
+          return sent;
+
+        lastSent  = std::move(latest);
+        lastDelta = now;
+        lastFrame = now;
+      } else if (now - lastFrame >= fleet::KEEPALIVE_INTERVAL) {
+        // Nothing to report yet; an empty delta tells the collector we're still here.
+        if (Result<> sent = SendDelta(socket, Diff(*lastSent, *lastSent), payload, frame); !sent)
+          return sent;
+
+        lastFrame = now;
+      }
+    }
+
+    return {};
+  }
+
+  auto Connect(asio::io_context& context, SnapshotService& snapshots, const Options& options) -> Result<> {
+    asio::error_code errc;
+
+    if (options.collector.local) {
+#ifdef ASIO_HAS_LOCAL_SOCKETS
+      asio::local::stream_protocol::socket socket(context);
+      socket.connect(asio::local::stream_protocol::endpoint(options.collector.host), errc);
+
+      if (errc)
+        ERR_FMT(NetworkError, "Failed to connect to {}: {}", options.collector.host, errc.message());
+
+      return RunSession(socket, snapshots, options);
+#else
+      ERR(NotSupported, "Unix sockets are not available on this platform");
+#endif
+    }
+
+    asio::ip::tcp::resolver resolver(context);
+    asio::ip::tcp::socket   socket(context);
+
+    asio::connect(socket, resolver.resolve(options.collector.host, options.collector.port, errc), errc);
+
+    if (errc)
+      ERR_FMT(NetworkError, "Failed to connect to {}:{}: {}", options.collector.host, options.collector.port, errc.message());
+
+    return RunSession(socket, snapshots, options);
+  }
+} // namespace
+
+auto main(const i32 argc, char* argv[]) -> i32 {
+  Result<Options> options = ParseOptions(argc, argv);
+
+  if (!options) {
+    std::cerr << options.error().message << '\n';
+    return EXIT_FAILURE;
+  }
+
+  std::signal(SIGINT, [](i32) { Stopping = true; });
+  std::signal(SIGTERM, [](i32) { Stopping = true; });
+
+  draconis::utils::cache::CacheManager cache;
+  SnapshotService                      snapshots(cache);
+  snapshots.start();
+
+  asio::io_context context;
+
+  // Back off exponentially while the collector is unreachable, up to one interval.
+  std::chrono::seconds backoff { 1 };
+
+  while (!Stopping) {
+    info_log("Connecting to collector as '{}'", options->hostId);
+
+    if (Result<> session = Connect(context, snapshots, *options); !session) {
+      warn_log("{}", session.error().message);
+
+      SleepFor(backoff);
+      backoff = std::min(backoff * 2, options->interval);
+    } else
+      backoff = std::chrono::seconds(1);
+  }
+
+  snapshots.stop();
+
+  return EXIT_SUCCESS;
+}
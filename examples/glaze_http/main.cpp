@@ -2,21 +2,28 @@
 #define ASIO_HAS_STD_COROUTINE 1
 
 #include <asio/error.hpp>            // asio::error::operation_aborted
+#include <chrono>                    // std::chrono::{clock_cast, floor, seconds, system_clock}
 #include <csignal>                   // SIGINT, SIGTERM, SIG_ERR, std::signal
 #include <cstdlib>                   // EXIT_FAILURE, EXIT_SUCCESS
 #include <fstream>                   // std::ifstream
+#include <functional>                // std::hash
 #include <magic_enum/magic_enum.hpp> // magic_enum::enum_name
+#include <memory>                    // std::{make_shared, weak_ptr}
+#include <ranges>                    // std::views::values
 
 #ifdef DELETE
   #undef DELETE
 #endif
 
-#include <glaze/core/context.hpp>    // glz::error_ctx
-#include <glaze/core/meta.hpp>       // glz::{meta, detail::Object}
-#include <glaze/net/http_server.hpp> // glz::http_server
-#include <matchit.hpp>               // matchit::impl::Overload
-#include <utility>                   // std::move
+#include <glaze/core/context.hpp>             // glz::error_ctx
+#include <glaze/core/meta.hpp>                // glz::{meta, detail::Object}
+#include <glaze/net/http_server.hpp>          // glz::http_server
+#include <glaze/net/websocket_connection.hpp> // glz::websocket_server
+#include <matchit.hpp>                        // matchit::impl::Overload
+#include <utility>                            // std::move
 
+#include <Drac++/Core/Metrics.hpp>
+#include <Drac++/Core/Snapshot.hpp>
 #include <Drac++/Core/System.hpp>
 
 #include <Drac++/Utils/CacheManager.hpp>
@@ -25,6 +32,8 @@
 #include <Drac++/Utils/Types.hpp>
 
 using namespace draconis::utils::types;
+using draconis::core::system::Diff, draconis::core::system::WriteOpenMetrics, draconis::core::system::WriteSnapshotDelta;
+using draconis::core::system::SnapshotDelta, draconis::core::system::SnapshotService, draconis::core::system::SystemSnapshot;
 using draconis::utils::error::DracError;
 using enum draconis::utils::error::DracErrorCode;
 
@@ -49,6 +58,81 @@ namespace {
 
     return result;
   }
+
+  // HTTP-date (RFC 9110), e.g. "Sun, 06 Nov 1994 08:49:37 GMT".
+  auto formatHttpDate(const std::chrono::system_clock::time_point time) -> String {
+    return std::format("{:%a, %d %b %Y %H:%M:%S} GMT", std::chrono::floor<std::chrono::seconds>(time));
+  }
+
+  // Whether the client's If-None-Match already names `etag`. Glaze stores header names lowercased.
+  auto matchesETag(const glz::request& req, const StringView etag) -> bool {
+    const auto iter = req.headers.find("if-none-match");
+
+    if (iter == req.headers.end())
+      return false;
+
+    const StringView candidates = iter->second;
+
+    return candidates == "*" || candidates.find(etag) != StringView::npos;
+  }
+
+  /**
+   * @brief A file read once and kept in memory, optionally re-read when it changes on disk.
+   */
+  class StaticFile {
+   public:
+    struct Contents {
+      String body;
+      usize  hash;
+      String etag;
+      String lastModified;
+
+      std::filesystem::file_time_type writeTime;
+    };
+
+    StaticFile(std::filesystem::path path, const bool watch)
+      : m_path(std::move(path)), m_watch(watch) {}
+
+    /**
+     * @brief The current contents, reloading first if watching and the file's write time moved.
+     */
+    auto get() -> Result<SharedPointer<const Contents>> {
+      const LockGuard lock(m_mutex);
+
+      if (m_contents && !m_watch)
+        return m_contents;
+
+      std::error_code                       errc;
+      const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(m_path, errc);
+
+      // Keep serving what we have if the file is briefly missing mid-save.
+      if (m_contents && (errc || writeTime == m_contents->writeTime))
+        return m_contents;
+
+      Result<String> body = readFile(m_path);
+
+      if (!body)
+        return Err(body.error());
+
+      const usize hash = std::hash<StringView> {}(*body);
+
+      m_contents = std::make_shared<const Contents>(Contents {
+        .body         = std::move(*body),
+        .hash         = hash,
+        .etag         = std::format("\"{:016x}\"", hash),
+        .lastModified = formatHttpDate(std::chrono::clock_cast<std::chrono::system_clock>(writeTime)),
+        .writeTime    = writeTime,
+      });
+
+      return m_contents;
+    }
+
+   private:
+    std::filesystem::path         m_path;
+    bool                          m_watch;
+    Mutex                         m_mutex;
+    SharedPointer<const Contents> m_contents;
+  };
 } // namespace
 
 struct SystemProperty {
@@ -92,7 +176,240 @@ namespace glz {
   };
 } // namespace glz
 
-auto main() -> i32 {
+namespace {
+  auto BuildSystemInfo(const SystemSnapshot& snapshot) -> SystemInfo {
+    using namespace draconis::core::system;
+    using matchit::impl::Overload;
+
+    SystemInfo sysInfo;
+
+    auto addProperty = Overload {
+      [&](const String& name, const Result<String>& result) {
+        if (result)
+          sysInfo.properties.emplace_back(name, *result);
+        else if (result.error().code != NotSupported)
+          sysInfo.properties.emplace_back(name, result.error());
+      },
+      [&](const String& name, const Result<OSInfo>& result) {
+        if (result)
+          sysInfo.properties.emplace_back(name, std::format("{} {}", result->name, result->version));
+        else
+          sysInfo.properties.emplace_back(name, result.error());
+      },
+      [&](const String& name, const Result<ResourceUsage>& result) {
+        if (result)
+          sysInfo.properties.emplace_back(name, std::format("{} / {}", BytesToGiB(result->usedBytes), BytesToGiB(result->totalBytes)));
+        else
+          sysInfo.properties.emplace_back(name, result.error());
+      },
+    };
+
+    addProperty("OS", snapshot.operatingSystem);
+    addProperty("Kernel Version", snapshot.kernelVersion);
+    addProperty("Host", snapshot.host);
+    addProperty("Shell", snapshot.shell);
+    addProperty("Desktop Environment", snapshot.desktopEnv);
+    addProperty("Window Manager", snapshot.windowMgr);
+    addProperty("CPU Model", snapshot.cpuModel);
+    addProperty("GPU Model", snapshot.gpuModel);
+    addProperty("Memory", snapshot.memInfo);
+    addProperty("Disk Usage", snapshot.diskUsage);
+
+    return sysInfo;
+  }
+
+  /**
+   * @brief The index page, rendered once per (snapshot version, template) pair.
+   *
+   * @details Glaze has no separate compile step for stencils, so the rendered
+   * page itself is what gets cached: requests between two snapshot refreshes
+   * just copy the same buffer, and revalidations with a matching ETag get 304.
+   */
+  class IndexPage {
+   public:
+    struct Rendered {
+      String html;
+      String etag;
+      String lastModified;
+    };
+
+    explicit IndexPage(const bool watch)
+      : m_template(indexFile, watch) {}
+
+    auto get(const SystemSnapshot& snapshot) -> Result<SharedPointer<const Rendered>> {
+      Result<SharedPointer<const StaticFile::Contents>> htmlTemplate = m_template.get();
+
+      if (!htmlTemplate)
+        return Err(htmlTemplate.error());
+
+      const LockGuard lock(m_mutex);
+
+      const StaticFile::Contents& source = **htmlTemplate;
+
+      if (m_rendered && m_version == snapshot.version && m_templateHash == source.hash)
+        return m_rendered;
+
+      Result<String, glz::error_ctx> result = glz::stencil(source.body, BuildSystemInfo(snapshot));
+
+      if (!result)
+        ERR_FMT(ParseError, "Failed to render stencil template:\n{}", glz::format_error(result.error(), source.body));
+
+      Rendered rendered {
+        .html         = std::move(*result),
+        .etag         = std::format("\"{}-{:016x}\"", snapshot.version, source.hash),
+        .lastModified = formatHttpDate(std::chrono::system_clock::now()),
+      };
+
+      m_version      = snapshot.version;
+      m_templateHash = source.hash;
+      m_rendered     = std::make_shared<const Rendered>(std::move(rendered));
+
+      return m_rendered;
+    }
+
+   private:
+    StaticFile m_template;
+
+    Mutex                         m_mutex;
+    u64                           m_version      = 0;
+    usize                         m_templateHash = 0;
+    SharedPointer<const Rendered> m_rendered;
+  };
+
+  /**
+   * @brief The OpenMetrics exposition, rendered once per snapshot version.
+   */
+  class MetricsPage {
+   public:
+    auto get(const SystemSnapshot& snapshot) -> SharedPointer<const String> {
+      const LockGuard lock(m_mutex);
+
+      if (!m_body || m_version != snapshot.version) {
+        String body;
+        WriteOpenMetrics(snapshot, body);
+
+        m_version = snapshot.version;
+        m_body    = std::make_shared<const String>(std::move(body));
+      }
+
+      return m_body;
+    }
+
+   private:
+    Mutex                       m_mutex;
+    u64                         m_version = 0;
+    SharedPointer<const String> m_body;
+  };
+
+  /**
+   * @brief Pushes snapshot deltas to every open /live WebSocket.
+   *
+   * @details Subscribed to the snapshot service, so one background refresh
+   * produces one serialized delta per format, shared by every client. New
+   * clients get the full snapshot first.
+   */
+  class LiveHub {
+   public:
+    using Send = Fn<void(StringView)>;
+
+    explicit LiveHub(SnapshotService& snapshots)
+      : m_snapshots(snapshots) {
+      m_subscription = m_snapshots.subscribe([this](const SystemSnapshot& previous, const SharedPointer<const SystemSnapshot>& next) {
+        broadcast(Diff(previous, *next));
+      });
+    }
+
+    ~LiveHub() {
+      m_snapshots.unsubscribe(m_subscription);
+    }
+
+    LiveHub(const LiveHub&)                    = delete;
+    LiveHub(LiveHub&&)                         = delete;
+    auto operator=(const LiveHub&) -> LiveHub& = delete;
+    auto operator=(LiveHub&&) -> LiveHub&      = delete;
+
+    auto add(const void* client, const bool binary, Send send) -> Unit {
+      // Held across the snapshot, the send and the insert so no broadcast can
+      // land in between; a delta-only client would never catch up on it.
+      const LockGuard lock(m_mutex);
+
+      if (String message; encode(Diff(*m_snapshots.current()), binary, message))
+        send(message);
+
+      m_clients.insert_or_assign(client, Client { .binary = binary, .send = std::move(send) });
+    }
+
+    auto remove(const void* client) -> Unit {
+      const LockGuard lock(m_mutex);
+      m_clients.erase(client);
+    }
+
+   private:
+    struct Client {
+      bool binary;
+      Send send;
+    };
+
+    SnapshotService& m_snapshots;
+    u64              m_subscription;
+
+    Mutex                    m_mutex;
+    Map<const void*, Client> m_clients;
+
+    static auto encode(const SnapshotDelta& delta, const bool binary, String& out) -> bool {
+      if (binary) {
+        Result<> written = WriteSnapshotDelta(delta, out);
+
+        if (!written)
+          error_log("Failed to serialize live update: {}", written.error().message);
+
+        return written.has_value();
+      }
+
+      if (const glz::error_ctx errc = glz::write_json(delta, out); errc) {
+        error_log("Failed to serialize live update: {}", glz::format_error(errc, out));
+        return false;
+      }
+
+      return true;
+    }
+
+    auto broadcast(const SnapshotDelta& delta) -> Unit {
+      Option<String> json, beve;
+
+      const LockGuard lock(m_mutex);
+
+      for (const Client& client : m_clients | std::views::values) {
+        Option<String>& message = client.binary ? beve : json;
+
+        if (!message) {
+          // A failed encode only skips this client; the others may use the other format.
+          if (String encoded; encode(delta, client.binary, encoded))
+            message = std::move(encoded);
+          else
+            continue;
+        }
+
+        client.send(*message);
+      }
+    }
+  };
+} // namespace
+
+auto main(const i32 argc, char* argv[]) -> i32 {
+  // Requests render the latest snapshot rather than running the readouts themselves.
+  draconis::utils::cache::CacheManager cacheManager;
+  SnapshotService                      snapshots(cacheManager);
+  snapshots.start();
+
+  // --watch re-reads the template and stylesheet when they change on disk, for editing them live.
+  const bool watch = argc > 1 && StringView(argv[1]) == "--watch";
+
+  StaticFile  stylesheet(stylingFile, watch);
+  IndexPage   indexPage(watch);
+  LiveHub     liveHub(snapshots);
+  MetricsPage metricsPage;
+
   glz::http_server server;
 
   server.on_error([](const std::error_code errc, const std::source_location& loc) {
@@ -100,88 +417,83 @@ auto main() -> i32 {
       error_log("Server error at {}:{} -> {}", loc.file_name(), loc.line(), errc.message());
   });
 
-  server.get("/style.css", [](const glz::request& req, glz::response& res) {
+  server.get("/style.css", [&stylesheet](const glz::request& req, glz::response& res) {
     info_log("Handling request for style.css from {}", req.remote_ip);
 
-    Result<String> result = readFile(stylingFile);
+    Result<SharedPointer<const StaticFile::Contents>> result = stylesheet.get();
 
-    if (result)
-      res.header("Content-Type", "text/css; charset=utf-8")
-        .header("Cache-Control", "no-cache, no-store, must-revalidate")
-        .header("Pragma", "no-cache")
-        .header("Expires", "0")
-        .body(*result);
-    else {
+    if (!result) {
       error_log("Failed to serve style.css: {}", result.error().message);
       res.status(500).body("Internal Server Error: Could not load stylesheet.");
+      return;
     }
-  });
 
-  server.get("/", [](const glz::request& req, glz::response& res) {
-    info_log("Handling request from {}", req.remote_ip);
+    const StaticFile::Contents& css = **result;
 
-    SystemInfo sysInfo;
+    res.header("Cache-Control", "no-cache")
+      .header("ETag", css.etag)
+      .header("Last-Modified", css.lastModified);
 
-    draconis::utils::cache::CacheManager cacheManager;
-
-    {
-      using namespace draconis::core::system;
-      using matchit::impl::Overload;
-      using enum draconis::utils::error::DracErrorCode;
-
-      auto addProperty = Overload {
-        [&](const String& name, const Result<String>& result) {
-          if (result)
-            sysInfo.properties.emplace_back(name, *result);
-          else if (result.error().code != NotSupported)
-            sysInfo.properties.emplace_back(name, result.error());
-        },
-        [&](const String& name, const Result<OSInfo>& result) {
-          if (result)
-            sysInfo.properties.emplace_back(name, std::format("{} {}", result->name, result->version));
-          else
-            sysInfo.properties.emplace_back(name, result.error());
-        },
-        [&](const String& name, const Result<ResourceUsage>& result) {
-          if (result)
-            sysInfo.properties.emplace_back(name, std::format("{} / {}", BytesToGiB(result->usedBytes), BytesToGiB(result->totalBytes)));
-          else
-            sysInfo.properties.emplace_back(name, result.error());
-        },
-      };
+    if (matchesETag(req, css.etag))
+      res.status(304);
+    else
+      res.header("Content-Type", "text/css; charset=utf-8").body(css.body);
+  });
 
-      addProperty("OS", GetOperatingSystem(cacheManager));
-      addProperty("Kernel Version", GetKernelVersion(cacheManager));
-      addProperty("Host", GetHost(cacheManager));
-      addProperty("Shell", GetShell(cacheManager));
-      addProperty("Desktop Environment", GetDesktopEnvironment(cacheManager));
-      addProperty("Window Manager", GetWindowManager(cacheManager));
-      addProperty("CPU Model", GetCPUModel(cacheManager));
-      addProperty("GPU Model", GetGPUModel(cacheManager));
-      addProperty("Memory", GetMemInfo(cacheManager));
-      addProperty("Disk Usage", GetDiskUsage(cacheManager));
-    }
+  server.get("/", [&snapshots, &indexPage](const glz::request& req, glz::response& res) {
+    info_log("Handling request from {}", req.remote_ip);
 
-    Result<String> htmlTemplate = readFile(indexFile);
+    Result<SharedPointer<const IndexPage::Rendered>> page = indexPage.get(*snapshots.current());
 
-    if (!htmlTemplate) {
-      error_log("Failed to read HTML template: {}", htmlTemplate.error().message);
-      res.status(500).body("Internal Server Error: Template file not found.");
+    if (!page) {
+      error_log("Failed to render index page: {}", page.error().message);
+      res.status(500).body("Internal Server Error: Template rendering failed.");
       return;
     }
 
-    if (Result<String, glz::error_ctx> result = glz::stencil(*htmlTemplate, sysInfo)) {
-      res.header("Content-Type", "text/html; charset=utf-8")
-        .header("Cache-Control", "no-cache, no-store, must-revalidate")
-        .header("Pragma", "no-cache")
-        .header("Expires", "0")
-        .body(*result);
-    } else {
-      error_log("Failed to render stencil template:\n{}", glz::format_error(result.error(), *htmlTemplate));
-      res.status(500).body("Internal Server Error: Template rendering failed.");
-    }
+    // The ETag changes with the snapshot version, so browsers revalidate on every load
+    // and only download the page again once the data behind it has changed.
+    res.header("Cache-Control", "no-cache")
+      .header("ETag", (*page)->etag)
+      .header("Last-Modified", (*page)->lastModified);
+
+    if (matchesETag(req, (*page)->etag))
+      res.status(304);
+    else
+      res.header("Content-Type", "text/html; charset=utf-8").body((*page)->html);
+  });
+
+  // Prometheus scrape target; each scrape copies the exposition of the current snapshot.
+  server.get("/metrics", [&snapshots, &metricsPage](const glz::request&, glz::response& res) {
+    res.header("Content-Type", draconis::core::system::OPENMETRICS_CONTENT_TYPE).body(*metricsPage.get(*snapshots.current()));
   });
 
+  // /live streams deltas as JSON text frames, /live.beve as binary BEVE frames (see ReadSnapshotDelta).
+  for (const bool binary : { false, true }) {
+    auto live = std::make_shared<glz::websocket_server>();
+
+    live->on_open([&liveHub, binary](auto conn, const glz::request& req) {
+      info_log("Live client connected from {}", req.remote_ip);
+
+      liveHub.add(conn.get(), binary, [weak = std::weak_ptr(conn), binary](const StringView message) {
+        auto client = weak.lock();
+
+        if (!client)
+          return;
+
+        if (binary)
+          client->send_binary(message);
+        else
+          client->send_text(message);
+      });
+    });
+
+    live->on_close([&liveHub](auto conn, auto&&...) { liveHub.remove(conn.get()); });
+    live->on_error([&liveHub](auto conn, auto&&...) { liveHub.remove(conn.get()); });
+
+    server.websocket(binary ? "/live.beve" : "/live", live);
+  }
+
   server.bind(port);
   server.start();
 
@@ -205,6 +517,8 @@ auto main() -> i32 {
     signalContext.run();
   }
 
+  snapshots.stop();
+
   info_log("Server stopped. Exiting.");
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,232 @@
+/**
+ * @file FleetStore.hpp
+ * @brief Latest state of every host reporting to the fleet collector
+ */
+
+#pragma once
+
+#include <chrono> // std::chrono::steady_clock
+#include <limits> // std::numeric_limits
+
+#include <Drac++/Core/Snapshot.hpp>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+namespace fleet {
+  using namespace draconis::utils::types;
+
+  /**
+   * @brief Snapshots of many hosts, with the numbers fleet-wide queries scan kept in columns.
+   *
+   * @details Each host gets a row index on first connect, and every column holds
+   * one entry per row. Summaries walk only the small numeric columns, so a query
+   * over thousands of hosts touches a few contiguous arrays instead of thousands of
+   * full snapshots. OS names are interned, so their column is numeric too. The
+   * full snapshot is kept alongside for per-host detail.
+   *
+   * Every connect() bumps the row's generation. A connection only updates or
+   * disconnects the row while it still holds the latest generation, so a stale
+   * session for the same host (or a second agent using the same host ID) can't
+   * clobber or disconnect the live one.
+   */
+  class FleetStore {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    struct HostRow {
+      String            hostId;
+      bool              connected;
+      Clock::time_point lastSeen;
+      Option<u64>       memUsedBytes;
+      Option<u64>       memTotalBytes;
+      Option<i64>       uptimeSeconds;
+    };
+
+    /**
+     * @brief One connection's claim on a row, as returned by connect()
+     */
+    struct Session {
+      usize row;
+      u64   generation;
+    };
+
+    struct Summary {
+      u64              hosts          = 0;
+      u64              connected      = 0;
+      u64              memUsedBytes   = 0;
+      u64              memTotalBytes  = 0;
+      u64              diskUsedBytes  = 0;
+      u64              diskTotalBytes = 0;
+      Map<String, u64> operatingSystems; ///< Hosts per OS name
+    };
+
+    /**
+     * @brief Register a (re)connecting host and take over its row
+     * @details The host's previous state is discarded; agents start every
+     * connection with a full snapshot. Any earlier session on the row is
+     * superseded.
+     */
+    auto connect(const String& hostId) -> Session {
+      const LockGuard lock(m_mutex);
+
+      auto [iter, inserted] = m_rows.try_emplace(hostId, m_hostIds.size());
+
+      if (inserted) {
+        m_hostIds.push_back(hostId);
+        m_connected.push_back(false);
+        m_lastSeen.emplace_back();
+        m_memUsed.push_back(0);
+        m_memTotal.push_back(0);
+        m_diskUsed.push_back(0);
+        m_diskTotal.push_back(0);
+        m_uptime.push_back(-1);
+        m_os.push_back(NO_OS);
+        m_generations.push_back(0);
+        m_snapshots.emplace_back();
+      }
+
+      const usize row = iter->second;
+
+      m_connected[row] = true;
+      m_lastSeen[row]  = Clock::now();
+      m_snapshots[row] = {};
+      updateColumns(row);
+
+      return { .row = row, .generation = ++m_generations[row] };
+    }
+
+    /**
+     * @brief Mark the session's host as gone, unless a newer session has taken over the row
+     */
+    auto disconnect(const Session& session) -> Unit {
+      const LockGuard lock(m_mutex);
+
+      if (m_generations[session.row] == session.generation)
+        m_connected[session.row] = false;
+    }
+
+    /**
+     * @brief Apply a delta received on `session`
+     * @return An error if the delta doesn't apply, or if a newer session owns the row
+     */
+    auto apply(const Session& session, const draconis::core::system::SnapshotDelta& delta) -> Result<> {
+      using enum draconis::utils::error::DracErrorCode;
+
+      const LockGuard lock(m_mutex);
+
+      const usize row = session.row;
+
+      if (m_generations[row] != session.generation)
+        ERR_FMT(InvalidArgument, "Host '{}' has reconnected on a newer session", m_hostIds[row]);
+
+      if (Result<> applied = draconis::core::system::Apply(m_snapshots[row], delta); !applied)
+        return applied;
+
+      m_lastSeen[row] = Clock::now();
+      updateColumns(row);
+
+      return {};
+    }
+
+    [[nodiscard]] auto summary() const -> Summary {
+      const LockGuard lock(m_mutex);
+
+      Summary summary { .hosts = m_hostIds.size() };
+
+      Vec<u64> hostsPerOs(m_osNames.size(), 0);
+
+      for (usize row = 0; row < m_hostIds.size(); ++row) {
+        summary.connected += m_connected[row] ? 1 : 0;
+        summary.memUsedBytes += m_memUsed[row];
+        summary.memTotalBytes += m_memTotal[row];
+        summary.diskUsedBytes += m_diskUsed[row];
+        summary.diskTotalBytes += m_diskTotal[row];
+
+        if (m_os[row] != NO_OS)
+          hostsPerOs[m_os[row]]++;
+      }
+
+      for (usize osId = 0; osId < m_osNames.size(); ++osId)
+        if (hostsPerOs[osId] > 0)
+          summary.operatingSystems.emplace(m_osNames[osId], hostsPerOs[osId]);
+
+      return summary;
+    }
+
+    [[nodiscard]] auto hosts() const -> Vec<HostRow> {
+      const LockGuard lock(m_mutex);
+
+      Vec<HostRow> rows;
+      rows.reserve(m_hostIds.size());
+
+      for (usize row = 0; row < m_hostIds.size(); ++row)
+        rows.push_back({
+          .hostId        = m_hostIds[row],
+          .connected     = m_connected[row] != 0,
+          .lastSeen      = m_lastSeen[row],
+          .memUsedBytes  = m_memTotal[row] ? Option<u64>(m_memUsed[row]) : None,
+          .memTotalBytes = m_memTotal[row] ? Option<u64>(m_memTotal[row]) : None,
+          .uptimeSeconds = m_uptime[row] >= 0 ? Option<i64>(m_uptime[row]) : None,
+        });
+
+      return rows;
+    }
+
+    [[nodiscard]] auto host(const String& hostId) const -> Option<draconis::core::system::SystemSnapshot> {
+      const LockGuard lock(m_mutex);
+
+      const auto iter = m_rows.find(hostId);
+
+      if (iter == m_rows.end())
+        return None;
+
+      return m_snapshots[iter->second];
+    }
+
+   private:
+    static constexpr u32 NO_OS = std::numeric_limits<u32>::max();
+
+    mutable Mutex m_mutex;
+
+    UnorderedMap<String, usize> m_rows;
+
+    Vec<String>            m_hostIds;
+    Vec<u8>                m_connected;
+    Vec<Clock::time_point> m_lastSeen;
+    Vec<u64>               m_memUsed;
+    Vec<u64>               m_memTotal;
+    Vec<u64>               m_diskUsed;
+    Vec<u64>               m_diskTotal;
+    Vec<i64>               m_uptime; ///< -1 when unknown
+    Vec<u32>               m_os;     ///< Index into m_osNames, or NO_OS when unknown
+    Vec<u64>               m_generations;
+
+    // Interned OS names; a fleet runs a handful of them across any number of hosts.
+    Vec<String>               m_osNames;
+    UnorderedMap<String, u32> m_osIds;
+
+    Vec<draconis::core::system::SystemSnapshot> m_snapshots;
+
+    // Failed readouts count as zero in the columns.
+    auto updateColumns(const usize row) -> Unit {
+      const draconis::core::system::SystemSnapshot& snapshot = m_snapshots[row];
+
+      m_memUsed[row]   = snapshot.memInfo ? snapshot.memInfo->usedBytes : 0;
+      m_memTotal[row]  = snapshot.memInfo ? snapshot.memInfo->totalBytes : 0;
+      m_diskUsed[row]  = snapshot.diskUsage ? snapshot.diskUsage->usedBytes : 0;
+      m_diskTotal[row] = snapshot.diskUsage ? snapshot.diskUsage->totalBytes : 0;
+      m_uptime[row]    = snapshot.uptime ? snapshot.uptime->count() : -1;
+      m_os[row]        = snapshot.operatingSystem && !snapshot.operatingSystem->name.empty() ? internOs(snapshot.operatingSystem->name) : NO_OS;
+    }
+
+    auto internOs(const String& name) -> u32 {
+      const auto [iter, inserted] = m_osIds.try_emplace(name, static_cast<u32>(m_osNames.size()));
+
+      if (inserted)
+        m_osNames.push_back(name);
+
+      return iter->second;
+    }
+  };
+} // namespace fleet
@@ -5,10 +5,30 @@
  * This example demonstrates how to create an MCP server that exposes
  * Draconis++ library functionality via standard input/output, making it
  * compatible with stdio-based MCP clients.
+ *
+ * Started with `--fleet-listen <host:port | unix:/path>`, it also collects
+ * snapshots pushed by fleet agents (examples/fleet) and exposes fleet-wide
+ * queries as extra tools.
  */
 
+#define ASIO_HAS_CO_AWAIT      1
+#define ASIO_HAS_STD_COROUTINE 1
+
+#include <algorithm>
+#include <asio/cancel_after.hpp>
+#include <asio/co_spawn.hpp>
+#include <asio/detached.hpp>
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/local/stream_protocol.hpp>
+#include <asio/read.hpp>
+#include <asio/steady_timer.hpp>
+#include <asio/use_awaitable.hpp>
 #include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
+#include <filesystem>
 #include <glaze/core/meta.hpp>
 #include <glaze/core/read.hpp>
 #include <glaze/core/write.hpp>
@@ -19,8 +39,11 @@
 #include <iostream>
 #include <magic_enum/magic_enum.hpp>
 #include <matchit.hpp>
+#include <thread>
 #include <utility>
 
+#include <Drac++/Core/Invalidation.hpp>
+#include <Drac++/Core/Snapshot.hpp>
 #include <Drac++/Core/System.hpp>
 #include <Drac++/Services/Packages.hpp>
 
@@ -29,6 +52,9 @@
 #include <Drac++/Utils/Error.hpp>
 #include <Drac++/Utils/Types.hpp>
 
+#include "../fleet/Protocol.hpp"
+#include "FleetStore.hpp"
+
 using namespace draconis::utils::types;
 using namespace draconis::core::system;
 using namespace draconis::services::packages;
@@ -114,6 +140,15 @@ struct ComprehensiveInfo {
   Option<Map<String, u64>> packages;
 };
 
+struct FleetHostEntry {
+  String      host;
+  bool        connected;
+  i64         lastSeenSecondsAgo;
+  Option<u64> memUsedBytes;
+  Option<u64> memTotalBytes;
+  Option<i64> uptimeSeconds;
+};
+
 namespace glz {
   template <>
   struct meta<ToolResponse> {
@@ -240,13 +275,34 @@ namespace glz {
   };
 
   template <>
-  struct meta<ResourceUsage> {
-    using T = ResourceUsage;
+  struct meta<FleetHostEntry> {
+    using T = FleetHostEntry;
+
+    // clang-format off
+    static constexpr detail::Object value = object(
+      "host",               &T::host,
+      "connected",          &T::connected,
+      "lastSeenSecondsAgo", &T::lastSeenSecondsAgo,
+      "memUsedBytes",       &T::memUsedBytes,
+      "memTotalBytes",      &T::memTotalBytes,
+      "uptimeSeconds",      &T::uptimeSeconds
+    );
+    // clang-format on
+  };
+
+  template <>
+  struct meta<fleet::FleetStore::Summary> {
+    using T = fleet::FleetStore::Summary;
 
     // clang-format off
     static constexpr detail::Object value = object(
-      "usedBytes",  &T::usedBytes,
-      "totalBytes", &T::totalBytes
+      "hosts",            &T::hosts,
+      "connected",        &T::connected,
+      "memUsedBytes",     &T::memUsedBytes,
+      "memTotalBytes",    &T::memTotalBytes,
+      "diskUsedBytes",    &T::diskUsedBytes,
+      "diskTotalBytes",   &T::diskTotalBytes,
+      "operatingSystems", &T::operatingSystems
     );
     // clang-format on
   };
@@ -256,11 +312,48 @@ namespace {
   using ToolHandler        = Fn<ToolResponse(const Map<String, String>&)>;
   using NoParamToolHandler = Fn<ToolResponse()>;
 
+  // Shared by every worker thread; CacheManager locks per shard and coalesces concurrent misses on the same key.
   auto GetCacheManager() -> CacheManager& {
     static CacheManager SCacheManager;
     return SCacheManager;
   }
 
+  // Handlers answer from the latest snapshot instead of running the readouts
+  // themselves; the service refreshes volatile fields in the background.
+  auto GetSnapshots() -> SnapshotService& {
+    static SnapshotService SSnapshots(GetCacheManager());
+
+    // Fields with a change source (package databases, interfaces, batteries)
+    // are refreshed when it fires instead of waiting for their next interval.
+    static CacheInvalidator SInvalidator(GetCacheManager());
+
+    static const bool Started = [] {
+      SSnapshots.start();
+
+      SInvalidator.subscribe([](const InvalidationRule& rule) {
+        if (!rule.fields.empty())
+          SSnapshots.refresh(rule.fields);
+      });
+
+      if (Result<> watching = SInvalidator.start(); !watching && watching.error().code != NotSupported)
+        std::cerr << "Falling back to interval refreshes: " << watching.error().message << '\n';
+
+      return true;
+    }();
+    static_cast<void>(Started);
+
+    return SSnapshots;
+  }
+
+  auto formatUptime(const std::chrono::seconds uptime) -> UptimeInfoResponse {
+    const u32 seconds          = uptime.count();
+    const u32 hours            = seconds / 3600;
+    const u32 minutes          = (seconds % 3600) / 60;
+    const u32 remainingSeconds = seconds % 60;
+
+    return { .seconds = seconds, .formatted = std::format("{}h {}m {}s", hours, minutes, remainingSeconds) };
+  }
+
   template <typename T>
   auto resultToJson(const Result<T>& result) -> GlzJson {
     if (result)
@@ -301,230 +394,365 @@ namespace {
   }
 
   auto SystemInfoHandler() -> ToolResponse {
-    CacheManager& cacheManager = GetCacheManager();
+    const SharedPointer<const SystemSnapshot> snapshot = GetSnapshots().current();
 
     SystemInfoResponse info;
 
-    if (Result<OSInfo> res = GetOperatingSystem(cacheManager); res)
-      info.operatingSystem = *res;
-    if (Result<String> res = GetKernelVersion(cacheManager); res)
-      info.kernelVersion = *res;
-    if (Result<String> res = GetHost(cacheManager); res)
-      info.host = *res;
-    if (Result<String> res = GetShell(cacheManager); res)
-      info.shell = *res;
-    if (Result<String> res = GetDesktopEnvironment(cacheManager); res)
-      info.desktopEnv = *res;
-    if (Result<String> res = GetWindowManager(cacheManager); res)
-      info.windowMgr = *res;
-    if (Result<String> res = GetCPUModel(cacheManager); res)
-      info.cpuModel = *res;
-    if (Result<CPUCores> res = GetCPUCores(cacheManager); res)
-      info.cpuCores = *res;
+    if (snapshot->operatingSystem)
+      info.operatingSystem = *snapshot->operatingSystem;
+    if (snapshot->kernelVersion)
+      info.kernelVersion = *snapshot->kernelVersion;
+    if (snapshot->host)
+      info.host = *snapshot->host;
+    if (snapshot->shell)
+      info.shell = *snapshot->shell;
+    if (snapshot->desktopEnv)
+      info.desktopEnv = *snapshot->desktopEnv;
+    if (snapshot->windowMgr)
+      info.windowMgr = *snapshot->windowMgr;
+    if (snapshot->cpuModel)
+      info.cpuModel = *snapshot->cpuModel;
+    if (snapshot->cpuCores)
+      info.cpuCores = *snapshot->cpuCores;
 
     return { makeSuccessResult(info) };
   }
 
   auto HardwareInfoHandler() -> ToolResponse {
-    CacheManager& cacheManager = GetCacheManager();
+    const SharedPointer<const SystemSnapshot> snapshot = GetSnapshots().current();
 
     HardwareInfoResponse info;
 
-    if (Result<String> res = GetCPUModel(cacheManager); res)
-      info.cpuModel = *res;
-    if (Result<CPUCores> res = GetCPUCores(cacheManager); res)
-      info.cpuCores = *res;
-    if (Result<String> res = GetGPUModel(cacheManager); res)
-      info.gpuModel = *res;
-    if (Result<ResourceUsage> res = GetMemInfo(cacheManager); res)
-      info.memInfo = *res;
-    if (Result<ResourceUsage> res = GetDiskUsage(cacheManager); res)
-      info.diskUsage = *res;
+    if (snapshot->cpuModel)
+      info.cpuModel = *snapshot->cpuModel;
+    if (snapshot->cpuCores)
+      info.cpuCores = *snapshot->cpuCores;
+    if (snapshot->gpuModel)
+      info.gpuModel = *snapshot->gpuModel;
+    if (snapshot->memInfo)
+      info.memInfo = *snapshot->memInfo;
+    if (snapshot->diskUsage)
+      info.diskUsage = *snapshot->diskUsage;
 
     return { makeSuccessResult(info) };
   }
 
-  auto PackageCountHandler(const Map<String, String>& params) -> ToolResponse {
-    if constexpr (DRAC_ENABLE_PACKAGECOUNT) {
-      using enum Manager;
-
-      Manager enabledManagers = None;
-
-      static const UnorderedMap<String, Manager> MANAGER_MAP = {
-        {  "cargo",  Cargo },
-#if defined(__linux__) || defined(__APPLE__)
-        {    "nix",    Nix },
-#endif
-#ifdef __linux__
-        {    "apk",    Apk },
-        {   "dpkg",   Dpkg },
-        {   "moss",   Moss },
-        { "pacman", Pacman },
-        {    "rpm",    Rpm },
-        {   "xbps",   Xbps },
-#elifdef __APPLE__
-        { "homebrew", Homebrew },
-        { "macports", Macports },
-#elifdef _WIN32
-        { "winget", Winget },
-        { "chocolatey", Chocolatey },
-        { "scoop", Scoop },
-#elif defined(__FreeBSD__) || defined(__DragonFly__)
-        { "pkgng", PkgNg },
-#elifdef __NetBSD__
-        { "pkgsrc", PkgSrc },
-#elifdef __HAIKU__
-        { "haikupkg", HaikuPkg },
-#endif
-      };
-
-      auto mgrIter = params.find("managers");
+  auto PackageCountHandler([[maybe_unused]] const Map<String, String>& params) -> ToolResponse {
+#if DRAC_ENABLE_PACKAGECOUNT
+    const SharedPointer<const SystemSnapshot> snapshot = GetSnapshots().current();
 
-      if (mgrIter != params.end() && !mgrIter->second.empty()) {
-        String      managersStr = mgrIter->second;
-        Vec<String> managersList;
+    if (!snapshot->packageCounts)
+      return { makeErrorResult("Failed to get package count: " + snapshot->packageCounts.error().message), true };
 
-        managersList.reserve(std::count(managersStr.begin(), managersStr.end(), ',') + 1);
-        usize pos = 0;
+    auto mgrIter = params.find("managers");
 
-        while ((pos = managersStr.find(',')) != String::npos) {
-          managersList.emplace_back(managersStr.substr(0, pos));
-          managersStr.erase(0, pos + 1);
-        }
+    if (mgrIter == params.end() || mgrIter->second.empty())
+      return { makeSuccessResult(*snapshot->packageCounts) };
 
-        managersList.emplace_back(managersStr);
+    // The snapshot counts every manager; keep only the requested ones, which
+    // are keyed by the same lowercase names the tool accepts.
+    Map<String, u64> counts;
+    StringView       managers = mgrIter->second;
 
-        for (const String& mgr : managersList) {
-          auto iter = MANAGER_MAP.find(mgr);
+    while (!managers.empty()) {
+      const usize      comma = managers.find(',');
+      const StringView name  = managers.substr(0, comma);
 
-          if (iter != MANAGER_MAP.end())
-            enabledManagers |= iter->second;
-        }
-      } else {
-        for (const auto& [_, value] : MANAGER_MAP)
-          enabledManagers |= value;
-      }
+      if (auto iter = snapshot->packageCounts->find(name); iter != snapshot->packageCounts->end())
+        counts.emplace(iter->first, iter->second);
 
-      if (enabledManagers == None)
-        return { makeErrorResult("No valid package managers specified or available"), true };
+      managers = comma == StringView::npos ? StringView {} : managers.substr(comma + 1);
+    }
 
-      Result<Map<String, u64>> countResult = GetIndividualCounts(GetCacheManager(), enabledManagers);
-      if (!countResult)
-        return { makeErrorResult("Failed to get package count: " + countResult.error().message), true };
+    if (counts.empty())
+      return { makeErrorResult("No valid package managers specified or available"), true };
 
-      return { makeSuccessResult(*countResult) };
-    } else {
-      return { makeErrorResult("Package counting not enabled in this build"), true };
-    }
+    return { makeSuccessResult(counts) };
+#else
+    return { makeErrorResult("Package counting not enabled in this build"), true };
+#endif
   }
 
   auto NetworkInfoHandler() -> ToolResponse {
-    CacheManager& cacheManager = GetCacheManager();
+    const SharedPointer<const SystemSnapshot> snapshot = GetSnapshots().current();
 
     NetworkInfoResponse info;
-    if (Result<Vec<NetworkInterface>> res = GetNetworkInterfaces(cacheManager); res)
-      info.interfaces = *res;
-    if (Result<NetworkInterface> res = GetPrimaryNetworkInterface(cacheManager); res)
-      info.primaryInterface = *res;
+    if (snapshot->networkInterfaces)
+      info.interfaces = *snapshot->networkInterfaces;
+    if (snapshot->primaryNetworkInterface)
+      info.primaryInterface = *snapshot->primaryNetworkInterface;
 
     return { makeSuccessResult(info) };
   }
 
   auto DisplayInfoHandler() -> ToolResponse {
-    CacheManager& cacheManager = GetCacheManager();
+    const SharedPointer<const SystemSnapshot> snapshot = GetSnapshots().current();
 
     DisplayInfoResponse info;
-    if (Result<Vec<DisplayInfo>> res = GetOutputs(cacheManager); res)
-      info.displays = *res;
-    if (Result<DisplayInfo> res = GetPrimaryOutput(cacheManager); res)
-      info.primaryDisplay = *res;
+    if (snapshot->outputs)
+      info.displays = *snapshot->outputs;
+    if (snapshot->primaryOutput)
+      info.primaryDisplay = *snapshot->primaryOutput;
 
-    if (info.displays->empty())
+    if (!info.displays || info.displays->empty())
       return { makeErrorResult("No displays found"), true };
 
     return { makeSuccessResult(info) };
   }
 
   auto UptimeHandler() -> ToolResponse {
-    Result<std::chrono::seconds> uptimeResult = GetUptime();
-    if (!uptimeResult)
-      return { makeErrorResult("Failed to get uptime: " + uptimeResult.error().message), true };
+    const SharedPointer<const SystemSnapshot> snapshot = GetSnapshots().current();
 
-    u32 seconds          = uptimeResult->count();
-    u32 hours            = seconds / 3600;
-    u32 minutes          = (seconds % 3600) / 60;
-    u32 remainingSeconds = seconds % 60;
+    if (!snapshot->uptime)
+      return { makeErrorResult("Failed to get uptime: " + snapshot->uptime.error().message), true };
 
-    UptimeInfoResponse info { .seconds = seconds, .formatted = std::format("{}h {}m {}s", hours, minutes, remainingSeconds) };
-    return { makeSuccessResult(info) };
+    return { makeSuccessResult(formatUptime(*snapshot->uptime)) };
   }
 
-  auto ComprehensiveInfoHandler([[maybe_unused]] const Map<String, String>& params) -> ToolResponse {
-    CacheManager& cacheManager = GetCacheManager();
-
+  auto BuildComprehensiveInfo(const SystemSnapshot& snapshot) -> ComprehensiveInfo {
     ComprehensiveInfo info;
 
     // Helper lambda to safely assign optional results
-    auto tryAssign = [](auto& dest, auto result) {
+    auto tryAssign = [](auto& dest, const auto& result) {
       if (result)
         dest = *result;
     };
 
-    tryAssign(info.system.operatingSystem, GetOperatingSystem(cacheManager));
-    tryAssign(info.system.kernelVersion, GetKernelVersion(cacheManager));
-    tryAssign(info.system.host, GetHost(cacheManager));
-    tryAssign(info.system.shell, GetShell(cacheManager));
-    tryAssign(info.system.desktopEnv, GetDesktopEnvironment(cacheManager));
-    tryAssign(info.system.windowMgr, GetWindowManager(cacheManager));
-
-    tryAssign(info.hardware.cpuModel, GetCPUModel(cacheManager));
-    tryAssign(info.hardware.cpuCores, GetCPUCores(cacheManager));
-    tryAssign(info.hardware.gpuModel, GetGPUModel(cacheManager));
-    tryAssign(info.hardware.memInfo, GetMemInfo(cacheManager));
-    tryAssign(info.hardware.diskUsage, GetDiskUsage(cacheManager));
-
-    tryAssign(info.network.interfaces, GetNetworkInterfaces(cacheManager));
-    tryAssign(info.network.primaryInterface, GetPrimaryNetworkInterface(cacheManager));
-
-    tryAssign(info.display.displays, GetOutputs(cacheManager));
-    tryAssign(info.display.primaryDisplay, GetPrimaryOutput(cacheManager));
-
-    if (Result<std::chrono::seconds> res = GetUptime(); res) {
-      u32 seconds          = res->count();
-      u32 hours            = seconds / 3600;
-      u32 minutes          = (seconds % 3600) / 60;
-      u32 remainingSeconds = seconds % 60;
-      info.uptime          = { .seconds = seconds, .formatted = std::format("{}h {}m {}s", hours, minutes, remainingSeconds) };
-    }
+    tryAssign(info.system.operatingSystem, snapshot.operatingSystem);
+    tryAssign(info.system.kernelVersion, snapshot.kernelVersion);
+    tryAssign(info.system.host, snapshot.host);
+    tryAssign(info.system.shell, snapshot.shell);
+    tryAssign(info.system.desktopEnv, snapshot.desktopEnv);
+    tryAssign(info.system.windowMgr, snapshot.windowMgr);
 
-    if constexpr (DRAC_ENABLE_PACKAGECOUNT) {
-      using enum Manager;
+    tryAssign(info.hardware.cpuModel, snapshot.cpuModel);
+    tryAssign(info.hardware.cpuCores, snapshot.cpuCores);
+    tryAssign(info.hardware.gpuModel, snapshot.gpuModel);
+    tryAssign(info.hardware.memInfo, snapshot.memInfo);
+    tryAssign(info.hardware.diskUsage, snapshot.diskUsage);
 
-      Manager enabledManagers = Cargo;
-#if defined(__linux__) || defined(__APPLE__)
-      enabledManagers |= Nix;
-#endif
-#ifdef __linux__
-      enabledManagers |= Apk | Dpkg | Moss | Pacman | Rpm | Xbps;
-#elifdef __APPLE__
-      enabledManagers |= Homebrew | Macports;
-#elifdef _WIN32
-      enabledManagers |= Winget | Chocolatey | Scoop;
-#elif defined(__FreeBSD__) || defined(__DragonFly__)
-      enabledManagers |= PkgNg;
-#elifdef __NetBSD__
-      enabledManagers |= PkgSrc;
-#elifdef __HAIKU__
-      enabledManagers |= HaikuPkg;
+    tryAssign(info.network.interfaces, snapshot.networkInterfaces);
+    tryAssign(info.network.primaryInterface, snapshot.primaryNetworkInterface);
+
+    tryAssign(info.display.displays, snapshot.outputs);
+    tryAssign(info.display.primaryDisplay, snapshot.primaryOutput);
+
+    if (snapshot.uptime)
+      info.uptime = formatUptime(*snapshot.uptime);
+
+#if DRAC_ENABLE_PACKAGECOUNT
+    tryAssign(info.packages, snapshot.packageCounts);
 #endif
 
-      if (Result<Map<String, u64>> packages = GetIndividualCounts(cacheManager, enabledManagers); packages)
-        info.packages = *packages;
+    return info;
+  }
+
+  auto ComprehensiveInfoHandler([[maybe_unused]] const Map<String, String>& params) -> ToolResponse {
+    return { makeSuccessResult(BuildComprehensiveInfo(*GetSnapshots().current())) };
+  }
+
+  auto GetFleetStore() -> fleet::FleetStore& {
+    static fleet::FleetStore SFleetStore;
+    return SFleetStore;
+  }
+
+  auto FleetSummaryHandler() -> ToolResponse {
+    return { makeSuccessResult(GetFleetStore().summary()) };
+  }
+
+  auto FleetHostsHandler() -> ToolResponse {
+    const fleet::FleetStore::Clock::time_point now = fleet::FleetStore::Clock::now();
+
+    Vec<FleetHostEntry> entries;
+
+    for (fleet::FleetStore::HostRow& row : GetFleetStore().hosts())
+      entries.push_back({
+        .host               = std::move(row.hostId),
+        .connected          = row.connected,
+        .lastSeenSecondsAgo = std::chrono::duration_cast<std::chrono::seconds>(now - row.lastSeen).count(),
+        .memUsedBytes       = row.memUsedBytes,
+        .memTotalBytes      = row.memTotalBytes,
+        .uptimeSeconds      = row.uptimeSeconds,
+      });
+
+    return { makeSuccessResult(entries) };
+  }
+
+  auto FleetHostHandler(const Map<String, String>& params) -> ToolResponse {
+    const auto hostIter = params.find("host");
+
+    if (hostIter == params.end() || hostIter->second.empty())
+      return { makeErrorResult("Missing 'host' parameter"), true };
+
+    Option<SystemSnapshot> snapshot = GetFleetStore().host(hostIter->second);
+
+    if (!snapshot)
+      return { makeErrorResult(std::format("Unknown host '{}'", hostIter->second)), true };
+
+    return { makeSuccessResult(BuildComprehensiveInfo(*snapshot)) };
+  }
+
+  // Reads one agent's frames until it disconnects, goes quiet for longer than
+  // the keepalive allows, or sends something we can't use.
+  template <typename Socket>
+  auto ServeAgent(Socket socket, fleet::FleetStore& store) -> asio::awaitable<void> {
+    Array<char, fleet::FRAME_HEADER_BYTES> header {};
+    String                                 frame;
+    Option<fleet::FleetStore::Session>     session;
+
+    try {
+      while (true) {
+        // A read that times out throws operation_aborted, which ends the session below.
+        co_await asio::async_read(socket, asio::buffer(header), asio::cancel_after(fleet::IDLE_TIMEOUT, asio::use_awaitable));
+
+        Result<u32> length = fleet::ReadFrameLength(header);
+
+        if (!length) {
+          std::cerr << "Dropping agent: " << length.error().message << '\n';
+          break;
+        }
+
+        frame.resize(*length);
+        co_await asio::async_read(socket, asio::buffer(frame), asio::cancel_after(fleet::IDLE_TIMEOUT, asio::use_awaitable));
+
+        const auto       kind    = static_cast<fleet::FrameKind>(frame.front());
+        const StringView payload = StringView(frame).substr(1);
+
+        if (!session) {
+          fleet::Hello hello;
+
+          if (kind != fleet::FrameKind::Hello || glz::read_beve(hello, payload) || hello.protocolVersion != fleet::PROTOCOL_VERSION) {
+            std::cerr << "Dropping agent: expected a hello frame\n";
+            break;
+          }
+
+          session = store.connect(hello.hostId);
+          continue;
+        }
+
+        if (kind != fleet::FrameKind::Delta) {
+          std::cerr << "Dropping agent: unexpected frame kind\n";
+          break;
+        }
+
+        Result<SnapshotDelta> delta = ReadSnapshotDelta(payload);
+
+        if (!delta) {
+          std::cerr << "Dropping agent: " << delta.error().message << '\n';
+          break;
+        }
+
+        // Out of sync (e.g. we restarted mid-stream) or superseded by a newer
+        // connection; closing makes the agent reconnect with a full snapshot.
+        if (Result<> applied = store.apply(*session, *delta); !applied) {
+          std::cerr << "Dropping agent: " << applied.error().message << '\n';
+          break;
+        }
+      }
+    } catch (const std::system_error&) {
+      // Disconnected, reset or idle for too long; the agent will reconnect.
     }
 
-    return { makeSuccessResult(info) };
+    if (session)
+      store.disconnect(*session);
   }
 
+  template <typename Acceptor>
+  auto AcceptAgents(Acceptor acceptor, fleet::FleetStore& store) -> asio::awaitable<void> {
+    using namespace std::chrono_literals;
+
+    // Errors like EMFILE persist until something else changes, so back off instead of spinning.
+    constexpr std::chrono::milliseconds maxBackoff = 5s;
+
+    std::chrono::milliseconds backoff = 0ms;
+    asio::steady_timer        retry(acceptor.get_executor());
+
+    while (acceptor.is_open()) {
+      try {
+        auto socket = co_await acceptor.async_accept(asio::use_awaitable);
+        asio::co_spawn(acceptor.get_executor(), ServeAgent(std::move(socket), store), asio::detached);
+
+        backoff = 0ms;
+        continue;
+      } catch (const std::system_error& err) {
+        if (err.code() == asio::error::operation_aborted)
+          break;
+
+        backoff = std::clamp<std::chrono::milliseconds>(backoff * 2, 100ms, maxBackoff);
+
+        std::cerr << "Failed to accept agent (retrying in " << backoff.count() << "ms): " << err.what() << '\n';
+      }
+
+      retry.expires_after(backoff);
+
+      try {
+        co_await retry.async_wait(asio::use_awaitable);
+      } catch (const std::system_error&) {
+        break;
+      }
+    }
+  }
+
+  /**
+   * @brief Accepts fleet agents on one io_context thread, next to the stdio server
+   */
+  class FleetCollector {
+   public:
+    FleetCollector() = default;
+
+    FleetCollector(const FleetCollector&)                    = delete;
+    FleetCollector(FleetCollector&&)                         = delete;
+    auto operator=(const FleetCollector&) -> FleetCollector& = delete;
+    auto operator=(FleetCollector&&) -> FleetCollector&      = delete;
+
+    ~FleetCollector() {
+      m_context.stop();
+
+      if (m_thread.joinable())
+        m_thread.join();
+    }
+
+    auto start(const fleet::Endpoint& endpoint, fleet::FleetStore& store) -> Result<> {
+      try {
+        if (endpoint.local) {
+#ifdef ASIO_HAS_LOCAL_SOCKETS
+          using asio::local::stream_protocol;
+
+          // A socket file left behind by a previous run would make bind fail;
+          // anything else at that path is not ours to delete.
+          std::error_code statErrc;
+
+          if (std::filesystem::is_socket(endpoint.host, statErrc))
+            std::filesystem::remove(endpoint.host, statErrc);
+          else if (std::filesystem::exists(endpoint.host, statErrc))
+            ERR_FMT(InvalidArgument, "Cannot listen on {}: it exists and is not a socket", endpoint.host);
+
+          asio::co_spawn(m_context, AcceptAgents(stream_protocol::acceptor(m_context, stream_protocol::endpoint(endpoint.host)), store), asio::detached);
+#else
+          ERR(NotSupported, "Unix sockets are not available on this platform");
+#endif
+        } else {
+          using asio::ip::tcp;
+
+          tcp::resolver resolver(m_context);
+          tcp::endpoint address = *resolver.resolve(endpoint.host, endpoint.port, asio::ip::resolver_base::passive).begin();
+
+          asio::co_spawn(m_context, AcceptAgents(tcp::acceptor(m_context, address), store), asio::detached);
+        }
+      } catch (const std::system_error& err) {
+        ERR_FMT(NetworkError, "Failed to listen for fleet agents: {}", err.what());
+      }
+
+      m_thread = std::thread([this] { m_context.run(); });
+
+      return {};
+    }
+
+   private:
+    asio::io_context m_context;
+    std::thread      m_thread;
+  };
+
   auto CacheClearHandler() -> ToolResponse {
     return { makeSuccessResult(std::format("Removed {} files.", GetCacheManager().invalidateAll(false))) };
   }
@@ -547,7 +775,37 @@ class DracStdioServer {
     m_tools[tool.name] = { tool, [handler](const Map<String, String>&) -> ToolResponse { return handler(); } };
   }
 
+  /**
+   * @brief Serve requests from stdin until it closes
+   *
+   * @details This thread only reads and parses. Requests are handled by a pool
+   * of workers, so a slow tool call doesn't hold up the cheap ones behind it,
+   * and a single writer thread emits each response as soon as it is ready.
+   * Responses carry their request's id, so they may arrive out of order.
+   */
   auto run() -> Result<> {
+    const u32 workerCount = std::clamp(std::thread::hardware_concurrency(), 2U, 8U);
+
+    Channel<GlzObject> requests;
+    Channel<String>    responses;
+
+    std::thread writer([&responses] {
+      while (Option<String> response = responses.pop()) {
+        std::cout << *response << '\n';
+        std::cout.flush();
+      }
+    });
+
+    Vec<std::thread> workers;
+    workers.reserve(workerCount);
+
+    for (u32 i = 0; i < workerCount; ++i)
+      workers.emplace_back([this, &requests, &responses] {
+        while (Option<GlzObject> request = requests.pop())
+          if (Option<String> response = handleRequest(*request))
+            responses.push(std::move(*response));
+      });
+
     String line;
 
     while (std::getline(std::cin, line)) {
@@ -556,80 +814,132 @@ class DracStdioServer {
 
       GlzObject requestJson;
 
-      glz::error_ctx errc = glz::read_json(requestJson, line);
-
-      if (errc) {
+      if (glz::error_ctx errc = glz::read_json(requestJson, line)) {
         std::cerr << "Failed to parse input: " << glz::format_error(errc, line) << '\n';
         continue;
       }
 
-      String method = requestJson.contains("method") ? requestJson["method"].get<String>() : "";
+      requests.push(std::move(requestJson));
+    }
 
-      GlzJson params = requestJson.contains("params") ? requestJson["params"] : GlzJson {};
+    // Let in-flight requests finish and their responses drain before exiting.
+    requests.close();
 
-      String jsonrpc = requestJson.contains("jsonrpc") ? requestJson["jsonrpc"].get<String>() : "2.0";
+    for (std::thread& worker : workers)
+      worker.join();
 
-      try {
-        Result<GlzJson> result = processRequest(method, params);
-
-        if (requestJson.contains("id")) {
-          GlzJson idVal = requestJson["id"];
-
-          GlzObject response;
-          response["jsonrpc"] = jsonrpc;
-          response["id"]      = idVal;
-
-          if (result) {
-            response["result"] = *result;
-          } else {
-            response["error"] = GlzObject {
-              {    "code",                                              -32603 },
-              { "message", "Internal error: " + String(result.error().message) }
-            };
-          }
+    responses.close();
+    writer.join();
 
-          String responseStr;
-          if (glz::error_ctx writeErrc = glz::write_json(response, responseStr); writeErrc)
-            ERR_FMT(ParseError, "Failed to serialize response: {}", glz::format_error(writeErrc, responseStr));
+    return {};
+  }
 
-          std::cout << responseStr << '\n';
-          std::cout.flush();
-        }
-      } catch (const Exception& e) {
-        if (requestJson.contains("id")) {
-          GlzJson idVal = requestJson["id"];
-
-          GlzObject response;
-          response["jsonrpc"] = jsonrpc;
-          response["id"]      = idVal;
-          response["error"]   = GlzObject {
-              {    "code",                                -32603 },
-              { "message", "Internal error: " + String(e.what()) }
-          };
+ private:
+  using Tools = Map<String, Pair<Tool, ToolHandler>>;
 
-          String responseStr;
-          if (glz::error_ctx writeErrc = glz::write_json(response, responseStr); writeErrc)
-            ERR_FMT(ParseError, "Failed to serialize error response: {}", glz::format_error(writeErrc, responseStr));
+  /**
+   * @brief Unbounded multi-producer, multi-consumer queue shared by the reader, workers and writer
+   */
+  template <typename T>
+  class Channel {
+   public:
+    auto push(T value) -> void {
+      {
+        LockGuard lock(m_mutex);
+        m_items.push_back(std::move(value));
+      }
 
-          std::cout << responseStr << '\n';
-          std::cout.flush();
-        } else {
-          std::cerr << "Internal error: " << e.what() << '\n';
-        }
+      m_ready.notify_one();
+    }
+
+    /**
+     * @brief Wait for the next item
+     * @return The item, or None once the channel is closed and empty
+     */
+    auto pop() -> Option<T> {
+      std::unique_lock lock(m_mutex);
+      m_ready.wait(lock, [this] { return m_closed || !m_items.empty(); });
+
+      if (m_items.empty())
+        return None;
+
+      T value = std::move(m_items.front());
+      m_items.pop_front();
+
+      return value;
+    }
+
+    auto close() -> void {
+      {
+        LockGuard lock(m_mutex);
+        m_closed = true;
       }
+
+      m_ready.notify_all();
     }
-    return {};
-  }
 
- private:
-  using Tools = Map<String, Pair<Tool, ToolHandler>>;
+   private:
+    Mutex                   m_mutex;
+    std::condition_variable m_ready;
+    std::deque<T>           m_items;
+    bool                    m_closed = false;
+  };
 
   String    m_name;
   String    m_version;
   GlzObject m_capabilities;
-  Tools     m_tools;
+  Tools     m_tools; ///< Only read once run() starts, so workers share it without locking
+
+  /**
+   * @brief Run one request and serialize its response
+   * @return The response line, or None for notifications (requests without an id)
+   */
+  auto handleRequest(GlzObject& requestJson) const -> Option<String> {
+    String method = requestJson.contains("method") ? requestJson["method"].get<String>() : "";
+
+    GlzJson params = requestJson.contains("params") ? requestJson["params"] : GlzJson {};
+
+    String jsonrpc = requestJson.contains("jsonrpc") ? requestJson["jsonrpc"].get<String>() : "2.0";
+
+    Result<GlzJson> result;
+
+    try {
+      result = processRequest(method, params);
+    } catch (const Exception& e) {
+      result = Err(draconis::utils::error::DracError(InternalError, e.what()));
+    }
+
+    if (!requestJson.contains("id")) {
+      if (!result)
+        std::cerr << "Internal error: " << result.error().message << '\n';
 
-  auto processRequest(const String& method, const GlzJson& params) -> Result<GlzJson> {
+      return None;
+    }
+
+    GlzObject response;
+    response["jsonrpc"] = jsonrpc;
+    response["id"]      = requestJson["id"];
+
+    if (result) {
+      response["result"] = *result;
+    } else {
+      response["error"] = GlzObject {
+        {    "code",                                              -32603 },
+        { "message", "Internal error: " + String(result.error().message) }
+      };
+    }
+
+    String responseStr;
+
+    if (glz::error_ctx writeErrc = glz::write_json(response, responseStr); writeErrc) {
+      std::cerr << "Failed to serialize response: " << glz::format_error(writeErrc, responseStr) << '\n';
+      return None;
+    }
+
+    return responseStr;
+  }
+
+  auto processRequest(const String& method, const GlzJson& params) const -> Result<GlzJson> {
     if (method == "initialize") {
       return GlzObject {
         { "protocolVersion",                                               "2025-06-18" },
@@ -750,8 +1060,9 @@ class DracStdioServer {
   }
 };
 
-auto main() -> i32 {
+auto main(const i32 argc, char* argv[]) -> i32 {
   DracStdioServer server("Draconis++ MCP Server", DRAC_VERSION);
+  FleetCollector  collector;
 
   server.setCapabilities({
     { "tools", { { "listChanged", true } } }
@@ -784,6 +1095,33 @@ auto main() -> i32 {
   server.registerTool(uptimeTool, UptimeHandler);
   server.registerTool(comprehensiveTool, ComprehensiveInfoHandler);
 
+  if (argc == 3 && StringView(argv[1]) == "--fleet-listen") {
+    Result<fleet::Endpoint> endpoint = fleet::ParseEndpoint(argv[2]);
+
+    if (!endpoint) {
+      std::cerr << "Error: " << endpoint.error().message << '\n';
+      return EXIT_FAILURE;
+    }
+
+    if (Result<> started = collector.start(*endpoint, GetFleetStore()); !started) {
+      std::cerr << "Error: " << started.error().message << '\n';
+      return EXIT_FAILURE;
+    }
+
+    Tool fleetSummaryTool("fleet_summary", "Get fleet-wide totals: host count, connected agents, memory and disk usage, hosts per OS");
+    Tool fleetHostsTool("fleet_hosts", "List every host reporting to this collector with its connection state, memory usage and uptime");
+
+    Tool fleetHostTool(
+      "fleet_host",
+      "Get the latest comprehensive information reported by one fleet host",
+      ToolParam { .name = "host", .description = "Host id, as listed by fleet_hosts", .required = true }
+    );
+
+    server.registerTool(fleetSummaryTool, FleetSummaryHandler);
+    server.registerTool(fleetHostsTool, FleetHostsHandler);
+    server.registerTool(fleetHostTool, FleetHostHandler);
+  }
+
   Result<> res = server.run();
 
   if (res)
@@ -0,0 +1,100 @@
+/**
+ * @file CPUUsage.hpp
+ * @brief Turns cumulative CPU times into a rolling history of utilisation
+ * @author Draconis++ Team
+ * @version 1.0.0
+ *
+ * @details GetCPUTimes() only reports ticks accumulated since boot; utilisation
+ * is the change between two reads. A CPUUsageSampler keeps the previous read
+ * and a fixed-size ring of the loads computed from it, so an exporter or a
+ * dashboard can sample on its own schedule and show recent history without
+ * tracking ticks itself.
+ *
+ * @code{.cpp}
+ * CPUUsageSampler sampler;
+ *
+ * while (running) {
+ *   if (Result<CPULoad> load = sampler.sample())
+ *     ...
+ *   std::this_thread::sleep_for(1s);
+ * }
+ * @endcode
+ *
+ * The default reader is GetCPUTimes(), which only Linux implements; elsewhere
+ * sample() returns NotSupported unless a reader is passed in.
+ */
+
+#pragma once
+
+#include <chrono> // std::chrono::steady_clock
+
+#include "../Utils/DataTypes.hpp"
+#include "../Utils/Error.hpp"
+#include "../Utils/Types.hpp"
+
+namespace draconis::core::system {
+  namespace types = ::draconis::utils::types;
+
+  /**
+   * @brief One entry of a CPUUsageSampler's history.
+   */
+  struct CPUUsageSample {
+    std::chrono::steady_clock::time_point at;   ///< When the period ended.
+    types::CPULoad                        load; ///< Utilisation over the period.
+  };
+
+  /**
+   * @brief Samples CPU times and keeps the most recent loads.
+   *
+   * @details The first sample() has nothing to difference against, so it
+   * reports the average since boot. After that each sample covers the time
+   * since the one before. Once the ring is full, sampling reuses its storage
+   * and no longer allocates. All members are safe to call from any thread.
+   */
+  class CPUUsageSampler {
+   public:
+    /// Reads cumulative times, filling one entry per CPU; see GetCPUTimes().
+    using Reader = types::Fn<types::Result<types::CPUTimes>(types::Vec<types::CPUTimes>& perCpu)>;
+
+    static constexpr types::usize DEFAULT_CAPACITY = 60;
+
+    /**
+     * @param capacity Samples kept in history(); at least one is always kept
+     * @param reader Source of CPU times; empty uses GetCPUTimes()
+     */
+    explicit CPUUsageSampler(types::usize capacity = DEFAULT_CAPACITY, Reader reader = {});
+
+    /**
+     * @brief Read the CPU times and record the load since the previous sample
+     * @return The new load; on error the history is left unchanged
+     */
+    auto sample() -> types::Result<types::CPULoad>;
+
+    /**
+     * @brief The most recent sample, if any
+     */
+    [[nodiscard]] auto latest() const -> types::Option<CPUUsageSample>;
+
+    /**
+     * @brief Copy the recorded samples into @p out, oldest first
+     * @details @p out is resized to the number of samples; pass the same vector each time to avoid allocating.
+     */
+    auto history(types::Vec<CPUUsageSample>& out) const -> types::Unit;
+
+    /// How many samples history() can hold.
+    [[nodiscard]] auto capacity() const -> types::usize;
+
+   private:
+    Reader m_reader;
+
+    mutable types::Mutex m_mutex;
+
+    types::Vec<types::CPUTimes> m_previous;
+    types::Vec<types::CPUTimes> m_current;
+    types::CPUTimes             m_previousTotal;
+
+    types::Vec<CPUUsageSample> m_ring;
+    types::usize               m_next  = 0; ///< Slot the next sample is written to.
+    types::usize               m_count = 0; ///< Occupied slots.
+  };
+} // namespace draconis::core::system
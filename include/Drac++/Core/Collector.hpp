@@ -0,0 +1,108 @@
+/**
+ * @file Collector.hpp
+ * @brief Dependency-aware parallel task runner for system information collection
+ * @author Draconis++ Team
+ * @version 1.0.0
+ *
+ * @details Most readouts (memory, disk, GPU, package counts, plugins, ...) touch
+ * unrelated kernel interfaces, so running them one after another makes the total
+ * wall-clock time the sum of every probe. The Collector runs them as independent
+ * tasks on a small worker pool instead, so the slowest readout bounds startup time.
+ *
+ * Tasks may depend on tasks that were added before them. Because a dependency must
+ * already exist when a task is added, the task list is always in topological order
+ * and cycles cannot be expressed.
+ */
+
+#pragma once
+
+#include "../Utils/Types.hpp"
+
+namespace draconis::core::collector {
+  namespace types = ::draconis::utils::types;
+
+  /**
+   * @brief Handle to a task registered with a Collector.
+   */
+  using TaskId = types::usize;
+
+  /**
+   * @brief Wall-clock time spent running a single task.
+   */
+  struct TaskTiming {
+    types::String name;
+    types::f64    durationMs = 0.0;
+  };
+
+  /**
+   * @brief Runs a set of named tasks concurrently while honouring their dependencies.
+   *
+   * @details Tasks communicate results by writing into state captured by their
+   * closures. Every task must write to distinct state (or synchronise itself);
+   * the Collector only guarantees that a task starts after all its dependencies
+   * have finished, which also makes their writes visible to it.
+   *
+   * @code{.cpp}
+   * Collector collector;
+   *
+   * Result<OSInfo> os;
+   * Result<String> logo;
+   *
+   * const TaskId osTask = collector.add("os", [&] { os = GetOperatingSystem(cache); });
+   * collector.add("logo", [&] { logo = LookupLogo(os); }, { osTask });
+   *
+   * collector.run();
+   * @endcode
+   */
+  class Collector {
+   public:
+    /**
+     * @brief Creates an empty collector.
+     * @param maxThreads Upper bound on worker threads, including the calling
+     *                   thread. 0 picks std::thread::hardware_concurrency().
+     */
+    explicit Collector(types::usize maxThreads = 0);
+
+    /**
+     * @brief Registers a task.
+     * @param name Name used for logging and timing reports.
+     * @param work The work to perform.
+     * @param dependsOn Tasks that must finish before this one starts. Ids that
+     *                  don't refer to an already-added task are ignored.
+     * @return Handle that later tasks can depend on.
+     */
+    auto add(types::String name, types::Fn<types::Unit()> work, types::Vec<TaskId> dependsOn = {}) -> TaskId;
+
+    /**
+     * @brief Runs every registered task once and blocks until all have finished.
+     *
+     * @details The calling thread takes part in the work, so a collector limited
+     * to a single thread runs everything inline, in registration order.
+     * Exceptions escaping a task are logged and treated as task completion so
+     * that dependents still run.
+     */
+    auto run() -> types::Unit;
+
+    /**
+     * @brief Per-task timings from the last run(), in registration order.
+     */
+    [[nodiscard]] auto timings() const -> const types::Vec<TaskTiming>&;
+
+    /**
+     * @brief Number of registered tasks.
+     */
+    [[nodiscard]] auto size() const noexcept -> types::usize;
+
+   private:
+    struct Task {
+      types::String            name;
+      types::Fn<types::Unit()> work;
+      types::Vec<TaskId>       dependents;
+      types::usize             dependencyCount = 0;
+    };
+
+    types::Vec<Task>       m_tasks;
+    types::Vec<TaskTiming> m_timings;
+    types::usize           m_maxThreads;
+  };
+} // namespace draconis::core::collector
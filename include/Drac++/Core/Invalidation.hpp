@@ -0,0 +1,144 @@
+/**
+ * @file Invalidation.hpp
+ * @brief Clears cached readouts when the kernel reports that their source changed
+ * @author Draconis++ Team
+ * @version 1.0.0
+ *
+ * @details CacheManager entries only expire by TTL, so a long-running process
+ * either polls or serves stale values. A CacheInvalidator instead subscribes to
+ * the places changes come from:
+ * - inotify on files and directories (package databases, os-release, the config)
+ * - rtnetlink link, address and route notifications
+ * - kernel uevents, filtered by subsystem (power_supply, drm, pci, cpu)
+ *
+ * When a source fires, the keys of every matching rule are invalidated and
+ * listeners are told which snapshot fields went stale. Bursts (a package
+ * transaction touches hundreds of files) are coalesced into one notification.
+ * With it running, readouts can be cached without a TTL and still update as soon
+ * as something changes.
+ *
+ * @code{.cpp}
+ * CacheManager     cache;
+ * SnapshotService  snapshots(cache);
+ * CacheInvalidator invalidator(cache);
+ *
+ * invalidator.subscribe([&](const InvalidationRule& rule) {
+ *   if (!rule.fields.empty())
+ *     snapshots.refresh(rule.fields);
+ * });
+ *
+ * if (Result<> started = invalidator.start(); !started)
+ *   ...
+ * @endcode
+ *
+ * Only Linux has change sources; elsewhere start() returns NotSupported.
+ */
+
+#pragma once
+
+#include <filesystem> // std::filesystem::path
+#include <thread>     // std::thread
+
+#include "../Utils/CacheManager.hpp"
+#include "../Utils/Error.hpp"
+#include "../Utils/Types.hpp"
+
+#include "Snapshot.hpp"
+
+namespace draconis::core::system {
+  namespace types = ::draconis::utils::types;
+
+  /**
+   * @brief Where an InvalidationRule hears about changes.
+   */
+  enum class ChangeSource : types::u8 {
+    Path,    ///< inotify on a file, or on everything directly inside a directory
+    Network, ///< rtnetlink link, address and route changes
+    Uevent,  ///< Kernel uevents for one subsystem
+  };
+
+  /**
+   * @brief A change source and what goes stale when it fires.
+   */
+  struct InvalidationRule {
+    ChangeSource              source;
+    types::String             target; ///< Path for Path, subsystem (e.g. "power_supply") for Uevent; unused for Network
+    types::Vec<types::String> keys;   ///< Cache keys to invalidate
+    types::Vec<SnapshotField> fields; ///< Snapshot fields the change affects, for listeners
+  };
+
+  /**
+   * @brief Rules covering the readouts this platform caches
+   * @param configPath Also watch this file. Its rule has no keys or fields, so
+   *                   listeners recognise it by `target`.
+   * @return Empty where there are no change sources
+   */
+  auto DefaultInvalidationRules(const types::Option<std::filesystem::path>& configPath = types::None) -> types::Vec<InvalidationRule>;
+
+  /**
+   * @brief Watches the sources of a set of rules from one background thread.
+   */
+  class CacheInvalidator {
+   public:
+    /**
+     * @brief Called once per fired rule, after its keys have been invalidated.
+     * @details Runs on the watcher thread; slow work should be handed off.
+     */
+    using Listener = types::Fn<types::Unit(const InvalidationRule& rule)>;
+
+    /**
+     * @param cache Cache to invalidate; must outlive the invalidator
+     * @param rules What to watch
+     */
+    explicit CacheInvalidator(utils::cache::CacheManager& cache, types::Vec<InvalidationRule> rules = DefaultInvalidationRules());
+
+    ~CacheInvalidator();
+
+    CacheInvalidator(const CacheInvalidator&)                    = delete;
+    CacheInvalidator(CacheInvalidator&&)                         = delete;
+    auto operator=(const CacheInvalidator&) -> CacheInvalidator& = delete;
+    auto operator=(CacheInvalidator&&) -> CacheInvalidator&      = delete;
+
+    /**
+     * @brief Open the change sources and start watching
+     * @details Rules whose source can't be opened (a package manager that isn't
+     * installed, a sandbox without netlink) are skipped with a debug log.
+     * Does nothing if already running.
+     * @return NotSupported off Linux; NotFound if no rule could be watched
+     */
+    auto start() -> types::Result<>;
+
+    /**
+     * @brief Stop watching and close the sources
+     */
+    auto stop() -> types::Unit;
+
+    /**
+     * @brief Get called whenever a rule fires
+     * @return An id for unsubscribe()
+     */
+    auto subscribe(Listener listener) -> types::u64;
+
+    /**
+     * @brief Stop calling a listener; a call already in progress still finishes
+     */
+    auto unsubscribe(types::u64 id) -> types::Unit;
+
+   private:
+    struct Sources; // Platform file descriptors, only defined where there are any
+
+    utils::cache::CacheManager&  m_cache;
+    types::Vec<InvalidationRule> m_rules;
+
+    types::Mutex                     m_listenerMutex;
+    types::Map<types::u64, Listener> m_listeners;
+    types::u64                       m_nextListenerId = 0;
+
+    types::Mutex                  m_controlMutex;
+    types::UniquePointer<Sources> m_sources;
+    std::thread                   m_worker;
+
+    auto run(Sources& sources) -> types::Unit;
+    auto fire(const types::Vec<bool>& fired) -> types::Unit;
+  };
+} // namespace draconis::core::system
@@ -0,0 +1,36 @@
+/**
+ * @file Metrics.hpp
+ * @brief OpenMetrics exposition of a SystemSnapshot
+ * @author Draconis++ Team
+ * @version 1.0.0
+ *
+ * @details Renders a snapshot in the OpenMetrics text format, so Prometheus can
+ * scrape a long-running process directly:
+ * - Gauges cover memory, disks, CPU and GPU load, uptime, battery and package counts.
+ * - Counters cover network traffic.
+ * - Static facts (OS, kernel, host, CPU, GPU) go into a single info metric.
+ * - Failed readouts are left out rather than reported as zero.
+ *
+ * @code{.cpp}
+ * String body;
+ * WriteOpenMetrics(*snapshots.current(), body);
+ * // Serve with OPENMETRICS_CONTENT_TYPE.
+ * @endcode
+ */
+
+#pragma once
+
+#include "../Utils/Types.hpp"
+#include "Snapshot.hpp"
+
+namespace draconis::core::system {
+  namespace types = ::draconis::utils::types;
+
+  /// Content-Type for WriteOpenMetrics() output.
+  inline constexpr types::StringView OPENMETRICS_CONTENT_TYPE = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+  /**
+   * @brief Append `snapshot` to `out` as an OpenMetrics exposition, including the trailing "# EOF"
+   */
+  auto WriteOpenMetrics(const SystemSnapshot& snapshot, types::String& out) -> types::Unit;
+} // namespace draconis::core::system
@@ -19,8 +19,11 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <filesystem>
+#include <format>
 #include <fstream>
+#include <future>
 #include <glaze/glaze.hpp>
 
 // Required for DRAC_PLUGIN macro which uses draconis::utils::logging::LogLevel and SetLogLevelPtr
@@ -40,7 +43,16 @@ namespace draconis::utils::cache {
  * data in BEVE format (glaze's binary encoding) for maximum efficiency. Plugins can cache
  * any type that has glaze metadata defined.
  *
- * Cache entries include an expiry timestamp, and expired entries are automatically ignored.
+ * Cache entries include an expiry timestamp, and get() ignores expired entries; getStale()
+ * still returns them, flagged, for plugins that would rather show an old value than wait.
+ *
+ * In WriteMode::WriteBehind, set() and invalidate() only touch memory; dirty entries are
+ * written out by flush(), which runs on destruction and, if a flush interval is set, from
+ * set() once the interval has passed. Every file is written to a temporary name and renamed
+ * into place, so concurrent instances never observe a torn entry.
+ *
+ * @note Entries stay one file per key rather than going through CachePack: dynamically loaded
+ * plugins only see this header, not the library's symbols.
  */
 class PluginCache {
   using String = draconis::utils::types::String;
@@ -61,11 +73,29 @@ class PluginCache {
     Option<u64> expires; // UNIX timestamp, None = no expiry
   };
 
-  explicit PluginCache(const std::filesystem::path& cacheDir) : m_cacheDir(cacheDir) {
+  enum class WriteMode : draconis::utils::types::u8 {
+    Immediate,   ///< Every set()/invalidate() goes straight to disk
+    WriteBehind, ///< Changes are buffered in memory until flush()
+  };
+
+  explicit PluginCache(const std::filesystem::path& cacheDir, const WriteMode mode = WriteMode::Immediate)
+    : m_cacheDir(cacheDir), m_mode(mode) {
     std::error_code errc;
     std::filesystem::create_directories(m_cacheDir, errc);
   }
 
+  ~PluginCache() {
+    flush();
+  }
+
+  /**
+   * @brief Flush write-behind changes automatically once this much time has passed since the last flush
+   * @param interval Minimum time between automatic flushes (zero = only flush explicitly or on destruction)
+   */
+  auto setFlushInterval(const std::chrono::steady_clock::duration interval) -> void {
+    m_flushInterval = interval;
+  }
+
   /**
    * @brief Get a cached value
    * @tparam T The type to retrieve (must have glaze metadata)
@@ -74,24 +104,47 @@ class PluginCache {
    */
   template <typename T>
   [[nodiscard]] auto get(const String& key) const -> Option<T> {
+    if (Option<Pair<T, bool>> cached = getStale<T>(key); cached && !cached->second)
+      return std::move(cached->first);
+
+    return None;
+  }
+
+  /**
+   * @brief Get a cached value even if it has expired
+   * @tparam T The type to retrieve (must have glaze metadata)
+   * @param key Cache key
+   * @return The cached value and whether it has expired, or None if nothing is cached
+   *
+   * @details For stale-while-revalidate: a plugin whose fetch is slow (a network
+   * request) can return the expired value straight away and refetch afterwards,
+   * or leave that to the next `draconis++ --warm-cache`. This is opt-in: the host
+   * never serves a plugin's expired entries on its behalf, so a plugin that only
+   * calls get() keeps fetching on every miss.
+   */
+  template <typename T>
+  [[nodiscard]] auto getStale(const String& key) const -> Option<Pair<T, bool>> {
     // Check in-memory cache first
     if (auto iter = m_cache.find(key); iter != m_cache.end()) {
       const auto& [data, expiryTp] = iter->second;
-      if (std::chrono::system_clock::now() < expiryTp) {
-        CacheEntry<T> entry;
-        if (glz::read_beve(entry, data) == glz::error_code::none)
-          return entry.data;
-      }
-    }
 
-    // Check filesystem
-    const std::filesystem::path filePath = m_cacheDir / key;
-    if (!std::filesystem::exists(filePath))
+      // Empty data marks a key known to be absent (or invalidated but not yet flushed)
+      if (data.empty())
+        return None;
+
+      CacheEntry<T> entry;
+      if (glz::read_beve(entry, data) == glz::error_code::none)
+        return Pair<T, bool>(std::move(entry.data), std::chrono::system_clock::now() >= expiryTp);
+
       return None;
+    }
 
-    std::ifstream ifs(filePath, std::ios::binary);
-    if (!ifs)
+    // Check filesystem; a failed open covers the missing-file case without a separate stat
+    std::ifstream ifs(m_cacheDir / key, std::ios::binary);
+    if (!ifs) {
+      m_cache[key] = { String(), std::chrono::system_clock::time_point::min() };
       return None;
+    }
 
     String        fileContents((std::istreambuf_iterator<char>(ifs)), {});
     CacheEntry<T> entry;
@@ -99,20 +152,13 @@ class PluginCache {
     if (glz::read_beve(entry, fileContents) != glz::error_code::none)
       return None;
 
-    // Check expiry
-    if (entry.expires.has_value()) {
-      auto expiryTp = std::chrono::system_clock::time_point(std::chrono::seconds(*entry.expires));
-      if (std::chrono::system_clock::now() >= expiryTp)
-        return None;
-    }
-
-    // Store in memory cache for faster subsequent access
+    // Store in memory cache for faster subsequent access; expired entries too, since getStale() still wants them
     auto expiryTp = entry.expires.has_value()
       ? std::chrono::system_clock::time_point(std::chrono::seconds(*entry.expires))
       : std::chrono::system_clock::time_point::max();
-    m_cache[key]  = { fileContents, expiryTp };
+    m_cache[key]  = { std::move(fileContents), expiryTp };
 
-    return entry.data;
+    return Pair<T, bool>(std::move(entry.data), std::chrono::system_clock::now() >= expiryTp);
   }
 
   /**
@@ -142,16 +188,17 @@ class PluginCache {
     String binaryBuffer;
     glz::write_beve(entry, binaryBuffer);
 
-    // Store in memory
-    m_cache[key] = { binaryBuffer, expiryTp };
+    if (m_mode == WriteMode::Immediate) {
+      writeFile(key, binaryBuffer);
+      m_cache[key] = { std::move(binaryBuffer), expiryTp };
+      return;
+    }
 
-    // Store to filesystem
-    const std::filesystem::path filePath = m_cacheDir / key;
-    std::error_code             errc;
-    std::filesystem::create_directories(filePath.parent_path(), errc);
+    m_cache[key] = { binaryBuffer, expiryTp };
+    m_dirty.insert_or_assign(key, Option<String>(std::move(binaryBuffer)));
 
-    if (std::ofstream ofs(filePath, std::ios::binary | std::ios::trunc); ofs.is_open())
-      ofs.write(binaryBuffer.data(), static_cast<std::streamsize>(binaryBuffer.size()));
+    if (m_flushInterval > steady_clock::duration::zero() && steady_clock::now() - m_lastFlush >= m_flushInterval)
+      flush();
   }
 
   /**
@@ -159,14 +206,81 @@ class PluginCache {
    * @param key Cache key to invalidate
    */
   auto invalidate(const String& key) -> void {
-    m_cache.erase(key);
+    m_cache[key] = { String(), std::chrono::system_clock::time_point::min() };
+
+    if (m_mode == WriteMode::WriteBehind) {
+      m_dirty.insert_or_assign(key, Option<String>(None));
+      return;
+    }
+
     std::error_code errc;
     std::filesystem::remove(m_cacheDir / key, errc);
   }
 
+  /**
+   * @brief Write every buffered change to disk
+   * @details A no-op in WriteMode::Immediate or when nothing is dirty.
+   */
+  auto flush() -> void {
+    m_lastFlush = std::chrono::steady_clock::now();
+
+    if (m_dirty.empty())
+      return;
+
+    for (const auto& [key, data] : m_dirty)
+      if (data)
+        writeFile(key, *data);
+      else {
+        std::error_code errc;
+        std::filesystem::remove(m_cacheDir / key, errc);
+      }
+
+    m_dirty.clear();
+  }
+
  private:
   std::filesystem::path                                                             m_cacheDir;
+  WriteMode                                                                         m_mode;
   mutable UnorderedMap<String, Pair<String, std::chrono::system_clock::time_point>> m_cache;
+  UnorderedMap<String, Option<String>>                                              m_dirty; // None = pending removal
+  std::chrono::steady_clock::duration                                               m_flushInterval = std::chrono::steady_clock::duration::zero();
+  std::chrono::steady_clock::time_point                                             m_lastFlush     = std::chrono::steady_clock::now();
+
+  auto writeFile(const String& key, const String& data) const -> void {
+    const std::filesystem::path filePath = m_cacheDir / key;
+    std::error_code             errc;
+
+    // Keys may contain subdirectories; the cache root itself exists since construction
+    if (filePath.parent_path() != m_cacheDir)
+      std::filesystem::create_directories(filePath.parent_path(), errc);
+
+    // Unique per instance and write, so racing writers never share a temporary
+    std::filesystem::path tmpPath = filePath;
+    tmpPath += std::format(
+      ".{:x}{:x}.tmp",
+      reinterpret_cast<std::uintptr_t>(this), // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count())
+    );
+
+    {
+      std::ofstream ofs(tmpPath, std::ios::binary | std::ios::trunc);
+      if (!ofs.is_open())
+        return;
+
+      ofs.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+      if (!ofs) {
+        ofs.close();
+        std::filesystem::remove(tmpPath, errc);
+        return;
+      }
+    }
+
+    std::filesystem::rename(tmpPath, filePath, errc);
+
+    if (errc)
+      std::filesystem::remove(tmpPath, errc);
+  }
 };
 
 // Glaze metadata for CacheEntry (in global glz namespace)
@@ -204,15 +318,62 @@ namespace draconis::core::plugin {
     PluginDependencies   dependencies;
   };
 
+  /**
+   * @class IEventLoop
+   * @brief Host-owned event loop shared by every asynchronous plugin
+   *
+   * @details All callbacks run on the loop's single thread, so plugins must not
+   * block inside them. Going through this interface (rather than a concrete
+   * asio type) keeps plugins free of a compile-time asio dependency; plugins
+   * that are built against the same asio can reach the underlying
+   * `asio::io_context` through nativeHandle().
+   */
+  class IEventLoop {
+   public:
+    IEventLoop()                                     = default;
+    IEventLoop(const IEventLoop&)                    = delete;
+    IEventLoop(IEventLoop&&)                         = delete;
+    auto operator=(const IEventLoop&) -> IEventLoop& = delete;
+    auto operator=(IEventLoop&&) -> IEventLoop&      = delete;
+    virtual ~IEventLoop()                            = default;
+
+    /**
+     * @brief Run a task on the loop thread
+     * @param task Work to run; must not block
+     */
+    virtual auto post(utils::types::Fn<void()> task) -> utils::types::Unit = 0;
+
+    /**
+     * @brief Run a task on the loop thread once a delay has passed
+     * @param delay Time to wait before running the task
+     * @param task Work to run; must not block
+     */
+    virtual auto postAfter(std::chrono::milliseconds delay, utils::types::Fn<void()> task) -> utils::types::Unit = 0;
+
+    /**
+     * @brief Wait until a socket or file descriptor becomes readable
+     * @param descriptor Native descriptor owned by the plugin; it is not closed by the loop
+     * @param onReadable Called on the loop thread once readable, or with an error
+     */
+    virtual auto waitReadable(utils::types::i64 descriptor, utils::types::Fn<void(utils::types::Result<utils::types::Unit>)> onReadable)
+      -> utils::types::Unit = 0;
+
+    /**
+     * @brief The underlying `asio::io_context*`, for plugins built against the host's asio
+     */
+    [[nodiscard]] virtual auto nativeHandle() -> void* = 0;
+  };
+
   /**
    * @struct PluginContext
    * @brief Context passed to plugins during initialization
    * @details Contains paths and configuration needed by plugins
    */
   struct PluginContext {
-    std::filesystem::path configDir; ///< Directory where plugin configs live (e.g., ~/.config/draconis++/plugins/)
-    std::filesystem::path cacheDir;  ///< Directory for plugin cache files
-    std::filesystem::path dataDir;   ///< Directory for plugin data files
+    std::filesystem::path configDir;           ///< Directory where plugin configs live (e.g., ~/.config/draconis++/plugins/)
+    std::filesystem::path cacheDir;            ///< Directory for plugin cache files
+    std::filesystem::path dataDir;             ///< Directory for plugin data files
+    IEventLoop*           eventLoop = nullptr; ///< Shared event loop for asynchronous plugins; outlives the plugin
   };
 
   class IPlugin {
@@ -320,6 +481,40 @@ namespace draconis::core::plugin {
     [[nodiscard]] virtual auto isEnabled() const -> bool = 0;
   };
 
+  /**
+   * @class IAsyncInfoProviderPlugin
+   * @brief Info provider that collects without blocking a thread
+   *
+   * @details Instead of collectData(), the host calls collectDataAsync() and
+   * waits for the completion callback, so any number of these providers can
+   * overlap their network or socket I/O on the single PluginContext::eventLoop
+   * thread. The plugin should keep the event loop pointer from initialize().
+   */
+  class IAsyncInfoProviderPlugin : public IInfoProviderPlugin {
+   public:
+    /**
+     * @brief Start collecting data from this provider
+     * @param cache Cache interface for data persistence; valid until onComplete is called
+     * @param onComplete Called exactly once, from any thread, when collection finishes
+     * @details Must return promptly; the actual work belongs on the event loop.
+     */
+    virtual auto collectDataAsync(::PluginCache& cache, utils::types::Fn<void(utils::types::Result<utils::types::Unit>)> onComplete)
+      -> utils::types::Unit = 0;
+
+    /**
+     * @brief Blocking adapter over collectDataAsync()
+     * @warning Never call this from the event loop thread; it would wait on itself.
+     */
+    auto collectData(::PluginCache& cache) -> utils::types::Result<utils::types::Unit> override {
+      auto promise = std::make_shared<std::promise<utils::types::Result<utils::types::Unit>>>();
+      auto future  = promise->get_future();
+
+      collectDataAsync(cache, [promise](utils::types::Result<utils::types::Unit> result) { promise->set_value(std::move(result)); });
+
+      return future.get();
+    }
+  };
+
   /**
    * @class IOutputFormatPlugin
    * @brief Plugin interface for output formatting
@@ -373,7 +568,7 @@ namespace draconis::core::plugin {
  *
  * @param PluginClass The plugin class to instantiate (must be default-constructible)
  *
- * For static builds, creates factory functions and self-registers the plugin at startup.
+ * For static builds, defines the factory functions the generated static plugin table points at.
  * For dynamic builds, creates extern "C" exports for dynamic loading.
  *
  * @example
@@ -383,15 +578,16 @@ namespace draconis::core::plugin {
  */
 #ifdef DRAC_STATIC_PLUGIN_BUILD
   #include <Drac++/Core/StaticPlugins.hpp>
-  #define DRAC_PLUGIN(PluginClass)                                                  \
-    static auto Create_##PluginClass() -> draconis::core::plugin::IPlugin* {        \
-      return new PluginClass();                                                     \
-    }                                                                               \
-    static auto Destroy_##PluginClass(draconis::core::plugin::IPlugin* p) -> void { \
-      delete p;                                                                     \
-    }                                                                               \
-    static const bool g_##PluginClass##_registered =                                \
-      draconis::core::plugin::RegisterStaticPlugin(#PluginClass, { Create_##PluginClass, Destroy_##PluginClass });
+// NOLINTBEGIN(bugprone-macro-parentheses) - false positive
+  #define DRAC_PLUGIN(PluginClass)                                                                     \
+    DRAC_DECLARE_STATIC_PLUGIN(PluginClass)                                                            \
+    extern "C" auto DracStaticCreate_##PluginClass() -> draconis::core::plugin::IPlugin* {             \
+      return new PluginClass();                                                                        \
+    }                                                                                                  \
+    extern "C" auto DracStaticDestroy_##PluginClass(draconis::core::plugin::IPlugin* plugin) -> void { \
+      delete plugin;                                                                                   \
+    }
+// NOLINTEND(bugprone-macro-parentheses)
 #else
 // NOLINTBEGIN(bugprone-macro-parentheses) - false positive
   #define DRAC_PLUGIN(PluginClass)                                                                            \
@@ -21,5 +21,23 @@ namespace draconis::core::plugin {
   struct PluginConfig {
     bool                                                        enabled = true; ///< Whether the plugin system is enabled
     draconis::utils::types::Vec<draconis::utils::types::String> autoLoad;       ///< List of plugin names to auto-load
+
+    /// How long to wait for each info provider's data, in milliseconds (0 = no deadline)
+    draconis::utils::types::u32 collectTimeoutMs = 0;
+
+    /// Per-plugin deadlines keyed by provider ID, overriding collectTimeoutMs
+    draconis::utils::types::Map<draconis::utils::types::String, draconis::utils::types::u32> collectTimeoutsMs;
+
+    /**
+     * @brief Deadline for a single info provider
+     * @param providerId Provider ID of the plugin
+     * @return Deadline in milliseconds, 0 if the plugin may take as long as it needs
+     */
+    [[nodiscard]] auto collectTimeoutFor(const draconis::utils::types::String& providerId) const -> draconis::utils::types::u32 {
+      if (const auto iter = collectTimeoutsMs.find(providerId); iter != collectTimeoutsMs.end())
+        return iter->second;
+
+      return collectTimeoutMs;
+    }
   };
 } // namespace draconis::core::plugin
@@ -32,12 +32,15 @@ namespace draconis::core::plugin {
   namespace fs = std::filesystem;
 
   using utils::cache::CacheManager;
+  using utils::types::i64;
   using utils::types::Map;
+  using utils::types::Mutex;
   using utils::types::Option;
   using utils::types::Result;
   using utils::types::String;
   using utils::types::UniquePointer;
   using utils::types::Unit;
+  using utils::types::u64;
   using utils::types::Vec;
 
   // Platform-specific dynamic library handle
@@ -76,18 +79,63 @@ namespace draconis::core::plugin {
     auto operator=(LoadedPlugin&&) -> LoadedPlugin&      = default;
   };
 
+  /**
+   * @struct PluginManifestEntry
+   * @brief What the plugin manifest remembers about a dynamic plugin
+   *
+   * @details The manifest is persisted in the cache directory and lets the
+   * manager describe a plugin, or decide whether it is needed at all, without
+   * dlopen-ing it. An entry is only trusted while the library's path, mtime
+   * and size still match.
+   */
+  struct PluginManifestEntry {
+    String         path;       ///< Library the entry was recorded from
+    i64            mtime = 0;  ///< Library modification time, in file clock ticks
+    u64            size  = 0;  ///< Library size in bytes
+    PluginMetadata metadata;   ///< Metadata reported by the plugin instance
+    String         providerId; ///< Provider ID for info providers, empty otherwise
+  };
+
+  /**
+   * @brief Read a plugin manifest written by WritePluginManifest()
+   * @param path Manifest file
+   * @return The recorded entries; NotFound if there is no manifest, ParseError
+   *         if it is unreadable or was written by another manifest version
+   */
+  auto ReadPluginManifest(const fs::path& path) -> Result<Map<String, PluginManifestEntry>>;
+
+  /**
+   * @brief Replace a plugin manifest with the given entries
+   * @details Written to a uniquely named temporary file next to `path` and
+   * renamed over it, so readers and other writers never see a partial file.
+   */
+  auto WritePluginManifest(const fs::path& path, const Map<String, PluginManifestEntry>& entries) -> Result<Unit>;
+
   /**
    * @brief Get the plugin context with standard paths
    * @return PluginContext with config, cache, and data directories
    */
   auto GetPluginContext() -> PluginContext;
 
+  /**
+   * @brief The event loop shared by asynchronous plugins
+   * @details Its thread is only started once a plugin first submits work.
+   */
+  auto GetEventLoop() -> IEventLoop&;
+
   class PluginManager {
    private:
     Map<String, LoadedPlugin> m_plugins;
     Map<String, fs::path>     m_discoveredPlugins;
     Vec<fs::path>             m_pluginSearchPaths;
 
+    // Manifest entries for discovered plugins, keyed by plugin name
+    Map<String, PluginManifestEntry> m_manifest;
+    bool                             m_manifestDirty = false;
+
+    // Orders manifest writes, which happen outside m_mutex
+    Mutex m_manifestWriteMutex;
+
     // Type-safe, sorted plugin caches for fast access
     Vec<IInfoProviderPlugin*> m_infoProviderPlugins;
     Vec<IOutputFormatPlugin*> m_outputFormatPlugins;
@@ -105,6 +153,12 @@ namespace draconis::core::plugin {
 
     auto scanForPlugins() -> Result<Unit>;
 
+    auto loadPluginImpl(const String& pluginName, CacheManager& cache) -> Result<Unit>;
+
+    auto loadManifest() -> Unit;
+    auto saveManifest() -> Unit;
+    auto recordManifestEntry(const String& pluginName, const LoadedPlugin& loadedPlugin) -> Unit;
+
     static auto getCreatePluginFunc(DynamicLibraryHandle handle) -> Result<IPlugin* (*)()>;
     static auto getDestroyPluginFunc(DynamicLibraryHandle handle) -> Result<void (*)(IPlugin*)>;
     static auto syncPluginLogLevel(DynamicLibraryHandle handle) -> void;
@@ -149,6 +203,30 @@ namespace draconis::core::plugin {
     auto listLoadedPlugins() const -> Vec<PluginMetadata>;
     auto listDiscoveredPlugins() const -> Vec<String>; // Lists all .so/.dll files found
     auto isPluginLoaded(const String& pluginName) const -> bool;
+
+    /**
+     * @brief Look up a discovered plugin in the manifest without loading it
+     * @param pluginName Name of the discovered plugin
+     * @return The manifest entry, or None if the plugin has not been loaded since it last changed
+     */
+    auto getManifestEntry(const String& pluginName) const -> Option<PluginManifestEntry>;
+
+    /**
+     * @brief Mark a plugin as running plugin code outside the caller's thread
+     * @details A collection left running past its deadline can still be inside
+     * the plugin when the manager unloads it at exit. While any collection is in
+     * flight, unloadPlugin() neither shuts the instance down nor destroys it or
+     * closes its library; both are left to the process teardown instead.
+     * Every call must be paired with endCollection().
+     */
+    static auto beginCollection(const IPlugin* plugin) -> Unit;
+
+    /**
+     * @brief Mark one collection started with beginCollection() as finished
+     * @note Call only once the collection will not touch the plugin again.
+     * Static, so it is safe to call after the manager has been destroyed.
+     */
+    static auto endCollection(const IPlugin* plugin) -> Unit;
   };
 
   inline auto GetPluginManager() -> PluginManager& {
@@ -0,0 +1,386 @@
+/**
+ * @file Snapshot.hpp
+ * @brief Background-refreshed, immutable snapshots of the system readouts
+ * @author Draconis++ Team
+ * @version 1.0.0
+ *
+ * @details Long-running consumers (servers, dashboards, exporters) shouldn't
+ * re-run the readouts for every request. A SnapshotService collects everything
+ * once up front, then refreshes each field on its own interval from a single
+ * background thread. Every refresh publishes a new immutable SystemSnapshot,
+ * so readers take a reference-counted pointer to the latest one in constant
+ * time and never wait on collection.
+ *
+ * Diff() reduces two snapshots to the fields that changed, Apply() replays
+ * such a delta on the receiving side, and WriteSnapshotDelta() /
+ * ReadSnapshotDelta() carry deltas (or whole snapshots) as BEVE.
+ *
+ * @code{.cpp}
+ * CacheManager    cache;
+ * SnapshotService snapshots(cache);
+ * snapshots.start();
+ *
+ * SharedPointer<const SystemSnapshot> latest = snapshots.current();
+ * if (latest->memInfo)
+ *   ...
+ * @endcode
+ */
+
+#pragma once
+
+#include <chrono>             // std::chrono::{milliseconds, seconds, steady_clock}
+#include <condition_variable> // std::condition_variable
+#include <span>               // std::span
+#include <thread>             // std::thread
+
+#include "../Utils/CacheManager.hpp"
+#include "../Utils/DataTypes.hpp"
+#include "../Utils/Error.hpp"
+#include "../Utils/Types.hpp"
+
+#if DRAC_ENABLE_PACKAGECOUNT
+  #include "../Services/Packages.hpp"
+#endif
+
+#include "CPUUsage.hpp"
+
+namespace draconis::core::system {
+  namespace types = ::draconis::utils::types;
+
+  /**
+   * @brief Groups of readouts a SnapshotService refreshes together.
+   */
+  enum class SnapshotField : types::u8 {
+    OperatingSystem,
+    Kernel,
+    Host,
+    Shell,
+    DesktopEnv,
+    WindowMgr,
+    CPUModel,
+    CPUCores,
+    CPUUsage, ///< Busy share since the previous refresh, overall and per CPU
+    GPUModel,
+    GPUs, ///< Every display controller with its current load
+    Memory,
+    DiskUsage, ///< The system disk plus every mounted one
+    Uptime,
+    Battery,
+    Network, ///< Every interface plus the primary one
+    Outputs, ///< Every display plus the primary one
+    Packages,
+  };
+
+  inline constexpr types::usize SNAPSHOT_FIELD_COUNT = static_cast<types::usize>(SnapshotField::Packages) + 1;
+
+  /**
+   * @brief Every readout, as of one point in time.
+   *
+   * @details Fields are Results so failures are kept alongside values.
+   * Published snapshots are never modified; a refresh copies the latest one
+   * and replaces the fields it re-collected.
+   */
+  struct SystemSnapshot {
+    /// Bumped every time a refresh changes any field. Equal versions from the
+    /// same service mean equal contents.
+    types::u64 version = 0;
+
+    /// When this version was published. Monotonic, so only meaningful
+    /// relative to other snapshots taken on the same host since boot.
+    std::chrono::steady_clock::time_point collectedAt;
+
+    types::Result<types::OSInfo>                       operatingSystem;
+    types::Result<types::String>                       kernelVersion;
+    types::Result<types::String>                       host;
+    types::Result<types::String>                       shell;
+    types::Result<types::String>                       desktopEnv;
+    types::Result<types::String>                       windowMgr;
+    types::Result<types::String>                       cpuModel;
+    types::Result<types::CPUCores>                     cpuCores;
+    types::Result<types::CPULoad>                      cpuUsage;
+    types::Result<types::String>                       gpuModel;
+    types::Result<types::Vec<types::GPUInfo>>          gpus;
+    types::Result<types::ResourceUsage>                memInfo;
+    types::Result<types::ResourceUsage>                diskUsage;
+    types::Result<types::Vec<types::DiskInfo>>         disks;
+    types::Result<std::chrono::seconds>                uptime;
+    types::Result<types::Battery>                      battery;
+    types::Result<types::Vec<types::NetworkInterface>> networkInterfaces;
+    types::Result<types::NetworkInterface>             primaryNetworkInterface;
+    types::Result<types::Vec<types::DisplayInfo>>      outputs;
+    types::Result<types::DisplayInfo>                  primaryOutput;
+#if DRAC_ENABLE_PACKAGECOUNT
+    types::Result<types::Map<types::String, types::u64>> packageCounts;
+#endif
+  };
+
+  /**
+   * @brief A readout that failed, as carried by a SnapshotDelta.
+   */
+  struct SnapshotError {
+    types::String               member; ///< Name of the SystemSnapshot member, e.g. "battery"
+    utils::error::DracErrorCode code;
+    types::String               message;
+  };
+
+  /**
+   * @brief The fields that differ between two snapshots.
+   *
+   * @details Members mirror SystemSnapshot. A set member carries the new value;
+   * a member that now fails is listed in `errors` instead; anything else is
+   * unchanged. A delta with no `baseVersion` holds every field, so it doubles
+   * as a full snapshot on the wire.
+   */
+  struct SnapshotDelta {
+    types::Option<types::u64>             baseVersion; ///< Version this applies on top of; None for a full snapshot
+    types::u64                            version = 0;
+    std::chrono::steady_clock::time_point collectedAt;
+
+    types::Option<types::OSInfo>                       operatingSystem;
+    types::Option<types::String>                       kernelVersion;
+    types::Option<types::String>                       host;
+    types::Option<types::String>                       shell;
+    types::Option<types::String>                       desktopEnv;
+    types::Option<types::String>                       windowMgr;
+    types::Option<types::String>                       cpuModel;
+    types::Option<types::CPUCores>                     cpuCores;
+    types::Option<types::CPULoad>                      cpuUsage;
+    types::Option<types::String>                       gpuModel;
+    types::Option<types::Vec<types::GPUInfo>>          gpus;
+    types::Option<types::ResourceUsage>                memInfo;
+    types::Option<types::ResourceUsage>                diskUsage;
+    types::Option<types::Vec<types::DiskInfo>>         disks;
+    types::Option<std::chrono::seconds>                uptime;
+    types::Option<types::Battery>                      battery;
+    types::Option<types::Vec<types::NetworkInterface>> networkInterfaces;
+    types::Option<types::NetworkInterface>             primaryNetworkInterface;
+    types::Option<types::Vec<types::DisplayInfo>>      outputs;
+    types::Option<types::DisplayInfo>                  primaryOutput;
+#if DRAC_ENABLE_PACKAGECOUNT
+    types::Option<types::Map<types::String, types::u64>> packageCounts;
+#endif
+
+    types::Vec<SnapshotError> errors;
+  };
+
+  /**
+   * @brief Only what changed from `previous` to `next`
+   */
+  auto Diff(const SystemSnapshot& previous, const SystemSnapshot& next) -> SnapshotDelta;
+
+  /**
+   * @brief Every field of `snapshot`, as a delta with no base version
+   */
+  auto Diff(const SystemSnapshot& snapshot) -> SnapshotDelta;
+
+  /**
+   * @brief Bring `target` up to the delta's version
+   * @return InvalidArgument if the delta was taken against a different version than `target`
+   */
+  auto Apply(SystemSnapshot& target, const SnapshotDelta& delta) -> types::Result<>;
+
+  /**
+   * @brief Encode a delta (or full snapshot) as BEVE
+   */
+  auto WriteSnapshotDelta(const SnapshotDelta& delta, types::String& out) -> types::Result<>;
+
+  /**
+   * @brief Decode a delta written by WriteSnapshotDelta
+   */
+  auto ReadSnapshotDelta(types::StringView data) -> types::Result<SnapshotDelta>;
+
+  /**
+   * @brief Default refresh intervals: volatile readouts every few seconds, static facts once.
+   */
+  constexpr auto DefaultSnapshotIntervals() -> types::Array<std::chrono::milliseconds, SNAPSHOT_FIELD_COUNT> {
+    using namespace std::chrono_literals;
+    using enum SnapshotField;
+
+    types::Array<std::chrono::milliseconds, SNAPSHOT_FIELD_COUNT> intervals {};
+
+    intervals[static_cast<types::usize>(CPUUsage)]  = 2s;
+    intervals[static_cast<types::usize>(GPUs)]      = 2s;
+    intervals[static_cast<types::usize>(Memory)]    = 2s;
+    intervals[static_cast<types::usize>(DiskUsage)] = 30s;
+    intervals[static_cast<types::usize>(Uptime)]    = 1s;
+    intervals[static_cast<types::usize>(Battery)]   = 10s;
+    intervals[static_cast<types::usize>(Network)]   = 5s;
+    intervals[static_cast<types::usize>(Outputs)]   = 30s;
+    intervals[static_cast<types::usize>(Packages)]  = 5min;
+
+    return intervals;
+  }
+
+  /**
+   * @brief How often a SnapshotService refreshes each field.
+   */
+  struct SnapshotOptions {
+    /// Refresh interval per SnapshotField; zero collects the field only once.
+    types::Array<std::chrono::milliseconds, SNAPSHOT_FIELD_COUNT> intervals = DefaultSnapshotIntervals();
+
+#if DRAC_ENABLE_PACKAGECOUNT
+    /// Package managers counted for SnapshotField::Packages.
+    services::packages::Manager packageManagers = services::packages::ALL_PACKAGE_MANAGERS;
+#endif
+
+    /**
+     * @brief Set the refresh interval of one field
+     */
+    constexpr auto setInterval(const SnapshotField field, const std::chrono::milliseconds interval) -> SnapshotOptions& {
+      intervals[static_cast<types::usize>(field)] = interval;
+      return *this;
+    }
+  };
+
+  /**
+   * @brief Keeps an up-to-date SystemSnapshot, refreshed in the background.
+   *
+   * @details The constructor collects every field once (in parallel), so
+   * current() is usable immediately. start() then launches a single thread
+   * that re-collects each field whenever its interval elapses. current() is
+   * safe to call from any thread.
+   */
+  class SnapshotService {
+   public:
+    /**
+     * @brief Called after every refresh that published a new snapshot.
+     * @details Runs on the refreshing thread (usually the background one), so it
+     * should hand off anything slow rather than hold up the next refresh.
+     */
+    using Listener = types::Fn<types::Unit(const SystemSnapshot& previous, const types::SharedPointer<const SystemSnapshot>& next)>;
+
+    /**
+     * @brief Collect the initial snapshot
+     * @param cache Cache manager passed to the readouts; must outlive the service
+     * @param options Per-field refresh intervals
+     */
+    explicit SnapshotService(utils::cache::CacheManager& cache, SnapshotOptions options = {});
+
+    ~SnapshotService();
+
+    SnapshotService(const SnapshotService&)                    = delete;
+    SnapshotService(SnapshotService&&)                         = delete;
+    auto operator=(const SnapshotService&) -> SnapshotService& = delete;
+    auto operator=(SnapshotService&&) -> SnapshotService&      = delete;
+
+    /**
+     * @brief Start refreshing in the background
+     * @details Does nothing if already running, or if no field has an interval.
+     */
+    auto start() -> types::Unit;
+
+    /**
+     * @brief Stop the background thread, waiting for an in-progress refresh to finish
+     */
+    auto stop() -> types::Unit;
+
+    /**
+     * @brief The latest published snapshot
+     */
+    [[nodiscard]] auto current() const -> types::SharedPointer<const SystemSnapshot>;
+
+    /**
+     * @brief Re-collect some fields now and publish the result
+     * @param fields Fields to re-collect
+     * @return The snapshot that is current afterwards
+     *
+     * @details The version is only bumped if a re-collected field changed.
+     */
+    auto refresh(std::span<const SnapshotField> fields) -> types::SharedPointer<const SystemSnapshot>;
+
+    /**
+     * @brief Get called whenever a refresh publishes a new snapshot
+     * @return An id for unsubscribe()
+     */
+    auto subscribe(Listener listener) -> types::u64;
+
+    /**
+     * @brief Stop calling a listener; a call already in progress still finishes
+     */
+    auto unsubscribe(types::u64 id) -> types::Unit;
+
+   private:
+    utils::cache::CacheManager& m_cache;
+    SnapshotOptions             m_options;
+    CPUUsageSampler             m_cpuUsage { 1 }; // Keeps the ticks each CPUUsage refresh is measured against
+
+    mutable types::Mutex                       m_snapshotMutex;
+    types::SharedPointer<const SystemSnapshot> m_snapshot;
+
+    types::Mutex m_refreshMutex; // Serialises refresh() calls
+
+    types::Mutex                     m_listenerMutex;
+    types::Map<types::u64, Listener> m_listeners;
+    types::u64                       m_nextListenerId = 0;
+
+    types::Mutex            m_controlMutex;
+    std::condition_variable m_wake;
+    bool                    m_stopping = false;
+    std::thread             m_worker;
+
+    auto run() -> types::Unit;
+  };
+} // namespace draconis::core::system
+
+namespace glz {
+  template <>
+  struct meta<draconis::core::system::SnapshotError> {
+    using T = draconis::core::system::SnapshotError;
+
+    static constexpr detail::Object value = object("member", &T::member, "code", &T::code, "message", &T::message);
+  };
+
+  template <>
+  struct meta<draconis::core::system::SnapshotDelta> {
+    using T = draconis::core::system::SnapshotDelta;
+
+    // Durations and time points travel as integer counts.
+    static constexpr auto readCollectedAt = [](T& self, const draconis::utils::types::i64 nanoseconds) {
+      self.collectedAt = std::chrono::steady_clock::time_point(std::chrono::nanoseconds(nanoseconds));
+    };
+
+    static constexpr auto writeCollectedAt = [](const T& self) -> draconis::utils::types::i64 {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(self.collectedAt.time_since_epoch()).count();
+    };
+
+    static constexpr auto readUptime = [](T& self, const draconis::utils::types::Option<draconis::utils::types::i64>& seconds) {
+      self.uptime = seconds.transform([](const draconis::utils::types::i64 count) { return std::chrono::seconds(count); });
+    };
+
+    static constexpr auto writeUptime = [](const T& self) -> draconis::utils::types::Option<draconis::utils::types::i64> {
+      return self.uptime.transform([](const std::chrono::seconds uptime) { return uptime.count(); });
+    };
+
+    // clang-format off
+    static constexpr detail::Object value = object(
+      "baseVersion",             &T::baseVersion,
+      "version",                 &T::version,
+      "collectedAt",             custom<readCollectedAt, writeCollectedAt>,
+      "operatingSystem",         &T::operatingSystem,
+      "kernelVersion",           &T::kernelVersion,
+      "host",                    &T::host,
+      "shell",                   &T::shell,
+      "desktopEnv",              &T::desktopEnv,
+      "windowMgr",               &T::windowMgr,
+      "cpuModel",                &T::cpuModel,
+      "cpuCores",                &T::cpuCores,
+      "cpuUsage",                &T::cpuUsage,
+      "gpuModel",                &T::gpuModel,
+      "gpus",                    &T::gpus,
+      "memInfo",                 &T::memInfo,
+      "diskUsage",               &T::diskUsage,
+      "disks",                   &T::disks,
+      "uptime",                  custom<readUptime, writeUptime>,
+      "battery",                 &T::battery,
+      "networkInterfaces",       &T::networkInterfaces,
+      "primaryNetworkInterface", &T::primaryNetworkInterface,
+      "outputs",                 &T::outputs,
+      "primaryOutput",           &T::primaryOutput,
+  #if DRAC_ENABLE_PACKAGECOUNT
+      "packageCounts",           &T::packageCounts,
+  #endif
+      "errors",                  &T::errors
+    );
+    // clang-format on
+  };
+} // namespace glz
@@ -11,7 +11,10 @@
  * - Faster startup (no dynamic library loading)
  * - Smaller distribution (no separate .dll/.so files needed)
  *
- * Plugins self-register using the DRAC_PLUGIN macro at static initialization.
+ * The set of static plugins is fixed at configure time, so meson generates
+ * the registry as a constant table sorted by name: nothing runs during static
+ * initialization, and lookups are a binary search. Each plugin's DRAC_PLUGIN
+ * invocation provides the factory functions the table points at.
  */
 
 #pragma once
@@ -27,48 +30,46 @@ namespace draconis::core::plugin {
    * @brief Entry for a statically compiled plugin
    */
   struct StaticPluginEntry {
+    utils::types::StringView name; ///< Name the plugin was given in -Dstatic_plugins
     IPlugin* (*createFunc)();
     void (*destroyFunc)(IPlugin*);
   };
 
   /**
-   * @brief Get the mutable registry of static plugins (for registration)
-   * @return Reference to the map of plugin name -> entry
+   * @brief Get every statically compiled plugin
+   * @return Entries sorted by name
    */
-  auto GetStaticPluginRegistry() -> utils::types::UnorderedMap<utils::types::String, StaticPluginEntry>&;
-
-  /**
-   * @brief Register a static plugin (called automatically by DRAC_PLUGIN macro)
-   * @param name The plugin name
-   * @param entry The plugin entry to register
-   * @return true (used to enable static initialization)
-   */
-  inline auto RegisterStaticPlugin(const char* name, StaticPluginEntry entry) -> bool {
-    GetStaticPluginRegistry().emplace(name, entry);
-    return true;
-  }
+  auto GetStaticPlugins() -> utils::types::Span<const StaticPluginEntry>;
 
   /**
    * @brief Check if a plugin is available as a static plugin
    * @param name The plugin name to check
    * @return true if the plugin is statically compiled, false otherwise
    */
-  auto IsStaticPlugin(const utils::types::String& name) -> bool;
+  auto IsStaticPlugin(utils::types::StringView name) -> bool;
 
   /**
    * @brief Create an instance of a static plugin
    * @param name The plugin name
    * @return Pointer to the created plugin instance, or nullptr if not found
    */
-  auto CreateStaticPlugin(const utils::types::String& name) -> IPlugin*;
+  auto CreateStaticPlugin(utils::types::StringView name) -> IPlugin*;
 
   /**
    * @brief Destroy an instance of a static plugin
    * @param name The plugin name
    * @param plugin The plugin instance to destroy
    */
-  auto DestroyStaticPlugin(const utils::types::String& name, IPlugin* plugin) -> void;
+  auto DestroyStaticPlugin(utils::types::StringView name, IPlugin* plugin) -> void;
 
 } // namespace draconis::core::plugin
 
+  // Factory functions DRAC_PLUGIN defines for a static plugin, referenced by the generated table.
+  #define DRAC_DECLARE_STATIC_PLUGIN(PluginClass)                                         \
+    extern "C" auto DracStaticCreate_##PluginClass() -> draconis::core::plugin::IPlugin*; \
+    extern "C" auto DracStaticDestroy_##PluginClass(draconis::core::plugin::IPlugin* plugin) -> void;
+
+  #define DRAC_STATIC_PLUGIN_ENTRY(name, PluginClass) \
+    draconis::core::plugin::StaticPluginEntry { name, DracStaticCreate_##PluginClass, DracStaticDestroy_##PluginClass }
+
 #endif // DRAC_ENABLE_PLUGINS && DRAC_PRECOMPILED_CONFIG
@@ -7,6 +7,10 @@
 
 #pragma once
 
+#include <algorithm> // std::ranges::{any_of, equal}
+#include <cctype>    // std::tolower
+#include <chrono>    // std::chrono::milliseconds
+
 #include "../Utils/CacheManager.hpp"
 #include "../Utils/DataTypes.hpp"
 #include "../Utils/Types.hpp"
@@ -280,10 +284,12 @@ namespace draconis::core::system {
    *
    * @details Obtained differently depending on the platform:
    *  - Windows: `GetLogicalProcessorInformation`
+   *  - Linux: GetCPUTopology(), falling back to `__get_cpuid` (x86) without sysfs
    *  - Other: To be implemented
    *
    * @warning This function can fail if:
    *  - Windows: `GetLogicalProcessorInformation` fails
+   *  - Linux: `/sys/devices/system/cpu` can't be read, and CPUID isn't available or fails
    *  - Other: To be implemented
    *
    * @code{.cpp}
@@ -306,6 +312,36 @@ namespace draconis::core::system {
    */
   auto GetCPUCores(utils::cache::CacheManager& cache) -> utils::types::Result<utils::types::CPUCores>;
 
+  /**
+   * @brief Fetches how the online CPUs are laid out.
+   * @return Packages, NUMA nodes, hybrid core kinds and per-CPU max frequency.
+   *
+   * @details Obtained differently depending on the platform:
+   *  - Linux: `/sys/devices/system/cpu` (topology, cpufreq, cpu_capacity) and
+   *    `/sys/devices/cpu_core` / `cpu_atom` for Intel hybrid parts; read once
+   *    and kept in the temp-directory cache
+   *  - Other: To be implemented
+   *
+   * @warning This function can fail if:
+   *  - Linux: `/sys/devices/system/cpu/online` can't be read
+   *  - Other: To be implemented
+   */
+  auto GetCPUTopology(utils::cache::CacheManager& cache) -> utils::types::Result<utils::types::CPUTopology>;
+
+  /**
+   * @brief Reads cumulative CPU time, for the caller to difference.
+   * @param perCpu Filled with one entry per CPU number; reused across calls so
+   *               sampling doesn't allocate once it has the right size.
+   * @return The sum over all CPUs.
+   *
+   * @details Obtained differently depending on the platform:
+   *  - Linux: the `cpu` lines of `/proc/stat`
+   *  - Other: To be implemented
+   *
+   * CPUUsageSampler (Core/CPUUsage.hpp) turns successive reads into utilisation.
+   */
+  auto GetCPUTimes(utils::types::Vec<utils::types::CPUTimes>& perCpu) -> utils::types::Result<utils::types::CPUTimes>;
+
   /**
    * @brief Fetches the GPU model.
    * @return The GPU model (e.g., "NVIDIA GeForce RTX 3070").
@@ -339,6 +375,40 @@ namespace draconis::core::system {
    */
   auto GetGPUModel(utils::cache::CacheManager& cache) -> utils::types::Result<utils::types::String>;
 
+  /**
+   * @brief Fetches every display controller with its current load.
+   * @return The GPUs, ordered by PCI address.
+   *
+   * @details Obtained differently depending on the platform:
+   *  - Linux: one pass over `/sys/bus/pci/devices`, kept in the temp-directory cache; each call
+   *    then only re-reads `gpu_busy_percent` / `mem_info_vram_used`, or asks NVML
+   *    (`libnvidia-ml.so.1`, loaded on first use) for devices bound to `nvidia`
+   *  - Other: To be implemented
+   *
+   * @warning This function can fail if:
+   *  - Linux: `/sys/bus/pci/devices` can't be read or holds no display controllers
+   *  - Other: To be implemented
+   *
+   * @code{.cpp}
+   * #include <print>
+   * #include <Drac++/Core/System.hpp>
+   *
+   * int main() {
+   *   Result<Vec<GPUInfo>> gpus = draconis::core::system::GetGPUs();
+   *
+   *   if (gpus.has_value()) {
+   *     for (const GPUInfo& gpu : *gpus)
+   *       std::println("{} {}: {}%", gpu.pciAddress, gpu.model, gpu.busyPercent.value_or(0));
+   *   } else {
+   *     std::println("Failed to get GPUs: {}", gpus.error().message());
+   *   }
+   *
+   *   return 0;
+   * }
+   * @endcode
+   */
+  auto GetGPUs(utils::cache::CacheManager& cache) -> utils::types::Result<utils::types::Vec<utils::types::GPUInfo>>;
+
   /**
    * @brief Fetches the kernel version.
    * @return The kernel version (e.g., "6.14.4").
@@ -406,7 +476,65 @@ namespace draconis::core::system {
    */
   auto GetDiskUsage(utils::cache::CacheManager& cache) -> utils::types::Result<utils::types::ResourceUsage>;
 
-  auto GetDisks(utils::cache::CacheManager& cache) -> utils::types::Result<utils::types::Vec<utils::types::DiskInfo>>;
+  /**
+   * @brief Controls which mounts GetDisks() looks at and how long it waits for each.
+   */
+  struct DiskQueryOptions {
+    /**
+     * @brief How long to wait for any one mount to answer.
+     *
+     * @details Mounts are queried concurrently, so this bounds the whole call. A
+     * mount that doesn't answer in time (e.g. a hung NFS/CIFS server) is left
+     * out of the result. Ignored on Windows.
+     */
+    std::chrono::milliseconds statTimeout = std::chrono::milliseconds(500);
+
+    /**
+     * @brief Filesystem types to include (e.g. "ext4", "btrfs"); empty means every non-pseudo filesystem.
+     *
+     * @details Listing a pseudo filesystem such as "tmpfs" here includes it.
+     * Mounts are filtered before they are queried, so excluded mounts can't block.
+     */
+    utils::types::Vec<utils::types::String> filesystems;
+
+    /**
+     * @brief Filesystem types to leave out (e.g. "nfs4", "cifs"), applied after `filesystems`.
+     */
+    utils::types::Vec<utils::types::String> excludeFilesystems;
+
+    /**
+     * @brief Whether a mount of the given filesystem type passes the filter (case-insensitive).
+     * @param filesystem The mount's filesystem type.
+     * @param isPseudo Whether the type is a pseudo/virtual filesystem (proc, sysfs, tmpfs, ...).
+     */
+    [[nodiscard]] auto selects(const utils::types::StringView filesystem, const bool isPseudo = false) const -> bool {
+      const auto matches = [filesystem](const utils::types::String& wanted) -> bool {
+        return std::ranges::equal(wanted, filesystem, [](const char lhs, const char rhs) {
+          return std::tolower(static_cast<unsigned char>(lhs)) == std::tolower(static_cast<unsigned char>(rhs));
+        });
+      };
+
+      if (std::ranges::any_of(excludeFilesystems, matches))
+        return false;
+
+      if (filesystems.empty())
+        return !isPseudo;
+
+      return std::ranges::any_of(filesystems, matches);
+    }
+  };
+
+  /**
+   * @brief Fetches every mounted disk.
+   * @param cache The cache manager.
+   * @param options Filesystem filter and per-mount timeout.
+   */
+  auto GetDisks(utils::cache::CacheManager& cache, const DiskQueryOptions& options) -> utils::types::Result<utils::types::Vec<utils::types::DiskInfo>>;
+
+  inline auto GetDisks(utils::cache::CacheManager& cache) -> utils::types::Result<utils::types::Vec<utils::types::DiskInfo>> {
+    return GetDisks(cache, {});
+  }
+
   auto GetSystemDisk(utils::cache::CacheManager& cache) -> utils::types::Result<utils::types::DiskInfo>;
   auto GetDiskByPath(const utils::types::String& path, utils::cache::CacheManager& cache) -> utils::types::Result<utils::types::DiskInfo>;
 
@@ -76,6 +76,32 @@ namespace draconis::services::packages {
     return lhs = lhs | rhs;
   }
 
+  /**
+   * @brief Every package manager supported on the current platform.
+   */
+  inline constexpr Manager ALL_PACKAGE_MANAGERS = [] {
+    using enum Manager;
+
+    Manager managers = Cargo;
+  #if defined(__linux__) || defined(__APPLE__)
+    managers |= Nix;
+  #endif
+  #ifdef __linux__
+    managers |= Apk | Dpkg | Moss | Pacman | Rpm | Xbps;
+  #elifdef __APPLE__
+    managers |= Homebrew | Macports;
+  #elifdef _WIN32
+    managers |= Winget | Chocolatey | Scoop;
+  #elif defined(__FreeBSD__) || defined(__DragonFly__)
+    managers |= PkgNg;
+  #elifdef __NetBSD__
+    managers |= PkgSrc;
+  #elifdef __HAIKU__
+    managers |= HaikuPkg;
+  #endif
+    return managers;
+  }();
+
   /**
    * @brief Checks if a specific PackageManager flag is set in a given bitmask.
    * @note This is an internal helper function for the PackageCounting service.
@@ -98,6 +124,45 @@ namespace draconis::services::packages {
     types::String countQuery; ///< Query string (e.g., SQL) or specific file/pattern if not DB.
   };
 
+  /**
+   * @struct IncrementalDbCount
+   * @brief Describes an append-mostly SQLite table whose count can be updated incrementally.
+   *
+   * @details Instead of re-running the filtered COUNT over the whole table
+   * whenever the database changes, the previous count is kept together with
+   * the table's highest rowid, and only rows above it are filtered and added.
+   * Deletions are caught by comparing the table's row count (a cheap b-tree
+   * count) against the previous one, and fall back to a full recount, as does
+   * a carried state older than a day.
+   *
+   * @warning `condition` must only depend on values fixed at insertion time;
+   * a row that starts matching after it was counted is only picked up by the
+   * next full recount.
+   */
+  struct IncrementalDbCount {
+    types::String table;     ///< Rowid table holding one row per package (e.g., "ValidPaths").
+    types::String condition; ///< SQL expression a row must satisfy to be counted; empty counts every row.
+  };
+
+  /**
+   * @brief Per-manager count results, keyed by package manager name (e.g., "dpkg").
+   * @details Contains one entry for every enabled manager available on this platform,
+   * whether or not its count succeeded.
+   */
+  using CountTable = types::Map<types::String, types::Result<types::u64>>;
+
+  /**
+   * @brief Counts packages for every enabled package manager concurrently.
+   * @details Each backend is an independent I/O operation (directory scan, SQLite
+   * query, ...), so all of them run at once and the slowest one bounds the total time.
+   * GetTotalCount() and GetIndividualCounts() are both derived from this table.
+   * A count whose database or directory changed since it was cached is returned
+   * as it was and recounted by the cache's next refresh
+   * (CacheManager::runPendingRefreshes(), or a `--warm-cache` run).
+   * @return Table with one result per enabled package manager.
+   */
+  auto GetCounts(cache::CacheManager& cache, Manager enabledPackageManagers) -> CountTable;
+
   /**
    * @brief Gets the total package count by querying all relevant package managers.
    * @return Result containing the total package count (u64) on success,
@@ -123,6 +188,42 @@ namespace draconis::services::packages {
   auto GetCountFromDb(cache::CacheManager& cache, const types::String& pmId, const fs::path& dbPath, const types::String& countQuery)
     -> types::Result<types::u64>;
 
+  /**
+   * @brief Gets package count from a SQLite table, counting only rows added since the last run.
+   * @param cache The CacheManager instance to use for caching.
+   * @param pmId Identifier for the package manager (for logging/cache).
+   * @param dbPath Path to the SQLite database file.
+   * @param spec Table and filter to count (see IncrementalDbCount).
+   * @return Result containing the count (u64) or a DracError.
+   */
+  auto GetCountFromDb(cache::CacheManager& cache, const types::String& pmId, const fs::path& dbPath, const IncrementalDbCount& spec)
+    -> types::Result<types::u64>;
+
+  /**
+   * @brief Counts occurrences of a record separator in a text buffer.
+   *
+   * @details Two-byte separators (the blank line "\n\n" between records in apk,
+   * opkg and dpkg status files) go through an SSE2/AVX2/NEON kernel with a
+   * scalar tail; other lengths fall back to a plain search. Matches may overlap,
+   * so "\n\n\n" counts as two, as it would when counting empty lines.
+   *
+   * @param data Buffer to scan.
+   * @param separator Separator to count; an empty separator counts as zero.
+   * @return Number of positions where @p separator starts.
+   */
+  auto CountRecordSeparators(types::StringView data, types::StringView separator) -> types::u64;
+
+  /**
+   * @brief Gets package count from a text database by counting record separators.
+   * @param cache The CacheManager instance to use for caching.
+   * @param pmId Identifier for the package manager (for logging/cache).
+   * @param filePath Path to the database file; it is memory-mapped rather than read.
+   * @param separator Separator that ends each record (e.g., "\n\n").
+   * @return Result containing the count (u64) or a DracError.
+   */
+  auto GetCountFromRecordFile(cache::CacheManager& cache, const types::String& pmId, const fs::path& filePath, types::StringView separator)
+    -> types::Result<types::u64>;
+
   /**
    * @brief Gets package count by iterating entries in a directory, optionally filtering and subtracting.
    * @param cache The CacheManager instance to use for caching.
@@ -252,7 +353,9 @@ namespace draconis::services::packages {
     -> types::Result<types::u64>;
   #elifdef __APPLE__
   /**
-   * @brief Counts installed packages using Homebrew.
+   * @brief Counts installed Homebrew formulae and casks.
+   * @details Scans Cellar and Caskroom under every Homebrew prefix concurrently;
+   * each directory's count is cached separately and revalidated by its mtime.
    * @param cache The CacheManager instance to use for caching.
    * @return Result containing the count (u64) or a DracError.
    */
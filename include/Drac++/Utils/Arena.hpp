@@ -0,0 +1,140 @@
+/**
+ * @file Arena.hpp
+ * @brief Scratch memory for work that is thrown away as a whole.
+ *
+ * A watch-mode frame or a server request builds many short-lived vectors and
+ * strings that all die together. FrameArena hands out that memory from one
+ * block with a `std::pmr::monotonic_buffer_resource` and gives it all back in
+ * a single reset(). When a frame outgrows the block, the next reset() grows it,
+ * so a steady workload stops reaching malloc after its first few frames.
+ *
+ * @code{.cpp}
+ * FrameArena arena;
+ *
+ * while (running) {
+ *   std::pmr::vector<usize> widths(arena.resource());
+ *   // ...
+ *   arena.reset();
+ * }
+ * @endcode
+ *
+ * Neither type is thread-safe; each thread keeps its own arena.
+ */
+
+#pragma once
+
+#include <algorithm>       // std::max
+#include <cstddef>         // std::byte, std::max_align_t
+#include <memory_resource> // std::pmr::memory_resource, std::pmr::monotonic_buffer_resource
+
+#include "Types.hpp"
+
+namespace draconis::utils::memory {
+  namespace types = ::draconis::utils::types;
+
+  /**
+   * @brief Forwards to an upstream resource, counting what passes through.
+   */
+  class CountingResource final : public std::pmr::memory_resource {
+   public:
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+      : m_upstream(upstream) {}
+
+    /// Allocations made since construction or the last resetCounts().
+    [[nodiscard]] auto allocations() const noexcept -> types::u64 {
+      return m_allocations;
+    }
+
+    /// Bytes requested since construction or the last resetCounts().
+    [[nodiscard]] auto bytes() const noexcept -> types::u64 {
+      return m_bytes;
+    }
+
+    auto resetCounts() noexcept -> types::Unit {
+      m_allocations = 0;
+      m_bytes       = 0;
+    }
+
+   private:
+    std::pmr::memory_resource* m_upstream;
+    types::u64                 m_allocations = 0;
+    types::u64                 m_bytes       = 0;
+
+    auto do_allocate(const types::usize bytes, const types::usize alignment) -> void* override {
+      void* ptr = m_upstream->allocate(bytes, alignment);
+
+      m_allocations++;
+      m_bytes += bytes;
+
+      return ptr;
+    }
+
+    auto do_deallocate(void* ptr, const types::usize bytes, const types::usize alignment) -> void override {
+      m_upstream->deallocate(ptr, bytes, alignment);
+    }
+
+    [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+      return this == &other;
+    }
+  };
+
+  /**
+   * @brief Monotonic arena that is released and reused once per frame.
+   */
+  class FrameArena {
+   public:
+    static constexpr types::usize DEFAULT_BYTES = 16 * 1024;
+
+    explicit FrameArena(const types::usize initialBytes = DEFAULT_BYTES, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : m_upstream(upstream), m_block(std::max<types::usize>(initialBytes, alignof(std::max_align_t))) {
+      m_resource.emplace(m_block.data(), m_block.size(), &m_upstream);
+    }
+
+    FrameArena(const FrameArena&)                    = delete;
+    FrameArena(FrameArena&&)                         = delete;
+    auto operator=(const FrameArena&) -> FrameArena& = delete;
+    auto operator=(FrameArena&&) -> FrameArena&      = delete;
+    ~FrameArena()                                    = default;
+
+    /**
+     * @brief The resource to hand to pmr containers for this frame.
+     * @details Stays the same object across resets, so it can be captured once.
+     */
+    [[nodiscard]] auto resource() noexcept -> std::pmr::memory_resource* {
+      return &*m_resource;
+    }
+
+    /**
+     * @brief Releases everything allocated since the last reset.
+     * @details Anything still holding arena memory must be gone by now. If the
+     * frame spilled past the block, the block grows by the spill first.
+     */
+    auto reset() -> types::Unit {
+      const types::u64 spilled = m_upstream.bytes();
+
+      // Destroying the resource returns the spilled chunks before the block is resized.
+      m_resource.reset();
+
+      if (spilled > 0)
+        m_block.resize(m_block.size() + spilled);
+
+      m_upstream.resetCounts();
+      m_resource.emplace(m_block.data(), m_block.size(), &m_upstream);
+    }
+
+    /// Bytes the arena can hand out without going upstream.
+    [[nodiscard]] auto capacity() const noexcept -> types::usize {
+      return m_block.size();
+    }
+
+    /// Upstream allocations since the last reset; zero once the block fits a frame.
+    [[nodiscard]] auto spills() const noexcept -> types::u64 {
+      return m_upstream.allocations();
+    }
+
+   private:
+    CountingResource                                   m_upstream;
+    types::Vec<std::byte>                              m_block;
+    types::Option<std::pmr::monotonic_buffer_resource> m_resource;
+  };
+} // namespace draconis::utils::memory
@@ -0,0 +1,54 @@
+/**
+ * @file AsyncLogging.hpp
+ * @brief Optional background sink for log records.
+ *
+ * By default every log call formats its record and writes it synchronously
+ * under the global log mutex. Once StartAsyncLogging() has run, records are
+ * instead pushed onto a bounded lock-free queue and written by a background
+ * thread, in batches, either to the console or to a file. A logging thread
+ * only blocks if the queue is full, until the writer catches up.
+ *
+ * The sink is drained at exit and from the terminate handler, and FlushLogs()
+ * drains it on demand. Records from dynamically loaded plugins still go
+ * through their own synchronous path.
+ *
+ * @code{.cpp}
+ * if (Result<> started = StartAsyncLogging({ .file = "draconis.log" }); !started)
+ *   error_at(started.error());
+ * @endcode
+ */
+
+#pragma once
+
+#include <filesystem> // std::filesystem::path
+
+#include "Types.hpp"
+
+namespace draconis::utils::logging {
+  namespace types = ::draconis::utils::types;
+
+  struct AsyncLogOptions {
+    /**
+     * File to append records to, with ANSI escapes removed. When unset,
+     * records go to stdout/stderr exactly as synchronous logging would write them.
+     */
+    types::Option<std::filesystem::path> file = types::None;
+  };
+
+  /**
+   * @brief Starts the background writer and routes log records through it.
+   * @details Does nothing if the sink is already running.
+   * @param options Where records should be written.
+   */
+  auto StartAsyncLogging(const AsyncLogOptions& options = {}) -> types::Result<>;
+
+  /**
+   * @brief Blocks until every record logged before the call has been written.
+   */
+  auto FlushLogs() -> types::Unit;
+
+  /**
+   * @brief Drains the queue, stops the writer and goes back to synchronous logging.
+   */
+  auto StopAsyncLogging() -> types::Unit;
+} // namespace draconis::utils::logging
@@ -1,12 +1,24 @@
 #pragma once
 
 #include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <filesystem>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <typeinfo>
+
+#ifndef _WIN32
+  #include <sys/stat.h> // stat
+#endif
 #include <glaze/glaze.hpp>
 
+#include "CachePack.hpp"
 #include "DataTypes.hpp"
 #include "Env.hpp"
 #include "Logging.hpp"
+#include "Tracing.hpp"
 
 namespace draconis::utils::cache {
   namespace types = ::draconis::utils::types;
@@ -21,7 +33,8 @@ namespace draconis::utils::cache {
   enum class CacheLocation : types::u8 {
     InMemory,      ///< Volatile, lost on app exit. Fastest.
     TempDirectory, ///< Persists until next reboot or system cleanup.
-    Persistent     ///< Stored in a user-level cache dir (e.g., ~/.cache).
+    Persistent,    ///< Stored in a user-level cache dir (e.g., ~/.cache).
+    Pack           ///< Single memory-mapped pack file in the temp directory. Persists like TempDirectory.
   };
 
   struct CachePolicy {
@@ -29,6 +42,25 @@ namespace draconis::utils::cache {
 
     types::Option<seconds> ttl = days(1); ///< Default to 1 day.
 
+    /**
+     * Files or directories the cached value is derived from. When non-empty,
+     * entries store a fingerprint (inode, size, mtime) of these paths and are
+     * only reused while it still matches, so a single stat per path keeps the
+     * value exactly as fresh as its source.
+     */
+    types::Vec<fs::path> sources = {};
+
+    /**
+     * How long past its expiry an entry may still be returned while a fresh
+     * value is fetched out of band (see CacheManager::runPendingRefreshes()).
+     * An entry whose sources changed counts as stale rather than missing.
+     * None fetches inline as soon as the entry goes stale.
+     *
+     * The fetcher is kept for the refresh, so it must not capture anything by
+     * reference that could be gone by the time the refresh runs.
+     */
+    types::Option<seconds> staleFor = types::None;
+
     static auto inMemory() -> CachePolicy {
       return { .location = CacheLocation::InMemory, .ttl = types::None };
     }
@@ -40,6 +72,10 @@ namespace draconis::utils::cache {
     static auto tempDirectory() -> CachePolicy {
       return { .location = CacheLocation::TempDirectory, .ttl = types::None };
     }
+
+    static auto pack() -> CachePolicy {
+      return { .location = CacheLocation::Pack, .ttl = types::None };
+    }
   };
 
   class CacheManager {
@@ -54,38 +90,91 @@ namespace draconis::utils::cache {
      */
     static inline bool ignoreCache = false;
 
+    /*!
+     * @brief Global flag to refetch everything while still writing the cache.
+     *
+     * When set to true, getOrSet() ignores cached values, runs the fetcher and
+     * stores its result. This backs the CLI's "--warm-cache" option, which hooks
+     * and timers call so interactive runs find fresh entries.
+     */
+    static inline bool revalidate = false;
+
     /**
      * @brief Get the persistent cache directory path for the current platform.
      * @return The path to the cache directory (e.g., ~/.cache/draconis++ on Linux,
-     *         ~/Library/Caches/draconis++ on macOS, %LOCALAPPDATA%/draconis++/cache on Windows)
+     *         ~/Library/Caches/draconis++ on macOS, %LOCALAPPDATA%/draconis++/cache on Windows),
+     *         resolved once in the environment snapshot
      */
-    static auto getPersistentCacheDir() -> fs::path {
-#ifdef __APPLE__
-      return fs::path(std::format("{}/Library/Caches/draconis++", draconis::utils::env::GetEnv("HOME").value_or(".")));
-#elif defined(_WIN32)
-      // On Windows, use LOCALAPPDATA for cache (standard Windows location)
-      if (auto localAppData = draconis::utils::env::GetEnv("LOCALAPPDATA"))
-        return fs::path(*localAppData) / "draconis++" / "cache";
-      // Fallback to USERPROFILE if LOCALAPPDATA is not set
-      return fs::path(draconis::utils::env::GetEnv("USERPROFILE").value_or(".")) / ".cache" / "draconis++";
-#else
-      return fs::path(std::format("{}/.cache/draconis++", draconis::utils::env::GetEnv("HOME").value_or(".")));
-#endif
+    static auto getPersistentCacheDir() -> const fs::path& {
+      return draconis::utils::env::GetEnvSnapshot().persistentCacheDir;
+    }
+
+    /**
+     * @brief Get the directory used for TempDirectory and Pack cache entries.
+     * @return A draconis++-owned subdirectory of the system temp directory, so
+     *         that clearing the cache never touches unrelated files.
+     */
+    static auto getTempCacheDir() -> const fs::path& {
+      return draconis::utils::env::GetEnvSnapshot().tempCacheDir;
+    }
+
+    CacheManager()
+      : m_globalPolicy { .location = CacheLocation::Persistent, .ttl = days(1) },
+        m_pack(getTempCacheDir() / "cache.pack", true) {}
+
+    CacheManager(const CacheManager&)                    = delete;
+    CacheManager(CacheManager&&)                         = delete;
+    auto operator=(const CacheManager&) -> CacheManager& = delete;
+    auto operator=(CacheManager&&) -> CacheManager&      = delete;
+
+    ~CacheManager() {
+      {
+        types::LockGuard lock(m_refreshMutex);
+        m_refreshStopping = true;
+      }
+
+      m_refreshWake.notify_all();
+
+      if (m_refreshWorker.joinable())
+        m_refreshWorker.join();
     }
 
-    CacheManager() : m_globalPolicy { .location = CacheLocation::Persistent, .ttl = days(1) } {}
+    /**
+     * @brief Commit pending CacheLocation::Pack writes to disk.
+     *
+     * Called automatically on destruction; exposed for callers that exit
+     * without unwinding (e.g. via std::exit).
+     */
+    auto flush() -> types::Result<> {
+      return m_pack.flush();
+    }
 
     auto setGlobalPolicy(const CachePolicy& policy) -> types::Unit {
-      types::LockGuard lock(m_cacheMutex);
+      types::LockGuard lock(m_policyMutex);
       m_globalPolicy = policy;
     }
 
     template <typename T>
     struct CacheEntry {
       T                         data;
-      types::Option<types::u64> expires; // store as UNIX timestamp (seconds since epoch), None if no expiry
+      types::Option<types::u64> expires;     // store as UNIX timestamp (seconds since epoch), None if no expiry
+      types::Option<types::u64> fingerprint; // fingerprint of CachePolicy::sources at fetch time, if any
     };
 
+    /**
+     * @brief Return the cached value for @p key, or compute and cache it.
+     *
+     * Lookup order is: decoded in-memory tier, on-disk tier (pack or per-key
+     * file, as selected by the policy), then @p fetcher.
+     *
+     * Keys are spread over independent shards, so lookups for different keys
+     * never block each other, and the fetcher always runs without any lock held.
+     * Concurrent misses on the same key are coalesced: only the first caller
+     * runs the fetcher, and the others wait for and share its result.
+     *
+     * If the policy sets a stale window, an entry inside it is returned as is
+     * and a refresh with @p fetcher is queued instead of fetching inline.
+     */
     template <typename T>
     auto getOrSet(
       const types::String&          key,
@@ -93,110 +182,302 @@ namespace draconis::utils::cache {
       types::Fn<types::Result<T>()> fetcher
     ) -> types::Result<T> {
       if constexpr (DRAC_ENABLE_CACHING) {
+        DRAC_TRACE_SCOPE_DETAIL("cache", "getOrSet", key);
+
         /* Early-exit if caching is globally disabled for this run. */
         if (ignoreCache)
           return fetcher();
 
-        types::LockGuard lock(m_cacheMutex);
+        const CachePolicy policy = overridePolicy.value_or(getGlobalPolicy());
 
-        const CachePolicy& policy = overridePolicy.value_or(m_globalPolicy);
+        const types::Option<types::u64> fingerprint =
+          policy.sources.empty() ? types::None : types::Some(fingerprintSources(policy.sources));
 
-        // 1. Check in-memory cache
-        if (const auto iter = m_inMemoryCache.find(key); iter != m_inMemoryCache.end())
-          if (
-            CacheEntry<T> entry; glz::read_beve(entry, iter->second.first) == glz::error_code::none &&
-            (!entry.expires.has_value() || system_clock::now() < system_clock::time_point(seconds(*entry.expires)))
-          )
-            return entry.data;
+        Shard& shard = shardFor(key);
 
-        // 2. Check filesystem cache
-        const types::Option<fs::path> filePath = getCacheFilePath(key, policy.location);
+        std::promise<types::SharedPointer<const void>> flightPromise;
 
-        if (filePath && fs::exists(*filePath)) {
-          if (std::ifstream ifs(*filePath, std::ios::binary); ifs) {
-            std::string fileContents((std::istreambuf_iterator<char>(ifs)), {});
+        {
+          std::unique_lock lock(shard.mutex);
 
-            CacheEntry<T> entry;
+          // 1. Check the decoded in-memory tier
+          if (types::Option<Lookup<T>> hit = revalidate ? types::None : lookupInMemory<T>(shard, key, fingerprint, policy.staleFor)) {
+            if (hit->stale) {
+              DRAC_TRACE_INSTANT("cache", "hit:stale", key);
+              scheduleRefresh<T>(key, policy, fetcher);
+            } else
+              DRAC_TRACE_INSTANT("cache", "hit:memory", key);
 
-            if (glz::read_beve(entry, fileContents) == glz::error_code::none) {
-              if (!entry.expires.has_value() || system_clock::now() < system_clock::time_point(seconds(*entry.expires))) {
-                system_clock::time_point expiryTp = entry.expires.has_value() ? system_clock::time_point(seconds(*entry.expires)) : system_clock::time_point::max();
+            return std::move(hit->value);
+          }
 
-                m_inMemoryCache[key] = { fileContents, expiryTp };
+          // 2. Another thread is already resolving this key; share its result
+          if (const auto iter = shard.inFlight.find(key); iter != shard.inFlight.end()) {
+            const InFlight flight = iter->second;
+            lock.unlock();
 
-                return entry.data;
-              }
-            }
+            DRAC_TRACE_SCOPE_DETAIL("cache", "wait:in-flight", key);
+
+            if (*flight.type != typeid(T))
+              return fetcher();
+
+            return *static_cast<const types::Result<T>*>(flight.result.get().get());
           }
+
+          shard.inFlight.emplace(key, InFlight { .result = flightPromise.get_future().share(), .type = &typeid(T) });
         }
 
-        // 3. Cache miss: call fetcher (move the callable to indicate consumption)
-        types::Result<T> fetchedResult = fetcher();
+        // From here on this thread is the only one resolving `key`.
+        const auto finishFlight = [&]() -> types::Unit {
+          types::LockGuard lock(shard.mutex);
+          shard.inFlight.erase(key);
+        };
 
-        if (!fetchedResult)
-          return fetchedResult;
+        types::Result<T> result = [&]() -> types::Result<T> {
+          try {
+            return resolve<T>(key, policy, fingerprint, fetcher);
+          } catch (...) {
+            finishFlight();
+            flightPromise.set_exception(std::current_exception());
+            throw;
+          }
+        }();
 
-        // 4. Store in cache
-        types::Option<types::u64> expiryTs;
-        if (policy.ttl.has_value()) {
-          system_clock::time_point now        = system_clock::now();
-          system_clock::time_point expiryTime = now + *policy.ttl;
+        finishFlight();
+        flightPromise.set_value(std::make_shared<const types::Result<T>>(result));
 
-          expiryTs = duration_cast<seconds>(expiryTime.time_since_epoch()).count();
-        }
+        return result;
+      } else {
+        (void)key;
+        (void)overridePolicy;
+        return fetcher();
+      }
+    }
 
-        CacheEntry<T> newEntry {
-          .data    = *fetchedResult,
-          .expires = expiryTs
-        };
+    template <typename T>
+    auto getOrSet(const types::String& key, types::Fn<types::Result<T>()> fetcher) -> types::Result<T> {
+      return getOrSet(key, types::None, fetcher);
+    }
 
-        std::string binaryBuffer;
-        glz::write_beve(newEntry, binaryBuffer);
+    /**
+     * @brief getOrSet() for values derived from files on disk.
+     *
+     * Uses the global policy's location, but instead of expiring after a TTL
+     * the entry stays valid exactly as long as @p sources are unchanged.
+     *
+     * @param key Cache key.
+     * @param sources Files or directories the value is computed from (see CachePolicy::sources).
+     * @param fetcher Computes the value on a miss.
+     * @param serveStale Once @p sources change, keep returning the old value
+     *        until a queued refresh replaces it (see CachePolicy::staleFor).
+     */
+    template <typename T>
+    auto getOrSetValidated(
+      const types::String&          key,
+      types::Vec<fs::path>          sources,
+      types::Fn<types::Result<T>()> fetcher,
+      const bool                    serveStale = false
+    ) -> types::Result<T> {
+      CachePolicy policy = getGlobalPolicy();
 
-        system_clock::time_point inMemoryExpiryTp = expiryTs.has_value()
-          ? system_clock::time_point(seconds(*expiryTs))
-          : system_clock::time_point::max();
+      policy.ttl     = types::None;
+      policy.sources = std::move(sources);
 
-        m_inMemoryCache[key] = { binaryBuffer, inMemoryExpiryTp };
+      // Without a TTL nothing expires, so a zero window only lets changed sources through.
+      if (serveStale)
+        policy.staleFor = seconds::zero();
 
-        if (policy.location != CacheLocation::InMemory && filePath) {
-          std::error_code errc;
-          fs::create_directories(filePath->parent_path(), errc);
-          if (!errc) {
-            if (std::ofstream ofs(*filePath, std::ios::binary | std::ios::trunc); ofs.is_open()) {
-              ofs.write(binaryBuffer.data(), static_cast<std::streamsize>(binaryBuffer.size()));
-            }
-          }
+      return getOrSet<T>(key, policy, std::move(fetcher));
+    }
+
+    /**
+     * @brief Return the value cached under @p key without fetching on a miss.
+     *
+     * Applies the same expiry and fingerprint checks as getOrSet(). Intended
+     * for state a fetcher carries between runs (e.g. a high-water mark), where
+     * a missing entry simply means starting from scratch.
+     */
+    template <typename T>
+    auto get(const types::String& key, types::Option<CachePolicy> overridePolicy = types::None) -> types::Option<T> {
+      if constexpr (DRAC_ENABLE_CACHING) {
+        if (ignoreCache)
+          return types::None;
+
+        const CachePolicy policy = overridePolicy.value_or(getGlobalPolicy());
+
+        const types::Option<types::u64> fingerprint =
+          policy.sources.empty() ? types::None : types::Some(fingerprintSources(policy.sources));
+
+        {
+          Shard&           shard = shardFor(key);
+          types::LockGuard lock(shard.mutex);
+
+          if (types::Option<Lookup<T>> hit = lookupInMemory<T>(shard, key, fingerprint))
+            return std::move(hit->value);
         }
 
-        return fetchedResult;
+        if (types::Option<Lookup<T>> stored = lookupStored<T>(key, policy.location, fingerprint))
+          return std::move(stored->value);
+
+        return types::None;
       } else {
         (void)key;
         (void)overridePolicy;
-        return fetcher();
+        return types::None;
       }
     }
 
+    /**
+     * @brief Store @p value under @p key, replacing any existing entry.
+     */
     template <typename T>
-    auto getOrSet(const types::String& key, types::Fn<types::Result<T>()> fetcher) -> types::Result<T> {
-      return getOrSet(key, types::None, fetcher);
+    auto set(const types::String& key, const T& value, types::Option<CachePolicy> overridePolicy = types::None) -> types::Unit {
+      if constexpr (DRAC_ENABLE_CACHING) {
+        if (ignoreCache)
+          return;
+
+        const CachePolicy policy = overridePolicy.value_or(getGlobalPolicy());
+
+        const types::Option<types::u64> fingerprint =
+          policy.sources.empty() ? types::None : types::Some(fingerprintSources(policy.sources));
+
+        store(key, value, policy, fingerprint);
+      } else {
+        (void)key;
+        (void)value;
+        (void)overridePolicy;
+      }
+    }
+
+    /**
+     * @brief Compute a fingerprint of the given paths from a single stat() each.
+     *
+     * Covers device, inode, size and modification time, so replacing,
+     * rewriting or (for directories) adding/removing entries changes it.
+     * Missing paths contribute a fixed marker rather than failing.
+     */
+    static auto fingerprintSources(const types::Vec<fs::path>& sources) -> types::u64 {
+      types::u64 hash = 0xcbf29ce484222325ULL;
+
+      const auto mix = [&hash](const types::u64 value) {
+        hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+      };
+
+      for (const fs::path& source : sources) {
+#ifdef _WIN32
+        std::error_code errc;
+
+        const fs::file_time_type modified = fs::last_write_time(source, errc);
+
+        if (errc) {
+          mix(0);
+          continue;
+        }
+
+        mix(1);
+        mix(static_cast<types::u64>(modified.time_since_epoch().count()));
+
+        if (const types::u64 size = fs::file_size(source, errc); !errc)
+          mix(size);
+#else
+        struct stat info {};
+
+        if (stat(source.c_str(), &info) != 0) {
+          mix(0);
+          continue;
+        }
+
+  #ifdef __APPLE__
+        const timespec& modified = info.st_mtimespec;
+  #else
+        const timespec& modified = info.st_mtim;
+  #endif
+
+        mix(1);
+        mix(static_cast<types::u64>(info.st_dev));
+        mix(static_cast<types::u64>(info.st_ino));
+        mix(static_cast<types::u64>(info.st_size));
+        mix(static_cast<types::u64>(modified.tv_sec));
+        mix(static_cast<types::u64>(modified.tv_nsec));
+#endif
+      }
+
+      return hash;
+    }
+
+    /**
+     * @brief Run the refreshes queued for stale entries on the calling thread.
+     *
+     * Short-lived callers that would rather not start a thread drain the queue
+     * here once their output is out of the way.
+     *
+     * @return How many refreshes ran.
+     */
+    auto runPendingRefreshes() -> types::usize {
+      types::usize ran = 0;
+
+      std::unique_lock lock(m_refreshMutex);
+
+      while (!m_pendingRefreshes.empty()) {
+        auto job = m_pendingRefreshes.extract(m_pendingRefreshes.begin());
+        lock.unlock();
+
+        job.second();
+        ran++;
+
+        lock.lock();
+      }
+
+      return ran;
+    }
+
+    /**
+     * @brief Run queued refreshes on a worker thread as soon as they are queued.
+     *
+     * For long-running callers (watch mode, the snapshot service). The worker
+     * is started once and stopped when the manager is destroyed.
+     */
+    auto refreshInBackground() -> types::Unit {
+      types::LockGuard lock(m_refreshMutex);
+
+      if (m_refreshWorker.joinable())
+        return;
+
+      m_refreshWorker = std::thread([this] { refreshLoop(); });
+    }
+
+    /// Refreshes queued and not yet run.
+    auto pendingRefreshes() -> types::usize {
+      types::LockGuard lock(m_refreshMutex);
+      return m_pendingRefreshes.size();
+    }
+
+    /// How many times getOrSet() returned a stale entry.
+    auto staleHits() -> types::u64 {
+      types::LockGuard lock(m_refreshMutex);
+      return m_staleHits;
     }
 
     /**
      * @brief Remove a cached entry corresponding to the given key.
      *
-     * This erases the entry from the in-memory cache and also attempts to
-     * remove any corresponding files in the temporary and persistent cache
-     * locations (if they exist).
+     * This erases the entry from the in-memory cache and the pack file, and
+     * also attempts to remove any corresponding files in the temporary and
+     * persistent cache locations (if they exist).
      *
      * @param key Cache key to invalidate.
      */
     auto invalidate(const types::String& key) -> types::Unit {
       if constexpr (DRAC_ENABLE_CACHING) {
-        types::LockGuard lock(m_cacheMutex);
+        {
+          Shard&           shard = shardFor(key);
+          types::LockGuard lock(shard.mutex);
 
-        // Erase from in-memory cache (no harm if the key is absent).
-        m_inMemoryCache.erase(key);
+          // Erase from in-memory cache (no harm if the key is absent).
+          shard.entries.erase(key);
+        }
+
+        m_pack.erase(key);
 
         // Attempt to remove the on-disk copies for both possible locations.
         for (const CacheLocation loc : { CacheLocation::TempDirectory, CacheLocation::Persistent })
@@ -212,71 +493,65 @@ namespace draconis::utils::cache {
     /**
      * @brief Remove **all** cached data – both in-memory and on-disk.
      *
-     * This clears the in-memory cache map and removes all files from the
-     * persistent and temporary cache directories while preserving the
-     * directory structure.
+     * This clears the in-memory cache map, deletes the pack file and removes
+     * all files from the persistent and temporary cache directories while
+     * preserving the directory structure. Only directories owned by draconis++
+     * are swept; files elsewhere in the system temp directory are removed only
+     * if their name matches a key currently held in memory.
      */
     auto invalidateAll(bool logRemovals = false) -> types::u8 {
       if constexpr (DRAC_ENABLE_CACHING) {
-        types::LockGuard lock(m_cacheMutex);
-
         types::u8 removedCount = 0;
 
-        // Record keys currently present so we can clean their temp-dir copies
-        // after we clear the map.
+        // Record keys currently present so we can clean up flat temp-dir
+        // copies left behind by older versions after we clear the map.
         types::Vec<types::String> keys;
-        keys.reserve(m_inMemoryCache.size());
-        for (const auto& [key, val] : m_inMemoryCache)
-          keys.emplace_back(key);
 
-        // Clear in-memory cache.
-        m_inMemoryCache.clear();
+        for (Shard& shard : m_shards) {
+          types::LockGuard lock(shard.mutex);
+
+          for (const auto& [key, val] : shard.entries)
+            keys.emplace_back(key);
 
-        // Remove all files from persistent cache directory.
-        const fs::path persistentDir = getPersistentCacheDir();
+          // Clear in-memory cache.
+          shard.entries.clear();
+        }
+
+        // Drop the pack file (and any pending writes to it).
+        if (m_pack.clear()) {
+          removedCount++;
+          if (logRemovals)
+            info_log("Removed cache pack: {}", m_pack.path().string());
+        }
+
+        const auto removeAllIn = [&](const fs::path& dir, const types::StringView kind) {
+          if (!fs::exists(dir))
+            return;
 
-        if (fs::exists(persistentDir)) {
           std::error_code errc;
-          for (const fs::directory_entry& entry : fs::recursive_directory_iterator(persistentDir, errc))
+          for (const fs::directory_entry& entry : fs::recursive_directory_iterator(dir, errc))
             if (entry.is_regular_file()) {
               fs::remove(entry.path(), errc);
               removedCount++;
               if (logRemovals)
-                info_log("Removed persistent cache file: {}", entry.path().string());
+                info_log("Removed {} cache file: {}", kind, entry.path().string());
             }
-        }
+        };
 
-        // Remove all files from temp directory that match our cache pattern.
-        const fs::path tempDir = fs::temp_directory_path();
-        if (fs::exists(tempDir)) {
-          std::error_code errc;
-          for (const fs::directory_entry& entry : fs::directory_iterator(tempDir, errc)) {
-            if (entry.is_regular_file()) {
-              // Check if this file is one of our cache files by looking at known keys
-              // or by checking if it's a file we might have created
-              bool shouldRemove = false;
-
-              // Remove files that match our known keys
-              for (const types::String& key : keys)
-                if (entry.path().filename() == key) {
-                  shouldRemove = true;
-                  break;
-                }
-
-              // Also remove any files that might be orphaned cache files
-              // (files that don't have extensions and are likely our cache files)
-              if (!shouldRemove && entry.path().extension().empty())
-                shouldRemove = true;
-
-              if (shouldRemove) {
-                fs::remove(entry.path(), errc);
-                removedCount++;
-                if (logRemovals)
-                  info_log("Removed temp-directory cache file: {}", entry.path().string());
-              }
+        removeAllIn(getPersistentCacheDir(), "persistent");
+        removeAllIn(getTempCacheDir(), "temp-directory");
+
+        // Flat files directly in the system temp directory are only ours if
+        // they match a known key.
+        for (const types::String& key : keys)
+          if (const fs::path legacyPath = fs::temp_directory_path() / key; fs::is_regular_file(legacyPath)) {
+            std::error_code errc;
+            if (fs::remove(legacyPath, errc)) {
+              removedCount++;
+              if (logRemovals)
+                info_log("Removed temp-directory cache file: {}", legacyPath.string());
             }
           }
-        }
 
         return removedCount;
       } else {
@@ -286,23 +561,352 @@ namespace draconis::utils::cache {
     }
 
    private:
-    CachePolicy m_globalPolicy;
+    /**
+     * @brief A decoded value held by the in-memory tier.
+     */
+    struct MemoryEntry {
+      types::SharedPointer<const void> value;
+      const std::type_info*            type;
+      system_clock::time_point         expires;
+      types::Option<types::u64>        fingerprint;
+    };
+
+    /**
+     * @brief A fetch in progress; followers wait on `result` (a Result<T>).
+     */
+    struct InFlight {
+      std::shared_future<types::SharedPointer<const void>> result;
+      const std::type_info*                                type;
+    };
+
+    struct Shard {
+      types::Mutex                                     mutex;
+      types::UnorderedMap<types::String, MemoryEntry> entries;
+      types::UnorderedMap<types::String, InFlight>    inFlight;
+    };
+
+    /**
+     * @brief A cached value and whether it is only being served until a refresh.
+     */
+    template <typename T>
+    struct Lookup {
+      T    value;
+      bool stale;
+    };
+
+    static constexpr types::usize SHARD_COUNT = 16;
+
+    CachePolicy  m_globalPolicy;
+    types::Mutex m_policyMutex;
+
+    types::Array<Shard, SHARD_COUNT> m_shards;
+
+    // Backing store for CacheLocation::Pack; mapped lazily on first lookup.
+    CachePack m_pack;
+
+    // Refreshes for stale entries, at most one per key.
+    types::Mutex                                                 m_refreshMutex;
+    std::condition_variable                                      m_refreshWake;
+    types::UnorderedMap<types::String, types::Fn<types::Unit()>> m_pendingRefreshes;
+    types::u64                                                   m_staleHits       = 0;
+    bool                                                         m_refreshStopping = false;
+    std::thread                                                  m_refreshWorker;
+
+    auto getGlobalPolicy() -> CachePolicy {
+      types::LockGuard lock(m_policyMutex);
+      return m_globalPolicy;
+    }
+
+    auto shardFor(const types::String& key) -> Shard& {
+      return m_shards[std::hash<types::String> {}(key) % SHARD_COUNT];
+    }
+
+    static auto toTimePoint(const types::Option<types::u64>& expires) -> system_clock::time_point {
+      return expires ? system_clock::time_point(seconds(*expires)) : system_clock::time_point::max();
+    }
+
+    // Whether an entry that is no longer fresh may still be served. One that
+    // hasn't reached its expiry is stale because its sources changed.
+    static auto withinStaleWindow(const system_clock::time_point expires, const types::Option<seconds>& staleFor) -> bool {
+      if (!staleFor)
+        return false;
+
+      const system_clock::time_point now = system_clock::now();
+
+      return now < expires || now - expires < *staleFor;
+    }
+
+    // Caller must hold shard.mutex.
+    template <typename T>
+    static auto lookupInMemory(
+      Shard&                           shard,
+      const types::String&             key,
+      const types::Option<types::u64>& fingerprint,
+      const types::Option<seconds>&    staleFor = types::None
+    ) -> types::Option<Lookup<T>> {
+      const auto iter = shard.entries.find(key);
+
+      if (iter == shard.entries.end())
+        return types::None;
+
+      const bool fresh = system_clock::now() < iter->second.expires && (!fingerprint || iter->second.fingerprint == fingerprint);
+
+      if (!fresh && !withinStaleWindow(iter->second.expires, staleFor)) {
+        shard.entries.erase(iter);
+        return types::None;
+      }
+
+      if (*iter->second.type != typeid(T))
+        return types::None;
+
+      return Lookup<T> { .value = *static_cast<const T*>(iter->second.value.get()), .stale = !fresh };
+    }
+
+    template <typename T>
+    auto storeInMemory(
+      const types::String&             key,
+      const T&                         value,
+      const system_clock::time_point   expires,
+      const types::Option<types::u64>& fingerprint
+    ) -> types::Unit {
+      Shard&           shard = shardFor(key);
+      types::LockGuard lock(shard.mutex);
+
+      shard.entries.insert_or_assign(
+        key,
+        MemoryEntry { .value = std::make_shared<const T>(value), .type = &typeid(T), .expires = expires, .fingerprint = fingerprint }
+      );
+    }
+
+    template <typename T>
+    auto resolve(
+      const types::String&                 key,
+      const CachePolicy&                   policy,
+      const types::Option<types::u64>&     fingerprint,
+      const types::Fn<types::Result<T>()>& fetcher
+    ) -> types::Result<T> {
+      // 3. Check on-disk cache (pack file or per-key file)
+      if (types::Option<Lookup<T>> stored = revalidate ? types::None : lookupStored<T>(key, policy.location, fingerprint, policy.staleFor)) {
+        if (stored->stale) {
+          DRAC_TRACE_INSTANT("cache", "hit:stale", key);
+          scheduleRefresh<T>(key, policy, fetcher);
+        } else
+          DRAC_TRACE_INSTANT("cache", "hit:disk", key);
+
+        return std::move(stored->value);
+      }
+
+      // 4. Cache miss: call fetcher
+      DRAC_TRACE_INSTANT("cache", "miss", key);
+
+      types::Result<T> fetchedResult = [&] {
+        DRAC_TRACE_SCOPE_DETAIL("cache", "fetch", key);
+        return fetcher();
+      }();
+
+      if (!fetchedResult)
+        return fetchedResult;
+
+      // 5. Store in cache
+      store(key, *fetchedResult, policy, fingerprint);
+
+      return fetchedResult;
+    }
+
+    // Decodes an on-disk entry and promotes it to the in-memory tier if it is
+    // still valid, or stale but inside @p staleFor.
+    template <typename T>
+    auto lookupStored(
+      const types::String&             key,
+      const CacheLocation              location,
+      const types::Option<types::u64>& fingerprint,
+      const types::Option<seconds>&    staleFor = types::None
+    ) -> types::Option<Lookup<T>> {
+      types::Option<types::String> stored = readStored(key, location);
+
+      if (!stored)
+        return types::None;
+
+      CacheEntry<T> entry;
+
+      if (glz::read_beve(entry, *stored) != glz::error_code::none)
+        return types::None;
+
+      const system_clock::time_point expires = toTimePoint(entry.expires);
+
+      const bool fresh = system_clock::now() < expires && (!fingerprint || entry.fingerprint == fingerprint);
+
+      if (!fresh && !withinStaleWindow(expires, staleFor))
+        return types::None;
+
+      // The stored fingerprint goes with it, so a stale entry stays stale in memory until refreshed.
+      storeInMemory(key, entry.data, expires, entry.fingerprint);
 
-    // BEVE-encoded cache entries (for typed data with automatic serialization)
-    types::UnorderedMap<types::String, types::Pair<types::String, system_clock::time_point>> m_inMemoryCache;
+      return Lookup<T> { .value = std::move(entry.data), .stale = !fresh };
+    }
+
+    // Queues a refresh of `key`; a refresh already queued for it is kept. The job
+    // takes part in the in-flight deduplication getOrSet() uses for misses.
+    template <typename T>
+    auto scheduleRefresh(const types::String& key, const CachePolicy& policy, const types::Fn<types::Result<T>()>& fetcher) -> types::Unit {
+      {
+        types::LockGuard lock(m_refreshMutex);
+
+        m_staleHits++;
+
+        if (m_pendingRefreshes.contains(key))
+          return;
+
+        m_pendingRefreshes.emplace(key, [this, key, policy, fetcher]() -> types::Unit {
+          DRAC_TRACE_SCOPE_DETAIL("cache", "refresh", key);
+
+          // Taken before fetching, so a change made during the fetch still shows up as stale next time.
+          const types::Option<types::u64> fingerprint =
+            policy.sources.empty() ? types::None : types::Some(fingerprintSources(policy.sources));
+
+          Shard& shard = shardFor(key);
+
+          std::promise<types::SharedPointer<const void>> flightPromise;
+
+          // Registered like any other fetch, so a miss while the refresh runs waits for it
+          // instead of calling the fetcher a second time.
+          while (true) {
+            std::unique_lock lock(shard.mutex);
+
+            if (const auto iter = shard.inFlight.find(key); iter != shard.inFlight.end()) {
+              const InFlight flight = iter->second;
+              lock.unlock();
+
+              flight.result.wait();
+              continue;
+            }
+
+            // Whoever held the key may have fetched it already.
+            if (types::Option<Lookup<T>> hit = lookupInMemory<T>(shard, key, fingerprint, policy.staleFor); hit && !hit->stale)
+              return;
+
+            shard.inFlight.emplace(key, InFlight { .result = flightPromise.get_future().share(), .type = &typeid(T) });
+            break;
+          }
+
+          const auto finishFlight = [&]() -> types::Unit {
+            types::LockGuard lock(shard.mutex);
+            shard.inFlight.erase(key);
+          };
+
+          try {
+            types::Result<T> fresh = fetcher();
+
+            if (fresh)
+              store(key, *fresh, policy, fingerprint);
+            else
+              debug_at(fresh.error());
+
+            finishFlight();
+            flightPromise.set_value(std::make_shared<const types::Result<T>>(std::move(fresh)));
+          } catch (const types::Exception& e) {
+            debug_log("Refreshing cache entry '{}' failed: {}", key, e.what());
+
+            finishFlight();
+            flightPromise.set_exception(std::current_exception());
+          } catch (...) {
+            finishFlight();
+            flightPromise.set_exception(std::current_exception());
+            throw;
+          }
+        });
+      }
+
+      m_refreshWake.notify_one();
+    }
+
+    auto refreshLoop() -> types::Unit {
+      std::unique_lock lock(m_refreshMutex);
+
+      while (true) {
+        m_refreshWake.wait(lock, [this] { return m_refreshStopping || !m_pendingRefreshes.empty(); });
+
+        if (m_refreshStopping)
+          return;
+
+        auto job = m_pendingRefreshes.extract(m_pendingRefreshes.begin());
+        lock.unlock();
+
+        job.second();
+
+        lock.lock();
+      }
+    }
+
+    template <typename T>
+    auto store(const types::String& key, const T& value, const CachePolicy& policy, const types::Option<types::u64>& fingerprint) -> types::Unit {
+      types::Option<types::u64> expiryTs;
+      if (policy.ttl.has_value()) {
+        system_clock::time_point now        = system_clock::now();
+        system_clock::time_point expiryTime = now + *policy.ttl;
+
+        expiryTs = duration_cast<seconds>(expiryTime.time_since_epoch()).count();
+      }
+
+      storeInMemory(key, value, toTimePoint(expiryTs), fingerprint);
+
+      if (policy.location != CacheLocation::InMemory) {
+        CacheEntry<T> newEntry {
+          .data        = value,
+          .expires     = expiryTs,
+          .fingerprint = fingerprint
+        };
+
+        std::string binaryBuffer;
+        glz::write_beve(newEntry, binaryBuffer);
+
+        writeStored(key, policy.location, std::move(binaryBuffer));
+      }
+    }
+
+    auto readStored(const types::String& key, const CacheLocation location) -> types::Option<types::String> {
+      if (location == CacheLocation::Pack)
+        return m_pack.get(key);
+
+      if (const types::Option<fs::path> filePath = getCacheFilePath(key, location); filePath && fs::exists(*filePath))
+        if (std::ifstream ifs(*filePath, std::ios::binary); ifs)
+          return std::string((std::istreambuf_iterator<char>(ifs)), {});
+
+      return types::None;
+    }
+
+    auto writeStored(const types::String& key, const CacheLocation location, types::String binaryBuffer) -> types::Unit {
+      if (location == CacheLocation::Pack) {
+        m_pack.put(key, std::move(binaryBuffer));
+        return;
+      }
+
+      if (const types::Option<fs::path> filePath = getCacheFilePath(key, location); filePath && createCacheDir(filePath->parent_path(), location))
+        if (std::ofstream ofs(*filePath, std::ios::binary | std::ios::trunc); ofs.is_open())
+          ofs.write(binaryBuffer.data(), static_cast<std::streamsize>(binaryBuffer.size()));
+    }
+
+    static auto createCacheDir(const fs::path& dir, const CacheLocation location) -> bool {
+      // The temp cache sits under a shared directory, so make sure it is ours before writing into it.
+      if (location == CacheLocation::TempDirectory)
+        return CreatePrivateDirectory(dir).has_value();
 
-    types::Mutex m_cacheMutex;
+      std::error_code errc;
+      fs::create_directories(dir, errc);
+
+      return !errc;
+    }
 
     static auto getCacheFilePath(const types::String& key, const CacheLocation location) -> types::Option<fs::path> {
       using matchit::match, matchit::is, matchit::_;
 
       types::Option<fs::path> cacheDir = types::None;
 
-      if (location == CacheLocation::InMemory)
-        return types::None; // In-memory cache does not have a file path
+      if (location == CacheLocation::InMemory || location == CacheLocation::Pack)
+        return types::None; // In-memory and packed entries do not have a per-key file path
 
       if (location == CacheLocation::TempDirectory)
-        return types::Some(fs::temp_directory_path() / key);
+        return types::Some(getTempCacheDir() / key);
 
       if (location == CacheLocation::Persistent)
         return types::Some(getPersistentCacheDir() / key);
@@ -331,6 +935,35 @@ namespace glz {
     // clang-format on
   };
 
+  template <>
+  struct meta<draconis::utils::types::ResourceUsage> {
+    using T = draconis::utils::types::ResourceUsage;
+
+    static constexpr detail::Object value = object("usedBytes", &T::usedBytes, "totalBytes", &T::totalBytes);
+  };
+
+  template <>
+  struct meta<draconis::utils::types::Battery> {
+    using T = draconis::utils::types::Battery;
+
+    // The remaining time travels as whole seconds.
+    static constexpr auto readTimeRemaining = [](T& self, const draconis::utils::types::Option<draconis::utils::types::i64>& seconds) {
+      self.timeRemaining = seconds.transform([](const draconis::utils::types::i64 count) { return std::chrono::seconds(count); });
+    };
+
+    static constexpr auto writeTimeRemaining = [](const T& self) -> draconis::utils::types::Option<draconis::utils::types::i64> {
+      return self.timeRemaining.transform([](const std::chrono::seconds remaining) { return remaining.count(); });
+    };
+
+    // clang-format off
+    static constexpr detail::Object value = object(
+      "status",        &T::status,
+      "percentage",    &T::percentage,
+      "timeRemaining", custom<readTimeRemaining, writeTimeRemaining>
+    );
+    // clang-format on
+  };
+
   template <>
   struct meta<draconis::utils::types::CPUCores> {
     using T = draconis::utils::types::CPUCores;
@@ -348,7 +981,9 @@ namespace glz {
       "isUp",        &T::isUp,
       "isLoopback",  &T::isLoopback,
       "ipv4Address", &T::ipv4Address,
-      "macAddress",  &T::macAddress
+      "macAddress",  &T::macAddress,
+      "rxBytes",     &T::rxBytes,
+      "txBytes",     &T::txBytes
     );
     // clang-format on
   };
@@ -378,6 +1013,6 @@ namespace glz {
   struct meta<draconis::utils::cache::CacheManager::CacheEntry<Tp>> {
     using T = draconis::utils::cache::CacheManager::CacheEntry<Tp>;
 
-    static constexpr detail::Object value = object("data", &T::data, "expires", &T::expires);
+    static constexpr detail::Object value = object("data", &T::data, "expires", &T::expires, "fingerprint", &T::fingerprint);
   };
 } // namespace glz
@@ -0,0 +1,123 @@
+/**
+ * @file CachePack.hpp
+ * @brief Single-file, memory-mapped key/value store backing CacheLocation::Pack.
+ *
+ * The pack replaces the one-file-per-key layout with a single file that is
+ * mapped into memory once on first use. Lookups are then hash-table probes into
+ * the mapping with no per-key syscalls, and writes are buffered in memory and
+ * committed atomically (write to a temporary file, then rename) on flush().
+ *
+ * On-disk layout (integers in native byte order; the pack is a local cache
+ * and is never shared between machines):
+ * @code
+ * "DRACPACK"  u32 version  u32 entryCount
+ * entryCount × { u32 keyLength  u32 valueLength  key bytes  value bytes }
+ * @endcode
+ */
+
+#pragma once
+
+#include <filesystem> // std::filesystem::path
+
+#include <Drac++/Utils/Types.hpp>
+
+namespace draconis::utils::cache {
+  namespace types = ::draconis::utils::types;
+
+  class CachePack {
+   public:
+    /**
+     * @brief Creates a pack backed by the given file. Nothing is read until first use.
+     * @param path Location of the pack file.
+     * @param privateDirectory Create the pack's directory with CreatePrivateDirectory(),
+     *        for packs that live under a shared temp directory.
+     */
+    explicit CachePack(std::filesystem::path path, bool privateDirectory = false);
+
+    /**
+     * @brief Flushes pending writes and unmaps the file.
+     */
+    ~CachePack();
+
+    CachePack(const CachePack&)                    = delete;
+    CachePack(CachePack&&)                         = delete;
+    auto operator=(const CachePack&) -> CachePack& = delete;
+    auto operator=(CachePack&&) -> CachePack&      = delete;
+
+    /**
+     * @brief Looks up the value stored for a key.
+     * @param key Cache key.
+     * @return Copy of the stored bytes, or None if the key is absent.
+     */
+    [[nodiscard]] auto get(types::StringView key) -> types::Option<types::String>;
+
+    /**
+     * @brief Stores a value, replacing any existing one. Persisted on flush().
+     */
+    auto put(types::StringView key, types::String value) -> types::Unit;
+
+    /**
+     * @brief Removes a key. Persisted on flush().
+     * @details A key that is neither pending nor in the mapped pack is ignored,
+     * so invalidating something that was never cached doesn't rewrite the file.
+     */
+    auto erase(types::StringView key) -> types::Unit;
+
+    /**
+     * @brief Drops every entry and deletes the pack file.
+     * @return true if a pack file was removed.
+     */
+    auto clear() -> bool;
+
+    /**
+     * @brief Atomically writes pending changes to disk.
+     *
+     * @details The current on-disk pack is re-read at flush time, so entries
+     * written by other processes (or other CacheManager instances) since this
+     * pack was mapped are preserved unless this pack overwrote or erased them.
+     * The re-read, merge and rename happen under an exclusive lock on a
+     * `<pack>.lock` sidecar file, so concurrent flushes are serialised rather
+     * than losing each other's entries. If the lock can't be taken, the flush
+     * still goes ahead unlocked.
+     * Does nothing if there are no pending changes.
+     */
+    auto flush() -> types::Result<>;
+
+    /**
+     * @brief Path of the backing pack file.
+     */
+    [[nodiscard]] auto path() const -> const std::filesystem::path&;
+
+   private:
+    std::filesystem::path m_path;
+    bool                  m_privateDirectory;
+
+    // Read-only view of the mapped file, indexed by key.
+    types::UnorderedMap<types::String, types::StringView> m_index;
+    types::RawPointer                                      m_mapping    = nullptr;
+    types::usize                                           m_mappedSize = 0;
+    bool                                                   m_loaded     = false;
+
+    // Unflushed changes. None marks an erased key.
+    types::UnorderedMap<types::String, types::Option<types::String>> m_pending;
+
+    types::Mutex m_mutex;
+
+    auto ensureLoaded() -> types::Unit;
+    auto unmap() -> types::Unit;
+  };
+
+  /**
+   * @brief Creates a cache directory that only the current user can use.
+   *
+   * @details The temp cache lives under a world-writable directory, where
+   * another user could create it first. On POSIX the directory must be a real
+   * directory (not a symlink) owned by the effective user; it is then
+   * restricted to mode 0700. On Windows the temp directory is already
+   * per-user, so the directory is only created.
+   *
+   * @param dir Directory to create if missing.
+   * @return An error if it can't be created or belongs to someone else.
+   */
+  auto CreatePrivateDirectory(const std::filesystem::path& dir) -> types::Result<>;
+} // namespace draconis::utils::cache
@@ -29,6 +29,8 @@ namespace draconis::utils::types {
       : name(std::move(name)),
         version(std::move(version)),
         id(std::move(identifier)) {}
+
+    auto operator==(const OSInfo&) const -> bool = default;
   };
 
   struct DiskInfo {
@@ -39,6 +41,24 @@ namespace draconis::utils::types {
     u64    totalBytes;    // Total capacity
     u64    usedBytes;     // Used space
     bool   isSystemDrive; // Whether this is the system/boot drive
+
+    auto operator==(const DiskInfo&) const -> bool = default;
+  };
+
+  /**
+   * @struct GPUInfo
+   * @brief One display controller and, where the driver exposes them, its live counters.
+   */
+  struct GPUInfo {
+    String      pciAddress;     ///< PCI address (e.g., "0000:03:00.0").
+    String      vendor;         ///< Short vendor name (e.g., "AMD", "NVIDIA").
+    String      model;          ///< Cleaned-up model name (e.g., "AMD Radeon RX 7900 XTX").
+    String      driver;         ///< Kernel driver bound to the device (e.g., "amdgpu"), empty if none.
+    Option<u64> vramTotalBytes; ///< Dedicated video memory.
+    Option<u64> vramUsedBytes;  ///< Video memory in use at the time of the read.
+    Option<f64> busyPercent;    ///< Share of time the GPU was busy, 0-100.
+
+    auto operator==(const GPUInfo&) const -> bool = default;
   };
 
   /**
@@ -55,6 +75,8 @@ namespace draconis::utils::types {
 
     ResourceUsage(const u64& usedBytes, const u64& totalBytes)
       : usedBytes(usedBytes), totalBytes(totalBytes) {}
+
+    auto operator==(const ResourceUsage&) const -> bool = default;
   };
 
   /**
@@ -72,6 +94,8 @@ namespace draconis::utils::types {
 
     MediaInfo(Option<String> title, Option<String> artist)
       : title(std::move(title)), artist(std::move(artist)) {}
+
+    auto operator==(const MediaInfo&) const -> bool = default;
   };
 
   /**
@@ -88,6 +112,63 @@ namespace draconis::utils::types {
 
     CPUCores(const usize& physical, const usize& logical)
       : physical(physical), logical(logical) {}
+
+    auto operator==(const CPUCores&) const -> bool = default;
+  };
+
+  /**
+   * @struct CPUTopology
+   * @brief How the online logical CPUs map onto cores, packages and NUMA nodes.
+   */
+  struct CPUTopology {
+    /// Core type on hybrid (big.LITTLE, P/E-core) designs.
+    enum class CoreKind : u8 {
+      Uniform,     ///< Not a hybrid design, or the kernel doesn't say.
+      Performance, ///< Big / P-core.
+      Efficiency,  ///< Little / E-core.
+    };
+
+    struct LogicalCPU {
+      u32         id;              ///< Kernel CPU number (the N in cpuN).
+      u32         package;         ///< Physical package (socket).
+      u32         core;            ///< Core within the package; SMT siblings share it.
+      Option<u32> node;            ///< NUMA node, if the kernel was built with NUMA.
+      Option<u64> maxFrequencyKHz; ///< Highest frequency the core can run at.
+      CoreKind    kind;            ///< Core type on hybrid designs.
+
+      auto operator==(const LogicalCPU&) const -> bool = default;
+    };
+
+    usize           packages         = 0; ///< Populated sockets.
+    usize           physicalCores    = 0; ///< Distinct (package, core) pairs.
+    usize           numaNodes        = 0; ///< NUMA nodes with at least one online CPU; 0 without NUMA.
+    usize           performanceCores = 0; ///< Physical P-cores; 0 unless hybrid.
+    usize           efficiencyCores  = 0; ///< Physical E-cores; 0 unless hybrid.
+    Vec<LogicalCPU> cpus;                 ///< Online CPUs, ordered by id.
+
+    auto operator==(const CPUTopology&) const -> bool = default;
+  };
+
+  /**
+   * @struct CPUTimes
+   * @brief Cumulative CPU time since boot, in clock ticks.
+   */
+  struct CPUTimes {
+    u64 busy = 0; ///< user + nice + system + irq + softirq + steal.
+    u64 idle = 0; ///< idle + iowait.
+
+    auto operator==(const CPUTimes&) const -> bool = default;
+  };
+
+  /**
+   * @struct CPULoad
+   * @brief Share of time the CPUs were busy over one sampling period.
+   */
+  struct CPULoad {
+    f64      total = 0.0; ///< All CPUs together, 0-100.
+    Vec<f64> perCpu;      ///< Indexed by CPU number, 0-100; offline CPUs read 0.
+
+    auto operator==(const CPULoad&) const -> bool = default;
   };
 
   /**
@@ -102,7 +183,9 @@ namespace draconis::utils::types {
     struct Resolution {
       usize width;  ///< Width in pixels.
       usize height; ///< Height in pixels.
-    } resolution;   ///< Resolution in pixels.
+
+      auto operator==(const Resolution&) const -> bool = default;
+    } resolution; ///< Resolution in pixels.
 
     f64  refreshRate; ///< Refresh rate in Hz.
     bool isPrimary;   ///< Whether the display is the primary display.
@@ -111,6 +194,8 @@ namespace draconis::utils::types {
 
     DisplayInfo(const usize& identifier, const Resolution& resolution, const f64& refreshRate, const bool& isPrimary)
       : id(identifier), resolution(resolution), refreshRate(refreshRate), isPrimary(isPrimary) {}
+
+    auto operator==(const DisplayInfo&) const -> bool = default;
   };
 
   /**
@@ -124,11 +209,15 @@ namespace draconis::utils::types {
     Option<String> macAddress;  ///< Network interface MAC address.
     bool           isUp;        ///< Whether the network interface is up.
     bool           isLoopback;  ///< Whether the network interface is a loopback interface.
+    Option<u64>    rxBytes;     ///< Bytes received since the interface came up, where the platform reports it.
+    Option<u64>    txBytes;     ///< Bytes transmitted since the interface came up, where the platform reports it.
 
     NetworkInterface() = default;
 
     NetworkInterface(String& name, Option<String> ipv4Address, Option<String> ipv6Address, Option<String> macAddress, bool isUp, bool isLoopback)
       : name(std::move(name)), ipv4Address(std::move(ipv4Address)), ipv6Address(std::move(ipv6Address)), macAddress(std::move(macAddress)), isUp(isUp), isLoopback(isLoopback) {}
+
+    auto operator==(const NetworkInterface&) const -> bool = default;
   };
 
   /**
@@ -151,6 +240,8 @@ namespace draconis::utils::types {
 
     Battery(const Status& status, const Option<u8> percentage, Option<std::chrono::seconds> timeRemaining)
       : status(status), percentage(percentage), timeRemaining(timeRemaining) {}
+
+    auto operator==(const Battery&) const -> bool = default;
   };
 
   /**
@@ -2,9 +2,12 @@
 
 #ifdef _WIN32
   #include <stdlib.h> // NOLINT(*-deprecated-headers)
+#else
+  #include <unistd.h> // geteuid
 #endif
 
-#include <cstdlib>
+#include <cstdlib>    // std::getenv
+#include <filesystem> // std::filesystem::{current_path, path, temp_directory_path}
 
 #include "Error.hpp"
 #include "Types.hpp"
@@ -113,4 +116,137 @@ namespace draconis::utils::env {
     unsetenv(name);
   }
 #endif
+
+  /**
+   * @brief The variables the readouts and path helpers consult, and the
+   * directories derived from them, as they were when the process started.
+   *
+   * @details Taken once by GetEnvSnapshot(). Cache lookups, plugin and config
+   * path helpers and the session readouts (shell, desktop, display server) all
+   * read from here, so `environ` is scanned and the paths are built once per
+   * process rather than on every call. Later SetEnv()/UnsetEnv() calls are not
+   * reflected; use GetEnv() for anything expected to change at runtime.
+   */
+  struct EnvSnapshot {
+    types::Option<types::String> home;
+    types::Option<types::String> user;
+    types::Option<types::String> logname;
+    types::Option<types::String> shell;
+    types::Option<types::String> xdgConfigHome;
+    types::Option<types::String> xdgCacheHome;
+    types::Option<types::String> xdgDataHome;
+    types::Option<types::String> xdgCurrentDesktop;
+    types::Option<types::String> xdgSessionType;
+    types::Option<types::String> desktopSession;
+    types::Option<types::String> waylandDisplay;
+    types::Option<types::String> display;
+    types::Option<types::String> cargoHome;
+#ifdef _WIN32
+    types::Option<types::String> localAppData;
+    types::Option<types::String> appData;
+    types::Option<types::String> userProfile;
+    types::Option<types::String> msystem;
+#endif
+
+    std::filesystem::path persistentCacheDir; ///< CacheManager's persistent store, e.g. ~/.cache/draconis++
+    std::filesystem::path tempCacheDir;       ///< CacheManager's TempDirectory and Pack store, e.g. /tmp/draconis++-1000 (per user; %TEMP% is per user already on Windows)
+    std::filesystem::path configDir;          ///< $XDG_CONFIG_HOME/draconis++ or ~/.config/draconis++; %LOCALAPPDATA%\draconis++ on Windows
+    std::filesystem::path cacheDir;           ///< $XDG_CACHE_HOME/draconis++ or ~/.cache/draconis++; config dir + "cache" without either
+    std::filesystem::path dataDir;            ///< $XDG_DATA_HOME/draconis++ or ~/.local/share/draconis++; config dir + "data" without either
+  };
+
+  namespace detail {
+    inline auto Capture(const types::PCStr name) -> types::Option<types::String> {
+      if (types::Result<types::String> value = GetEnv(name))
+        return std::move(*value);
+
+      return types::None;
+    }
+
+    inline auto TakeEnvSnapshot() -> EnvSnapshot {
+      namespace fs = std::filesystem;
+
+      EnvSnapshot env;
+
+      env.home              = Capture("HOME");
+      env.user              = Capture("USER");
+      env.logname           = Capture("LOGNAME");
+      env.shell             = Capture("SHELL");
+      env.xdgConfigHome     = Capture("XDG_CONFIG_HOME");
+      env.xdgCacheHome      = Capture("XDG_CACHE_HOME");
+      env.xdgDataHome       = Capture("XDG_DATA_HOME");
+      env.xdgCurrentDesktop = Capture("XDG_CURRENT_DESKTOP");
+      env.xdgSessionType    = Capture("XDG_SESSION_TYPE");
+      env.desktopSession    = Capture("DESKTOP_SESSION");
+      env.waylandDisplay    = Capture("WAYLAND_DISPLAY");
+      env.display           = Capture("DISPLAY");
+      env.cargoHome         = Capture("CARGO_HOME");
+
+#ifdef _WIN32
+      env.localAppData = Capture("LOCALAPPDATA");
+      env.appData      = Capture("APPDATA");
+      env.userProfile  = Capture("USERPROFILE");
+      env.msystem      = Capture("MSYSTEM");
+
+      env.persistentCacheDir = env.localAppData
+        ? fs::path(*env.localAppData) / "draconis++" / "cache"
+        : fs::path(env.userProfile.value_or(".")) / ".cache" / "draconis++";
+
+      env.configDir = env.localAppData ? fs::path(*env.localAppData) / "draconis++"
+        : env.userProfile              ? fs::path(*env.userProfile) / ".config" / "draconis++"
+                                       : fs::current_path();
+
+      env.cacheDir = env.localAppData ? fs::path(*env.localAppData) / "draconis++" / "cache" : env.configDir / "cache";
+      env.dataDir  = env.localAppData ? fs::path(*env.localAppData) / "draconis++" / "data" : env.configDir / "data";
+#else
+  #ifdef __APPLE__
+      env.persistentCacheDir = fs::path(env.home.value_or(".")) / "Library" / "Caches" / "draconis++";
+  #else
+      env.persistentCacheDir = fs::path(env.home.value_or(".")) / ".cache" / "draconis++";
+  #endif
+
+      env.configDir = env.xdgConfigHome ? fs::path(*env.xdgConfigHome) / "draconis++"
+        : env.home                      ? fs::path(*env.home) / ".config" / "draconis++"
+                                        : fs::current_path();
+
+      env.cacheDir = env.xdgCacheHome ? fs::path(*env.xdgCacheHome) / "draconis++"
+        : env.home                    ? fs::path(*env.home) / ".cache" / "draconis++"
+                                      : env.configDir / "cache";
+
+      env.dataDir = env.xdgDataHome ? fs::path(*env.xdgDataHome) / "draconis++"
+        : env.home                  ? fs::path(*env.home) / ".local" / "share" / "draconis++"
+                                    : env.configDir / "data";
+#endif
+
+#ifdef _WIN32
+      env.tempCacheDir = fs::temp_directory_path() / "draconis++";
+#else
+      // The system temp directory is shared, so keep users out of each other's caches.
+      env.tempCacheDir = fs::temp_directory_path() / ("draconis++-" + std::to_string(geteuid()));
+#endif
+
+      return env;
+    }
+  } // namespace detail
+
+  /**
+   * @brief The process-wide environment snapshot, taken on first call
+   * @details Call it early in main() so the snapshot reflects the environment
+   * the process was started with, before anything calls SetEnv().
+   */
+  [[nodiscard]] inline auto GetEnvSnapshot() -> const EnvSnapshot& {
+    static const EnvSnapshot Snapshot = detail::TakeEnvSnapshot();
+
+    return Snapshot;
+  }
+
+  /**
+   * @brief A snapshot variable in the form GetEnv() returns it
+   */
+  [[nodiscard]] inline auto ToResult(const types::Option<types::String>& value) -> types::Result<types::String> {
+    if (!value)
+      ERR(NotFound, "Environment variable not found");
+
+    return *value;
+  }
 } // namespace draconis::utils::env
@@ -4,6 +4,14 @@
  *
  * This header defines the TranslationManager class which handles loading
  * translation files and providing localized strings for the application.
+ *
+ * Every lookup returns a view into the static tables in TranslationData.hpp.
+ * Literal keys can be resolved at compile time with the `_key` suffix, which
+ * turns an unknown key into a build error and a lookup into an array load:
+ *
+ * @code{.cpp}
+ * StringView label = _("uptime"_key);
+ * @endcode
  */
 
 #pragma once
@@ -25,6 +33,26 @@ namespace draconis::utils::localization {
     String fallback;    ///< Fallback language code (usually "en")
   };
 
+  /**
+   * @brief A translation key resolved to its index in the translation tables.
+   */
+  struct TranslationKey {
+    usize index;
+  };
+
+  /**
+   * @brief Resolves a literal translation key at compile time.
+   * @details Fails to compile if no language table contains the key.
+   */
+  consteval auto operator""_key(const PCStr key, const usize length) -> TranslationKey {
+    const Option<usize> index = data::FindKeyIndex(StringView(key, length));
+
+    if (!index)
+      throw "unknown translation key"; // Not a constant expression, so this is a compile error
+
+    return TranslationKey { .index = *index };
+  }
+
   /**
    * @brief Manages translations for the application.
    *
@@ -60,16 +88,26 @@ namespace draconis::utils::localization {
     /**
      * @brief Gets a localized string by key.
      * @param key The translation key
-     * @return The localized string, or the key itself if not found
+     * @return The localized string, or the key itself if not found (so the
+     *         view is only as long-lived as @p key in that case)
      */
-    auto get(StringView key) const -> String;
+    auto get(StringView key) const -> StringView;
+
+    /**
+     * @brief Gets a localized string by compile-time resolved key.
+     * @param key The translation key, e.g. `"uptime"_key`
+     * @return The localized string
+     */
+    [[nodiscard]] auto get(const TranslationKey key) const -> StringView {
+      return m_labels[key.index];
+    }
 
     /**
      * @brief Gets a localized string with fallback to English.
      * @param key The translation key
      * @return The localized string, or English translation, or key if not found
      */
-    auto getWithFallback(StringView key) const -> String;
+    auto getWithFallback(StringView key) const -> StringView;
 
     /**
      * @brief Checks if a translation key exists.
@@ -100,29 +138,14 @@ namespace draconis::utils::localization {
    private:
     /**
      * @brief Loads translation data for a specific language.
+     * @details Resolves every label for the language once, so lookups never search.
      * @param languageCode The language code to load
      * @return true if successfully loaded, false otherwise
      */
     auto loadTranslations(StringView languageCode) -> bool;
 
-    /**
-     * @brief Computes hash for a string key (same as TranslationEntry::hash).
-     * @param str The string to hash
-     * @return The computed hash
-     */
-    static constexpr auto hashKey(StringView str) -> u64 {
-      u64 hash = 0;
-
-      for (char character : str)
-        hash = (hash * 31) + static_cast<u8>(character);
-
-      return hash;
-    }
-
-    String                                        m_currentLanguage;     ///< Current language code
-    const std::array<data::TranslationEntry, 19>* m_englishTranslations; ///< English translations
-    const std::array<data::TranslationEntry, 19>* m_currentTranslations; ///< Current language translations
-    const data::TranslationMap<19>*               m_currentMap;          ///< Current language hash map for fast lookups
+    String                                     m_currentLanguage; ///< Current language code
+    Array<StringView, data::TRANSLATION_COUNT> m_labels {};       ///< Current language's value for each key, falling back to English
   };
 
   /**
@@ -135,7 +158,16 @@ namespace draconis::utils::localization {
    * @param key The translation key
    * @return The localized string
    */
-  inline auto _(StringView key) -> String {
+  inline auto _(StringView key) -> StringView {
+    return GetTranslationManager().get(key);
+  }
+
+  /**
+   * @brief Convenience function to get a localized string by compile-time resolved key.
+   * @param key The translation key, e.g. `"uptime"_key`
+   * @return The localized string
+   */
+  inline auto _(const TranslationKey key) -> StringView {
     return GetTranslationManager().get(key);
   }
 
@@ -144,10 +176,18 @@ namespace draconis::utils::localization {
    * @param key The translation key
    * @return The localized string with fallback
    */
-  inline auto _f(StringView key) -> String { // NOLINT(readability-identifier-naming)
+  inline auto _f(StringView key) -> StringView { // NOLINT(readability-identifier-naming)
     return GetTranslationManager().getWithFallback(key);
   }
 
+  /**
+   * @brief Convenience function to get a localized string by compile-time resolved key.
+   * @details Resolved labels already fall back to English, so this is the same as _().
+   */
+  inline auto _f(const TranslationKey key) -> StringView { // NOLINT(readability-identifier-naming)
+    return GetTranslationManager().get(key);
+  }
+
   /**
    * @brief Convenience function to get a formatted localized string.
    * @tparam Args Format argument types
@@ -171,4 +211,24 @@ namespace draconis::utils::localization {
   inline auto _format_f(StringView key, Args&&... args) -> String { // NOLINT(readability-identifier-naming)
     return std::vformat(GetTranslationManager().getWithFallback(key), std::make_format_args(std::forward<Args>(args)...));
   }
+
+  /**
+   * @brief Convenience function to get a formatted localized string by compile-time resolved key.
+   * @tparam Args Format argument types
+   * @param key The translation key, e.g. `"hello"_key`
+   * @param args Format arguments
+   * @return The formatted localized string
+   */
+  template <typename... Args>
+  inline auto _format(const TranslationKey key, Args&&... args) -> String { // NOLINT(readability-identifier-naming)
+    return std::vformat(GetTranslationManager().get(key), std::make_format_args(std::forward<Args>(args)...));
+  }
+
+  /**
+   * @brief Same as the TranslationKey overload of _format(); resolved labels already fall back to English.
+   */
+  template <typename... Args>
+  inline auto _format_f(const TranslationKey key, Args&&... args) -> String { // NOLINT(readability-identifier-naming)
+    return std::vformat(GetTranslationManager().get(key), std::make_format_args(std::forward<Args>(args)...));
+  }
 } // namespace draconis::utils::localization
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>     // std::atomic
 #include <chrono>     // std::chrono::{days, floor, seconds, system_clock}
 #include <ctime>      // localtime_r/s, strftime, time_t, tm
 #include <filesystem> // std::filesystem::path
@@ -136,6 +137,17 @@ namespace draconis::utils::logging {
     Error,
   };
 
+#ifndef DRAC_MIN_LOG_LEVEL
+  #define DRAC_MIN_LOG_LEVEL 0
+#endif
+
+  /**
+   * @brief Lowest log level compiled into this build (`-Dmin_log_level`).
+   * @details Logging macros below this level expand to a discarded `if constexpr`
+   *          branch, so neither the call nor its arguments exist in the binary.
+   */
+  inline constexpr LogLevel MIN_LOG_LEVEL = static_cast<LogLevel>(DRAC_MIN_LOG_LEVEL);
+
   /**
    * @brief Gets a reference to the shared log level pointer storage.
    * @details Using a function with static local avoids global variable warnings
@@ -195,6 +207,14 @@ namespace draconis::utils::logging {
       GetLocalLogLevel() = level;
   }
 
+  /**
+   * @brief Checks whether a record at the given level would be written.
+   * @details The logging macros call this before evaluating any arguments.
+   */
+  inline auto ShouldLog(const LogLevel level) -> bool {
+    return level >= MIN_LOG_LEVEL && level >= GetRuntimeLogLevel();
+  }
+
   /**
    * @struct Style
    * @brief Options for text styling with ANSI codes.
@@ -397,6 +417,34 @@ namespace draconis::utils::logging {
     return { TsBuffer.data(), 8 };
   }
 
+  /**
+   * @brief Hook that takes ownership of a finished log record.
+   * @details Installed by StartAsyncLogging() (AsyncLogging.hpp). Returns
+   *          false if it didn't take the record, which is then written
+   *          synchronously as usual.
+   */
+  using LogSinkFn = bool (*)(LogLevel level, types::String& record);
+
+  /**
+   * @brief Gets the active log sink for this module, or nullptr to write synchronously.
+   */
+  inline auto GetLogSinkStorage() -> std::atomic<LogSinkFn>& {
+    static std::atomic<LogSinkFn> Sink = nullptr;
+    return Sink;
+  }
+
+  /**
+   * @brief Hands a complete record (including its trailing reset/newline) to the sink, or writes it.
+   */
+  inline auto EmitLogRecord(const LogLevel level, types::String record) -> void {
+    if (const LogSinkFn sink = GetLogSinkStorage().load(std::memory_order_acquire))
+      if (sink(level, record))
+        return;
+
+    const types::LockGuard lock(GetLogMutex());
+    WriteToConsole(record, ShouldUseStderr(level));
+  }
+
   /**
    * @brief Logs a message with the specified log level, source location, and format string.
    * @tparam Args Parameter pack for format arguments.
@@ -433,24 +481,25 @@ namespace draconis::utils::logging {
     const types::String fullDebugLine = std::format("{}{}", LogLevelConst::DEBUG_LINE_PREFIX, fileLine);
 #endif
 
-    {
-      const types::LockGuard lock(GetLogMutex());
+    // One record per message, so it reaches the terminal (or the async sink) in a single write.
+    types::String record = std::format(
+      LogLevelConst::LOG_FORMAT,
+      coloredTimestamp,
+      GetLevelInfo().at(static_cast<types::usize>(level)),
+      message
+    );
 
-      Println(
-        level,
-        LogLevelConst::LOG_FORMAT,
-        coloredTimestamp,
-        GetLevelInfo().at(static_cast<types::usize>(level)),
-        message
-      );
+    record += '\n';
 
 #ifndef NDEBUG
-      Print(level, Stylize(fullDebugLine, { .color = LogColor::White, .italic = true }));
-      Println(level, LogLevelConst::RESET_CODE);
+    record += Stylize(fullDebugLine, { .color = LogColor::White, .italic = true });
+    record += LogLevelConst::RESET_CODE;
+    record += '\n';
 #else
-      Print(level, LogLevelConst::RESET_CODE);
+    record += LogLevelConst::RESET_CODE;
 #endif
-    }
+
+    EmitLogRecord(level, std::move(record));
   }
 
   template <typename ErrorType>
@@ -487,24 +536,35 @@ namespace draconis::utils::logging {
 #endif
   }
 
-#define debug_at(error_obj) ::draconis::utils::logging::LogError(::draconis::utils::logging::LogLevel::Debug, error_obj)
-#define info_at(error_obj)  ::draconis::utils::logging::LogError(::draconis::utils::logging::LogLevel::Info, error_obj)
-#define warn_at(error_obj)  ::draconis::utils::logging::LogError(::draconis::utils::logging::LogLevel::Warn, error_obj)
-#define error_at(error_obj) ::draconis::utils::logging::LogError(::draconis::utils::logging::LogLevel::Error, error_obj)
-
 #ifdef NDEBUG
-  #define debug_log(fmt, ...) ::draconis::utils::logging::LogImpl(::draconis::utils::logging::LogLevel::Debug, fmt __VA_OPT__(, ) __VA_ARGS__)
-  #define info_log(fmt, ...)  ::draconis::utils::logging::LogImpl(::draconis::utils::logging::LogLevel::Info, fmt __VA_OPT__(, ) __VA_ARGS__)
-  #define warn_log(fmt, ...)  ::draconis::utils::logging::LogImpl(::draconis::utils::logging::LogLevel::Warn, fmt __VA_OPT__(, ) __VA_ARGS__)
-  #define error_log(fmt, ...) ::draconis::utils::logging::LogImpl(::draconis::utils::logging::LogLevel::Error, fmt __VA_OPT__(, ) __VA_ARGS__)
+  #define DRAC_LOG_LOCATION
 #else
-  #define debug_log(fmt, ...) \
-    ::draconis::utils::logging::LogImpl(::draconis::utils::logging::LogLevel::Debug, std::source_location::current(), fmt __VA_OPT__(, ) __VA_ARGS__)
-  #define info_log(fmt, ...) \
-    ::draconis::utils::logging::LogImpl(::draconis::utils::logging::LogLevel::Info, std::source_location::current(), fmt __VA_OPT__(, ) __VA_ARGS__)
-  #define warn_log(fmt, ...) \
-    ::draconis::utils::logging::LogImpl(::draconis::utils::logging::LogLevel::Warn, std::source_location::current(), fmt __VA_OPT__(, ) __VA_ARGS__)
-  #define error_log(fmt, ...) \
-    ::draconis::utils::logging::LogImpl(::draconis::utils::logging::LogLevel::Error, std::source_location::current(), fmt __VA_OPT__(, ) __VA_ARGS__)
+  #define DRAC_LOG_LOCATION std::source_location::current(),
 #endif
+
+// Levels below MIN_LOG_LEVEL are discarded at compile time. Above it, the runtime
+// level is checked before the arguments are evaluated, so a disabled call costs one branch.
+#define DRAC_LOG_AT_LEVEL(level, fmt, ...)                                                            \
+  do {                                                                                                \
+    if constexpr ((level) >= ::draconis::utils::logging::MIN_LOG_LEVEL)                               \
+      if (::draconis::utils::logging::ShouldLog(level)) [[unlikely]]                                  \
+        ::draconis::utils::logging::LogImpl(level, DRAC_LOG_LOCATION fmt __VA_OPT__(, ) __VA_ARGS__); \
+  } while (false)
+
+#define DRAC_LOG_ERROR_AT_LEVEL(level, error_obj)                       \
+  do {                                                                  \
+    if constexpr ((level) >= ::draconis::utils::logging::MIN_LOG_LEVEL) \
+      if (::draconis::utils::logging::ShouldLog(level)) [[unlikely]]    \
+        ::draconis::utils::logging::LogError(level, error_obj);         \
+  } while (false)
+
+#define debug_at(error_obj) DRAC_LOG_ERROR_AT_LEVEL(::draconis::utils::logging::LogLevel::Debug, error_obj)
+#define info_at(error_obj)  DRAC_LOG_ERROR_AT_LEVEL(::draconis::utils::logging::LogLevel::Info, error_obj)
+#define warn_at(error_obj)  DRAC_LOG_ERROR_AT_LEVEL(::draconis::utils::logging::LogLevel::Warn, error_obj)
+#define error_at(error_obj) DRAC_LOG_ERROR_AT_LEVEL(::draconis::utils::logging::LogLevel::Error, error_obj)
+
+#define debug_log(fmt, ...) DRAC_LOG_AT_LEVEL(::draconis::utils::logging::LogLevel::Debug, fmt __VA_OPT__(, ) __VA_ARGS__)
+#define info_log(fmt, ...)  DRAC_LOG_AT_LEVEL(::draconis::utils::logging::LogLevel::Info, fmt __VA_OPT__(, ) __VA_ARGS__)
+#define warn_log(fmt, ...)  DRAC_LOG_AT_LEVEL(::draconis::utils::logging::LogLevel::Warn, fmt __VA_OPT__(, ) __VA_ARGS__)
+#define error_log(fmt, ...) DRAC_LOG_AT_LEVEL(::draconis::utils::logging::LogLevel::Error, fmt __VA_OPT__(, ) __VA_ARGS__)
 } // namespace draconis::utils::logging
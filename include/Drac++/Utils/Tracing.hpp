@@ -0,0 +1,142 @@
+/**
+ * @file Tracing.hpp
+ * @brief Lightweight scoped-span tracing with Chrome trace-event export.
+ *
+ * Spans and instant events are only recorded when the library is built with
+ * `-Dtracing=enabled` (DRAC_ENABLE_TRACING) *and* tracing has been started at
+ * runtime with Start(). When the option is disabled the DRAC_TRACE_* macros
+ * expand to nothing and their arguments are never evaluated; when it is
+ * enabled but tracing hasn't been started, each macro costs one relaxed
+ * atomic load.
+ *
+ * The file written by WriteChromeTrace() uses the Chrome trace-event JSON
+ * format and can be opened in Perfetto (https://ui.perfetto.dev) or
+ * chrome://tracing.
+ *
+ * @code{.cpp}
+ * auto GetKernelVersion(CacheManager& cache) -> Result<String> {
+ *   DRAC_TRACE_SCOPE("system", "GetKernelVersion");
+ *   ...
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#if DRAC_ENABLE_TRACING
+  #include <atomic>     // std::atomic
+  #include <filesystem> // std::filesystem::path
+
+  #include "Types.hpp"
+
+namespace draconis::utils::tracing {
+  namespace types = ::draconis::utils::types;
+
+  namespace detail {
+    inline std::atomic<bool> Active = false;
+
+    /**
+     * @brief Nanoseconds since tracing was started, on a monotonic clock.
+     */
+    auto Now() noexcept -> types::u64;
+
+    auto RecordComplete(
+      types::StringView name,
+      types::StringView category,
+      types::String     detail,
+      types::u64        startNs,
+      types::u64        endNs
+    ) -> types::Unit;
+  } // namespace detail
+
+  /**
+   * @brief Whether events are currently being recorded.
+   */
+  [[nodiscard]] inline auto IsActive() noexcept -> bool {
+    return detail::Active.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Discards any previously recorded events and starts recording.
+   */
+  auto Start() -> types::Unit;
+
+  /**
+   * @brief Stops recording. Already recorded events are kept until the next Start().
+   */
+  auto Stop() -> types::Unit;
+
+  /**
+   * @brief Records a zero-duration event on the calling thread.
+   * @param name Event name.
+   * @param category Event category (shown as "cat" in the trace viewer).
+   * @param detail Free-form text attached as the event's "detail" argument.
+   */
+  auto RecordInstant(types::StringView name, types::StringView category, types::StringView detail = {}) -> types::Unit;
+
+  /**
+   * @brief Writes every recorded event as a Chrome trace-event JSON file.
+   * @param path Destination file; overwritten if it exists.
+   */
+  auto WriteChromeTrace(const std::filesystem::path& path) -> types::Result<>;
+
+  /**
+   * @brief RAII span: records a complete ("X") event covering its lifetime.
+   *
+   * @details @p name and @p category are not copied until the span ends, so
+   * they must outlive it (string literals or strings owned by the caller).
+   */
+  class Span {
+   public:
+    Span(const types::StringView name, const types::StringView category) noexcept
+      : m_name(name), m_category(category), m_active(IsActive()), m_startNs(m_active ? detail::Now() : 0) {}
+
+    Span(const types::StringView name, const types::StringView category, types::String detail) noexcept
+      : Span(name, category) {
+      m_detail = std::move(detail);
+    }
+
+    ~Span() {
+      if (m_active)
+        detail::RecordComplete(m_name, m_category, std::move(m_detail), m_startNs, detail::Now());
+    }
+
+    Span(const Span&)                    = delete;
+    Span(Span&&)                         = delete;
+    auto operator=(const Span&) -> Span& = delete;
+    auto operator=(Span&&) -> Span&      = delete;
+
+   private:
+    types::StringView m_name;
+    types::StringView m_category;
+    types::String     m_detail;
+    bool              m_active;
+    types::u64        m_startNs;
+  };
+} // namespace draconis::utils::tracing
+
+  #define DRAC_TRACE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+  #define DRAC_TRACE_CONCAT(lhs, rhs)      DRAC_TRACE_CONCAT_IMPL(lhs, rhs)
+
+  #define DRAC_TRACE_SCOPE(category, name) \
+    const ::draconis::utils::tracing::Span DRAC_TRACE_CONCAT(dracTraceSpan, __LINE__)(name, category)
+
+  // `detail` is only evaluated while tracing is active.
+  #define DRAC_TRACE_SCOPE_DETAIL(category, name, detail)                                 \
+    const ::draconis::utils::tracing::Span DRAC_TRACE_CONCAT(dracTraceSpan, __LINE__)(    \
+      name,                                                                               \
+      category,                                                                           \
+      ::draconis::utils::tracing::IsActive() ? ::draconis::utils::types::String(detail)   \
+                                             : ::draconis::utils::types::String()         \
+    )
+
+  #define DRAC_TRACE_INSTANT(category, name, detail)                         \
+    do {                                                                     \
+      if (::draconis::utils::tracing::IsActive())                            \
+        ::draconis::utils::tracing::RecordInstant(name, category, detail);   \
+    } while (false)
+#else
+  #define DRAC_TRACE_SCOPE(category, name)                static_cast<void>(0)
+  #define DRAC_TRACE_SCOPE_DETAIL(category, name, detail) static_cast<void>(0)
+  #define DRAC_TRACE_INSTANT(category, name, detail)      static_cast<void>(0)
+#endif
@@ -22,24 +22,15 @@ namespace draconis::utils::localization::data {
 
     constexpr TranslationEntry(types::StringView key, types::StringView value)
       : key(key), value(value) {}
-
-    // Compile-time hash for key
-    static constexpr auto hash(types::StringView str) -> types::u64 {
-      types::u64 hash = 0;
-
-      for (char character : str)
-        hash = (hash * 31) + static_cast<types::u8>(character);
-
-      return hash;
-    }
-
-    [[nodiscard]] constexpr auto keyHash() const -> types::u64 {
-      return hash(key);
-    }
   };
 
+  /**
+   * @brief Number of keys every language table provides.
+   */
+  constexpr types::usize TRANSLATION_COUNT = 19;
+
   // clang-format off
-  constexpr types::Array<TranslationEntry, 19> ENGLISH_TRANSLATIONS = {{
+  constexpr types::Array<TranslationEntry, TRANSLATION_COUNT> ENGLISH_TRANSLATIONS = {{
     {      "hello", "Hello {0}!" },
     {       "date",       "Date" },
     {    "weather",    "Weather" },
@@ -63,7 +54,7 @@ namespace draconis::utils::localization::data {
   // clang-format on
 
   // clang-format off
-  constexpr types::Array<TranslationEntry, 19> SPANISH_TRANSLATIONS = {{
+  constexpr types::Array<TranslationEntry, TRANSLATION_COUNT> SPANISH_TRANSLATIONS = {{
     {      "hello",          "¡Hola {0}!" },
     {       "date",               "Fecha" },
     {    "weather",               "Clima" },
@@ -87,7 +78,7 @@ namespace draconis::utils::localization::data {
   // clang-format on
 
   // clang-format off
-  constexpr types::Array<TranslationEntry, 19> FRENCH_TRANSLATIONS = {{
+  constexpr types::Array<TranslationEntry, TRANSLATION_COUNT> FRENCH_TRANSLATIONS = {{
     {      "hello",     "Bonjour {0}!" },
     {       "date",             "Date" },
     {    "weather",            "Météo" },
@@ -111,7 +102,7 @@ namespace draconis::utils::localization::data {
   // clang-format on
 
   // clang-format off
-  constexpr types::Array<TranslationEntry, 19> GERMAN_TRANSLATIONS = {{
+  constexpr types::Array<TranslationEntry, TRANSLATION_COUNT> GERMAN_TRANSLATIONS = {{
     {      "hello",   "Hallo {0}!" },
     {       "date",        "Datum" },
     {    "weather",       "Wetter" },
@@ -135,77 +126,39 @@ namespace draconis::utils::localization::data {
   // clang-format on
 
   /**
-   * @brief Simple compile-time hash map for fast translation lookups.
-   */
-  template <types::usize n>
-  struct TranslationMap {
-    types::Array<types::Pair<types::u64, types::StringView>, n> entries;
-
-    [[nodiscard]] constexpr auto find(types::u64 hash) const -> types::StringView {
-      for (const auto& entry : entries)
-        if (entry.first == hash)
-          return entry.second;
-
-      return types::StringView {}; // Not found
-    }
-  };
-
-  /**
-   * @brief Helper to create translation map from array.
+   * @brief Finds a key's position in the English table, which defines the key order.
+   * @details Usable at compile time, where it turns literal keys into table indices.
+   * @return The index, or None if no language knows the key.
    */
-  template <types::usize n>
-  constexpr auto CreateTranslationMap(const types::Array<TranslationEntry, n>& translations) -> TranslationMap<n> {
-    TranslationMap<n> map {};
+  constexpr auto FindKeyIndex(const types::StringView key) -> types::Option<types::usize> {
+    for (types::usize i = 0; i < TRANSLATION_COUNT; ++i)
+      if (ENGLISH_TRANSLATIONS[i].key == key)
+        return i;
 
-    for (types::usize i = 0; i < n; ++i)
-      map.entries.at(i) = { translations.at(i).keyHash(), translations.at(i).value };
-
-    return map;
+    return types::None;
   }
 
   /**
-   * @brief English translation map for O(1) lookups.
-   */
-  constexpr TranslationMap<19> ENGLISH_MAP = CreateTranslationMap(ENGLISH_TRANSLATIONS);
-
-  /**
-   * @brief Spanish translation map for O(1) lookups.
-   */
-  constexpr TranslationMap<19> SPANISH_MAP = CreateTranslationMap(SPANISH_TRANSLATIONS);
-
-  /**
-   * @brief French translation map for O(1) lookups.
-   */
-  constexpr TranslationMap<19> FRENCH_MAP = CreateTranslationMap(FRENCH_TRANSLATIONS);
-
-  /**
-   * @brief German translation map for O(1) lookups.
-   */
-  constexpr TranslationMap<19> GERMAN_MAP = CreateTranslationMap(GERMAN_TRANSLATIONS);
-
-  /**
-   * @brief Language information structure with hash map.
+   * @brief Language information structure.
    */
   struct LanguageInfo {
-    types::StringView                         code;
-    types::StringView                         displayName;
-    const types::Array<TranslationEntry, 19>* translations;
-    const TranslationMap<19>*                 map;
+    types::StringView                                        code;
+    types::StringView                                        displayName;
+    const types::Array<TranslationEntry, TRANSLATION_COUNT>* translations;
 
     constexpr LanguageInfo(
-      types::StringView                         code,
-      types::StringView                         displayName,
-      const types::Array<TranslationEntry, 19>* translations,
-      const TranslationMap<19>*                 map
-    ) : code(code), displayName(displayName), translations(translations), map(map) {}
+      types::StringView                                        code,
+      types::StringView                                        displayName,
+      const types::Array<TranslationEntry, TRANSLATION_COUNT>* translations
+    ) : code(code), displayName(displayName), translations(translations) {}
   };
 
   // clang-format off
   constexpr types::Array<LanguageInfo, 4> AVAILABLE_LANGUAGES = {{
-    { "en",  "English", &ENGLISH_TRANSLATIONS, &ENGLISH_MAP },
-    { "es",  "Español", &SPANISH_TRANSLATIONS, &SPANISH_MAP },
-    { "fr", "Français",  &FRENCH_TRANSLATIONS,  &FRENCH_MAP },
-    { "de",  "Deutsch",  &GERMAN_TRANSLATIONS,  &GERMAN_MAP },
+    { "en",  "English", &ENGLISH_TRANSLATIONS },
+    { "es",  "Español", &SPANISH_TRANSLATIONS },
+    { "fr", "Français",  &FRENCH_TRANSLATIONS },
+    { "de",  "Deutsch",  &GERMAN_TRANSLATIONS },
   }};
   // clang-format on
 } // namespace draconis::utils::localization::data
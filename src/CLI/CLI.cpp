@@ -7,11 +7,29 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
 #include <glaze/glaze.hpp>
 #include <magic_enum/magic_enum.hpp>
+#include <thread>
+
+#ifdef _WIN32
+  #include <fcntl.h>   // _O_BINARY
+  #include <io.h>      // _setmode, _fileno
+  #include <windows.h> // CreateProcessW, GetModuleFileNameW
+#else
+  #include <cstring>  // std::strerror
+  #include <fcntl.h>  // O_RDONLY, O_WRONLY
+  #include <spawn.h>  // posix_spawnp, posix_spawnattr_*, posix_spawn_file_actions_*
+  #include <unistd.h> // environ
+
+extern char** environ; // NOLINT(readability-redundant-declaration) - not declared by every libc
+#endif
 
 #include <Drac++/Services/Packages.hpp>
 
+#include <Drac++/Utils/Arena.hpp>
 #include <Drac++/Utils/DataTypes.hpp>
 #include <Drac++/Utils/Error.hpp>
 #include <Drac++/Utils/Logging.hpp>
@@ -22,56 +40,231 @@
   #include <Drac++/Utils/CacheManager.hpp>
 #endif
 
+#include "Core/Allocations.hpp"
+#include "UI/UI.hpp"
+
+namespace draconis::cli {
+  namespace {
+    struct BenchmarkReport {
+      utils::types::u32                  iterations;
+      utils::types::u32                  warmup;
+      utils::types::Vec<BenchmarkResult> results;
+    };
+  } // namespace
+} // namespace draconis::cli
+
+namespace glz {
+  template <>
+  struct meta<draconis::cli::BenchmarkStats> {
+    using T = draconis::cli::BenchmarkStats;
+
+    // clang-format off
+    static constexpr detail::Object value = object(
+      "minMs",       &T::minMs,
+      "medianMs",    &T::medianMs,
+      "p95Ms",       &T::p95Ms,
+      "p99Ms",       &T::p99Ms,
+      "meanMs",      &T::meanMs,
+      "samples",     &T::samples,
+      "allocations", &T::allocations
+    );
+    // clang-format on
+  };
+
+  template <>
+  struct meta<draconis::cli::BenchmarkResult> {
+    using T = draconis::cli::BenchmarkResult;
+
+    // clang-format off
+    static constexpr detail::Object value = object(
+      "name",    &T::name,
+      "group",   &T::group,
+      "cold",    &T::cold,
+      "warm",    &T::warm,
+      "success", &T::success
+    );
+    // clang-format on
+  };
+
+  template <>
+  struct meta<draconis::cli::BenchmarkReport> {
+    using T = draconis::cli::BenchmarkReport;
+
+    static constexpr detail::Object value = object("iterations", &T::iterations, "warmup", &T::warmup, "results", &T::results);
+  };
+} // namespace glz
+
 namespace draconis::cli {
   using namespace utils::types;
   using namespace utils::logging;
   using namespace core::system;
   using namespace config;
 
+  namespace {
+    using std::chrono::steady_clock, std::chrono::duration;
+
+    // Nearest-rank percentile over an already sorted, non-empty sample set.
+    auto Percentile(const Vec<f64>& sorted, const f64 fraction) -> f64 {
+      const auto rank = static_cast<usize>(std::ceil(fraction * static_cast<f64>(sorted.size())));
+      return sorted.at(std::clamp<usize>(rank, 1, sorted.size()) - 1);
+    }
+
+    auto Summarize(Vec<f64> samples) -> BenchmarkStats {
+      if (samples.empty())
+        return {};
+
+      std::ranges::sort(samples);
+
+      const usize count = samples.size();
+      f64         total = 0.0;
+
+      for (const f64 sample : samples)
+        total += sample;
+
+      return {
+        .minMs    = samples.front(),
+        .medianMs = count % 2 == 0 ? (samples.at((count / 2) - 1) + samples.at(count / 2)) / 2.0 : samples.at(count / 2),
+        .p95Ms    = Percentile(samples, 0.95),
+        .p99Ms    = Percentile(samples, 0.99),
+        .meanMs   = total / static_cast<f64>(count),
+        .samples  = count,
+      };
+    }
+
+    struct WatchSchedule {
+      VolatileField             field;
+      std::chrono::milliseconds interval;
+    };
+
+    // Minimum refresh interval per volatile readout. The user-supplied tick can
+    // only make these slower, never faster.
+    constexpr auto WATCH_SCHEDULE = std::to_array<WatchSchedule>({
+      WatchSchedule { VolatileField::Uptime,    std::chrono::seconds(1) },
+      WatchSchedule { VolatileField::Memory,    std::chrono::seconds(1) },
+      WatchSchedule { VolatileField::Battery,   std::chrono::seconds(10) },
+      WatchSchedule { VolatileField::DiskUsage, std::chrono::seconds(30) },
+      WatchSchedule { VolatileField::Date,      std::chrono::seconds(60) },
+      WatchSchedule { VolatileField::Plugins,   std::chrono::seconds(60) },
+    });
+
+    volatile std::sig_atomic_t WatchStopRequested = 0;
+
+    auto HandleWatchSignal(const i32 /*signal*/) -> void {
+      WatchStopRequested = 1;
+    }
+  } // namespace
+
   auto RunBenchmark(
     utils::cache::CacheManager& cache,
-    const Config&               config
+    const Config&               config,
+    const BenchmarkOptions&     options
   ) -> Vec<BenchmarkResult> {
-    using std::chrono::high_resolution_clock, std::chrono::duration;
+    using utils::cache::CacheManager;
+    using utils::memory::FrameArena;
 
     Vec<BenchmarkResult> results;
-    results.reserve(20);
-
-    // Time each data source individually
-    auto timeOperation = [&results](const String& name, auto&& func) -> auto {
-      auto start  = high_resolution_clock::now();
-      auto result = func();
-      auto end    = high_resolution_clock::now();
-      auto dur    = duration<f64, std::milli>(end - start).count();
-      results.push_back({ .name = name, .durationMs = dur, .success = static_cast<bool>(result) });
+    results.reserve(32);
+
+    const bool ignoreCacheBefore = CacheManager::ignoreCache;
+
+    // Runs `func` for the warmup iterations untimed, then for the measured ones.
+    auto measure = [&options](auto& func, bool& success) -> BenchmarkStats {
+      for (u32 i = 0; i < options.warmup; ++i)
+        static_cast<void>(func());
+
+      Vec<f64> samples;
+      samples.reserve(options.iterations);
+
+      const Option<u64> allocationsBefore = GetAllocationCount();
+
+      for (u32 i = 0; i < options.iterations; ++i) {
+        const auto start  = steady_clock::now();
+        const auto result = func();
+        const auto end    = steady_clock::now();
+
+        success = success && static_cast<bool>(result);
+        samples.push_back(duration<f64, std::milli>(end - start).count());
+      }
+
+      const Option<u64> allocationsAfter = GetAllocationCount();
+
+      BenchmarkStats stats = Summarize(std::move(samples));
+
+      if (allocationsBefore && allocationsAfter && options.iterations > 0)
+        stats.allocations = static_cast<f64>(*allocationsAfter - *allocationsBefore) / static_cast<f64>(options.iterations);
+
+      return stats;
+    };
+
+    auto bench = [&](const StringView group, String name, const bool cached, auto&& func) -> Unit {
+      BenchmarkResult result { .name = std::move(name), .group = String(group) };
+
+      if (cached) {
+        CacheManager::ignoreCache = true;
+        result.cold               = measure(func, result.success);
+      }
+
+      CacheManager::ignoreCache = ignoreCacheBefore;
+      result.warm               = measure(func, result.success);
+
+      results.push_back(std::move(result));
     };
 
-    timeOperation("Desktop Environment", [&]() -> Result<String> { return GetDesktopEnvironment(cache); });
-    timeOperation("Window Manager", [&]() -> Result<String> { return GetWindowManager(cache); });
-    timeOperation("Operating System", [&]() -> Result<OSInfo> { return GetOperatingSystem(cache); });
-    timeOperation("Kernel Version", [&]() -> Result<String> { return GetKernelVersion(cache); });
-    timeOperation("Host", [&]() -> Result<String> { return GetHost(cache); });
-    timeOperation("CPU Model", [&]() -> Result<String> { return GetCPUModel(cache); });
-    timeOperation("CPU Cores", [&]() -> Result<CPUCores> { return GetCPUCores(cache); });
-    timeOperation("GPU Model", [&]() -> Result<String> { return GetGPUModel(cache); });
-    timeOperation("Shell", [&]() -> Result<String> { return GetShell(cache); });
-    timeOperation("Memory Info", [&]() -> Result<ResourceUsage> { return GetMemInfo(cache); });
-    timeOperation("Disk Usage", [&]() -> Result<ResourceUsage> { return GetDiskUsage(cache); });
-    timeOperation("Uptime", [&]() -> Result<std::chrono::seconds> { return GetUptime(); });
+    bench("core", "Desktop Environment", true, [&] { return GetDesktopEnvironment(cache); });
+    bench("core", "Window Manager", true, [&] { return GetWindowManager(cache); });
+    bench("core", "Operating System", true, [&] { return GetOperatingSystem(cache); });
+    bench("core", "Kernel Version", true, [&] { return GetKernelVersion(cache); });
+    bench("core", "Host", true, [&] { return GetHost(cache); });
+    bench("core", "CPU Model", true, [&] { return GetCPUModel(cache); });
+    bench("core", "CPU Cores", true, [&] { return GetCPUCores(cache); });
+#ifdef __linux__
+    bench("core", "CPU Topology", true, [&] { return GetCPUTopology(cache); });
+#endif
+    bench("core", "GPU Model", true, [&] { return GetGPUModel(cache); });
+#ifdef __linux__
+    bench("core", "GPUs", true, [&] { return GetGPUs(cache); });
+#endif
+    bench("core", "Shell", true, [&] { return GetShell(cache); });
+    bench("core", "Memory Info", true, [&] { return GetMemInfo(cache); });
+    bench("core", "Disk Usage", true, [&] { return GetDiskUsage(cache); });
+    bench("core", "Uptime", false, [] { return GetUptime(); });
 
 #if DRAC_ENABLE_PACKAGECOUNT
-    timeOperation("Package Count", [&]() -> Result<u64> {
-      return draconis::services::packages::GetTotalCount(cache, config.enabledPackageManagers);
-    });
-#else
-    (void)config; // Suppress unused warning
+    {
+      using draconis::services::packages::CountTable;
+      using draconis::services::packages::GetCounts;
+      using draconis::services::packages::GetTotalCount;
+      using draconis::services::packages::HasPackageManager;
+      using draconis::services::packages::Manager;
+
+      // Benchmark each enabled backend separately so a regression in one
+      // counter isn't hidden by the others running concurrently.
+      for (u8 bit = 0; bit < 8; ++bit) {
+        const auto manager = static_cast<Manager>(1U << bit);
+
+        if (!HasPackageManager(config.enabledPackageManagers, manager))
+          continue;
+
+        // Managers that exist in the enum but not on this platform produce no entry.
+        const CountTable probe = GetCounts(cache, manager);
+
+        if (probe.empty())
+          continue;
+
+        bench("packages", std::format("Packages: {}", probe.begin()->first), true, [&cache, manager] {
+          const CountTable counts = GetCounts(cache, manager);
+          return std::ranges::all_of(counts, [](const auto& entry) -> bool { return entry.second.has_value(); });
+        });
+      }
+
+      bench("packages", "Packages: total", true, [&] { return GetTotalCount(cache, config.enabledPackageManagers); });
+    }
 #endif
 
 #if DRAC_ENABLE_PLUGINS
-    // Benchmark info provider plugins
     auto& pluginManager = draconis::core::plugin::GetPluginManager();
-    if (pluginManager.isInitialized()) {
-      // First, load all discovered plugins
+
+    if (pluginManager.isInitialized())
       for (const auto& pluginName : pluginManager.listDiscoveredPlugins())
         if (!pluginManager.isPluginLoaded(pluginName)) {
           Result<Unit> loadResult = pluginManager.loadPlugin(pluginName, cache);
@@ -79,93 +272,217 @@ namespace draconis::cli {
           if (!loadResult)
             Print("Warning: failed to load plugin '{}'\n", pluginName);
         }
+#endif
+
+    // Full collection and rendering, the path a normal invocation takes.
+    bench("ui", "Collect SystemInfo", true, [&] {
+      [[maybe_unused]] const SystemInfo data(cache, config);
+      return true;
+    });
+
+    {
+      const SystemInfo data(cache, config);
+
+      bench("ui", "Render UI", false, [&] { return !CreateUI(cache, config, data, false).empty(); });
+      bench("ui", "Render UI (no ASCII)", false, [&] { return !CreateUI(cache, config, data, true).empty(); });
+
+      // Watch mode renders into one buffer it keeps between frames, with its scratch in an arena.
+      String     frame;
+      FrameArena arena;
+      bench("ui", "Render UI (reused buffer)", false, [&] {
+        frame.clear();
+        RenderUI(cache, config, data, false, frame, arena.resource());
+        arena.reset();
+        return !frame.empty();
+      });
+    }
 
-      // Create a PluginCache for benchmarking using the persistent cache directory
-      PluginCache pluginCache(utils::cache::CacheManager::getPersistentCacheDir() / "plugins");
+#if DRAC_ENABLE_PLUGINS
+    if (pluginManager.isInitialized()) {
+      PluginCache pluginCache(utils::cache::CacheManager::getPersistentCacheDir() / "plugins", PluginCache::WriteMode::WriteBehind);
 
-      // Then benchmark each info provider plugin
+      // Plugins keep their own cache (and may hit the network when it's cold),
+      // so only the warm path is measured.
       for (auto* plugin : pluginManager.getInfoProviderPlugins())
         if (plugin && plugin->isReady() && plugin->isEnabled())
-          timeOperation(std::format("Plugin: {}", plugin->getMetadata().name), [&]() -> Result<String> {
-            if (auto result = plugin->collectData(pluginCache); !result)
-              return std::unexpected(result.error());
-            return plugin->getDisplayValue();
+          bench("plugins", std::format("Plugin: {}", plugin->getMetadata().name), false, [&pluginCache, plugin] {
+            return plugin->collectData(pluginCache);
           });
     }
 #endif
 
+    CacheManager::ignoreCache = ignoreCacheBefore;
+
     return results;
   }
 
-  auto PrintBenchmarkReport(const Vec<BenchmarkResult>& results) -> Unit {
-    f64 totalTime  = 0.0;
-    f64 coreTime   = 0.0;
-    f64 pluginTime = 0.0;
+  auto PrintBenchmarkReport(const Vec<BenchmarkResult>& results, const BenchmarkOptions& options) -> Unit {
+    constexpr auto GROUPS = std::to_array<Pair<StringView, StringView>>({
+      {     "core",       "Core System Data" },
+      { "packages",         "Package Counts" },
+      {       "ui", "Collection & Rendering" },
+      {  "plugins",            "Plugin Data" },
+    });
 
-    // Separate core system results from plugin results
-    Vec<BenchmarkResult> coreResults;
-    Vec<BenchmarkResult> pluginResults;
+    usize maxNameLen = 0;
+    for (const BenchmarkResult& result : results)
+      maxNameLen = std::max(maxNameLen, result.name.size());
 
-    for (const auto& result : results) {
-      if (result.name.starts_with("Plugin: "))
-        pluginResults.push_back(result);
-      else
-        coreResults.push_back(result);
-    }
+    auto formatMs = [](const f64 value) -> String { return std::format("{:.3f}", value); };
 
-    // Sort each group by duration (slowest first)
-    auto sortByDuration = [](const BenchmarkResult& resA, const BenchmarkResult& resB) -> bool {
-      return resA.durationMs > resB.durationMs;
-    };
-    std::ranges::sort(coreResults, sortByDuration);
-    std::ranges::sort(pluginResults, sortByDuration);
+    Println("Benchmark Results ({} iterations, {} warmup, times in ms, allocations per iteration):", options.iterations, options.warmup);
+    Println("==========================================================");
 
-    // Find longest name for alignment (check both groups)
-    usize maxNameLen = 0;
-    for (const auto& result : coreResults)
-      maxNameLen = std::max(maxNameLen, result.name.size());
-    for (const auto& result : pluginResults)
-      maxNameLen = std::max(maxNameLen, result.name.size());
+    for (const auto& [group, title] : GROUPS) {
+      Vec<const BenchmarkResult*> groupResults;
 
-    // Helper to print a single result
-    auto printResult = [&maxNameLen](const BenchmarkResult& result) {
-      String status  = result.success ? "✓" : "✗";
-      String padding = String(maxNameLen - result.name.size(), ' ');
-      Println("  {} {}{} {:>8.2f} ms", status, result.name, padding, result.durationMs);
-    };
+      for (const BenchmarkResult& result : results)
+        if (result.group == group)
+          groupResults.push_back(&result);
 
-    Println("Benchmark Results:");
-    Println("==================");
+      if (groupResults.empty())
+        continue;
+
+      // Slowest first
+      std::ranges::sort(groupResults, [](const BenchmarkResult* lhs, const BenchmarkResult* rhs) -> bool {
+        return lhs->warm.medianMs > rhs->warm.medianMs;
+      });
 
-    // Print core system results
-    if (!coreResults.empty()) {
       Println();
-      Println("Core System Data:");
-      Println("-----------------");
-      for (const auto& result : coreResults) {
-        printResult(result);
-        coreTime += result.durationMs;
+      Println("{}:", title);
+      Println("{}", String(title.size() + 1, '-'));
+      Println(
+        "    {:<{}} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10}",
+        "",
+        maxNameLen,
+        "cold p50",
+        "min",
+        "p50",
+        "p95",
+        "p99",
+        "allocs"
+      );
+
+      f64 coldTotal = 0.0;
+      f64 warmTotal = 0.0;
+
+      for (const BenchmarkResult* result : groupResults) {
+        Println(
+          "  {} {:<{}} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10}",
+          result->success ? "✓" : "✗",
+          result->name,
+          maxNameLen,
+          result->cold ? formatMs(result->cold->medianMs) : String("-"),
+          formatMs(result->warm.minMs),
+          formatMs(result->warm.medianMs),
+          formatMs(result->warm.p95Ms),
+          formatMs(result->warm.p99Ms),
+          result->warm.allocations ? std::format("{:.1f}", *result->warm.allocations) : String("-")
+        );
+
+        coldTotal += result->cold ? result->cold->medianMs : result->warm.medianMs;
+        warmTotal += result->warm.medianMs;
       }
+
       Println();
-      Println("  Subtotal: {:>8.2f} ms ({} sources)", coreTime, coreResults.size());
+      Println("  Subtotal (p50): cold {:.3f} ms, warm {:.3f} ms ({} sources)", coldTotal, warmTotal, groupResults.size());
     }
+  }
 
-    // Print plugin results
-    if (!pluginResults.empty()) {
-      Println();
-      Println("Plugin Data:");
-      Println("------------");
-      for (const auto& result : pluginResults) {
-        printResult(result);
-        pluginTime += result.durationMs;
+  auto PrintBenchmarkJson(
+    const Vec<BenchmarkResult>& results,
+    const BenchmarkOptions&     options,
+    const bool                  prettyJson
+  ) -> Unit {
+    const BenchmarkReport report { .iterations = options.iterations, .warmup = options.warmup, .results = results };
+
+    String jsonStr;
+
+    glz::error_ctx errorContext =
+      prettyJson
+      ? glz::write<glz::opts { .prettify = true }>(report, jsonStr)
+      : glz::write_json(report, jsonStr);
+
+    if (errorContext)
+      Print("Failed to write JSON output: {}", glz::format_error(errorContext, jsonStr));
+    else
+      Println(jsonStr);
+  }
+
+  auto RunWatchMode(
+    utils::cache::CacheManager&        cache,
+    SystemInfo&                        data,
+    const f64                          intervalSeconds,
+    const Fn<Unit(const SystemInfo&)>& render
+  ) -> i32 {
+    using std::chrono::milliseconds, std::chrono::duration_cast;
+
+    const milliseconds tick = duration_cast<milliseconds>(duration<f64>(intervalSeconds));
+
+    if (tick <= milliseconds::zero()) {
+      error_log("Watch interval must be positive (got {})", intervalSeconds);
+      return EXIT_FAILURE;
+    }
+
+    // Let Ctrl-C end the loop normally so pending cache writes are flushed.
+    std::signal(SIGINT, HandleWatchSignal);
+    std::signal(SIGTERM, HandleWatchSignal);
+
+    Array<milliseconds, WATCH_SCHEDULE.size()>             intervals {};
+    Array<steady_clock::time_point, WATCH_SCHEDULE.size()> nextDue {};
+
+    const steady_clock::time_point start = steady_clock::now();
+
+    for (usize i = 0; i < WATCH_SCHEDULE.size(); ++i) {
+      intervals.at(i) = std::max(WATCH_SCHEDULE.at(i).interval, tick);
+      nextDue.at(i)   = start + intervals.at(i);
+    }
+
+    render(data);
+    std::fflush(stdout);
+
+    Vec<VolatileField> dueFields;
+    dueFields.reserve(WATCH_SCHEDULE.size());
+
+    steady_clock::time_point nextTick = start + tick;
+
+    while (WatchStopRequested == 0) {
+      // Sleep in short slices so a signal is noticed promptly.
+      for (steady_clock::time_point now = steady_clock::now(); WatchStopRequested == 0 && now < nextTick; now = steady_clock::now())
+        std::this_thread::sleep_for(std::min<steady_clock::duration>(nextTick - now, milliseconds(100)));
+
+      if (WatchStopRequested != 0)
+        break;
+
+      const steady_clock::time_point now = steady_clock::now();
+
+      dueFields.clear();
+
+      for (usize i = 0; i < WATCH_SCHEDULE.size(); ++i)
+        if (now >= nextDue.at(i)) {
+          dueFields.push_back(WATCH_SCHEDULE.at(i).field);
+          nextDue.at(i) = now + intervals.at(i);
+        }
+
+      if (!dueFields.empty()) {
+        data.refresh(cache, dueFields);
+        render(data);
+        std::fflush(stdout);
+
+        debug_log("Watch: refreshed {} readouts in {:.3f}ms", dueFields.size(), duration<f64, std::milli>(steady_clock::now() - now).count());
       }
-      Println();
-      Println("  Subtotal: {:>8.2f} ms ({} plugins)", pluginTime, pluginResults.size());
+
+      // Don't try to catch up on missed ticks (e.g. after a suspend).
+      nextTick += tick;
+
+      if (nextTick < now)
+        nextTick = now + tick;
     }
 
-    totalTime = coreTime + pluginTime;
-    Println();
-    Println("  Total: {:>8.2f} ms ({} data sources)", totalTime, results.size());
+    if (Result<> result = cache.flush(); !result)
+      debug_at(result.error());
+
+    return EXIT_SUCCESS;
   }
 
   auto PrintDoctorReport(
@@ -231,11 +548,17 @@ namespace draconis::cli {
     if (!pluginDisplay.empty()) {
       Vec<String> pluginFailures;
       Vec<String> pluginSuccesses;
+      Vec<String> pluginTimeouts;
 
       for (const auto& [pluginId, displayInfo] : pluginDisplay) {
-        if (displayInfo.value.has_value())
+        if (displayInfo.timedOut)
+          pluginTimeouts.push_back(
+            displayInfo.stale ? std::format("{} (showing last cached value)", displayInfo.label) : displayInfo.label
+          );
+
+        if (displayInfo.value.has_value() && !displayInfo.timedOut)
           pluginSuccesses.push_back(displayInfo.label);
-        else
+        else if (!displayInfo.timedOut)
           pluginFailures.push_back(displayInfo.label);
       }
 
@@ -243,19 +566,26 @@ namespace draconis::cli {
       Println("Plugin Readouts:");
       Println("----------------");
 
-      if (pluginFailures.empty())
+      if (pluginFailures.empty() && pluginTimeouts.empty())
         Println("  ✓ All {} plugin readouts were successful!", pluginDisplay.size());
       else {
         Println(
           "  Out of {} plugin readouts, {} failed.\n",
           pluginDisplay.size(),
-          pluginFailures.size()
+          pluginFailures.size() + pluginTimeouts.size()
         );
 
         for (const auto& label : pluginFailures)
           Println(R"(  ✗ Plugin "{}" failed to provide data)", label);
       }
 
+      if (!pluginTimeouts.empty()) {
+        Println();
+        Println("  Plugins that missed their collection deadline:");
+        for (const auto& label : pluginTimeouts)
+          Println("    ⏱ {}", label);
+      }
+
       if (!pluginSuccesses.empty()) {
         Println();
         Println("  Successful plugins:");
@@ -273,7 +603,7 @@ namespace draconis::cli {
 #if DRAC_ENABLE_PLUGINS
     totalReadouts += data.pluginDisplay.size();
     for (const auto& [pluginId, displayInfo] : data.pluginDisplay)
-      if (!displayInfo.value.has_value())
+      if (!displayInfo.value.has_value() || displayInfo.timedOut)
         totalFailures++;
 #endif
 
@@ -285,79 +615,126 @@ namespace draconis::cli {
 
   auto PrintJsonOutput(
     const SystemInfo& data,
-    bool              prettyJson
+    const bool        prettyJson,
+    String&           buffer
   ) -> Unit {
-    JsonInfo output;
-
-#define DRAC_SET_OPTIONAL(field) \
-  if (data.field)                \
-  output.field = *data.field
-
-    DRAC_SET_OPTIONAL(date);
-    DRAC_SET_OPTIONAL(host);
-    DRAC_SET_OPTIONAL(kernelVersion);
-    DRAC_SET_OPTIONAL(operatingSystem);
-    DRAC_SET_OPTIONAL(memInfo);
-    DRAC_SET_OPTIONAL(desktopEnv);
-    DRAC_SET_OPTIONAL(windowMgr);
-    DRAC_SET_OPTIONAL(diskUsage);
-    DRAC_SET_OPTIONAL(shell);
-    DRAC_SET_OPTIONAL(cpuModel);
-    DRAC_SET_OPTIONAL(cpuCores);
-    DRAC_SET_OPTIONAL(gpuModel);
-
-    if (data.uptime)
-      output.uptimeSeconds = data.uptime->count();
-
-    if constexpr (DRAC_ENABLE_PACKAGECOUNT)
-      DRAC_SET_OPTIONAL(packageCount);
-
-#if DRAC_ENABLE_PLUGINS
-    output.pluginFields = data.pluginData;
-#endif
-
-#undef DRAC_SET_OPTIONAL
-
-    String jsonStr;
+    buffer.clear();
 
     glz::error_ctx errorContext =
       prettyJson
-      ? glz::write<glz::opts { .prettify = true }>(output, jsonStr)
-      : glz::write_json(output, jsonStr);
+      ? glz::write<glz::opts { .prettify = true }>(data, buffer)
+      : glz::write_json(data, buffer);
 
     if (errorContext)
-      Print("Failed to write JSON output: {}", glz::format_error(errorContext, jsonStr));
+      Print("Failed to write JSON output: {}", glz::format_error(errorContext, buffer));
     else
-      Print(jsonStr);
+      Print(buffer);
   }
 
-  auto PrintCompactOutput(
-    const String&     templateStr,
-    const SystemInfo& data
-  ) -> Unit {
-    // Get all system info as a map
-    Map<String, String> infoMap = data.toMap();
-
-    // Generic placeholder substitution: replace all {key} with values from the map
-    String output = templateStr;
-    for (const auto& [key, value] : infoMap) {
-      String placeholder = std::format("{{{}}}", key);
-      usize  pos         = 0;
-      while ((pos = output.find(placeholder, pos)) != String::npos)
-        output.replace(pos, placeholder.length(), value);
+  auto PrintBeveOutput(const SystemInfo& data, String& buffer) -> Unit {
+    buffer.clear();
+
+    if (glz::error_ctx errorContext = glz::write_beve(data, buffer)) {
+      error_log("Failed to write BEVE output: {}", glz::format_error(errorContext, buffer));
+      return;
     }
 
-    // Remove any remaining unmatched placeholders (keys that weren't in the map)
+#ifdef _WIN32
+    // Keep the CRT from expanding 0x0A bytes into CRLF.
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+    std::fwrite(buffer.data(), 1, buffer.size(), stdout);
+    std::fflush(stdout);
+  }
+
+  CompactTemplate::CompactTemplate(const StringView templateStr) {
+    Segment current;
+
     usize pos = 0;
-    while ((pos = output.find('{', pos)) != String::npos) {
-      usize endPos = output.find('}', pos);
-      if (endPos != String::npos)
-        output.replace(pos, endPos - pos + 1, "");
-      else
+    while (pos < templateStr.size()) {
+      const usize open  = templateStr.find('{', pos);
+      const usize close = open == StringView::npos ? StringView::npos : templateStr.find('}', open);
+
+      // Text after the last complete placeholder is kept verbatim.
+      if (close == StringView::npos) {
+        current.literal += templateStr.substr(pos);
         break;
+      }
+
+      current.literal += templateStr.substr(pos, open - pos);
+      pos = close + 1;
+
+      const StringView key = templateStr.substr(open + 1, close - open - 1);
+
+      if (const Option<InfoField> field = FindInfoField(key))
+        current.field = field;
+      else if (key.starts_with(PLUGIN_FIELD_PREFIX)) {
+        current.plugin = PluginPlaceholder { .key = String(key.substr(PLUGIN_FIELD_PREFIX.size())), .idLength = None };
+        m_usesPlugins  = true;
+      } else
+        // Nothing provides this key, so it expands to nothing.
+        continue;
+
+      m_segments.push_back(std::move(current));
+      current = {};
     }
 
-    Println("{}", output);
+    if (!current.literal.empty())
+      m_segments.push_back(std::move(current));
+  }
+
+  auto CompactTemplate::getCollectionPlan() const -> CollectionPlan {
+    CollectionPlan plan { .readouts = Readout::None };
+
+    for (const Segment& segment : m_segments)
+      if (segment.field)
+        plan.readouts |= INFO_FIELDS[static_cast<usize>(*segment.field)].readout;
+
+    // Plugin keys don't map back to a provider ID unambiguously until the
+    // data exists, so collect every plugin.
+    if (m_usesPlugins)
+      plan.readouts |= Readout::Plugins;
+
+    return plan;
+  }
+
+  auto CompactTemplate::render(const SystemInfo& data, String& out) const -> Unit {
+    for (const Segment& segment : m_segments) {
+      out += segment.literal;
+
+      if (segment.field)
+        data.appendField(*segment.field, out);
+#if DRAC_ENABLE_PLUGINS
+      else if (segment.plugin) {
+        const PluginPlaceholder& plugin = *segment.plugin;
+
+        if (!plugin.idLength)
+          plugin.idLength = data.findPluginField(plugin.key);
+
+        if (!plugin.idLength)
+          continue;
+
+        const StringView key = plugin.key;
+
+        if (const auto pluginIter = data.pluginData.find(key.substr(0, *plugin.idLength)); pluginIter != data.pluginData.end())
+          if (const auto fieldIter = pluginIter->second.find(key.substr(*plugin.idLength + 1)); fieldIter != pluginIter->second.end())
+            out += fieldIter->second;
+      }
+#endif
+    }
+  }
+
+  auto PrintCompactOutput(
+    const CompactTemplate& compact,
+    const SystemInfo&      data,
+    String&                buffer
+  ) -> Unit {
+    buffer.clear();
+    compact.render(data, buffer);
+    buffer += '\n';
+
+    Print(buffer);
   }
 
 #if DRAC_ENABLE_PLUGINS
@@ -449,6 +826,14 @@ namespace draconis::cli {
         );
 
         Print("  • {} {}\n", pluginName, isLoaded ? "(loaded)" : "(available)");
+
+        // Unloaded plugins are described from the manifest rather than dlopened.
+        if (!isLoaded)
+          if (const auto entry = pluginManager.getManifestEntry(pluginName)) {
+            Print("    {} v{} ({})\n", entry->metadata.name, entry->metadata.version, entry->metadata.author);
+            Print("    Description: {}\n", entry->metadata.description);
+            Print("    Type: {}\n", magic_enum::enum_name(entry->metadata.type));
+          }
       }
 
       Print("\n");
@@ -523,7 +908,7 @@ namespace draconis::cli {
       Print(R"bash(
 _draconis++_completions() {
     local cur="${COMP_WORDS[COMP_CWORD]}"
-    local opts="-V --verbose -d --doctor -l --log-level --clear-cache --lang --ignore-cache --no-ascii --json --pretty --format --compact --logo-path --logo-protocol --logo-width --logo-height --version --help --benchmark --config-path --generate-completions --list-plugins --plugin-info"
+    local opts="-V --verbose -d --doctor -l --log-level --async-log --log-file --clear-cache --lang --ignore-cache --warm-cache --no-ascii --json --pretty --format --compact --logo-path --logo-protocol --logo-width --logo-height --version --help --benchmark --benchmark-iterations --benchmark-warmup -w --watch --config-path --generate-completions --list-plugins --plugin-info --trace"
 
     if [[ "$cur" == -* ]]; then
         COMPREPLY=($(compgen -W "$opts" -- "$cur"))
@@ -559,9 +944,12 @@ _draconis++() {
         '--doctor[Reports any failed readouts]'
         '-l[Set minimum log level]:level:(trace debug info warn error)'
         '--log-level[Set minimum log level]:level:(trace debug info warn error)'
+        '--async-log[Write log messages from a background thread]'
+        '--log-file[Append log messages to a file]:file:_files'
         '--clear-cache[Clears the cache]'
         '--lang[Set language]:language:(en es fr de)'
         '--ignore-cache[Ignore cache for this run]'
+        '--warm-cache[Refresh the cache without output]'
         '--no-ascii[Disable ASCII art]'
         '--json[Output in JSON format]'
         '--pretty[Pretty-print JSON]'
@@ -574,10 +962,15 @@ _draconis++() {
         '--version[Show version info]'
         '--help[Show help message]'
         '--benchmark[Show timing for each data source]'
+        '--benchmark-iterations[Timed iterations per benchmark phase]:count:'
+        '--benchmark-warmup[Warmup iterations per benchmark phase]:count:'
+        '-w[Refresh volatile readouts every N seconds]:seconds:'
+        '--watch[Refresh volatile readouts every N seconds]:seconds:'
         '--config-path[Display config file location]'
         '--generate-completions[Generate shell completions]:shell:(bash zsh fish powershell)'
         '--list-plugins[List all available plugins]'
         '--plugin-info[Show detailed plugin information]'
+        '--trace[Write a Chrome trace file]:file:_files'
     )
     _describe 'draconis++' opts
 }
@@ -590,9 +983,12 @@ _draconis++ "$@"
 complete -c draconis++ -s V -l verbose -d 'Enable verbose logging'
 complete -c draconis++ -s d -l doctor -d 'Reports any failed readouts'
 complete -c draconis++ -s l -l log-level -x -a 'trace debug info warn error' -d 'Set minimum log level'
+complete -c draconis++ -l async-log -d 'Write log messages from a background thread'
+complete -c draconis++ -l log-file -r -d 'Append log messages to a file'
 complete -c draconis++ -l clear-cache -d 'Clears the cache'
 complete -c draconis++ -l lang -x -a 'en es fr de' -d 'Set language'
 complete -c draconis++ -l ignore-cache -d 'Ignore cache for this run'
+complete -c draconis++ -l warm-cache -d 'Refresh the cache without output'
 complete -c draconis++ -l no-ascii -d 'Disable ASCII art'
 complete -c draconis++ -l json -d 'Output in JSON format'
 complete -c draconis++ -l pretty -d 'Pretty-print JSON'
@@ -605,10 +1001,14 @@ complete -c draconis++ -l logo-height -d 'Logo height in pixels'
 complete -c draconis++ -l version -d 'Show version info'
 complete -c draconis++ -l help -d 'Show help message'
 complete -c draconis++ -l benchmark -d 'Show timing for each data source'
+complete -c draconis++ -l benchmark-iterations -x -d 'Timed iterations per benchmark phase'
+complete -c draconis++ -l benchmark-warmup -x -d 'Warmup iterations per benchmark phase'
+complete -c draconis++ -s w -l watch -x -d 'Refresh volatile readouts every N seconds'
 complete -c draconis++ -l config-path -d 'Display config file location'
 complete -c draconis++ -l generate-completions -x -a 'bash zsh fish powershell' -d 'Generate shell completions'
 complete -c draconis++ -l list-plugins -d 'List all available plugins'
 complete -c draconis++ -l plugin-info -d 'Show detailed plugin information'
+complete -c draconis++ -l trace -r -d 'Write a Chrome trace file'
 )fish");
     } else if (shell == "powershell" || shell == "pwsh") {
       Print(R"pwsh(
@@ -623,9 +1023,12 @@ Register-ArgumentCompleter -CommandName draconis++ -ScriptBlock {
         @{ Name = '--doctor'; Tooltip = 'Reports any failed readouts' }
         @{ Name = '-l'; Tooltip = 'Set minimum log level' }
         @{ Name = '--log-level'; Tooltip = 'Set minimum log level' }
+        @{ Name = '--async-log'; Tooltip = 'Write log messages from a background thread' }
+        @{ Name = '--log-file'; Tooltip = 'Append log messages to a file' }
         @{ Name = '--clear-cache'; Tooltip = 'Clears the cache' }
         @{ Name = '--lang'; Tooltip = 'Set language' }
         @{ Name = '--ignore-cache'; Tooltip = 'Ignore cache for this run' }
+        @{ Name = '--warm-cache'; Tooltip = 'Refresh the cache without output' }
         @{ Name = '--no-ascii'; Tooltip = 'Disable ASCII art' }
         @{ Name = '--json'; Tooltip = 'Output in JSON format' }
         @{ Name = '--pretty'; Tooltip = 'Pretty-print JSON' }
@@ -638,10 +1041,15 @@ Register-ArgumentCompleter -CommandName draconis++ -ScriptBlock {
         @{ Name = '--version'; Tooltip = 'Show version info' }
         @{ Name = '--help'; Tooltip = 'Show help message' }
         @{ Name = '--benchmark'; Tooltip = 'Show timing for each data source' }
+        @{ Name = '--benchmark-iterations'; Tooltip = 'Timed iterations per benchmark phase' }
+        @{ Name = '--benchmark-warmup'; Tooltip = 'Warmup iterations per benchmark phase' }
+        @{ Name = '-w'; Tooltip = 'Refresh volatile readouts every N seconds' }
+        @{ Name = '--watch'; Tooltip = 'Refresh volatile readouts every N seconds' }
         @{ Name = '--config-path'; Tooltip = 'Display config file location' }
         @{ Name = '--generate-completions'; Tooltip = 'Generate shell completions' }
         @{ Name = '--list-plugins'; Tooltip = 'List all available plugins' }
         @{ Name = '--plugin-info'; Tooltip = 'Show detailed plugin information' }
+        @{ Name = '--trace'; Tooltip = 'Write a Chrome trace file' }
     )
 
     $options | Where-Object { $_.Name -like "$wordToComplete*" } | ForEach-Object {
@@ -653,4 +1061,60 @@ Register-ArgumentCompleter -CommandName draconis++ -ScriptBlock {
       Println("Unknown shell: {}. Supported shells: bash, zsh, fish, powershell", shell);
     }
   }
+
+  auto SpawnCacheWarmer(const PCStr executable) -> Result<> {
+    using enum utils::error::DracErrorCode;
+
+#ifdef _WIN32
+    // argv[0] may be a bare name resolved through PATH; the module path never is.
+    Array<wchar_t, MAX_PATH> path {};
+
+    if (GetModuleFileNameW(nullptr, path.data(), static_cast<DWORD>(path.size())) == 0)
+      ERR_FMT(InternalError, "GetModuleFileNameW failed: {}", GetLastError());
+
+    std::wstring commandLine = std::format(L"\"{}\" --warm-cache", path.data());
+
+    STARTUPINFOW        startup { .cb = sizeof(STARTUPINFOW) };
+    PROCESS_INFORMATION process {};
+
+    if (!CreateProcessW(path.data(), commandLine.data(), nullptr, nullptr, FALSE, DETACHED_PROCESS | CREATE_NEW_PROCESS_GROUP | CREATE_NO_WINDOW, nullptr, nullptr, &startup, &process))
+      ERR_FMT(InternalError, "CreateProcessW failed: {}", GetLastError());
+
+    CloseHandle(process.hThread);
+    CloseHandle(process.hProcess);
+#else
+    posix_spawn_file_actions_t actions;
+    posix_spawnattr_t          attributes;
+
+    posix_spawn_file_actions_init(&actions);
+    posix_spawnattr_init(&attributes);
+
+    // Nothing the warmer logs should land in the terminal after the prompt is back.
+    posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+    posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_addopen(&actions, STDERR_FILENO, "/dev/null", O_WRONLY, 0);
+
+    // Its own session (or at least process group), so a Ctrl-C meant for the shell's next command doesn't reach it.
+  #ifdef POSIX_SPAWN_SETSID
+    posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETSID);
+  #else
+    posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+    posix_spawnattr_setpgroup(&attributes, 0);
+  #endif
+
+    Array<char*, 3> argv = { const_cast<char*>(executable), const_cast<char*>("--warm-cache"), nullptr }; // NOLINT(cppcoreguidelines-pro-type-const-cast) - posix_spawn doesn't write to argv
+
+    pid_t      child  = 0;
+    const auto status = posix_spawnp(&child, executable, &actions, &attributes, argv.data(), environ);
+
+    posix_spawnattr_destroy(&attributes);
+    posix_spawn_file_actions_destroy(&actions);
+
+    // Never waited for: this process exits right after, and init reaps the child.
+    if (status != 0)
+      ERR_FMT(InternalError, "Failed to start '{} --warm-cache': {}", executable, std::strerror(status));
+#endif
+
+    return {};
+  }
 } // namespace draconis::cli
@@ -4,8 +4,9 @@
  *
  * This file contains utility functions for CLI features including:
  * - Benchmark timing and reporting
+ * - Watch mode (incremental refresh of volatile readouts)
  * - Shell completion generation
- * - Various output format helpers (doctor, JSON, compact)
+ * - Various output format helpers (doctor, JSON, BEVE, compact)
  */
 
 #pragma once
@@ -18,30 +19,91 @@
 
 namespace draconis::cli {
   /**
-   * @brief Structure to hold benchmark timing results for each data source
+   * @brief Summary statistics over the timed iterations of one benchmark
+   */
+  struct BenchmarkStats {
+    utils::types::f64                       minMs    = 0.0;
+    utils::types::f64                       medianMs = 0.0;
+    utils::types::f64                       p95Ms    = 0.0;
+    utils::types::f64                       p99Ms    = 0.0;
+    utils::types::f64                       meanMs   = 0.0;
+    utils::types::usize                     samples  = 0;
+    utils::types::Option<utils::types::f64> allocations; ///< Mean heap allocations per iteration, across all threads; None unless built with `count_allocations`
+  };
+
+  /**
+   * @brief Timing results for a single benchmarked operation
+   *
+   * @details `cold` is measured with CacheManager::ignoreCache set, so every
+   * iteration pays the full probe cost. `warm` is measured afterwards with the
+   * cache enabled. Operations that don't go through the cache only have `warm`.
    */
   struct BenchmarkResult {
-    utils::types::String name;
-    utils::types::f64    durationMs;
-    bool                 success;
+    utils::types::String                 name;
+    utils::types::String                 group; ///< "core", "packages", "ui" or "plugins"
+    utils::types::Option<BenchmarkStats> cold;
+    BenchmarkStats                       warm;
+    bool                                 success = true; ///< False if any iteration failed
+  };
+
+  /**
+   * @brief Iteration counts for RunBenchmark
+   */
+  struct BenchmarkOptions {
+    utils::types::u32 iterations = 20; ///< Timed iterations per phase
+    utils::types::u32 warmup     = 3;  ///< Untimed iterations before each phase
   };
 
   /**
-   * @brief Run benchmark and collect timing information for each data source
+   * @brief Run the benchmark suite over every readout, package counter, UI rendering and plugin
    * @param cache Cache manager reference
    * @param config Application configuration
-   * @return Vector of benchmark results
+   * @param options Iteration counts
+   * @return Vector of benchmark results, in registration order
    */
   auto RunBenchmark(
     utils::cache::CacheManager& cache,
-    const config::Config&       config
+    const config::Config&       config,
+    const BenchmarkOptions&     options
   ) -> utils::types::Vec<BenchmarkResult>;
 
   /**
-   * @brief Print benchmark report showing timing for each data source
+   * @brief Print a human-readable benchmark report
    * @param results Vector of benchmark results
+   * @param options Iteration counts the results were gathered with
    */
-  auto PrintBenchmarkReport(const utils::types::Vec<BenchmarkResult>& results) -> utils::types::Unit;
+  auto PrintBenchmarkReport(const utils::types::Vec<BenchmarkResult>& results, const BenchmarkOptions& options) -> utils::types::Unit;
+
+  /**
+   * @brief Print benchmark results as JSON, for regression tracking in CI
+   * @param results Vector of benchmark results
+   * @param options Iteration counts the results were gathered with
+   * @param prettyJson Whether to pretty-print the JSON
+   */
+  auto PrintBenchmarkJson(
+    const utils::types::Vec<BenchmarkResult>& results,
+    const BenchmarkOptions&                   options,
+    bool                                      prettyJson
+  ) -> utils::types::Unit;
+
+  /**
+   * @brief Keep the process alive and periodically refresh volatile readouts
+   * @param cache Cache manager reference
+   * @param data System information collected once up front; refreshed in place
+   * @param intervalSeconds Render tick in seconds (must be positive)
+   * @param render Called with the updated data whenever a readout was refreshed
+   * @return Exit code
+   *
+   * @details Static readouts are never re-collected. Each volatile readout has
+   * its own refresh interval (never shorter than the tick), so most ticks only
+   * touch one or two cheap sources. Runs until SIGINT/SIGTERM.
+   */
+  auto RunWatchMode(
+    utils::cache::CacheManager&                                                  cache,
+    core::system::SystemInfo&                                                    data,
+    utils::types::f64                                                            intervalSeconds,
+    const utils::types::Fn<utils::types::Unit(const core::system::SystemInfo&)>& render
+  ) -> utils::types::i32;
 
   /**
    * @brief Print doctor report showing failed readouts
@@ -53,23 +115,84 @@ namespace draconis::cli {
    * @brief Print system information in JSON format
    * @param data System information data
    * @param prettyJson Whether to pretty-print the JSON
+   * @param buffer Scratch space for the document, reused across watch-mode refreshes
+   *
+   * @details Serializes straight from SystemInfo; nothing is copied into an intermediate struct.
    */
   auto PrintJsonOutput(
     const core::system::SystemInfo& data,
-    bool                            prettyJson
+    bool                            prettyJson,
+    utils::types::String&           buffer
   ) -> utils::types::Unit;
 
   /**
-   * @brief Print system information in compact single-line format using a template string
-   * @param templateStr Template string with placeholders like {key}
+   * @brief Write system information to stdout as BEVE, glaze's binary JSON encoding
    * @param data System information data
+   * @param buffer Scratch space for the document, reused across watch-mode refreshes
    *
-   * Placeholders use the format {key} where key matches any field from SystemInfo::toMap().
-   * Common keys: date, host, os, kernel, cpu, gpu, ram, disk, uptime, shell, de, wm, packages, playing
+   * @details Same fields as the JSON output, for collectors that would rather
+   * not parse text. Each refresh is one self-delimiting BEVE value.
+   */
+  auto PrintBeveOutput(
+    const core::system::SystemInfo& data,
+    utils::types::String&           buffer
+  ) -> utils::types::Unit;
+
+  /**
+   * @brief A --compact template with its placeholders resolved to fields
+   *
+   * @details Placeholders use the format {key}, where key is one of the
+   * INFO_FIELDS keys (date, host, os, kernel, cpu, gpu, ram, disk, uptime,
+   * shell, de, wm, packages, ...) or `plugin_<pluginId>_<fieldName>`. Keys
+   * are resolved once, when the template is parsed, so rendering formats only
+   * the referenced fields and does no string-keyed lookups for core fields.
+   * Unknown placeholders render as nothing.
+   */
+  class CompactTemplate {
+   public:
+    explicit CompactTemplate(utils::types::StringView templateStr);
+
+    /**
+     * @brief Plan collecting only the readouts behind the template's placeholders
+     */
+    [[nodiscard]] auto getCollectionPlan() const -> core::system::CollectionPlan;
+
+    /**
+     * @brief Expand the template
+     * @param data System information data
+     * @param out String to append the expanded line to
+     */
+    auto render(const core::system::SystemInfo& data, utils::types::String& out) const -> utils::types::Unit;
+
+   private:
+    struct PluginPlaceholder {
+      utils::types::String key; ///< `<pluginId>_<fieldName>`, without the prefix
+
+      /// Where the plugin ID ends within `key`, once it has been
+      /// found in collected data; the split stays the same across refreshes.
+      mutable utils::types::Option<utils::types::usize> idLength;
+    };
+
+    struct Segment {
+      utils::types::String                          literal; ///< Text before the placeholder
+      utils::types::Option<core::system::InfoField> field;
+      utils::types::Option<PluginPlaceholder>       plugin;
+    };
+
+    utils::types::Vec<Segment> m_segments;
+    bool                       m_usesPlugins = false;
+  };
+
+  /**
+   * @brief Print system information in compact single-line format
+   * @param compact Parsed template
+   * @param data System information data
+   * @param buffer Scratch space for the line, reused across watch-mode refreshes
    */
   auto PrintCompactOutput(
-    const utils::types::String&     templateStr,
-    const core::system::SystemInfo& data
+    const CompactTemplate&          compact,
+    const core::system::SystemInfo& data,
+    utils::types::String&           buffer
   ) -> utils::types::Unit;
 
 #if DRAC_ENABLE_PLUGINS
@@ -104,4 +227,14 @@ namespace draconis::cli {
    * @param shell The shell to generate completions for (bash, zsh, fish, powershell)
    */
   auto GenerateCompletions(const utils::types::String& shell) -> utils::types::Unit;
+
+  /**
+   * @brief Start `draconis++ --warm-cache` in the background without waiting for it
+   * @param executable This program as it was invoked (argv[0])
+   *
+   * @details Used after output when the run was served stale cache entries. The
+   * child runs in its own session with stdio on the null device, so the caller
+   * can exit straight away.
+   */
+  auto SpawnCacheWarmer(utils::types::PCStr executable) -> utils::types::Result<>;
 } // namespace draconis::cli
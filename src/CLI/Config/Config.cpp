@@ -2,6 +2,7 @@
 
 #include <magic_enum/magic_enum.hpp>
 
+#include <Drac++/Utils/CacheManager.hpp>
 #include <Drac++/Utils/Logging.hpp>
 
 #if !DRAC_PRECOMPILED_CONFIG
@@ -23,9 +24,11 @@ namespace fs = std::filesystem;
   #include "../config.hpp" // user-defined config
 #endif
 
-#if !DRAC_PRECOMPILED_CONFIG
 using namespace draconis::utils::types;
-using draconis::utils::env::GetEnv;
+using draconis::utils::cache::CacheManager;
+
+#if !DRAC_PRECOMPILED_CONFIG
+using draconis::utils::env::GetEnvSnapshot;
 using draconis::utils::logging::LogColor;
 
 // Intermediate structs for TOML parsing with glaze
@@ -49,8 +52,10 @@ namespace {
   };
 
   struct TomlPlugins {
-    bool        enabled = true;
-    Vec<String> autoLoad;
+    bool             enabled = true;
+    Vec<String>      autoLoad;
+    u32              collectTimeoutMs = 0; // 0 = no deadline
+    Map<String, u32> collectTimeoutsMs;    // Per-plugin overrides, keyed by provider ID
   };
 
   struct TomlLayoutRow {
@@ -107,7 +112,7 @@ struct glz::meta<TomlPackages> {
 template <>
 struct glz::meta<TomlPlugins> {
   using T                     = TomlPlugins;
-  static constexpr auto value = object("enabled", &T::enabled, "auto_load", &T::autoLoad);
+  static constexpr auto value = object("enabled", &T::enabled, "auto_load", &T::autoLoad, "collect_timeout_ms", &T::collectTimeoutMs, "collect_timeouts_ms", &T::collectTimeoutsMs);
 };
 
 template <>
@@ -149,32 +154,119 @@ struct glz::meta<TomlConfig> {
     #pragma clang diagnostic pop
   #endif
 
+// Field maps for the BEVE config snapshot; these mirror the runtime types, not the TOML layout.
+// clang-format off
+template <>
+struct glz::meta<draconis::config::General> {
+  using T                     = draconis::config::General;
+  static constexpr auto value = object("name", &T::name, "language", &T::language);
+};
+
+template <>
+struct glz::meta<draconis::config::Logo> {
+  using T                     = draconis::config::Logo;
+  static constexpr auto value = object(
+    "imagePath", &T::imagePath,
+    "protocol",  &T::protocol,
+    "width",     &T::width,
+    "height",    &T::height
+  );
+};
+
+template <>
+struct glz::meta<draconis::config::UILayoutRow> {
+  using T                     = draconis::config::UILayoutRow;
+  static constexpr auto value = object(
+    "key",         &T::key,
+    "label",       &T::label,
+    "icon",        &T::icon,
+    "color",       &T::color,
+    "autoWrap",    &T::autoWrap,
+    "kind",        &T::kind,
+    "pluginId",    &T::pluginId,
+    "pluginField", &T::pluginField
+  );
+};
+
+template <>
+struct glz::meta<draconis::config::UILayoutGroup> {
+  using T                     = draconis::config::UILayoutGroup;
+  static constexpr auto value = object("name", &T::name, "rows", &T::rows);
+};
+
+template <>
+struct glz::meta<draconis::config::UI> {
+  using T                     = draconis::config::UI;
+  static constexpr auto value = object("layout", &T::layout);
+};
+
+  #if DRAC_ENABLE_PLUGINS
+template <>
+struct glz::meta<draconis::core::plugin::PluginConfig> {
+  using T                     = draconis::core::plugin::PluginConfig;
+  static constexpr auto value = object(
+    "enabled",           &T::enabled,
+    "autoLoad",          &T::autoLoad,
+    "collectTimeoutMs",  &T::collectTimeoutMs,
+    "collectTimeoutsMs", &T::collectTimeoutsMs
+  );
+};
+  #endif
+
+template <>
+struct glz::meta<draconis::config::Config> {
+  using T                     = draconis::config::Config;
+  static constexpr auto value = object(
+    "general", &T::general,
+    "logo",    &T::logo,
+    "ui",      &T::ui
+  #if DRAC_ENABLE_PACKAGECOUNT
+    , "enabledPackageManagers", &T::enabledPackageManagers
+  #endif
+  #if DRAC_ENABLE_PLUGINS
+    , "plugins", &T::plugins
+  #endif
+  );
+};
+// clang-format on
+
 namespace draconis::config {
-  auto Config::getConfigPath() -> fs::path {
-    Vec<fs::path> possiblePaths;
+  namespace {
+    // Every location a config file may live in, in priority order.
+    auto ConfigCandidates() -> Vec<fs::path> {
+      Vec<fs::path> possiblePaths;
+
+      const draconis::utils::env::EnvSnapshot& env = GetEnvSnapshot();
 
   #ifdef _WIN32
-    if (Result<String> result = GetEnv("LOCALAPPDATA"))
-      possiblePaths.emplace_back(fs::path(*result) / "draconis++" / "config.toml");
+      if (env.localAppData)
+        possiblePaths.emplace_back(fs::path(*env.localAppData) / "draconis++" / "config.toml");
 
-    if (Result<String> result = GetEnv("USERPROFILE")) {
-      possiblePaths.emplace_back(fs::path(*result) / ".config" / "draconis++" / "config.toml");
-      possiblePaths.emplace_back(fs::path(*result) / "AppData" / "Local" / "draconis++" / "config.toml");
-    }
+      if (env.userProfile) {
+        possiblePaths.emplace_back(fs::path(*env.userProfile) / ".config" / "draconis++" / "config.toml");
+        possiblePaths.emplace_back(fs::path(*env.userProfile) / "AppData" / "Local" / "draconis++" / "config.toml");
+      }
 
-    if (Result<String> result = GetEnv("APPDATA"))
-      possiblePaths.emplace_back(fs::path(*result) / "draconis++" / "config.toml");
+      if (env.appData)
+        possiblePaths.emplace_back(fs::path(*env.appData) / "draconis++" / "config.toml");
   #else
-    if (Result<String> result = GetEnv("XDG_CONFIG_HOME"))
-      possiblePaths.emplace_back(fs::path(*result) / "draconis++" / "config.toml");
+      if (env.xdgConfigHome)
+        possiblePaths.emplace_back(fs::path(*env.xdgConfigHome) / "draconis++" / "config.toml");
 
-    if (Result<String> result = GetEnv("HOME")) {
-      possiblePaths.emplace_back(fs::path(*result) / ".config" / "draconis++" / "config.toml");
-      possiblePaths.emplace_back(fs::path(*result) / ".draconis++" / "config.toml");
-    }
+      if (env.home) {
+        possiblePaths.emplace_back(fs::path(*env.home) / ".config" / "draconis++" / "config.toml");
+        possiblePaths.emplace_back(fs::path(*env.home) / ".draconis++" / "config.toml");
+      }
   #endif
 
-    possiblePaths.emplace_back(fs::path(".") / "config.toml");
+      possiblePaths.emplace_back(fs::path(".") / "config.toml");
+
+      return possiblePaths;
+    }
+  } // namespace
+
+  auto Config::getConfigPath() -> fs::path {
+    const Vec<fs::path> possiblePaths = ConfigCandidates();
 
     for (const fs::path& path : possiblePaths)
       if (std::error_code errc; fs::exists(path, errc) && !errc)
@@ -243,19 +335,45 @@ namespace {
 namespace draconis::config {
 #if DRAC_PRECOMPILED_CONFIG
   namespace {
+    constexpr auto CountPrecompiledRows() -> usize {
+      usize count = 0;
+
+      for (const PrecompiledLayoutGroup& group : DRAC_UI_LAYOUT)
+        count += group.rows.size();
+
+      return count;
+    }
+
+    // Every row's kind, in layout order, resolved while compiling.
+    constexpr auto PRECOMPILED_ROW_KINDS = [] {
+      Array<RowKind, CountPrecompiledRows()> kinds {};
+      usize                                  index = 0;
+
+      for (const PrecompiledLayoutGroup& group : DRAC_UI_LAYOUT)
+        for (const PrecompiledLayoutRow& row : group.rows)
+          kinds[index++] = row.key ? ResolveRowKind(row.key) : RowKind::Unknown;
+
+      return kinds;
+    }();
+
     auto PopulatePrecompiledLayout(Config& cfg) -> void {
       cfg.ui.layout.clear();
 
+      usize rowIndex = 0;
+
       for (const auto& group : DRAC_UI_LAYOUT) {
         UILayoutGroup cfgGroup;
         cfgGroup.name = group.name ? group.name : "";
 
         for (const auto& row : group.rows) {
-          if (row.key == nullptr || std::strlen(row.key) == 0)
+          const RowKind kind = PRECOMPILED_ROW_KINDS[rowIndex++];
+
+          // Unknown keys (including empty ones) could never render, so they're dropped here.
+          if (kind == RowKind::Unknown)
             continue;
 
           UILayoutRow cfgRow;
-          cfgRow.key = row.key;
+          cfgRow.setKey(row.key, kind);
 
           if (row.label != nullptr && std::strlen(row.label) > 0)
             cfgRow.label = row.label;
@@ -272,52 +390,17 @@ namespace draconis::config {
       }
     }
   } // namespace
-#endif
-
-  auto Config::getInstance() -> Config {
-#if DRAC_PRECOMPILED_CONFIG
-    using namespace draconis::config;
-
-    Config cfg;
-    cfg.general.name = DRAC_USERNAME;
-
-    if constexpr (DRAC_ENABLE_PACKAGECOUNT)
-      cfg.enabledPackageManagers = config::DRAC_ENABLED_PACKAGE_MANAGERS;
-
-  #if DRAC_ENABLE_PLUGINS
-    cfg.plugins.enabled = true;
-    // Auto-load all statically compiled plugins
-    for (const auto& [name, entry] : draconis::core::plugin::GetStaticPluginRegistry())
-      cfg.plugins.autoLoad.emplace_back(name);
-  #endif
-
-    PopulatePrecompiledLayout(cfg);
-
-    // Logo settings from precompiled config
-    if (DRAC_LOGO.path != nullptr && std::strlen(DRAC_LOGO.path) > 0)
-      cfg.logo.imagePath = DRAC_LOGO.path;
-    if (DRAC_LOGO.protocol != nullptr && std::strlen(DRAC_LOGO.protocol) > 0)
-      cfg.logo.protocol = DRAC_LOGO.protocol;
-    if (DRAC_LOGO.width > 0)
-      cfg.logo.width = DRAC_LOGO.width;
-    if (DRAC_LOGO.height > 0)
-      cfg.logo.height = DRAC_LOGO.height;
-
-    debug_log("Using precompiled configuration.");
-    return cfg;
 #else
-    try {
-      const fs::path configPath = Config::getConfigPath();
-
-      std::error_code errc;
-
-      const bool exists = fs::exists(configPath, errc);
+  namespace {
+    // Reads the TOML config at `configPath` (creating a default one first if it's missing) and converts it.
+    auto LoadConfig(const fs::path& configPath) -> Result<Config> {
+      using enum draconis::utils::error::DracErrorCode;
 
-      if (!exists) {
+      if (std::error_code errc; !fs::exists(configPath, errc)) {
         info_log("Config file not found at {}, creating defaults.", configPath.string());
 
         if (!CreateDefaultConfig(configPath))
-          return {};
+          ERR_FMT(IoError, "Failed to create a default config file at {}", configPath.string());
       }
 
       // Parse TOML using glaze with lenient parsing (ignore unknown keys like [weather])
@@ -327,18 +410,14 @@ namespace draconis::config {
       // Read file into buffer
       glz::context ctx {};
       ctx.current_file = configPath.string();
-      if (const auto fileError = glz::file_to_buffer(buffer, ctx.current_file); bool(fileError)) {
-        error_log("Failed to read config file: {}", configPath.string());
-        return {};
-      }
+      if (const auto fileError = glz::file_to_buffer(buffer, ctx.current_file); bool(fileError))
+        ERR_FMT(IoError, "Failed to read config file: {}", configPath.string());
 
       // Parse with error_on_unknown_keys = false to allow plugin sections like [weather]
       const auto readError = glz::read<glz::opts { .format = glz::TOML, .error_on_unknown_keys = false }>(tomlCfg, buffer, ctx);
 
-      if (readError) {
-        error_log("Failed to parse config file: {}", glz::format_error(readError, buffer));
-        return {};
-      }
+      if (readError)
+        ERR_FMT(ParseError, "Failed to parse config file: {}", glz::format_error(readError, buffer));
 
       debug_log("Config loaded from {}", configPath.string());
 
@@ -419,8 +498,10 @@ namespace draconis::config {
 
       // Plugin settings
       if constexpr (DRAC_ENABLE_PLUGINS) {
-        cfg.plugins.enabled  = tomlCfg.plugins.enabled;
-        cfg.plugins.autoLoad = tomlCfg.plugins.autoLoad;
+        cfg.plugins.enabled           = tomlCfg.plugins.enabled;
+        cfg.plugins.autoLoad          = tomlCfg.plugins.autoLoad;
+        cfg.plugins.collectTimeoutMs  = tomlCfg.plugins.collectTimeoutMs;
+        cfg.plugins.collectTimeoutsMs = tomlCfg.plugins.collectTimeoutsMs;
       }
 
       // UI layout settings
@@ -434,7 +515,7 @@ namespace draconis::config {
             continue;
 
           UILayoutRow cfgRow;
-          cfgRow.key = row.key;
+          cfgRow.setKey(row.key);
           if (!row.label.empty())
             cfgRow.label = row.label;
           if (!row.icon.empty())
@@ -451,6 +532,80 @@ namespace draconis::config {
       }
 
       return cfg;
+    }
+  } // namespace
+#endif
+
+  auto Config::getInstance() -> Config {
+#if DRAC_PRECOMPILED_CONFIG
+    using namespace draconis::config;
+
+    Config cfg;
+    cfg.general.name = DRAC_USERNAME;
+
+    if constexpr (DRAC_ENABLE_PACKAGECOUNT)
+      cfg.enabledPackageManagers = config::DRAC_ENABLED_PACKAGE_MANAGERS;
+
+  #if DRAC_ENABLE_PLUGINS
+    cfg.plugins.enabled = true;
+    // Auto-load all statically compiled plugins
+    for (const draconis::core::plugin::StaticPluginEntry& entry : draconis::core::plugin::GetStaticPlugins())
+      cfg.plugins.autoLoad.emplace_back(entry.name);
+  #endif
+
+    PopulatePrecompiledLayout(cfg);
+
+    // Logo settings from precompiled config
+    if (DRAC_LOGO.path != nullptr && std::strlen(DRAC_LOGO.path) > 0)
+      cfg.logo.imagePath = DRAC_LOGO.path;
+    if (DRAC_LOGO.protocol != nullptr && std::strlen(DRAC_LOGO.protocol) > 0)
+      cfg.logo.protocol = DRAC_LOGO.protocol;
+    if (DRAC_LOGO.width > 0)
+      cfg.logo.width = DRAC_LOGO.width;
+    if (DRAC_LOGO.height > 0)
+      cfg.logo.height = DRAC_LOGO.height;
+
+    debug_log("Using precompiled configuration.");
+    return cfg;
+#else
+    try {
+      Result<Config> cfg = LoadConfig(Config::getConfigPath());
+
+      if (!cfg) {
+        error_at(cfg.error());
+        return {};
+      }
+
+      return *std::move(cfg);
+    } catch (const Exception& exc) {
+      debug_log("Config loading failed: {}, using defaults", exc.what());
+      return {};
+    } catch (...) {
+      error_log("An unexpected error occurred during config loading. Using in-memory defaults.");
+      return {};
+    }
+#endif // DRAC_PRECOMPILED_CONFIG
+  }
+
+  auto Config::getInstance(CacheManager& cache) -> Config {
+#if DRAC_PRECOMPILED_CONFIG
+    (void)cache;
+    return getInstance();
+#else
+    try {
+      // Every candidate location is a source, so creating, replacing or editing any of
+      // them invalidates the snapshot; a warm start costs one stat() per candidate.
+      // The version suffix changes whenever the snapshot's fields do.
+      Result<Config> cfg = cache.getOrSetValidated<Config>("config_snapshot_v2", ConfigCandidates(), [] -> Result<Config> {
+        return LoadConfig(Config::getConfigPath());
+      });
+
+      if (!cfg) {
+        error_at(cfg.error());
+        return {};
+      }
+
+      return *std::move(cfg);
     } catch (const Exception& exc) {
       debug_log("Config loading failed: {}, using defaults", exc.what());
       return {};
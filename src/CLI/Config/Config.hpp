@@ -1,12 +1,15 @@
 #pragma once
 
+#include <algorithm> // std::ranges::{equal, transform}
+#include <string>    // std::char_traits
+
 #if !DRAC_PRECOMPILED_CONFIG
   #include <cctype>     // std::tolower
   #include <filesystem> // std::filesystem::path
-
-  #include <Drac++/Utils/Logging.hpp>
 #endif
 
+#include <Drac++/Utils/Logging.hpp>
+
 #if DRAC_ENABLE_PACKAGECOUNT
   #include <Drac++/Services/Packages.hpp>
 #endif
@@ -20,6 +23,7 @@
   #include <Drac++/Utils/Env.hpp>
 #endif
 
+#include <Drac++/Utils/CacheManager.hpp>
 #include <Drac++/Utils/Types.hpp>
 
 #if DRAC_ENABLE_PLUGINS
@@ -79,20 +83,19 @@ namespace draconis::config {
 
       return GetUserNameA(username.data(), &size) ? username.data() : "User";
 #else
-      using draconis::utils::env::GetEnv;
-      using draconis::utils::types::PCStr, draconis::utils::types::String, draconis::utils::types::Result;
+      using draconis::utils::env::EnvSnapshot, draconis::utils::env::GetEnvSnapshot;
+      using draconis::utils::types::PCStr;
 
       info_log("Getting default name from system");
 
-      const passwd*        pwd        = getpwuid(getuid());
-      PCStr                pwdName    = pwd ? pwd->pw_name : nullptr;
-      const Result<String> envUser    = GetEnv("USER");
-      const Result<String> envLogname = GetEnv("LOGNAME");
+      const passwd*      pwd     = getpwuid(getuid());
+      PCStr              pwdName = pwd ? pwd->pw_name : nullptr;
+      const EnvSnapshot& env     = GetEnvSnapshot();
 
       return pwdName ? pwdName
-        : envUser    ? *envUser
-        : envLogname ? *envLogname
-                     : "User";
+        : env.user    ? *env.user
+        : env.logname ? *env.logname
+                      : "User";
 #endif // _WIN32
     }
 
@@ -103,15 +106,112 @@ namespace draconis::config {
     }
   };
 
+  /**
+   * @brief What a layout row displays, resolved from its key when the layout is loaded.
+   */
+  enum class RowKind : draconis::utils::types::u8 {
+    Unknown, ///< Neither a built-in row nor a plugin key; never rendered.
+    Date,
+    Host,
+    OperatingSystem,
+    Kernel,
+    Memory,
+    Disk,
+    CPU,
+    GPU,
+    Uptime,
+    Shell,
+    Packages,
+    DesktopEnv,
+    WindowMgr,
+    Plugin, ///< "plugin.<id>" or "plugin.<id>.<field>".
+  };
+
+  inline constexpr draconis::utils::types::usize ROW_KIND_COUNT = static_cast<draconis::utils::types::usize>(RowKind::Plugin) + 1;
+
+  /**
+   * @brief Resolves a layout key to the row it names.
+   * @details Built-in keys are case-insensitive; the "plugin." prefix is not.
+   *          Usable at compile time, which is how precompiled layouts resolve their rows.
+   */
+  constexpr auto ResolveRowKind(const draconis::utils::types::StringView key) -> RowKind {
+    using draconis::utils::types::Array, draconis::utils::types::Pair, draconis::utils::types::StringView;
+
+    constexpr StringView PLUGIN_PREFIX = "plugin.";
+
+    if (key.starts_with(PLUGIN_PREFIX))
+      return key.size() > PLUGIN_PREFIX.size() ? RowKind::Plugin : RowKind::Unknown;
+
+    // clang-format off
+    constexpr Array<Pair<StringView, RowKind>, 14> BUILTIN_ROWS = {{
+      { "date",     RowKind::Date            },
+      { "host",     RowKind::Host            },
+      { "os",       RowKind::OperatingSystem },
+      { "kernel",   RowKind::Kernel          },
+      { "ram",      RowKind::Memory          },
+      { "disk",     RowKind::Disk            },
+      { "cpu",      RowKind::CPU             },
+      { "gpu",      RowKind::GPU             },
+      { "uptime",   RowKind::Uptime          },
+      { "shell",    RowKind::Shell           },
+      { "packages", RowKind::Packages        },
+      { "package",  RowKind::Packages        },
+      { "de",       RowKind::DesktopEnv      },
+      { "wm",       RowKind::WindowMgr       },
+    }};
+    // clang-format on
+
+    const auto lower = [](const char chr) -> char { return chr >= 'A' && chr <= 'Z' ? static_cast<char>(chr - 'A' + 'a') : chr; };
+
+    for (const auto& [name, kind] : BUILTIN_ROWS)
+      if (std::ranges::equal(key, name, {}, lower))
+        return kind;
+
+    return RowKind::Unknown;
+  }
+
   /**
    * @brief A single row in the UI layout, optionally overriding label/icon.
    */
   struct UILayoutRow {
-    draconis::utils::types::String                                 key;                                                  ///< Identifier for the row (e.g., "cpu", "plugin.weather.temp").
+    draconis::utils::types::String                                 key;                                                  ///< Identifier for the row (e.g., "cpu", "plugin.weather.temp"); set through setKey().
     draconis::utils::types::Option<draconis::utils::types::String> label    = std::nullopt;                              ///< Optional label override.
     draconis::utils::types::Option<draconis::utils::types::String> icon     = std::nullopt;                              ///< Optional icon override.
     draconis::utils::logging::LogColor                             color    = draconis::utils::logging::LogColor::White; ///< Value foreground color.
     bool                                                           autoWrap = false;                                     ///< Enable automatic word wrapping based on available width.
+    RowKind                                                        kind     = RowKind::Unknown;                          ///< What `key` names.
+    draconis::utils::types::String                                 pluginId;                                             ///< Provider ID, for RowKind::Plugin.
+    draconis::utils::types::Option<draconis::utils::types::String> pluginField;                                          ///< Field of the plugin's data, if the key names one.
+
+    /**
+     * @brief Sets the key along with a kind that was already resolved (e.g. at compile time).
+     */
+    auto setKey(draconis::utils::types::String newKey, const RowKind resolvedKind) -> void {
+      key  = std::move(newKey);
+      kind = resolvedKind;
+
+      pluginId.clear();
+      pluginField.reset();
+
+      if (kind != RowKind::Plugin)
+        return;
+
+      const draconis::utils::types::StringView rest   = draconis::utils::types::StringView(key).substr(std::char_traits<char>::length("plugin."));
+      const draconis::utils::types::usize      sepPos = rest.find('.');
+
+      pluginId = rest.substr(0, sepPos);
+
+      if (sepPos != draconis::utils::types::StringView::npos)
+        pluginField = draconis::utils::types::String(rest.substr(sepPos + 1));
+    }
+
+    /**
+     * @brief Sets the key and resolves what it names.
+     */
+    auto setKey(draconis::utils::types::String newKey) -> void {
+      const RowKind resolvedKind = ResolveRowKind(newKey);
+      setKey(std::move(newKey), resolvedKind);
+    }
   };
 
   /**
@@ -166,6 +266,19 @@ namespace draconis::config {
      */
     static auto getInstance() -> Config;
 
+    /**
+     * @brief Loads the configuration through a BEVE snapshot in @p cache.
+     * @param cache Cache holding the snapshot of the last parsed config.
+     * @return The configuration settings.
+     *
+     * The snapshot holds the parsed and converted Config and is validated
+     * against every candidate config location (see getConfigPath()), so a warm
+     * start skips reading and parsing the TOML file entirely. Editing, creating
+     * or removing any candidate file re-parses it. With a precompiled
+     * configuration this is the same as getInstance().
+     */
+    static auto getInstance(draconis::utils::cache::CacheManager& cache) -> Config;
+
 #if !DRAC_PRECOMPILED_CONFIG
     /**
      * @brief Gets the path to the configuration file without loading it.
@@ -0,0 +1,52 @@
+#include "Allocations.hpp"
+
+#if DRAC_COUNT_ALLOCATIONS
+
+  #include <atomic>  // std::atomic
+  #include <cstdlib> // std::malloc, std::free
+  #include <new>     // std::bad_alloc, std::get_new_handler
+
+namespace {
+  std::atomic<draconis::utils::types::u64> AllocationCount = 0;
+} // namespace
+
+namespace draconis::cli {
+  auto GetAllocationCount() noexcept -> utils::types::Option<utils::types::u64> {
+    return AllocationCount.load(std::memory_order_relaxed);
+  }
+} // namespace draconis::cli
+
+// The array and nothrow forms default to these, so replacing them covers every unaligned allocation.
+auto operator new(const std::size_t size) -> void* {
+  AllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+  while (true) {
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+      return ptr;
+
+    std::new_handler handler = std::get_new_handler();
+
+    if (!handler)
+      throw std::bad_alloc();
+
+    handler();
+  }
+}
+
+auto operator delete(void* ptr) noexcept -> void {
+  std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::size_t /*size*/) noexcept -> void {
+  std::free(ptr);
+}
+
+#else
+
+namespace draconis::cli {
+  auto GetAllocationCount() noexcept -> utils::types::Option<utils::types::u64> {
+    return utils::types::None;
+  }
+} // namespace draconis::cli
+
+#endif // DRAC_COUNT_ALLOCATIONS
@@ -0,0 +1,27 @@
+/**
+ * @file Allocations.hpp
+ * @brief Process-wide heap allocation counter for the CLI.
+ *
+ * With the `count_allocations` build option, the CLI replaces the global
+ * `operator new`/`operator delete` with versions that forward to malloc/free
+ * and bump a relaxed counter, so `--benchmark` can report how many allocations
+ * each operation makes. The count covers every thread, including package
+ * counters and the async log writer.
+ *
+ * The option is off by default. The counter costs an atomic increment on every
+ * allocation, and a contended cache line when several threads allocate at once.
+ * The replacement also takes `operator new` away from the allocator that would
+ * otherwise provide it. Release builds keep the usual allocator.
+ */
+
+#pragma once
+
+#include <Drac++/Utils/Types.hpp>
+
+namespace draconis::cli {
+  /**
+   * @brief Number of `operator new` calls since the process started.
+   * @return None unless built with `count_allocations`.
+   */
+  auto GetAllocationCount() noexcept -> utils::types::Option<utils::types::u64>;
+} // namespace draconis::cli
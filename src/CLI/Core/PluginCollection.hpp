@@ -0,0 +1,108 @@
+/**
+ * @file PluginCollection.hpp
+ * @brief State shared between SystemInfo and one in-progress plugin collection.
+ *
+ * The collecting thread (or the async completion callback) and the thread
+ * waiting on the deadline both hold a reference, so a collection that misses
+ * its deadline stays valid until the plugin finally reports back.
+ */
+
+#pragma once
+
+#if DRAC_ENABLE_PLUGINS
+
+  #include <atomic>
+  #include <chrono>
+  #include <condition_variable>
+  #include <filesystem>
+  #include <format>
+
+  #include <Drac++/Core/Plugin.hpp>
+  #include <Drac++/Core/PluginManager.hpp>
+
+  #include <Drac++/Utils/Types.hpp>
+
+namespace draconis::core::system {
+  struct PluginCollection {
+    // Each collection gets its own cache instance; PluginCache isn't thread-safe.
+    explicit PluginCollection(const std::filesystem::path& cacheDir) : cache(cacheDir, ::PluginCache::WriteMode::WriteBehind) {}
+
+    ::PluginCache cache;
+
+    utils::types::Mutex     mutex;
+    std::condition_variable ready;
+    bool                    done = false;
+
+    utils::types::Option<utils::types::Map<utils::types::String, utils::types::String>> fields;
+    utils::types::Option<utils::types::String>                                          displayValue;
+    utils::types::String                                                                error;
+
+    /**
+     * @brief Records the result and releases the plugin's collection hold
+     * @details Only the first call counts: a plugin that reports twice (or
+     * throws after reporting) can't overwrite the result or end the
+     * collection a second time.
+     * @return false if the collection had already finished.
+     */
+    auto finish(const plugin::IInfoProviderPlugin* plugin, const utils::types::Result<> result) -> bool {
+      if (m_finished.exchange(true, std::memory_order_acq_rel))
+        return false;
+
+      complete(plugin, result);
+      plugin::PluginManager::endCollection(plugin);
+
+      return true;
+    }
+
+    /**
+     * @brief Waits for the collection to finish
+     * @param deadline Give up at this point; None waits indefinitely.
+     * @return true if the collection finished in time.
+     */
+    auto wait(const utils::types::Option<std::chrono::steady_clock::time_point>& deadline) -> bool {
+      std::unique_lock lock(mutex);
+
+      if (deadline)
+        return ready.wait_until(lock, *deadline, [&] { return done; });
+
+      ready.wait(lock, [&] { return done; });
+      return true;
+    }
+
+   private:
+    std::atomic<bool> m_finished = false;
+
+    auto complete(const plugin::IInfoProviderPlugin* plugin, const utils::types::Result<> result) -> utils::types::Unit {
+      utils::types::Option<utils::types::Map<utils::types::String, utils::types::String>> collectedFields;
+      utils::types::Option<utils::types::String>                                          collectedDisplayValue;
+      utils::types::String                                                                collectedError;
+
+      try {
+        if (result) {
+          collectedFields = plugin->getFields();
+
+          if (auto value = plugin->getDisplayValue(); value)
+            collectedDisplayValue = std::move(*value);
+        } else {
+          collectedError = result.error().message;
+        }
+      } catch (const std::exception& e) {
+        collectedError = std::format("exception: {}", e.what());
+      } catch (...) {
+        collectedError = "unknown exception";
+      }
+
+      {
+        utils::types::LockGuard lock(mutex);
+        fields       = std::move(collectedFields);
+        displayValue = std::move(collectedDisplayValue);
+        error        = std::move(collectedError);
+        done         = true;
+      }
+
+      ready.notify_all();
+    }
+  };
+} // namespace draconis::core::system
+
+#endif // DRAC_ENABLE_PLUGINS
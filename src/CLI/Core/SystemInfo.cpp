@@ -1,5 +1,10 @@
 #include "SystemInfo.hpp"
 
+#include <iterator>
+#include <magic_enum/magic_enum.hpp>
+#include <thread>
+
+#include <Drac++/Core/Collector.hpp>
 #include <Drac++/Core/System.hpp>
 
 #if DRAC_ENABLE_PLUGINS
@@ -8,18 +13,43 @@
 
 #include <Drac++/Utils/Error.hpp>
 #include <Drac++/Utils/Logging.hpp>
+#include <Drac++/Utils/Tracing.hpp>
 #include <Drac++/Utils/Types.hpp>
 
 #include "Config/Config.hpp"
+#include "PluginCollection.hpp"
+
+#if DRAC_ENABLE_PLUGINS
+namespace draconis::core::system {
+  namespace {
+    // What a plugin last reported, kept so a missed deadline can fall back to it.
+    struct CollectedPluginData {
+      utils::types::Map<utils::types::String, utils::types::String> fields;
+      utils::types::Option<utils::types::String>                    displayValue;
+    };
+  } // namespace
+} // namespace draconis::core::system
+
+template <>
+struct glz::meta<draconis::core::system::CollectedPluginData> {
+  using T                     = draconis::core::system::CollectedPluginData;
+  static constexpr auto value = object("fields", &T::fields, "displayValue", &T::displayValue);
+};
+#endif
 
 namespace draconis::core::system {
   namespace {
     using draconis::config::Config;
+    using draconis::core::collector::Collector;
+    using draconis::core::collector::TaskId;
+    using draconis::core::collector::TaskTiming;
+    using draconis::utils::error::DracError;
     using namespace draconis::utils::types;
 
     using enum draconis::utils::error::DracErrorCode;
 
 #if DRAC_ENABLE_PLUGINS
+    using draconis::core::plugin::IAsyncInfoProviderPlugin;
     using draconis::core::plugin::IInfoProviderPlugin;
 #endif
 
@@ -61,10 +91,43 @@ namespace draconis::core::system {
 
       ERR(ParseError, "Failed to get local time");
     }
+
+    auto GetBattery([[maybe_unused]] utils::cache::CacheManager& cache) -> Result<Battery> {
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+      return GetBatteryInfo(cache);
+#else
+      ERR(NotSupported, "Battery information is not available on this platform");
+#endif
+    }
   } // namespace
 
-  SystemInfo::SystemInfo(utils::cache::CacheManager& cache, const Config& config) {
-    debug_log("SystemInfo: Starting construction");
+  SystemInfo::SystemInfo(utils::cache::CacheManager& cache, const Config& config, const CollectionPlan& plan) {
+    // Readouts the plan leaves out must not look like successful empty values.
+    const auto notCollected = Err(DracError(NotFound, "Readout was not collected for this output"));
+
+    date            = notCollected;
+    host            = notCollected;
+    kernelVersion   = notCollected;
+    operatingSystem = notCollected;
+    memInfo         = notCollected;
+    desktopEnv      = notCollected;
+    windowMgr       = notCollected;
+    diskUsage       = notCollected;
+    shell           = notCollected;
+    cpuModel        = notCollected;
+    cpuCores        = notCollected;
+    gpuModel        = notCollected;
+    uptime          = notCollected;
+    battery         = notCollected;
+#if DRAC_ENABLE_PACKAGECOUNT
+    packageCount = notCollected;
+#endif
+
+    collect(cache, config, plan);
+  }
+
+  auto SystemInfo::collect(utils::cache::CacheManager& cache, const Config& config, const CollectionPlan& plan) -> Unit {
+    debug_log("SystemInfo: Starting collection");
 
     // I'm not sure if AMD uses trademark symbols in their CPU models, but I know
     // Intel does. Might as well replace them with their unicode counterparts.
@@ -82,125 +145,203 @@ namespace draconis::core::system {
       return value;
     };
 
-    debug_log("SystemInfo: Getting desktop environment");
-    this->desktopEnv = GetDesktopEnvironment(cache);
-    debug_log("SystemInfo: Getting window manager");
-    this->windowMgr = GetWindowManager(cache);
-    debug_log("SystemInfo: Getting operating system");
-    this->operatingSystem = GetOperatingSystem(cache);
-    debug_log("SystemInfo: Getting kernel version");
-    this->kernelVersion = GetKernelVersion(cache);
-    debug_log("SystemInfo: Getting host");
-    this->host = GetHost(cache);
-    debug_log("SystemInfo: Getting CPU model");
-    this->cpuModel = replaceTrademarkSymbols(GetCPUModel(cache));
-    debug_log("SystemInfo: Getting CPU cores");
-    this->cpuCores = GetCPUCores(cache);
-    debug_log("SystemInfo: Getting GPU model");
-    this->gpuModel = GetGPUModel(cache);
-    debug_log("SystemInfo: Getting shell");
-    this->shell = GetShell(cache);
-    debug_log("SystemInfo: Getting memory info");
-    this->memInfo = GetMemInfo(cache);
-    debug_log("SystemInfo: Getting disk usage");
-    this->diskUsage = GetDiskUsage(cache);
-    debug_log("SystemInfo: Getting uptime");
-    this->uptime = GetUptime();
-    debug_log("SystemInfo: Getting date");
-    this->date = GetDate();
-
-    if constexpr (DRAC_ENABLE_PACKAGECOUNT) {
-      debug_log("SystemInfo: Getting package count");
+    // Every readout is an independent task; the collector runs them on a small
+    // worker pool so startup time is bounded by the slowest probe rather than
+    // the sum of all of them. Each task writes only to its own member.
+    Collector collector;
+
+    // Only schedule readouts the plan asks for and that haven't run yet.
+    const auto wanted = [&](const Readout readout) -> bool {
+      return HasReadout(plan.readouts, readout) && !HasReadout(m_collected, readout);
+    };
+
+    const auto addReadout = [&](const Readout readout, const StringView name, Fn<Unit()> work) -> Unit {
+      if (!wanted(readout))
+        return;
+
+      collector.add(String(name), std::move(work));
+      m_collected |= readout;
+    };
+
+    addReadout(Readout::DesktopEnv, "desktop_environment", [&] { this->desktopEnv = GetDesktopEnvironment(cache); });
+    addReadout(Readout::WindowMgr, "window_manager", [&] { this->windowMgr = GetWindowManager(cache); });
+    addReadout(Readout::OperatingSystem, "operating_system", [&] { this->operatingSystem = GetOperatingSystem(cache); });
+    addReadout(Readout::Kernel, "kernel_version", [&] { this->kernelVersion = GetKernelVersion(cache); });
+    addReadout(Readout::Host, "host", [&] { this->host = GetHost(cache); });
+    addReadout(Readout::CPUModel, "cpu_model", [&] { this->cpuModel = replaceTrademarkSymbols(GetCPUModel(cache)); });
+    addReadout(Readout::CPUCores, "cpu_cores", [&] { this->cpuCores = GetCPUCores(cache); });
+    addReadout(Readout::GPUModel, "gpu_model", [&] { this->gpuModel = GetGPUModel(cache); });
+    addReadout(Readout::Shell, "shell", [&] { this->shell = GetShell(cache); });
+    addReadout(Readout::Memory, "memory", [&] { this->memInfo = GetMemInfo(cache); });
+    addReadout(Readout::DiskUsage, "disk_usage", [&] { this->diskUsage = GetDiskUsage(cache); });
+    addReadout(Readout::Uptime, "uptime", [&] { this->uptime = GetUptime(); });
+    addReadout(Readout::Battery, "battery", [&] { this->battery = GetBattery(cache); });
+    addReadout(Readout::Date, "date", [&] { this->date = GetDate(); });
+
+#if DRAC_ENABLE_PACKAGECOUNT
+    addReadout(Readout::Packages, "package_count", [&] {
       this->packageCount = draconis::services::packages::GetTotalCount(cache, config.enabledPackageManagers);
+    });
+#else
+    (void)config;
+#endif
+
+#if DRAC_ENABLE_PLUGINS
+    if (HasReadout(plan.readouts, Readout::Plugins) && !m_collectedAllPlugins) {
+      Option<Vec<String>> pendingPlugins = None;
+
+      if (plan.pluginIds) {
+        pendingPlugins.emplace();
+
+        for (const String& pluginId : *plan.pluginIds)
+          if (std::ranges::find(m_collectedPlugins, pluginId) == m_collectedPlugins.end())
+            pendingPlugins->push_back(pluginId);
+      }
+
+      if (!pendingPlugins || !pendingPlugins->empty()) {
+        m_pluginConfig = config.plugins;
+
+        // Plugins have to be loaded before any of them can be asked for data.
+        const TaskId loadPluginsTask = collector.add("plugins_load", [this, &cache, pendingPlugins] { loadPlugins(cache, pendingPlugins); });
+        collector.add("plugins_collect", [this, pendingPlugins] { collectPluginData(pendingPlugins); }, { loadPluginsTask });
+
+        if (!pendingPlugins) {
+          m_collectedAllPlugins = true;
+          m_collected |= Readout::Plugins;
+        }
+      }
     }
+#endif
+
+    collector.run();
+
+    for (const TaskTiming& timing : collector.timings())
+      debug_log("SystemInfo: {} took {:.2f}ms", timing.name, timing.durationMs);
+
+    debug_log("SystemInfo: Collection complete ({} tasks)", collector.size());
+  }
 
+  auto SystemInfo::refresh(utils::cache::CacheManager& cache, const std::span<const VolatileField> fields) -> Unit {
+    using enum VolatileField;
+
+    // These are all cheap, uncached readouts, so they run inline rather than
+    // paying for a worker pool on every tick. Readouts the output never asked
+    // for stay uncollected.
+    for (const VolatileField field : fields)
+      switch (field) {
+        case Date:      if (hasCollected(Readout::Date)) date = GetDate(); break;
+        case Memory:    if (hasCollected(Readout::Memory)) memInfo = GetMemInfo(cache); break;
+        case DiskUsage: if (hasCollected(Readout::DiskUsage)) diskUsage = GetDiskUsage(cache); break;
+        case Uptime:    if (hasCollected(Readout::Uptime)) uptime = GetUptime(); break;
+        case Battery:   if (hasCollected(Readout::Battery)) battery = GetBattery(cache); break;
+        case Plugins:
 #if DRAC_ENABLE_PLUGINS
-    debug_log("SystemInfo: Collecting plugin data");
-    // Collect plugin data efficiently (only if plugins are enabled and initialized)
-    collectPluginData(cache);
+          if (m_collectedAllPlugins || !m_collectedPlugins.empty()) {
+            pluginData.clear();
+            pluginDisplay.clear();
+            collectPluginData(m_collectedAllPlugins ? None : Option<Vec<String>>(m_collectedPlugins));
+          }
 #endif
-    debug_log("SystemInfo: Construction complete");
+          break;
+      }
   }
 
-  auto SystemInfo::toMap() const -> Map<String, String> {
-    Map<String, String> data;
+  auto SystemInfo::appendField(const InfoField field, String& out) const -> bool {
+    using enum InfoField;
 
-    // Basic system info
-    if (date)
-      data["date"] = *date;
-    if (host)
-      data["host"] = *host;
-    if (kernelVersion)
-      data["kernel"] = *kernelVersion;
-    if (shell)
-      data["shell"] = *shell;
-
-    // CPU info
-    if (cpuModel)
-      data["cpu"] = *cpuModel;
-    if (cpuCores) {
-      data["cpu_cores_physical"] = std::to_string(cpuCores->physical);
-      data["cpu_cores_logical"]  = std::to_string(cpuCores->logical);
-    }
+    // `Battery` names the field below, not the type.
+    constexpr auto notPresent = utils::types::Battery::Status::NotPresent;
 
-    // GPU info
-    if (gpuModel)
-      data["gpu"] = *gpuModel;
-
-    // Desktop environment
-    if (desktopEnv)
-      data["de"] = *desktopEnv;
-    if (windowMgr)
-      data["wm"] = *windowMgr;
-
-    // Operating system info
-    if (operatingSystem) {
-      data["os"]         = std::format("{} {}", operatingSystem->name, operatingSystem->version);
-      data["os_name"]    = operatingSystem->name;
-      data["os_version"] = operatingSystem->version;
-      if (!operatingSystem->id.empty())
-        data["os_id"] = operatingSystem->id;
-    }
+    const auto append = [&out]<typename... Args>(std::format_string<Args...> fmt, Args&&... args) -> bool {
+      std::format_to(std::back_inserter(out), fmt, std::forward<Args>(args)...);
+      return true;
+    };
 
-    // Memory info
-    if (memInfo) {
-      data["ram"]                = std::format("{}/{}", BytesToGiB(memInfo->usedBytes), BytesToGiB(memInfo->totalBytes));
-      data["memory_used_bytes"]  = std::to_string(memInfo->usedBytes);
-      data["memory_total_bytes"] = std::to_string(memInfo->totalBytes);
-    }
+    const auto appendString = [&out](const Result<String>& value) -> bool {
+      if (!value)
+        return false;
 
-    // Disk info
-    if (diskUsage) {
-      data["disk"]             = std::format("{}/{}", BytesToGiB(diskUsage->usedBytes), BytesToGiB(diskUsage->totalBytes));
-      data["disk_used_bytes"]  = std::to_string(diskUsage->usedBytes);
-      data["disk_total_bytes"] = std::to_string(diskUsage->totalBytes);
-    }
+      out += *value;
+      return true;
+    };
 
-    // Uptime
-    if (uptime) {
-      data["uptime"]         = std::format("{}", SecondsToFormattedDuration { *uptime });
-      data["uptime_seconds"] = std::to_string(uptime->count());
+    switch (field) {
+      case Date:       return appendString(date);
+      case Host:       return appendString(host);
+      case Kernel:     return appendString(kernelVersion);
+      case Shell:      return appendString(shell);
+      case CPU:        return appendString(cpuModel);
+      case GPU:        return appendString(gpuModel);
+      case DesktopEnv: return appendString(desktopEnv);
+      case WindowMgr:  return appendString(windowMgr);
+
+      case CPUCoresPhysical: return cpuCores && append("{}", cpuCores->physical);
+      case CPUCoresLogical:  return cpuCores && append("{}", cpuCores->logical);
+
+      case OS:        return operatingSystem && append("{} {}", operatingSystem->name, operatingSystem->version);
+      case OSName:    return operatingSystem && append("{}", operatingSystem->name);
+      case OSVersion: return operatingSystem && append("{}", operatingSystem->version);
+      case OSId:      return operatingSystem && !operatingSystem->id.empty() && append("{}", operatingSystem->id);
+
+      case RAM:              return memInfo && append("{}/{}", BytesToGiB(memInfo->usedBytes), BytesToGiB(memInfo->totalBytes));
+      case MemoryUsedBytes:  return memInfo && append("{}", memInfo->usedBytes);
+      case MemoryTotalBytes: return memInfo && append("{}", memInfo->totalBytes);
+
+      case Disk:           return diskUsage && append("{}/{}", BytesToGiB(diskUsage->usedBytes), BytesToGiB(diskUsage->totalBytes));
+      case DiskUsedBytes:  return diskUsage && append("{}", diskUsage->usedBytes);
+      case DiskTotalBytes: return diskUsage && append("{}", diskUsage->totalBytes);
+
+      case Uptime:        return uptime && append("{}", SecondsToFormattedDuration { *uptime });
+      case UptimeSeconds: return uptime && append("{}", uptime->count());
+
+      case Battery:
+        return battery && battery->status != notPresent && battery->percentage && append("{}%", *battery->percentage);
+      case BatteryStatus:
+        return battery && battery->status != notPresent && append("{}", magic_enum::enum_name(battery->status));
+
+      case Packages:
+#if DRAC_ENABLE_PACKAGECOUNT
+        return packageCount && *packageCount > 0 && append("{}", *packageCount);
+#else
+        return false;
+#endif
     }
 
-    // Package count
-#if DRAC_ENABLE_PACKAGECOUNT
-    if (packageCount && *packageCount > 0)
-      data["packages"] = std::to_string(*packageCount);
+    return false;
+  }
+
+#if DRAC_ENABLE_PLUGINS
+  auto SystemInfo::findPluginField(const StringView key) const -> Option<usize> {
+    for (const auto& [pluginId, fields] : pluginData)
+      if (key.size() > pluginId.size() && key.starts_with(pluginId) && key[pluginId.size()] == '_' &&
+          fields.contains(key.substr(pluginId.size() + 1)))
+        return pluginId.size();
+
+    return std::nullopt;
+  }
 #endif
 
-    // Plugin data - flatten with plugin_<pluginId>_<fieldName> format for compact templates
+  auto SystemInfo::toMap() const -> Map<String, String> {
+    Map<String, String> data;
+
+    for (usize i = 0; i < INFO_FIELDS.size(); ++i)
+      if (String value; appendField(static_cast<InfoField>(i), value))
+        data.emplace(INFO_FIELDS[i].key, std::move(value));
+
 #if DRAC_ENABLE_PLUGINS
     for (const auto& [pluginId, fields] : pluginData)
       for (const auto& [fieldName, value] : fields)
-        data[std::format("plugin_{}_{}", pluginId, fieldName)] = value;
+        data.emplace(std::format("{}{}_{}", PLUGIN_FIELD_PREFIX, pluginId, fieldName), value);
 #endif
 
     return data;
   }
 
 #if DRAC_ENABLE_PLUGINS
-  auto SystemInfo::collectPluginData(utils::cache::CacheManager& cache) -> Unit {
+  auto SystemInfo::loadPlugins(utils::cache::CacheManager& cache, const Option<Vec<String>>& pluginIds) -> Unit {
     using draconis::core::plugin::GetPluginManager;
+    using draconis::core::plugin::PluginManifestEntry;
+    using draconis::core::plugin::PluginType;
 
     auto& pluginManager = GetPluginManager();
 
@@ -213,6 +354,16 @@ namespace draconis::core::system {
     debug_log("Attempting to load {} discovered plugins", discoveredPlugins.size());
 
     for (const auto& pluginName : discoveredPlugins) {
+      // The manifest says what an unchanged plugin provides, so plugins the
+      // output doesn't use are never dlopened. Unknown plugins are loaded once
+      // to record them.
+      if (pluginIds)
+        if (const Option<PluginManifestEntry> entry = pluginManager.getManifestEntry(pluginName))
+          if (entry->metadata.type != PluginType::InfoProvider || std::ranges::find(*pluginIds, entry->providerId) == pluginIds->end()) {
+            debug_log("Skipping plugin '{}' - not used by the active output", pluginName);
+            continue;
+          }
+
       if (!pluginManager.isPluginLoaded(pluginName)) {
         debug_log("Loading plugin: {}", pluginName);
         if (auto result = pluginManager.loadPlugin(pluginName, cache); !result)
@@ -223,6 +374,17 @@ namespace draconis::core::system {
         debug_log("Plugin '{}' is already loaded", pluginName);
       }
     }
+  }
+
+  auto SystemInfo::collectPluginData(const Option<Vec<String>>& pluginIds) -> Unit {
+    using draconis::core::plugin::GetPluginManager;
+    using draconis::core::plugin::PluginManager;
+    using std::chrono::steady_clock, std::chrono::milliseconds;
+
+    auto& pluginManager = GetPluginManager();
+
+    if (!pluginManager.isInitialized())
+      return;
 
     // Get all info provider plugins (high-performance lookup)
     Vec<IInfoProviderPlugin*> infoProviderPlugins = pluginManager.getInfoProviderPlugins();
@@ -232,9 +394,23 @@ namespace draconis::core::system {
     if (infoProviderPlugins.empty())
       return;
 
-    // Collect data from each plugin efficiently
-    // Create a PluginCache using the persistent cache directory for plugins
-    PluginCache pluginCacheInstance(utils::cache::CacheManager::getPersistentCacheDir() / "plugins");
+    // Plugins share the persistent cache directory; the last successful fields
+    // of every plugin are kept there too, as the fallback for a missed deadline.
+    const std::filesystem::path cacheDir = utils::cache::CacheManager::getPersistentCacheDir() / "plugins";
+    PluginCache                 fallbackCache(cacheDir, PluginCache::WriteMode::WriteBehind);
+
+    struct Pending {
+      String                           pluginId;
+      String                           name;
+      PluginDisplayInfo                displayInfo;
+      SharedPointer<PluginCollection>  collection;
+      Option<steady_clock::time_point> deadline;
+    };
+
+    Vec<Pending> pending;
+    pending.reserve(infoProviderPlugins.size());
+
+    const steady_clock::time_point start = steady_clock::now();
 
     for (IInfoProviderPlugin* plugin : infoProviderPlugins) {
       if (!plugin || !plugin->isReady()) {
@@ -249,39 +425,121 @@ namespace draconis::core::system {
 
       const auto& metadata = plugin->getMetadata();
       const auto  pluginId = plugin->getProviderId();
+
+      if (pluginIds && std::ranges::find(*pluginIds, pluginId) == pluginIds->end())
+        continue;
+
+      if (std::ranges::find(m_collectedPlugins, pluginId) == m_collectedPlugins.end())
+        m_collectedPlugins.push_back(pluginId);
+
+      Pending& entry = pending.emplace_back(Pending {
+        .pluginId    = pluginId,
+        .name        = metadata.name,
+        .displayInfo = { .icon = plugin->getDisplayIcon(), .label = plugin->getDisplayLabel() },
+        .collection  = nullptr,
+        .deadline    = None,
+      });
+
+      if (const u32 timeoutMs = m_pluginConfig.collectTimeoutFor(pluginId); timeoutMs > 0)
+        entry.deadline = start + milliseconds(timeoutMs);
+
+      // A plugin still busy with a previous, late collection is not asked again.
+      if (const auto lateIter = m_lateCollections.find(pluginId); lateIter != m_lateCollections.end()) {
+        LockGuard lock(lateIter->second->mutex);
+
+        if (!lateIter->second->done) {
+          debug_log("Plugin '{}' is still collecting from a previous run", metadata.name);
+          continue;
+        }
+
+        m_lateCollections.erase(lateIter);
+      }
+
       debug_log("Collecting data from plugin: {} (id: {})", metadata.name, pluginId);
 
-      PluginDisplayInfo displayInfo {
-        .icon  = plugin->getDisplayIcon(),
-        .label = plugin->getDisplayLabel()
-      };
-
-      try {
-        // Collect plugin data with error handling
-        if (auto result = plugin->collectData(pluginCacheInstance); result) {
-          // Get fields from plugin
-          auto fields = plugin->getFields();
-          debug_log("Plugin '{}' collected {} fields", metadata.name, fields.size());
-
-          // Create entry for this plugin and move data efficiently
-          auto& pluginFields = pluginData[pluginId];
-          for (auto&& [key, value] : fields) {
-            debug_log("Adding plugin field: {}[{}] = {}", pluginId, key, value);
+      entry.collection = std::make_shared<PluginCollection>(cacheDir);
+
+      // Until the collection completes, the manager won't destroy the plugin
+      // or close its library, even if this one is abandoned at its deadline.
+      PluginManager::beginCollection(plugin);
+
+      // Asynchronous providers run on the shared plugin event loop, so any
+      // number of them cost no extra threads.
+      if (auto* asyncPlugin = dynamic_cast<IAsyncInfoProviderPlugin*>(plugin)) {
+        try {
+          asyncPlugin->collectDataAsync(entry.collection->cache, [plugin, collection = entry.collection, name = metadata.name](Result<> result) {
+            // The first report already released the plugin, so a repeat mustn't touch it.
+            if (!collection->finish(plugin, std::move(result)))
+              debug_log("Plugin '{}' reported its collection more than once", name);
+          });
+        } catch (const std::exception& e) {
+          entry.collection->finish(plugin, Err(DracError(Other, std::format("exception: {}", e.what()))));
+        } catch (...) {
+          entry.collection->finish(plugin, Err(DracError(Other, "unknown exception")));
+        }
+
+        continue;
+      }
+
+      // Detached so a plugin that never returns can't hold up the caller. The
+      // thread owns a reference to its collection, so it stays valid either way.
+      std::thread([plugin, collection = entry.collection, name = metadata.name] {
+        DRAC_TRACE_SCOPE_DETAIL("plugins", "collect", name);
+
+        Result<> result;
+
+        try {
+          result = plugin->collectData(collection->cache);
+        } catch (const std::exception& e) {
+          result = Err(DracError(Other, std::format("exception: {}", e.what())));
+        } catch (...) {
+          result = Err(DracError(Other, "unknown exception"));
+        }
+
+        collection->finish(plugin, std::move(result));
+      }).detach();
+    }
+
+    for (Pending& entry : pending) {
+      PluginDisplayInfo& displayInfo = entry.displayInfo;
+      const String       fallbackKey = std::format("collected_{}", entry.pluginId);
+
+      const bool done = entry.collection && entry.collection->wait(entry.deadline);
+
+      if (done && entry.collection->fields) {
+        auto& fields = *entry.collection->fields;
+        debug_log("Plugin '{}' collected {} fields", entry.name, fields.size());
+
+        fallbackCache.set(fallbackKey, CollectedPluginData { .fields = fields, .displayValue = entry.collection->displayValue });
+
+        auto& pluginFields = pluginData[entry.pluginId];
+        for (auto&& [key, value] : fields) {
+          debug_log("Adding plugin field: {}[{}] = {}", entry.pluginId, key, value);
+          pluginFields.emplace(key, std::move(value));
+        }
+
+        displayInfo.value = std::move(entry.collection->displayValue);
+      } else if (done) {
+        debug_log("Plugin '{}' failed to collect data: {}", entry.name, entry.collection->error);
+      } else {
+        warn_log("Plugin '{}' missed its {}ms collection deadline", entry.name, m_pluginConfig.collectTimeoutFor(entry.pluginId));
+
+        displayInfo.timedOut = true;
+
+        if (entry.collection)
+          m_lateCollections.insert_or_assign(entry.pluginId, entry.collection);
+
+        if (Option<CollectedPluginData> cached = fallbackCache.get<CollectedPluginData>(fallbackKey)) {
+          auto& pluginFields = pluginData[entry.pluginId];
+          for (auto&& [key, value] : cached->fields)
             pluginFields.emplace(key, std::move(value));
-          }
 
-          if (auto displayValue = plugin->getDisplayValue(); displayValue)
-            displayInfo.value = *displayValue;
-        } else {
-          debug_log("Plugin '{}' failed to collect data: {}", metadata.name, result.error().message);
+          displayInfo.value = std::move(cached->displayValue);
+          displayInfo.stale = true;
         }
-      } catch (const std::exception& e) {
-        debug_log("Exception in plugin '{}': {}", metadata.name, e.what());
-      } catch (...) {
-        debug_log("Unknown exception in plugin '{}'", metadata.name);
       }
 
-      pluginDisplay[pluginId] = std::move(displayInfo);
+      pluginDisplay[entry.pluginId] = std::move(displayInfo);
     }
 
     debug_log("Total plugins with data: {}", pluginData.size());
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <glaze/glaze.hpp>
+#include <span>
 
 #include <Drac++/Core/System.hpp>
 
@@ -23,8 +25,176 @@ namespace draconis::core::system {
 #if DRAC_ENABLE_PLUGINS
   using plugin::GetPluginManager;
   using plugin::ISystemInfoPlugin;
+
+  struct PluginCollection;
 #endif
 
+  /**
+   * @brief Readouts that change while the process is running.
+   *
+   * @details Everything not listed here (OS, kernel, CPU, GPU, host, ...) is
+   * treated as static and only collected once, when SystemInfo is constructed.
+   */
+  enum class VolatileField : types::u8 {
+    Date,
+    Memory,
+    DiskUsage,
+    Uptime,
+    Battery,
+    Plugins,
+  };
+
+  /**
+   * @brief Individual readouts SystemInfo can collect, as bit flags.
+   */
+  enum class Readout : types::u16 {
+    None            = 0,
+    Date            = 1 << 0,
+    Host            = 1 << 1,
+    Kernel          = 1 << 2,
+    OperatingSystem = 1 << 3,
+    Memory          = 1 << 4,
+    DesktopEnv      = 1 << 5,
+    WindowMgr       = 1 << 6,
+    DiskUsage       = 1 << 7,
+    Shell           = 1 << 8,
+    CPUModel        = 1 << 9,
+    CPUCores        = 1 << 10,
+    GPUModel        = 1 << 11,
+    Uptime          = 1 << 12,
+    Battery         = 1 << 13,
+    Packages        = 1 << 14,
+    Plugins         = 1 << 15,
+    All             = 0xFFFF,
+  };
+
+  constexpr auto operator|(Readout lhs, Readout rhs) -> Readout {
+    return static_cast<Readout>(static_cast<types::u16>(lhs) | static_cast<types::u16>(rhs));
+  }
+
+  constexpr auto operator|=(Readout& lhs, Readout rhs) -> Readout& {
+    return lhs = lhs | rhs;
+  }
+
+  constexpr auto HasReadout(Readout current, Readout flag) -> bool {
+    return (static_cast<types::u16>(current) & static_cast<types::u16>(flag)) != 0;
+  }
+
+  /**
+   * @brief Flat, string-formatted fields of SystemInfo, as used by --compact templates.
+   *
+   * @details Each field has a stable placeholder key in INFO_FIELDS and is
+   * only formatted when something asks for it, via SystemInfo::appendField().
+   * Plugin fields aren't listed here; they're addressed as
+   * `plugin_<pluginId>_<fieldName>`.
+   */
+  enum class InfoField : types::u8 {
+    Date,
+    Host,
+    Kernel,
+    Shell,
+    CPU,
+    CPUCoresPhysical,
+    CPUCoresLogical,
+    GPU,
+    DesktopEnv,
+    WindowMgr,
+    OS,
+    OSName,
+    OSVersion,
+    OSId,
+    RAM,
+    MemoryUsedBytes,
+    MemoryTotalBytes,
+    Disk,
+    DiskUsedBytes,
+    DiskTotalBytes,
+    Uptime,
+    UptimeSeconds,
+    Battery,
+    BatteryStatus,
+    Packages,
+  };
+
+  struct InfoFieldInfo {
+    types::StringView key;
+    Readout           readout; ///< Readout the field is formatted from
+  };
+
+  // clang-format off
+  inline constexpr auto INFO_FIELDS = std::to_array<InfoFieldInfo>({
+    { "date",               Readout::Date            },
+    { "host",               Readout::Host            },
+    { "kernel",             Readout::Kernel          },
+    { "shell",              Readout::Shell           },
+    { "cpu",                Readout::CPUModel        },
+    { "cpu_cores_physical", Readout::CPUCores        },
+    { "cpu_cores_logical",  Readout::CPUCores        },
+    { "gpu",                Readout::GPUModel        },
+    { "de",                 Readout::DesktopEnv      },
+    { "wm",                 Readout::WindowMgr       },
+    { "os",                 Readout::OperatingSystem },
+    { "os_name",            Readout::OperatingSystem },
+    { "os_version",         Readout::OperatingSystem },
+    { "os_id",              Readout::OperatingSystem },
+    { "ram",                Readout::Memory          },
+    { "memory_used_bytes",  Readout::Memory          },
+    { "memory_total_bytes", Readout::Memory          },
+    { "disk",               Readout::DiskUsage       },
+    { "disk_used_bytes",    Readout::DiskUsage       },
+    { "disk_total_bytes",   Readout::DiskUsage       },
+    { "uptime",             Readout::Uptime          },
+    { "uptime_seconds",     Readout::Uptime          },
+    { "battery",            Readout::Battery         },
+    { "battery_status",     Readout::Battery         },
+    { "packages",           Readout::Packages        },
+  });
+  // clang-format on
+
+  static_assert(INFO_FIELDS.size() == static_cast<types::usize>(InfoField::Packages) + 1, "INFO_FIELDS must list every InfoField in order");
+
+  /**
+   * @brief Key prefix of plugin fields in compact templates and toMap().
+   */
+  inline constexpr types::StringView PLUGIN_FIELD_PREFIX = "plugin_";
+
+  /**
+   * @brief Look up a core field by its placeholder key.
+   */
+  constexpr auto FindInfoField(const types::StringView key) -> types::Option<InfoField> {
+    for (types::usize i = 0; i < INFO_FIELDS.size(); ++i)
+      if (INFO_FIELDS[i].key == key)
+        return static_cast<InfoField>(i);
+
+    return std::nullopt;
+  }
+
+  /**
+   * @brief What an output mode actually needs from SystemInfo.
+   *
+   * @details Built from the active layout or output template so readouts nobody
+   * displays (e.g. the PCI scan behind the GPU row, or package counting) are
+   * never run. The default plan collects everything.
+   */
+  struct CollectionPlan {
+    Readout readouts = Readout::All;
+
+    /// Provider IDs of the plugins to collect. None means every plugin; only
+    /// consulted when `readouts` includes Readout::Plugins.
+    types::Option<types::Vec<types::String>> pluginIds = std::nullopt;
+
+    /**
+     * @brief Add a single plugin to the plan
+     * @param pluginId Provider ID of the plugin
+     */
+    auto requirePlugin(const types::String& pluginId) -> types::Unit {
+      readouts |= Readout::Plugins;
+
+      if (pluginIds && std::ranges::find(*pluginIds, pluginId) == pluginIds->end())
+        pluginIds->push_back(pluginId);
+    }
+  };
+
   /**
    * @brief Utility struct for storing system information.
    *
@@ -47,6 +217,7 @@ namespace draconis::core::system {
     types::Result<types::CPUCores>      cpuCores;
     types::Result<types::String>        gpuModel;
     types::Result<seconds>              uptime;
+    types::Result<types::Battery>       battery;
 #if DRAC_ENABLE_PACKAGECOUNT
     types::Result<types::u64> packageCount;
 #endif
@@ -58,7 +229,9 @@ namespace draconis::core::system {
     struct PluginDisplayInfo {
       types::String                icon;
       types::String                label;
-      types::Option<types::String> value = std::nullopt;
+      types::Option<types::String> value    = std::nullopt;
+      bool                         timedOut = false; ///< Missed its collection deadline
+      bool                         stale    = false; ///< Value is the last cached one rather than fresh data
     };
 
     // Display data provided by plugins (icon/label/value)
@@ -118,86 +291,154 @@ namespace draconis::core::system {
     }
 #endif
 
+    /**
+     * @brief Append a field's formatted value to @p out
+     * @param field Field to format
+     * @param out String to append to; left untouched if the field is unavailable
+     * @return False if the readout behind the field failed or wasn't collected
+     */
+    auto appendField(InfoField field, types::String& out) const -> bool;
+
+#if DRAC_ENABLE_PLUGINS
+    /**
+     * @brief Look up a plugin field by its flattened `<pluginId>_<fieldName>` key
+     * @param key Key without PLUGIN_FIELD_PREFIX
+     * @return Length of the plugin ID within @p key, or None if no plugin provides that field
+     *
+     * @details Plugin IDs and field names may both contain underscores, so the
+     * split can only be found against the collected data.
+     */
+    [[nodiscard]] auto findPluginField(types::StringView key) const -> types::Option<types::usize>;
+#endif
+
     /**
      * @brief Convert all system info to a flat key-value map
-     * @details This is the single source of truth for all system info data.
-     * Used by compact output, plugins, and any other consumers that need
-     * a generic map representation. Adding new fields here automatically
-     * makes them available everywhere.
+     * @details Formats every available field. Only needed by plugin output
+     * formatters, whose interface takes a map; compact templates format just
+     * the fields they reference through appendField().
      * @return Map of field names to their string values
      */
     [[nodiscard]] auto toMap() const -> types::Map<types::String, types::String>;
 
-    explicit SystemInfo(utils::cache::CacheManager& cache, const Config& config);
+    /**
+     * @brief Collect the readouts selected by a plan
+     * @param cache Cache manager passed to the readouts
+     * @param config Application configuration
+     * @param plan Readouts to collect; everything by default
+     *
+     * @details Readouts outside the plan are left as a NotFound error until a
+     * later collect() call asks for them.
+     */
+    explicit SystemInfo(utils::cache::CacheManager& cache, const Config& config, const CollectionPlan& plan = {});
+
+    /**
+     * @brief Collect any readouts in @p plan that haven't been collected yet
+     * @param cache Cache manager passed to the readouts
+     * @param config Application configuration
+     * @param plan Readouts (and plugins) that the caller is about to use
+     *
+     * @details Lets consumers that need more than the initial plan materialize
+     * the missing fields on demand. Already-collected readouts are not re-run.
+     */
+    auto collect(utils::cache::CacheManager& cache, const Config& config, const CollectionPlan& plan) -> types::Unit;
+
+    /**
+     * @brief Whether a readout has been collected
+     */
+    [[nodiscard]] auto hasCollected(const Readout readout) const noexcept -> bool {
+      return HasReadout(m_collected, readout);
+    }
+
+    /**
+     * @brief Re-collect a subset of the volatile readouts in place
+     * @param cache Cache manager passed to the readouts
+     * @param fields Readouts to refresh; static readouts are left untouched
+     *
+     * @details Used by watch mode. Plugins are not reloaded; already-loaded
+     * info providers are simply asked for fresh data.
+     */
+    auto refresh(utils::cache::CacheManager& cache, std::span<const VolatileField> fields) -> types::Unit;
 
    private:
+    Readout m_collected = Readout::None;
+
 #if DRAC_ENABLE_PLUGINS
+    // Plugins already asked for data, so collect() doesn't query them twice.
+    types::Vec<types::String> m_collectedPlugins;
+    bool                      m_collectedAllPlugins = false;
+
+    // Deadlines for plugin collection, copied from the config.
+    core::plugin::PluginConfig m_pluginConfig;
+
+    // Collections that missed their deadline and are still running; the plugin
+    // isn't asked again until its previous collectData() call returns.
+    types::UnorderedMap<types::String, types::SharedPointer<PluginCollection>> m_lateCollections;
+
     /**
-     * @brief Collect data from all system info plugins efficiently
-     * @param cache Cache manager for plugin data persistence
+     * @brief Load the discovered plugins that aren't loaded yet
+     * @param cache Cache manager passed to plugin initialization
+     * @param pluginIds Provider IDs the output needs; None loads every plugin
      */
-    auto collectPluginData(utils::cache::CacheManager& cache) -> types::Unit;
-#endif
-  };
+    auto loadPlugins(utils::cache::CacheManager& cache, const types::Option<types::Vec<types::String>>& pluginIds = std::nullopt) -> types::Unit;
 
-  struct JsonInfo {
-    types::Option<types::String>        date;
-    types::Option<types::String>        host;
-    types::Option<types::String>        kernelVersion;
-    types::Option<types::OSInfo>        operatingSystem;
-    types::Option<types::ResourceUsage> memInfo;
-    types::Option<types::String>        desktopEnv;
-    types::Option<types::String>        windowMgr;
-    types::Option<types::ResourceUsage> diskUsage;
-    types::Option<types::String>        shell;
-    types::Option<types::String>        cpuModel;
-    types::Option<types::CPUCores>      cpuCores;
-    types::Option<types::String>        gpuModel;
-    types::Option<types::i64>           uptimeSeconds;
-#if DRAC_ENABLE_PACKAGECOUNT
-    types::Option<types::u64> packageCount;
-#endif
-#if DRAC_ENABLE_PLUGINS
-    // Plugin-contributed fields organized by plugin ID
-    types::Map<types::String, types::Map<types::String, types::String>> pluginFields;
+    /**
+     * @brief Collect data from loaded info provider plugins
+     * @param pluginIds Provider IDs to collect from; None collects from every plugin
+     * @note Must run after loadPlugins()
+     *
+     * @details Synchronous plugins collect on their own thread; asynchronous
+     * ones share the plugin event loop. A plugin that misses its
+     * deadline is left running in the background and reported with its last
+     * cached fields (or none), flagged as timed out.
+     */
+    auto collectPluginData(const types::Option<types::Vec<types::String>>& pluginIds = std::nullopt) -> types::Unit;
 #endif
   };
 
+  /**
+   * @brief Serialized form of a readout: the value, or null if it failed or wasn't collected.
+   * @details Points into the SystemInfo, so JSON and BEVE output never copy the readouts.
+   */
+  template <typename T>
+  constexpr auto ValueOrNull(const types::Result<T>& result) -> const T* {
+    return result ? &*result : nullptr;
+  }
 } // namespace draconis::core::system
 
 namespace glz {
+  // Serializes straight from SystemInfo; failed readouts are null and skipped.
   template <>
-  struct meta<draconis::utils::types::ResourceUsage> {
-    using T = draconis::utils::types::ResourceUsage;
+  struct meta<draconis::core::system::SystemInfo> {
+    using T = draconis::core::system::SystemInfo;
 
-    static constexpr detail::Object value = object("usedBytes", &T::usedBytes, "totalBytes", &T::totalBytes);
-  };
+    static constexpr auto uptimeSeconds = [](const T& self) -> draconis::utils::types::Option<draconis::utils::types::i64> {
+      if (self.uptime)
+        return self.uptime->count();
 
-  template <>
-  struct meta<draconis::core::system::JsonInfo> {
-    using T = draconis::core::system::JsonInfo;
+      return std::nullopt;
+    };
 
     // clang-format off
     static constexpr detail::Object value = object(
 #if DRAC_ENABLE_PACKAGECOUNT
-      "packageCount",    &T::packageCount,
+      "packageCount",    [](const T& self) { return draconis::core::system::ValueOrNull(self.packageCount); },
 #endif
 #if DRAC_ENABLE_PLUGINS
-      "pluginFields",    &T::pluginFields,
+      "pluginFields",    [](const T& self) { return &self.pluginData; },
 #endif
-      "date",            &T::date,
-      "host",            &T::host,
-      "kernelVersion",   &T::kernelVersion,
-      "operatingSystem", &T::operatingSystem,
-      "memInfo",         &T::memInfo,
-      "desktopEnv",      &T::desktopEnv,
-      "windowMgr",       &T::windowMgr,
-      "diskUsage",       &T::diskUsage,
-      "shell",           &T::shell,
-      "cpuModel",        &T::cpuModel,
-      "cpuCores",        &T::cpuCores,
-      "gpuModel",        &T::gpuModel,
-      "uptimeSeconds",   &T::uptimeSeconds
+      "date",            [](const T& self) { return draconis::core::system::ValueOrNull(self.date); },
+      "host",            [](const T& self) { return draconis::core::system::ValueOrNull(self.host); },
+      "kernelVersion",   [](const T& self) { return draconis::core::system::ValueOrNull(self.kernelVersion); },
+      "operatingSystem", [](const T& self) { return draconis::core::system::ValueOrNull(self.operatingSystem); },
+      "memInfo",         [](const T& self) { return draconis::core::system::ValueOrNull(self.memInfo); },
+      "desktopEnv",      [](const T& self) { return draconis::core::system::ValueOrNull(self.desktopEnv); },
+      "windowMgr",       [](const T& self) { return draconis::core::system::ValueOrNull(self.windowMgr); },
+      "diskUsage",       [](const T& self) { return draconis::core::system::ValueOrNull(self.diskUsage); },
+      "shell",           [](const T& self) { return draconis::core::system::ValueOrNull(self.shell); },
+      "cpuModel",        [](const T& self) { return draconis::core::system::ValueOrNull(self.cpuModel); },
+      "cpuCores",        [](const T& self) { return draconis::core::system::ValueOrNull(self.cpuCores); },
+      "gpuModel",        [](const T& self) { return draconis::core::system::ValueOrNull(self.gpuModel); },
+      "uptimeSeconds",   uptimeSeconds
     );
     // clang-format on
   };
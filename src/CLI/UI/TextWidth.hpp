@@ -0,0 +1,454 @@
+/**
+ * @file TextWidth.hpp
+ * @brief Terminal column measurement and word wrapping for UI text.
+ *
+ * @details Every row of the UI is measured on every render, and nearly all of
+ * that text is plain ASCII. GetVisualWidth() therefore skips over runs of
+ * printable ASCII sixteen bytes at a time (SSE2 on x86-64, NEON on AArch64)
+ * and only decodes UTF-8 and ANSI escapes where a block contains something
+ * else. Double-width codepoints are looked up in a two-level bitmap that is
+ * built at compile time from the range list below, instead of being checked
+ * against each range in turn.
+ *
+ * WordWrap() measures each word once and picks break points from running
+ * width totals, so wrapping stays linear in the length of the text.
+ */
+
+#pragma once
+
+#include <algorithm> // std::max, std::min
+#include <bit>       // std::countr_zero
+#include <limits>    // std::numeric_limits
+
+#if DRAC_ARCH_X86_64
+  #include <emmintrin.h> // _mm_loadu_si128, _mm_cmpeq_epi8, _mm_movemask_epi8
+#elif DRAC_ARCH_AARCH64
+  #include <arm_neon.h> // vld1q_u8, vceqq_u8, vcgeq_u8, vmaxvq_u8
+#endif
+
+#include <Drac++/Utils/Types.hpp>
+
+namespace draconis::ui::text {
+  namespace types = ::draconis::utils::types;
+
+  /**
+   * @brief One line of wrapped text along with its visual width.
+   */
+  struct WrappedLine {
+    types::String text;
+    types::usize  width = 0;
+  };
+
+  namespace detail {
+    struct WideRange {
+      char32_t first;
+      char32_t last;
+    };
+
+    // clang-format off
+    constexpr types::Array<WideRange, 27> WIDE_RANGES = {{
+      {  0x1100,  0x115F }, // Hangul Jamo
+      {  0x2329,  0x232A }, // Angle brackets
+      {  0x2E80,  0x2EFF }, // CJK Radicals Supplement
+      {  0x2F00,  0x2FDF }, // Kangxi Radicals
+      {  0x2FF0,  0x2FFF }, // Ideographic Description Characters
+      {  0x3000,  0x303E }, // CJK Symbols and Punctuation
+      {  0x3041,  0x3096 }, // Hiragana
+      {  0x3099,  0x30FF }, // Katakana
+      {  0x3105,  0x312F }, // Bopomofo
+      {  0x3131,  0x318E }, // Hangul Compatibility Jamo
+      {  0x3190,  0x31BF }, // Kanbun
+      {  0x31C0,  0x31EF }, // CJK Strokes
+      {  0x31F0,  0x31FF }, // Katakana Phonetic Extensions
+      {  0x3200,  0x32FF }, // Enclosed CJK Letters and Months
+      {  0x3300,  0x33FF }, // CJK Compatibility
+      {  0x3400,  0x4DBF }, // CJK Unified Ideographs Extension A
+      {  0x4E00,  0x9FFF }, // CJK Unified Ideographs
+      {  0xA000,  0xA48F }, // Yi Syllables
+      {  0xA490,  0xA4CF }, // Yi Radicals
+      {  0xAC00,  0xD7A3 }, // Hangul Syllables
+      {  0xF900,  0xFAFF }, // CJK Compatibility Ideographs
+      {  0xFE10,  0xFE19 }, // Vertical Forms
+      {  0xFE30,  0xFE6F }, // CJK Compatibility Forms
+      {  0xFF00,  0xFF60 }, // Fullwidth Forms
+      {  0xFFE0,  0xFFE6 }, // Fullwidth Forms
+      { 0x20000, 0x2FFFD }, // CJK Unified Ideographs Extension B, C, D, E
+      { 0x30000, 0x3FFFD }, // CJK Unified Ideographs Extension F
+    }};
+    // clang-format on
+
+    constexpr char32_t     WIDE_MIN   = 0x1100;  // Nothing below this is wide
+    constexpr char32_t     WIDE_END   = 0x40000; // ...and nothing at or above this
+    constexpr types::usize PAGE_BITS  = 8;
+    constexpr types::usize PAGE_SIZE  = types::usize(1) << PAGE_BITS;
+    constexpr types::usize PAGE_COUNT = WIDE_END >> PAGE_BITS;
+
+    // One bit per codepoint of a 256-codepoint page.
+    using WidthBlock = types::Array<types::u64, PAGE_SIZE / 64>;
+
+    consteval auto BuildBlock(const types::usize page) -> WidthBlock {
+      WidthBlock block {};
+
+      const char32_t base = static_cast<char32_t>(page << PAGE_BITS);
+      const char32_t end  = base + static_cast<char32_t>(PAGE_SIZE);
+
+      for (const WideRange& range : WIDE_RANGES)
+        for (char32_t codepoint = std::max(range.first, base); codepoint <= range.last && codepoint < end; ++codepoint) {
+          const types::usize bit = codepoint - base;
+          block.at(bit / 64) |= types::u64(1) << (bit % 64);
+        }
+
+      return block;
+    }
+
+    // Almost every page is entirely narrow or entirely wide, so pages share blocks.
+    consteval auto CountDistinctBlocks() -> types::usize {
+      types::Array<WidthBlock, PAGE_COUNT> distinct {};
+      types::usize                         count = 0;
+
+      for (types::usize page = 0; page < PAGE_COUNT; ++page) {
+        const WidthBlock block = BuildBlock(page);
+
+        if (std::find(distinct.begin(), distinct.begin() + count, block) == distinct.begin() + count)
+          distinct.at(count++) = block;
+      }
+
+      return count;
+    }
+
+    constexpr types::usize BLOCK_COUNT = CountDistinctBlocks();
+
+    static_assert(BLOCK_COUNT <= std::numeric_limits<types::u8>::max(), "page index must fit in a byte");
+
+    struct WidthTable {
+      types::Array<types::u8, PAGE_COUNT>   pages;
+      types::Array<WidthBlock, BLOCK_COUNT> blocks;
+    };
+
+    consteval auto BuildWidthTable() -> WidthTable {
+      WidthTable   table {};
+      types::usize count = 0;
+
+      for (types::usize page = 0; page < PAGE_COUNT; ++page) {
+        const WidthBlock block = BuildBlock(page);
+        const auto       found = std::find(table.blocks.begin(), table.blocks.begin() + count, block);
+
+        if (found == table.blocks.begin() + count)
+          table.blocks.at(count++) = block;
+
+        table.pages.at(page) = static_cast<types::u8>(found - table.blocks.begin());
+      }
+
+      return table;
+    }
+
+    constexpr WidthTable WIDTH_TABLE = BuildWidthTable();
+
+    // Printable runs end at a non-ASCII byte (UTF-8), ESC (an ANSI sequence) or NUL (zero width).
+    constexpr auto IsPlainAscii(const char chr) -> bool {
+      const auto byte = static_cast<types::u8>(chr);
+      return byte < 0x80 && byte != 0x1B && byte != 0;
+    }
+
+    /**
+     * @brief Length of the run of plain ASCII bytes at the start of @p str.
+     */
+    constexpr auto PlainAsciiPrefix(const types::StringView str) -> types::usize {
+      types::usize pos = 0;
+
+      if !consteval {
+#if DRAC_ARCH_X86_64
+        const __m128i escVec  = _mm_set1_epi8(0x1B);
+        const __m128i zeroVec = _mm_setzero_si128();
+
+        for (; pos + 16 <= str.size(); pos += 16) {
+          const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + pos));
+          const __m128i stops = _mm_or_si128(_mm_cmpeq_epi8(chunk, escVec), _mm_cmpeq_epi8(chunk, zeroVec));
+
+          // The high bit of each byte is set exactly for non-ASCII bytes.
+          if (const auto mask = static_cast<types::u32>(_mm_movemask_epi8(_mm_or_si128(chunk, stops))); mask != 0)
+            return pos + static_cast<types::usize>(std::countr_zero(mask));
+        }
+#elif DRAC_ARCH_AARCH64
+        const uint8x16_t escVec   = vdupq_n_u8(0x1B);
+        const uint8x16_t zeroVec  = vdupq_n_u8(0);
+        const uint8x16_t asciiEnd = vdupq_n_u8(0x80);
+
+        // NEON has no movemask; stop at the first block with a hit and find it with the scalar loop.
+        for (; pos + 16 <= str.size(); pos += 16) {
+          const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const types::u8*>(str.data() + pos));
+          const uint8x16_t stops = vorrq_u8(vcgeq_u8(chunk, asciiEnd), vorrq_u8(vceqq_u8(chunk, escVec), vceqq_u8(chunk, zeroVec)));
+
+          if (vmaxvq_u8(stops) != 0)
+            break;
+        }
+#endif
+      }
+
+      while (pos < str.size() && IsPlainAscii(str[pos]))
+        pos++;
+
+      return pos;
+    }
+  } // namespace detail
+
+  /**
+   * @brief Whether a codepoint occupies two terminal columns.
+   */
+  constexpr auto IsWideCharacter(const char32_t codepoint) -> bool {
+    using namespace detail;
+
+    if (codepoint < WIDE_MIN || codepoint >= WIDE_END)
+      return false;
+
+    const WidthBlock&  block = WIDTH_TABLE.blocks[WIDTH_TABLE.pages[codepoint >> PAGE_BITS]];
+    const types::usize bit   = codepoint & (PAGE_SIZE - 1);
+
+    return ((block[bit / 64] >> (bit % 64)) & 1) != 0;
+  }
+
+  /**
+   * @brief Decodes the UTF-8 sequence at @p pos and advances past it.
+   * @return The codepoint, or 0 for a truncated or invalid sequence.
+   */
+  constexpr auto DecodeUTF8(const types::StringView str, types::usize& pos) -> char32_t {
+    if (pos >= str.length())
+      return 0;
+
+    const auto getByte = [&](const types::usize index) -> types::u8 {
+      return static_cast<types::u8>(str[index]);
+    };
+
+    const types::u8 first = getByte(pos++);
+
+    if ((first & 0x80) == 0) // ASCII (0xxxxxxx)
+      return first;
+
+    if ((first & 0xE0) == 0xC0) {
+      // 2-byte sequence (110xxxxx 10xxxxxx)
+      if (pos >= str.length())
+        return 0;
+
+      const types::u8 second = getByte(pos++);
+
+      return ((first & 0x1F) << 6) | (second & 0x3F);
+    }
+
+    if ((first & 0xF0) == 0xE0) {
+      // 3-byte sequence (1110xxxx 10xxxxxx 10xxxxxx)
+      if (pos + 1 >= str.length())
+        return 0;
+
+      const types::u8 second = getByte(pos++);
+      const types::u8 third  = getByte(pos++);
+
+      return ((first & 0x0F) << 12) | ((second & 0x3F) << 6) | (third & 0x3F);
+    }
+
+    if ((first & 0xF8) == 0xF0) {
+      // 4-byte sequence (11110xxx 10xxxxxx 10xxxxxx 10xxxxxx)
+      if (pos + 2 >= str.length())
+        return 0;
+
+      const types::u8 second = getByte(pos++);
+      const types::u8 third  = getByte(pos++);
+      const types::u8 fourth = getByte(pos++);
+
+      return ((first & 0x07) << 18) | ((second & 0x3F) << 12) | ((third & 0x3F) << 6) | (fourth & 0x3F);
+    }
+
+    return 0; // Invalid UTF-8
+  }
+
+  /**
+   * @brief Number of terminal columns @p str occupies, ignoring ANSI escape sequences.
+   */
+  constexpr auto GetVisualWidth(const types::StringView str) -> types::usize {
+    types::usize width    = 0;
+    bool         inEscape = false;
+    types::usize pos      = 0;
+
+    while (pos < str.length()) {
+      if (!inEscape) {
+        const types::usize run = detail::PlainAsciiPrefix(str.substr(pos));
+
+        width += run;
+        pos += run;
+
+        if (pos >= str.length())
+          break;
+      }
+
+      const char current = str[pos];
+
+      if (inEscape) {
+        if (current == 'm' || current == '\\' || current == '\a')
+          inEscape = false;
+
+        pos++;
+      } else if (current == '\033') {
+        inEscape = true;
+        pos++;
+      } else {
+        const char32_t codepoint = DecodeUTF8(str, pos);
+        if (codepoint != 0)
+          width += IsWideCharacter(codepoint) ? 2 : 1;
+      }
+    }
+
+    return width;
+  }
+
+  /**
+   * @brief Word-wrap text to a specified visual width with balanced line lengths
+   * @param text The text to wrap
+   * @param wrapWidth Maximum visual width per line (0 = no wrap)
+   * @return Wrapped lines with their widths; words are separated by single spaces
+   */
+  inline auto WordWrap(const types::StringView text, const types::usize wrapWidth) -> types::Vec<WrappedLine> {
+    using types::usize;
+
+    types::Vec<WrappedLine> lines;
+
+    if (wrapWidth == 0) {
+      lines.push_back({ .text = types::String(text), .width = GetVisualWidth(text) });
+      return lines;
+    }
+
+    // Split into words and measure each one exactly once. prefixWidth[i] is the
+    // width of words 0..i-1 joined by single spaces, so any span is O(1).
+    types::Vec<types::StringView> words;
+    types::Vec<usize>             prefixWidth { 0 };
+
+    constexpr auto isSpace = [](const char chr) -> bool {
+      return chr == ' ' || chr == '\t' || chr == '\n' || chr == '\v' || chr == '\f' || chr == '\r';
+    };
+
+    for (usize pos = 0; pos < text.size();) {
+      if (isSpace(text[pos])) {
+        pos++;
+        continue;
+      }
+
+      const usize start = pos;
+
+      while (pos < text.size() && !isSpace(text[pos]))
+        pos++;
+
+      words.push_back(text.substr(start, pos - start));
+      prefixWidth.push_back(prefixWidth.back() + GetVisualWidth(words.back()) + (words.size() > 1 ? 1 : 0));
+    }
+
+    if (words.empty())
+      return lines;
+
+    const usize wordCount = words.size();
+
+    const auto wordWidth = [&](const usize idx) -> usize {
+      return prefixWidth[idx + 1] - prefixWidth[idx] - (idx > 0 ? 1 : 0);
+    };
+
+    // Width of words[start..end) with single spaces between them.
+    const auto spanWidth = [&](const usize start, const usize end) -> usize {
+      if (start >= end)
+        return 0;
+
+      return prefixWidth[end] - prefixWidth[start] - (start > 0 ? 1 : 0);
+    };
+
+    const auto emitLine = [&](const usize start, const usize end) -> void {
+      WrappedLine line;
+
+      line.text.reserve(static_cast<usize>(words[end - 1].data() + words[end - 1].size() - words[start].data()));
+
+      for (usize idx = start; idx < end; ++idx) {
+        if (idx > start)
+          line.text += ' ';
+        line.text += words[idx];
+      }
+
+      // Measured as joined: an escape or broken sequence can straddle a space.
+      line.width = GetVisualWidth(line.text);
+
+      lines.push_back(std::move(line));
+    };
+
+    // Greedy wrap first to determine the minimum number of lines needed
+    usize numLines     = 1;
+    usize currentWidth = 0;
+
+    for (usize idx = 0; idx < wordCount; ++idx) {
+      const usize addedWidth = wordWidth(idx) + (currentWidth > 0 ? 1 : 0);
+
+      if (currentWidth > 0 && currentWidth + addedWidth > wrapWidth) {
+        numLines++;
+        currentWidth = wordWidth(idx);
+      } else
+        currentWidth += addedWidth;
+    }
+
+    if (numLines == 1) {
+      emitLine(0, wordCount);
+      return lines;
+    }
+
+    lines.reserve(numLines);
+
+    // With 2 lines, pick the break that makes both halves most equal
+    if (numLines == 2) {
+      usize bestBreak = 1;
+      usize bestDiff  = std::numeric_limits<usize>::max();
+
+      for (usize breakPoint = 1; breakPoint < wordCount; ++breakPoint) {
+        const usize firstWidth  = spanWidth(0, breakPoint);
+        const usize secondWidth = spanWidth(breakPoint, wordCount);
+
+        // Both lines must fit within wrapWidth
+        if (firstWidth > wrapWidth || secondWidth > wrapWidth)
+          continue;
+
+        const usize diff = firstWidth > secondWidth ? firstWidth - secondWidth : secondWidth - firstWidth;
+
+        if (diff < bestDiff) {
+          bestDiff  = diff;
+          bestBreak = breakPoint;
+        }
+      }
+
+      emitLine(0, bestBreak);
+      emitLine(bestBreak, wordCount);
+      return lines;
+    }
+
+    // For 3+ lines, aim for an equal distribution across the greedy line count
+    const usize targetWidth = (spanWidth(0, wordCount) + numLines - 1) / numLines;
+
+    usize lineStart = 0;
+    usize linesLeft = numLines;
+    currentWidth    = 0;
+
+    for (usize idx = 0; idx < wordCount; ++idx) {
+      const usize widthIfAdded        = currentWidth + wordWidth(idx) + (currentWidth > 0 ? 1 : 0);
+      const usize remainingWidth      = spanWidth(idx, wordCount);
+      const usize avgRemainingPerLine = linesLeft > 0 ? (remainingWidth + linesLeft - 1) / linesLeft : 0;
+
+      // Break if: exceeds max, or current line is at target and remaining fits well in remaining lines
+      const bool shouldBreak = idx > lineStart &&
+        (widthIfAdded > wrapWidth ||
+         (currentWidth >= targetWidth && linesLeft > 1 && remainingWidth >= avgRemainingPerLine));
+
+      if (shouldBreak) {
+        emitLine(lineStart, idx);
+        lineStart    = idx;
+        currentWidth = 0;
+        linesLeft--;
+      }
+
+      currentWidth += wordWidth(idx) + (idx > lineStart ? 1 : 0);
+    }
+
+    emitLine(lineStart, wordCount);
+
+    return lines;
+  }
+} // namespace draconis::ui::text
@@ -1,19 +1,21 @@
 #include "UI.hpp"
 
 #include <algorithm>
-#include <cctype>
 #include <cmath>
 #include <filesystem>
 #include <fstream>
-#include <iostream>
-#include <sstream>
+#include <iterator>
+#include <memory_resource>
 #ifndef _WIN32
   #include <sys/ioctl.h> // TIOCGWINSZ
   #include <unistd.h>    // STDOUT_FILENO
 #endif
 
+#include <Drac++/Utils/CacheManager.hpp>
+#include <Drac++/Utils/Error.hpp>
 #include <Drac++/Utils/Localization.hpp>
 #include <Drac++/Utils/Logging.hpp>
+#include <Drac++/Utils/Tracing.hpp>
 #include <Drac++/Utils/Types.hpp>
 
 #if DRAC_ENABLE_PLUGINS
@@ -21,6 +23,7 @@
 #endif
 
 #include "AsciiArt.hpp"
+#include "TextWidth.hpp"
 
 using namespace draconis::utils::types;
 using namespace draconis::utils::logging;
@@ -29,11 +32,23 @@ using namespace draconis::utils::localization;
 namespace draconis::ui {
   using config::Config;
   using config::LogoProtocol;
+  using config::RowKind;
   using config::UILayoutGroup;
   using config::UILayoutRow;
+  using config::ROW_KIND_COUNT;
 
   using core::system::SystemInfo;
 
+  using utils::cache::CacheLocation;
+  using utils::cache::CacheManager;
+  using utils::cache::CachePolicy;
+
+  using enum utils::error::DracErrorCode;
+
+  using text::GetVisualWidth;
+  using text::WordWrap;
+  using text::WrappedLine;
+
   constexpr Theme DEFAULT_THEME = {
     .icon  = LogColor::Cyan,
     .label = LogColor::Yellow,
@@ -124,28 +139,44 @@ namespace draconis::ui {
     bool     autoWrap = false;
   };
 
+  // Lives for one frame, so its tables come from the frame's scratch resource.
   struct UIGroup {
-    Vec<RowInfo>  rows;
-    Vec<usize>    iconWidths;
-    Vec<usize>    labelWidths;
-    Vec<usize>    valueWidths;
-    Vec<String>   coloredIcons;
-    Vec<String>   coloredLabels;
-    Vec<String>   coloredValues;
-    Vec<bool>     autoWraps;
-    Vec<LogColor> valueColors;
-    usize         maxLabelWidth = 0;
+    std::pmr::vector<RowInfo>          rows;
+    std::pmr::vector<usize>            iconWidths;
+    std::pmr::vector<usize>            labelWidths;
+    std::pmr::vector<usize>            valueWidths;
+    std::pmr::vector<Vec<WrappedLine>> wrappedValues; // Filled in once the box width is known; empty for rows that don't wrap
+    usize                              maxLabelWidth = 0;
+
+    explicit UIGroup(std::pmr::memory_resource* scratch)
+      : rows(scratch), iconWidths(scratch), labelWidths(scratch), valueWidths(scratch), wrappedValues(scratch) {}
   };
 
-  namespace {
-    struct LogoRender {
-      Vec<String> lines;    // ASCII art lines when using ascii logos
-      String      sequence; // Escape sequence when using inline image logos
-      usize       width    = 0;
-      usize       height   = 0;
-      bool        isInline = false;
-    };
+  // Cached between runs, so building the escape sequence is a one-off per image, protocol and cell size.
+  struct LogoRender {
+    String sequence; // Escape sequence for the inline image
+    usize  width    = 0;
+    usize  height   = 0;
+    bool   isInline = false;
+  };
+} // namespace draconis::ui
+
+template <>
+struct glz::meta<draconis::ui::LogoRender> {
+  using T = draconis::ui::LogoRender;
+
+  // clang-format off
+  static constexpr detail::Object value = object(
+    "sequence", &T::sequence,
+    "width",    &T::width,
+    "height",   &T::height,
+    "isInline", &T::isInline
+  );
+  // clang-format on
+};
 
+namespace draconis::ui {
+  namespace {
     constexpr Array<char, 65> BASE64_TABLE = {
       'A',
       'B',
@@ -520,18 +551,9 @@ namespace draconis::ui {
       return sequence;
     }
 
-    auto BuildInlineLogo(const config::Logo& logoCfg, [[maybe_unused]] usize suggestedHeight) -> Option<LogoRender> {
-      if (!logoCfg.imagePath)
-        return None;
-
-      const LogoProtocol protocol = logoCfg.getProtocol();
-      if (protocol != LogoProtocol::Kitty && protocol != LogoProtocol::KittyDirect && protocol != LogoProtocol::Iterm2)
-        return None;
-
-      // Check if terminal supports the requested image protocol; fall back to ASCII if not
-      if (!SupportsInlineImages(protocol))
-        return None;
-
+    // Sizes the image in terminal cells and builds its escape sequence; everything here is
+    // derived from the file, the configured size and the cell metrics, so the result is cacheable.
+    auto RenderInlineLogo(const config::Logo& logoCfg, const Option<Pair<double, double>>& cellMetrics) -> Option<LogoRender> {
       usize logoWidthPx  = logoCfg.width.value_or(0);
       usize logoHeightPx = logoCfg.height.value_or(0); // leave height unset unless explicitly provided
 
@@ -564,7 +586,7 @@ namespace draconis::ui {
       const usize renderWidthPx  = logoWidthPx,
                   renderHeightPx = logoHeightPx;
 
-      if (const Option<Pair<double, double>> cellMetrics = GetCellMetricsPx()) {
+      if (cellMetrics) {
         const double cellW = cellMetrics->first;
         const double cellH = cellMetrics->second;
         if (cellW > 0.0 && renderWidthPx > 0)
@@ -624,6 +646,54 @@ namespace draconis::ui {
       return render;
     }
 
+    auto BuildInlineLogo(CacheManager& cache, const config::Logo& logoCfg, [[maybe_unused]] usize suggestedHeight) -> Option<LogoRender> {
+      if (!logoCfg.imagePath)
+        return None;
+
+      const LogoProtocol protocol = logoCfg.getProtocol();
+      if (protocol != LogoProtocol::Kitty && protocol != LogoProtocol::KittyDirect && protocol != LogoProtocol::Iterm2)
+        return None;
+
+      // Check if terminal supports the requested image protocol; fall back to ASCII if not
+      if (!SupportsInlineImages(protocol))
+        return None;
+
+      // Cell metrics change with the font or window, so they're part of the key rather than cached.
+      const Option<Pair<double, double>> cellMetrics = GetCellMetricsPx();
+
+      // FNV-1a of the path keeps the key a valid file name; the file's own identity is checked by fingerprint.
+      u64 pathHash = 0xcbf29ce484222325ULL;
+      for (const char chr : *logoCfg.imagePath)
+        pathHash = (pathHash ^ static_cast<u8>(chr)) * 0x100000001b3ULL;
+
+      const String key = std::format(
+        "logo_{}_{:016x}_{}x{}_{:.3f}x{:.3f}",
+        static_cast<u8>(protocol),
+        pathHash,
+        logoCfg.width.value_or(0),
+        logoCfg.height.value_or(0),
+        cellMetrics ? cellMetrics->first : 0.0,
+        cellMetrics ? cellMetrics->second : 0.0
+      );
+
+      // Always persistent: the entry is as large as the encoded image, so it stays out of the pack.
+      const CachePolicy policy { .location = CacheLocation::Persistent, .ttl = None, .sources = { *logoCfg.imagePath } };
+
+      Result<LogoRender> render = cache.getOrSet<LogoRender>(key, policy, [&] -> Result<LogoRender> {
+        if (Option<LogoRender> built = RenderInlineLogo(logoCfg, cellMetrics))
+          return *std::move(built);
+
+        ERR_FMT(NotFound, "Failed to read logo image '{}'", *logoCfg.imagePath);
+      });
+
+      if (!render) {
+        debug_at(render.error());
+        return None;
+      }
+
+      return *std::move(render);
+    }
+
 #ifdef __linux__
     // clang-format off
     constexpr Array<Pair<StringView, StringView>, 13> distro_icons {{
@@ -670,298 +740,58 @@ namespace draconis::ui {
       "\033[38;5;15m◯\033[0m"
     };
 
-    constexpr auto IsWideCharacter(char32_t codepoint) -> bool {
-      return (codepoint >= 0x1100 && codepoint <= 0x115F) || // Hangul Jamo
-        (codepoint >= 0x2329 && codepoint <= 0x232A) ||      // Angle brackets
-        (codepoint >= 0x2E80 && codepoint <= 0x2EFF) ||      // CJK Radicals Supplement
-        (codepoint >= 0x2F00 && codepoint <= 0x2FDF) ||      // Kangxi Radicals
-        (codepoint >= 0x2FF0 && codepoint <= 0x2FFF) ||      // Ideographic Description Characters
-        (codepoint >= 0x3000 && codepoint <= 0x303E) ||      // CJK Symbols and Punctuation
-        (codepoint >= 0x3041 && codepoint <= 0x3096) ||      // Hiragana
-        (codepoint >= 0x3099 && codepoint <= 0x30FF) ||      // Katakana
-        (codepoint >= 0x3105 && codepoint <= 0x312F) ||      // Bopomofo
-        (codepoint >= 0x3131 && codepoint <= 0x318E) ||      // Hangul Compatibility Jamo
-        (codepoint >= 0x3190 && codepoint <= 0x31BF) ||      // Kanbun
-        (codepoint >= 0x31C0 && codepoint <= 0x31EF) ||      // CJK Strokes
-        (codepoint >= 0x31F0 && codepoint <= 0x31FF) ||      // Katakana Phonetic Extensions
-        (codepoint >= 0x3200 && codepoint <= 0x32FF) ||      // Enclosed CJK Letters and Months
-        (codepoint >= 0x3300 && codepoint <= 0x33FF) ||      // CJK Compatibility
-        (codepoint >= 0x3400 && codepoint <= 0x4DBF) ||      // CJK Unified Ideographs Extension A
-        (codepoint >= 0x4E00 && codepoint <= 0x9FFF) ||      // CJK Unified Ideographs
-        (codepoint >= 0xA000 && codepoint <= 0xA48F) ||      // Yi Syllables
-        (codepoint >= 0xA490 && codepoint <= 0xA4CF) ||      // Yi Radicals
-        (codepoint >= 0xAC00 && codepoint <= 0xD7A3) ||      // Hangul Syllables
-        (codepoint >= 0xF900 && codepoint <= 0xFAFF) ||      // CJK Compatibility Ideographs
-        (codepoint >= 0xFE10 && codepoint <= 0xFE19) ||      // Vertical Forms
-        (codepoint >= 0xFE30 && codepoint <= 0xFE6F) ||      // CJK Compatibility Forms
-        (codepoint >= 0xFF00 && codepoint <= 0xFF60) ||      // Fullwidth Forms
-        (codepoint >= 0xFFE0 && codepoint <= 0xFFE6) ||      // Fullwidth Forms
-        (codepoint >= 0x20000 && codepoint <= 0x2FFFD) ||    // CJK Unified Ideographs Extension B, C, D, E
-        (codepoint >= 0x30000 && codepoint <= 0x3FFFD);      // CJK Unified Ideographs Extension F
-    }
-
-    constexpr auto DecodeUTF8(const StringView& str, usize& pos) -> char32_t {
-      if (pos >= str.length())
-        return 0;
-
-      const auto getByte = [&](usize index) -> u8 {
-        return static_cast<u8>(str[index]);
-      };
-
-      const u8 first = getByte(pos++);
-
-      if ((first & 0x80) == 0) // ASCII (0xxxxxxx)
-        return first;
-
-      if ((first & 0xE0) == 0xC0) {
-        // 2-byte sequence (110xxxxx 10xxxxxx)
-        if (pos >= str.length())
-          return 0;
-
-        const u8 second = getByte(pos++);
-
-        return ((first & 0x1F) << 6) | (second & 0x3F);
-      }
-
-      if ((first & 0xF0) == 0xE0) {
-        // 3-byte sequence (1110xxxx 10xxxxxx 10xxxxxx)
-        if (pos + 1 >= str.length())
-          return 0;
-
-        const u8 second = getByte(pos++);
-        const u8 third  = getByte(pos++);
-
-        return ((first & 0x0F) << 12) | ((second & 0x3F) << 6) | (third & 0x3F);
-      }
-
-      if ((first & 0xF8) == 0xF0) {
-        // 4-byte sequence (11110xxx 10xxxxxx 10xxxxxx 10xxxxxx)
-        if (pos + 2 >= str.length())
-          return 0;
-
-        const u8 second = getByte(pos++);
-        const u8 third  = getByte(pos++);
-        const u8 fourth = getByte(pos++);
-
-        return ((first & 0x07) << 18) | ((second & 0x3F) << 12) | ((third & 0x3F) << 6) | (fourth & 0x3F);
+    // In-place equivalent of Stylize(text, { .color = color }), so rendering never builds a styled temporary.
+    constexpr auto AppendStyled(String& out, const StringView text, const LogColor color) -> Unit {
+      if (color == LogColor::White) {
+        out += text;
+        return;
       }
 
-      return 0; // Invalid UTF-8
+      out += LogLevelConst::COLOR_CODE_LITERALS.at(static_cast<usize>(color));
+      out += text;
+      out += LogLevelConst::RESET_CODE;
     }
 
-    constexpr auto GetVisualWidth(const StringView& str) -> usize {
-      usize width    = 0;
-      bool  inEscape = false;
-      usize pos      = 0;
-
-      while (pos < str.length()) {
-        const char current = str[pos];
-
-        if (inEscape) {
-          if (current == 'm' || current == '\\' || current == '\a')
-            inEscape = false;
-
-          pos++;
-        } else if (current == '\033') {
-          inEscape = true;
-          pos++;
-        } else {
-          const char32_t codepoint = DecodeUTF8(str, pos);
-          if (codepoint != 0)
-            width += IsWideCharacter(codepoint) ? 2 : 1;
-        }
-      }
+    // Upper bound on the bytes AppendStyled() adds around its text.
+    constexpr usize STYLE_OVERHEAD_BYTES = 16;
 
-      return width;
-    }
+    constexpr usize COLOR_CIRCLE_WIDTH = GetVisualWidth(COLOR_CIRCLES.at(0));
 
     /**
-     * @brief Word-wrap text to a specified visual width with balanced line lengths
-     * @param text The text to wrap
-     * @param wrapWidth Maximum visual width per line (0 = no wrap)
-     * @return Vector of wrapped lines
+     * @brief Appends the palette circles spread across @p availableWidth.
+     * @return The visual width that was appended.
      */
-    auto WordWrap(const StringView& text, const usize wrapWidth) -> Vec<String> {
-      Vec<String> lines;
-
-      if (wrapWidth == 0) {
-        lines.emplace_back(text);
-        return lines;
-      }
-
-      // First, split into words with their widths
-      Vec<String>       words;
-      Vec<usize>        wordWidths;
-      std::stringstream textStream((String(text)));
-      String            word;
-      while (textStream >> word) {
-        wordWidths.push_back(GetVisualWidth(word));
-        words.push_back(std::move(word));
-      }
-
-      if (words.empty())
-        return lines;
-
-      // Calculate prefix sums for efficient width calculation
-      // prefixWidth[i] = total width of words 0..i-1 including spaces between them
-      Vec<usize> prefixWidth(words.size() + 1, 0);
-      for (usize idx = 0; idx < words.size(); ++idx)
-        prefixWidth[idx + 1] = prefixWidth[idx] + wordWidths[idx] + (idx > 0 ? 1 : 0);
-
-      // Helper to get width of words[start..end) with spaces
-      auto getLineWidth = [&](usize start, usize end) -> usize {
-        if (start >= end)
-          return 0;
-        // Width is: sum of word widths + (end-start-1) spaces
-        usize width = 0;
-        for (usize idx = start; idx < end; ++idx)
-          width += wordWidths[idx];
-        if (end > start)
-          width += end - start - 1; // spaces between words
-        return width;
-      };
-
-      // Do greedy wrap first to determine minimum number of lines needed
-      Vec<usize> greedyBreaks; // indices where lines start
-      greedyBreaks.push_back(0);
-      usize currentWidth = 0;
-      for (usize idx = 0; idx < words.size(); ++idx) {
-        const usize addedWidth = wordWidths[idx] + (currentWidth > 0 ? 1 : 0);
-        if (currentWidth > 0 && currentWidth + addedWidth > wrapWidth) {
-          greedyBreaks.push_back(idx);
-          currentWidth = wordWidths[idx];
-        } else {
-          currentWidth += addedWidth;
-        }
-      }
-
-      const usize numLines = greedyBreaks.size();
-
-      // If only one line, return as-is
-      if (numLines == 1) {
-        String line;
-        for (usize idx = 0; idx < words.size(); ++idx) {
-          if (idx > 0)
-            line += " ";
-          line += words[idx];
-        }
-        lines.push_back(line);
-        return lines;
-      }
-
-      // For balanced wrapping, find optimal break points
-      // Use dynamic programming to find breaks that minimize max line length difference
-      // For simplicity with 2 lines, just find the break that makes lines most equal
-      if (numLines == 2) {
-        usize bestBreak = 1;
-        usize bestDiff  = std::numeric_limits<usize>::max();
-
-        for (usize breakPoint = 1; breakPoint < words.size(); ++breakPoint) {
-          const usize firstWidth  = getLineWidth(0, breakPoint);
-          const usize secondWidth = getLineWidth(breakPoint, words.size());
-
-          // Both lines must fit within wrapWidth
-          if (firstWidth > wrapWidth || secondWidth > wrapWidth)
-            continue;
-
-          const usize diff = firstWidth > secondWidth ? firstWidth - secondWidth : secondWidth - firstWidth;
-          if (diff < bestDiff) {
-            bestDiff  = diff;
-            bestBreak = breakPoint;
-          }
-        }
-
-        // Build lines from best break
-        String line1, line2;
-        for (usize idx = 0; idx < bestBreak; ++idx) {
-          if (idx > 0)
-            line1 += " ";
-          line1 += words[idx];
-        }
-        for (usize idx = bestBreak; idx < words.size(); ++idx) {
-          if (idx > bestBreak)
-            line2 += " ";
-          line2 += words[idx];
-        }
-        lines.push_back(line1);
-        lines.push_back(line2);
-        return lines;
-      }
-
-      // For 3+ lines, use a generalized approach: aim for equal distribution
-      const usize totalWidth  = getLineWidth(0, words.size());
-      const usize targetWidth = (totalWidth + numLines - 1) / numLines;
-
-      lines.clear();
-      String currentLine;
-      currentWidth    = 0;
-      usize linesLeft = numLines;
-
-      for (usize idx = 0; idx < words.size(); ++idx) {
-        const usize widthIfAdded        = currentWidth + wordWidths[idx] + (currentWidth > 0 ? 1 : 0);
-        const usize remainingWidth      = getLineWidth(idx, words.size());
-        const usize avgRemainingPerLine = linesLeft > 0 ? (remainingWidth + linesLeft - 1) / linesLeft : 0;
-
-        // Break if: exceeds max, or current line is at target and remaining fits well in remaining lines
-        const bool shouldBreak = !currentLine.empty() &&
-          (widthIfAdded > wrapWidth ||
-           (currentWidth >= targetWidth && linesLeft > 1 && remainingWidth >= avgRemainingPerLine));
-
-        if (shouldBreak) {
-          lines.push_back(currentLine);
-          currentLine.clear();
-          currentWidth = 0;
-          linesLeft--;
-        }
-
-        if (!currentLine.empty()) {
-          currentLine += " ";
-          currentWidth += 1;
-        }
-        currentLine += words[idx];
-        currentWidth += wordWidths[idx];
-      }
-
-      if (!currentLine.empty())
-        lines.push_back(currentLine);
-
-      return lines;
-    }
-
-    constexpr auto CreateDistributedColorCircles(usize availableWidth) -> String {
+    constexpr auto AppendDistributedColorCircles(String& out, usize availableWidth) -> usize {
       if (COLOR_CIRCLES.empty() || availableWidth == 0)
-        return "";
+        return 0;
 
       const usize
-        circleWidth       = GetVisualWidth(COLOR_CIRCLES.at(0)),
         numCircles        = COLOR_CIRCLES.size(),
         minSpacingPerGap  = 1,
         totalMinSpacing   = (numCircles - 1) * minSpacingPerGap,
-        totalCirclesWidth = numCircles * circleWidth,
+        totalCirclesWidth = numCircles * COLOR_CIRCLE_WIDTH,
         requiredWidth     = totalCirclesWidth + totalMinSpacing,
         effectiveWidth    = std::max(availableWidth, requiredWidth);
 
       if (numCircles == 1) {
         const usize padding = effectiveWidth / 2;
-        return String(padding, ' ') + String(COLOR_CIRCLES.at(0));
+        out.append(padding, ' ');
+        out += COLOR_CIRCLES.at(0);
+        return padding + COLOR_CIRCLE_WIDTH;
       }
 
       const usize
         totalSpacing   = effectiveWidth - totalCirclesWidth,
         spacingBetween = totalSpacing / (numCircles - 1);
 
-      String result;
-      result.reserve(effectiveWidth);
-
       for (usize i = 0; i < numCircles; ++i) {
         if (i > 0)
-          result.append(spacingBetween, ' ');
+          out.append(spacingBetween, ' ');
 
-        const auto& circle = COLOR_CIRCLES.at(i);
-        result.append(circle.data(), circle.size());
+        out += COLOR_CIRCLES.at(i);
       }
 
-      return result;
+      return totalCirclesWidth + ((numCircles - 1) * spacingBetween);
     }
 
     constexpr auto ProcessGroup(UIGroup& group) -> usize {
@@ -971,11 +801,7 @@ namespace draconis::ui {
       group.iconWidths.reserve(group.rows.size());
       group.labelWidths.reserve(group.rows.size());
       group.valueWidths.reserve(group.rows.size());
-      group.coloredIcons.reserve(group.rows.size());
-      group.coloredLabels.reserve(group.rows.size());
-      group.coloredValues.reserve(group.rows.size());
-      group.autoWraps.reserve(group.rows.size());
-      group.valueColors.reserve(group.rows.size());
+      group.wrappedValues.resize(group.rows.size());
 
       usize groupMaxWidth = 0;
 
@@ -989,30 +815,6 @@ namespace draconis::ui {
         group.iconWidths.push_back(iconW);
         group.labelWidths.push_back(labelWidth);
         group.valueWidths.push_back(valueW);
-        group.autoWraps.push_back(row.autoWrap);
-        group.valueColors.push_back(row.color);
-
-        String coloredIcon  = Stylize(row.icon, { .color = DEFAULT_THEME.icon });
-        String coloredLabel = Stylize(row.label, { .color = DEFAULT_THEME.label });
-        String coloredValue = Stylize(row.value, { .color = row.color });
-
-        // Debug: check if colored strings have different visual widths
-        usize coloredIconW  = GetVisualWidth(coloredIcon);
-        usize coloredLabelW = GetVisualWidth(coloredLabel);
-        usize coloredValueW = GetVisualWidth(coloredValue);
-        if (coloredIconW != iconW || coloredLabelW != labelWidth || coloredValueW != valueW)
-          debug_log(
-            "Width mismatch! Icon: {} vs {}, Label: {} vs {}, Value: {} vs {}",
-            // clang-format off
-            iconW,      coloredIconW,
-            labelWidth, coloredLabelW,
-            valueW,     coloredValueW
-            // clang-format on
-          );
-
-        group.coloredIcons.push_back(coloredIcon);
-        group.coloredLabels.push_back(coloredLabel);
-        group.coloredValues.push_back(coloredValue);
 
         // Don't include value width for autoWrap rows - they will wrap to fit available width
         if (!row.autoWrap)
@@ -1024,59 +826,142 @@ namespace draconis::ui {
       return groupMaxWidth;
     }
 
-    constexpr auto RenderGroup(String& out, const UIGroup& group, const usize maxContentWidth, const String& hBorder, bool& hasRenderedContent) {
+    /**
+     * @brief Wraps the group's autoWrap rows to the final box width.
+     * @return The number of box lines the group's rows will take up.
+     */
+    auto WrapGroup(UIGroup& group, const usize maxContentWidth) -> usize {
+      usize lineCount = 0;
+
+      for (usize i = 0; i < group.rows.size(); ++i) {
+        if (!group.rows[i].autoWrap) {
+          lineCount++;
+          continue;
+        }
+
+        // Leave at least 1 space between label and value
+        const usize availableWidth = maxContentWidth - (group.iconWidths[i] + group.maxLabelWidth) - 1;
+
+        group.wrappedValues[i] = WordWrap(group.rows[i].value, availableWidth);
+        lineCount += group.wrappedValues[i].size();
+      }
+
+      return lineCount;
+    }
+
+    /**
+     * @brief Writes frame rows into one buffer: the logo column first, then the box line.
+     *
+     * @details ASCII logos are written inline on each row; inline images are
+     * drawn once up front, so their rows only move the cursor past the image.
+     * Without a logo the box lines are written as-is.
+     */
+    struct FrameWriter {
+      String&                out;
+      Span<const StringView> logoLines;
+      Span<const usize>      logoLineWidths;
+      usize                  logoWidth    = 0;
+      usize                  logoPadTop   = 0;
+      usize                  inlineShift  = 0;
+      bool                   isInlineLogo = false;
+      usize                  row          = 0;
+
+      // Starts the next frame row.
+      auto beginLine() -> Unit {
+        const usize current = row++;
+
+        if (isInlineLogo) {
+          std::format_to(std::back_inserter(out), "\r\033[{}C", inlineShift);
+          return;
+        }
+
+        if (logoLines.empty())
+          return;
+
+        if (current < logoPadTop || current >= logoPadTop + logoLines.size())
+          out.append(logoWidth, ' ');
+        else {
+          const usize logoIndex = current - logoPadTop;
+
+          out += logoLines[logoIndex];
+          out.append(logoWidth > logoLineWidths[logoIndex] ? logoWidth - logoLineWidths[logoIndex] : 0, ' ');
+          out += LogLevelConst::RESET_CODE;
+        }
+
+        out += "  ";
+      }
+
+      auto border(const StringView left, const StringView right, const usize innerWidth) -> Unit {
+        beginLine();
+
+        out += left;
+        for (usize i = 0; i < innerWidth; ++i) out += "─";
+        out += right;
+        out += '\n';
+      }
+
+      auto emptyBoxLine(const usize innerWidth) -> Unit {
+        beginLine();
+
+        out += "│";
+        out.append(innerWidth, ' ');
+        out += "│\n";
+      }
+    };
+
+    auto RenderGroup(FrameWriter& frame, const UIGroup& group, const usize maxContentWidth, const usize innerWidth) -> Unit {
       if (group.rows.empty())
         return;
 
-      if (hasRenderedContent) {
-        out += "├";
-        out += hBorder;
-        out += "┤\n";
-      }
+      String& out = frame.out;
+
+      frame.border("├", "┤", innerWidth);
 
       for (usize i = 0; i < group.rows.size(); ++i) {
-        const usize    leftWidth  = group.iconWidths[i] + group.maxLabelWidth;
-        const LogColor valueColor = group.valueColors[i];
+        const RowInfo& row       = group.rows[i];
+        const usize    leftWidth = group.iconWidths[i] + group.maxLabelWidth;
+
+        const auto beginRow = [&](const usize padding) -> Unit {
+          frame.beginLine();
+
+          out += "│";
+          AppendStyled(out, row.icon, DEFAULT_THEME.icon);
+          AppendStyled(out, row.label, DEFAULT_THEME.label);
+          out.append((group.maxLabelWidth - group.labelWidths[i]) + padding, ' ');
+        };
 
         // Handle word wrapping if enabled for this row
-        if (group.autoWraps[i]) {
-          // Leave at least 1 space between label and value
-          const usize       availableWidth = maxContentWidth - leftWidth - 1;
-          const Vec<String> wrappedLines   = WordWrap(group.rows[i].value, availableWidth);
+        if (row.autoWrap) {
+          const Vec<WrappedLine>& wrappedLines = group.wrappedValues[i];
 
-          if (!wrappedLines.empty()) {
-            // First line: icon + label + first wrapped segment
-            const String coloredFirstLine = Stylize(wrappedLines[0], { .color = valueColor });
+          if (wrappedLines.empty())
+            continue;
 
+          // First line: icon + label + first wrapped segment
+          const usize
+            firstLineWidth = wrappedLines[0].width,
+            firstPadding   = (maxContentWidth >= leftWidth + firstLineWidth + 1)
+              ? maxContentWidth - (leftWidth + firstLineWidth)
+              : 1;
+
+          beginRow(firstPadding);
+          AppendStyled(out, wrappedLines[0].text, row.color);
+          out += " │\n";
+
+          // Subsequent lines: indent + wrapped segment (right-aligned)
+          for (usize j = 1; j < wrappedLines.size(); ++j) {
             const usize
-              firstLineWidth = GetVisualWidth(wrappedLines[0]),
-              firstPadding   = (maxContentWidth >= leftWidth + firstLineWidth + 1)
-                ? maxContentWidth - (leftWidth + firstLineWidth)
-                : 1;
+              lineWidth   = wrappedLines[j].width,
+              linePadding = (maxContentWidth > lineWidth)
+              ? maxContentWidth - lineWidth
+              : 0;
+
+            frame.beginLine();
 
             out += "│";
-            out += group.coloredIcons[i];
-            out += group.coloredLabels[i];
-            out.append(group.maxLabelWidth - group.labelWidths[i], ' ');
-            out.append(firstPadding, ' ');
-            out += coloredFirstLine;
+            out.append(linePadding, ' ');
+            AppendStyled(out, wrappedLines[j].text, row.color);
             out += " │\n";
-
-            // Subsequent lines: indent + wrapped segment (right-aligned)
-            for (usize j = 1; j < wrappedLines.size(); ++j) {
-              const String coloredLine = Stylize(wrappedLines[j], { .color = valueColor });
-
-              const usize
-                lineWidth   = GetVisualWidth(wrappedLines[j]),
-                linePadding = (maxContentWidth > lineWidth)
-                ? maxContentWidth - lineWidth
-                : 0;
-
-              out += "│";
-              out.append(linePadding, ' ');
-              out += coloredLine;
-              out += " │\n";
-            }
           }
         } else {
           // Normal rendering without word wrap
@@ -1086,253 +971,232 @@ namespace draconis::ui {
                ? maxContentWidth - (leftWidth + rightWidth)
                : 0;
 
-          out += "│";
-          out += group.coloredIcons[i];
-          out += group.coloredLabels[i];
-          out.append(group.maxLabelWidth - group.labelWidths[i], ' ');
-          out.append(padding, ' ');
-          out += group.coloredValues[i];
+          beginRow(padding);
+          AppendStyled(out, row.value, row.color);
           out += " │\n";
         }
       }
-
-      hasRenderedContent = true;
-    }
-
-    constexpr auto ToLowerCopy(String str) -> String {
-      std::ranges::transform(
-        str,
-        str.begin(),
-        [](unsigned char chr) -> char { return static_cast<char>(std::tolower(chr)); }
-      );
-      return str;
-    }
-
-    constexpr auto ParsePluginKey(const String& key) -> Option<Pair<String, Option<String>>> {
-      const StringView prefix = "plugin.";
-
-      if (!key.starts_with(prefix))
-        return None;
-
-      const usize prefixLen = prefix.size();
-
-      if (key.size() <= prefixLen)
-        return None;
-
-      const String remainder = key.substr(prefixLen);
-      const usize  sepPos    = remainder.find('.');
-
-      if (sepPos == String::npos)
-        return Pair<String, Option<String>> { remainder, None };
-
-      String pluginId = remainder.substr(0, sepPos),
-             field    = remainder.substr(sepPos + 1);
-
-      return Pair<String, Option<String>> { std::move(pluginId), Option<String>(std::move(field)) };
     }
 
     auto BuildDefaultLayout(const SystemInfo& data) -> Vec<UILayoutGroup> {
       Vec<UILayoutGroup> layout;
 
+      const auto row = [](String key) -> UILayoutRow {
+        UILayoutRow layoutRow;
+        layoutRow.setKey(std::move(key));
+        return layoutRow;
+      };
+
       UILayoutGroup introGroup;
       introGroup.name = "intro";
-      introGroup.rows.push_back(UILayoutRow { .key = "date" });
+      introGroup.rows.push_back(row("date"));
 
 #if DRAC_ENABLE_PLUGINS
       for (const auto& [pluginId, _] : data.pluginDisplay)
-        introGroup.rows.push_back(UILayoutRow { .key = std::format("plugin.{}", pluginId) });
+        introGroup.rows.push_back(row(std::format("plugin.{}", pluginId)));
 #endif
 
       layout.push_back(std::move(introGroup));
 
       UILayoutGroup systemGroup;
       systemGroup.name = "system";
-      systemGroup.rows.push_back(UILayoutRow { .key = "host" });
-      systemGroup.rows.push_back(UILayoutRow { .key = "os" });
-      systemGroup.rows.push_back(UILayoutRow { .key = "kernel" });
+      systemGroup.rows.push_back(row("host"));
+      systemGroup.rows.push_back(row("os"));
+      systemGroup.rows.push_back(row("kernel"));
       layout.push_back(std::move(systemGroup));
 
       UILayoutGroup hardwareGroup;
       hardwareGroup.name = "hardware";
-      hardwareGroup.rows.push_back(UILayoutRow { .key = "ram" });
-      hardwareGroup.rows.push_back(UILayoutRow { .key = "disk" });
-      hardwareGroup.rows.push_back(UILayoutRow { .key = "cpu" });
-      hardwareGroup.rows.push_back(UILayoutRow { .key = "gpu" });
-      hardwareGroup.rows.push_back(UILayoutRow { .key = "uptime" });
+      hardwareGroup.rows.push_back(row("ram"));
+      hardwareGroup.rows.push_back(row("disk"));
+      hardwareGroup.rows.push_back(row("cpu"));
+      hardwareGroup.rows.push_back(row("gpu"));
+      hardwareGroup.rows.push_back(row("uptime"));
       layout.push_back(std::move(hardwareGroup));
 
       UILayoutGroup softwareGroup;
       softwareGroup.name = "software";
-      softwareGroup.rows.push_back(UILayoutRow { .key = "shell" });
+      softwareGroup.rows.push_back(row("shell"));
 #if DRAC_ENABLE_PACKAGECOUNT
-      softwareGroup.rows.push_back(UILayoutRow { .key = "packages" });
+      softwareGroup.rows.push_back(row("packages"));
 #endif
       layout.push_back(std::move(softwareGroup));
 
       UILayoutGroup envGroup;
       envGroup.name = "environment";
-      envGroup.rows.push_back(UILayoutRow { .key = "de" });
-      envGroup.rows.push_back(UILayoutRow { .key = "wm" });
+      envGroup.rows.push_back(row("de"));
+      envGroup.rows.push_back(row("wm"));
       layout.push_back(std::move(envGroup));
 
       return layout;
     }
 
-    auto BuildRowFromLayout(
-      const UILayoutRow& layoutRow,
-      const Icons&       iconType,
-      const SystemInfo&  data,
-      Option<StringView> distroIcon
-    ) -> Option<RowInfo> {
-      const String keyLower = ToLowerCopy(layoutRow.key);
+    using RowBuilder = auto (*)(const Icons&, const SystemInfo&, Option<StringView>) -> Option<RowInfo>;
 
-      if (const auto pluginKey = ParsePluginKey(layoutRow.key)) {
-#if DRAC_ENABLE_PLUGINS
-        const String&         pluginId       = pluginKey->first;
-        const Option<String>& fieldName      = pluginKey->second;
-        Option<String>        value          = None;
-        String                icon           = String(iconType.palette);
-        String                label          = pluginId;
-        const auto            displayIt      = data.pluginDisplay.find(pluginId);
-        const bool            hasDisplayInfo = displayIt != data.pluginDisplay.end();
-
-        if (fieldName) {
-          if (const auto pluginDataIt = data.pluginData.find(pluginId); pluginDataIt != data.pluginData.end())
-            if (const auto valueIt = pluginDataIt->second.find(*fieldName); valueIt != pluginDataIt->second.end())
-              value = valueIt->second;
-
-          if (!value)
-            return None;
-
-          if (hasDisplayInfo) {
-            if (!displayIt->second.icon.empty())
-              icon = displayIt->second.icon;
-            if (!displayIt->second.label.empty())
-              label = std::format("{} {}", displayIt->second.label, *fieldName);
-            else
-              label = *fieldName;
-          } else
-            label = *fieldName;
-        } else {
-          if (!hasDisplayInfo)
-            return None;
+    constexpr auto Index(const RowKind kind) -> usize {
+      return static_cast<usize>(kind);
+    }
 
-          icon  = displayIt->second.icon.empty() ? iconType.palette : displayIt->second.icon;
-          label = displayIt->second.label.empty() ? pluginId : displayIt->second.label;
+    // Built-in rows by RowKind; Unknown and Plugin have no builder.
+    // clang-format off
+    constexpr Array<RowBuilder, ROW_KIND_COUNT> K_ROW_BUILDERS = [] {
+      Array<RowBuilder, ROW_KIND_COUNT> builders {};
 
-          if (displayIt->second.value)
-            value = *displayIt->second.value;
-        }
+      builders[Index(RowKind::Date)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.date) return None;
+        return RowInfo { .icon = String(icons.calendar), .label = String(_("date"_key)), .value = *info.date };
+      };
+      builders[Index(RowKind::Host)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.host || info.host->empty()) return None;
+        return RowInfo { .icon = String(icons.host), .label = String(_("host"_key)), .value = *info.host };
+      };
+      builders[Index(RowKind::OperatingSystem)] = [](const Icons& icons, const SystemInfo& info, Option<StringView> distro) -> Option<RowInfo> {
+        if (!info.operatingSystem) return None;
+        return RowInfo {
+          .icon  = distro ? String(*distro) : String(icons.os),
+          .label = String(_("os"_key)),
+          .value = std::format("{} {}", info.operatingSystem->name, info.operatingSystem->version)
+        };
+      };
+      builders[Index(RowKind::Kernel)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.kernelVersion) return None;
+        return RowInfo { .icon = String(icons.kernel), .label = String(_("kernel"_key)), .value = *info.kernelVersion };
+      };
+      builders[Index(RowKind::Memory)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.memInfo) return None;
+        return RowInfo {
+          .icon  = String(icons.memory),
+          .label = String(_("ram"_key)),
+          .value = std::format("{}/{}", BytesToGiB(info.memInfo->usedBytes), BytesToGiB(info.memInfo->totalBytes))
+        };
+      };
+      builders[Index(RowKind::Disk)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.diskUsage) return None;
+        return RowInfo {
+          .icon  = String(icons.disk),
+          .label = String(_("disk"_key)),
+          .value = std::format("{}/{}", BytesToGiB(info.diskUsage->usedBytes), BytesToGiB(info.diskUsage->totalBytes))
+        };
+      };
+      builders[Index(RowKind::CPU)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.cpuModel) return None;
+        return RowInfo { .icon = String(icons.cpu), .label = String(_("cpu"_key)), .value = *info.cpuModel };
+      };
+      builders[Index(RowKind::GPU)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.gpuModel) return None;
+        return RowInfo { .icon = String(icons.gpu), .label = String(_("gpu"_key)), .value = *info.gpuModel };
+      };
+      builders[Index(RowKind::Uptime)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.uptime) return None;
+        return RowInfo {
+          .icon  = String(icons.uptime),
+          .label = String(_("uptime"_key)),
+          .value = std::format("{}", SecondsToFormattedDuration { *info.uptime })
+        };
+      };
+      builders[Index(RowKind::Shell)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.shell) return None;
+        return RowInfo { .icon = String(icons.shell), .label = String(_("shell"_key)), .value = *info.shell };
+      };
+#if DRAC_ENABLE_PACKAGECOUNT
+      builders[Index(RowKind::Packages)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.packageCount || *info.packageCount == 0) return None;
+        return RowInfo { .icon = String(icons.package), .label = String(_("packages"_key)), .value = std::format("{}", *info.packageCount) };
+      };
+#endif
+      builders[Index(RowKind::DesktopEnv)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.desktopEnv) return None;
+        if (info.windowMgr && *info.desktopEnv == *info.windowMgr) return None;
+        return RowInfo { .icon = String(icons.desktopEnvironment), .label = String(_("de"_key)), .value = *info.desktopEnv };
+      };
+      builders[Index(RowKind::WindowMgr)] = [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
+        if (!info.windowMgr) return None;
+        return RowInfo { .icon = String(icons.windowManager), .label = String(_("wm"_key)), .value = *info.windowMgr };
+      };
+
+      return builders;
+    }();
+    // clang-format on
+
+    auto BuildPluginRow(const UILayoutRow& layoutRow, const Icons& iconType, const SystemInfo& data) -> Option<RowInfo> {
+#if DRAC_ENABLE_PLUGINS
+      const String&         pluginId       = layoutRow.pluginId;
+      const Option<String>& fieldName      = layoutRow.pluginField;
+      Option<String>        value          = None;
+      String                icon           = String(iconType.palette);
+      String                label          = pluginId;
+      const auto            displayIt      = data.pluginDisplay.find(pluginId);
+      const bool            hasDisplayInfo = displayIt != data.pluginDisplay.end();
+
+      if (fieldName) {
+        if (const auto pluginDataIt = data.pluginData.find(pluginId); pluginDataIt != data.pluginData.end())
+          if (const auto valueIt = pluginDataIt->second.find(*fieldName); valueIt != pluginDataIt->second.end())
+            value = valueIt->second;
 
         if (!value)
           return None;
 
-        RowInfo row {
-          .icon     = std::move(icon),
-          .label    = std::move(label),
-          .value    = *std::move(value),
-          .color    = layoutRow.color,
-          .autoWrap = layoutRow.autoWrap
-        };
+        if (hasDisplayInfo) {
+          if (!displayIt->second.icon.empty())
+            icon = displayIt->second.icon;
+          if (!displayIt->second.label.empty())
+            label = std::format("{} {}", displayIt->second.label, *fieldName);
+          else
+            label = *fieldName;
+        } else
+          label = *fieldName;
+      } else {
+        if (!hasDisplayInfo)
+          return None;
 
-        if (layoutRow.icon)
-          row.icon = *layoutRow.icon;
-        if (layoutRow.label)
-          row.label = *layoutRow.label;
+        icon  = displayIt->second.icon.empty() ? iconType.palette : displayIt->second.icon;
+        label = displayIt->second.label.empty() ? pluginId : displayIt->second.label;
 
-        return row;
-#else
-        (void)pluginKey;
-        return None;
-#endif
+        if (displayIt->second.value)
+          value = *displayIt->second.value;
       }
 
-      // clang-format off
-      using RowBuilder = std::function<Option<RowInfo>(const Icons&, const SystemInfo&, Option<StringView>)>;
-      static const std::unordered_map<String, RowBuilder> K_ROW_BUILDERS = {
-        { "date", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.date) return None;
-          return RowInfo { .icon = String(icons.calendar), .label = String(_("date")), .value = *info.date };
-        }},
-        { "host", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.host || info.host->empty()) return None;
-          return RowInfo { .icon = String(icons.host), .label = String(_("host")), .value = *info.host };
-        }},
-        { "os", [](const Icons& icons, const SystemInfo& info, Option<StringView> distro) -> Option<RowInfo> {
-          if (!info.operatingSystem) return None;
-          return RowInfo {
-            .icon  = distro ? String(*distro) : String(icons.os),
-            .label = String(_("os")),
-            .value = std::format("{} {}", info.operatingSystem->name, info.operatingSystem->version)
-          };
-        }},
-        { "kernel", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.kernelVersion) return None;
-          return RowInfo { .icon = String(icons.kernel), .label = String(_("kernel")), .value = *info.kernelVersion };
-        }},
-        { "ram", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.memInfo) return None;
-          return RowInfo {
-            .icon  = String(icons.memory),
-            .label = String(_("ram")),
-            .value = std::format("{}/{}", BytesToGiB(info.memInfo->usedBytes), BytesToGiB(info.memInfo->totalBytes))
-          };
-        }},
-        { "disk", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.diskUsage) return None;
-          return RowInfo {
-            .icon  = String(icons.disk),
-            .label = String(_("disk")),
-            .value = std::format("{}/{}", BytesToGiB(info.diskUsage->usedBytes), BytesToGiB(info.diskUsage->totalBytes))
-          };
-        }},
-        { "cpu", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.cpuModel) return None;
-          return RowInfo { .icon = String(icons.cpu), .label = String(_("cpu")), .value = *info.cpuModel };
-        }},
-        { "gpu", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.gpuModel) return None;
-          return RowInfo { .icon = String(icons.gpu), .label = String(_("gpu")), .value = *info.gpuModel };
-        }},
-        { "uptime", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.uptime) return None;
-          return RowInfo {
-            .icon  = String(icons.uptime),
-            .label = String(_("uptime")),
-            .value = std::format("{}", SecondsToFormattedDuration { *info.uptime })
-          };
-        }},
-        { "shell", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.shell) return None;
-          return RowInfo { .icon = String(icons.shell), .label = String(_("shell")), .value = *info.shell };
-        }},
-#if DRAC_ENABLE_PACKAGECOUNT
-        { "packages", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.packageCount || *info.packageCount == 0) return None;
-          return RowInfo { .icon = String(icons.package), .label = String(_("packages")), .value = std::format("{}", *info.packageCount) };
-        }},
-        { "package", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.packageCount || *info.packageCount == 0) return None;
-          return RowInfo { .icon = String(icons.package), .label = String(_("packages")), .value = std::format("{}", *info.packageCount) };
-        }},
-#endif
-        { "de", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.desktopEnv) return None;
-          if (info.windowMgr && *info.desktopEnv == *info.windowMgr) return None;
-          return RowInfo { .icon = String(icons.desktopEnvironment), .label = String(_("de")), .value = *info.desktopEnv };
-        }},
-        { "wm", [](const Icons& icons, const SystemInfo& info, Option<StringView>) -> Option<RowInfo> {
-          if (!info.windowMgr) return None;
-          return RowInfo { .icon = String(icons.windowManager), .label = String(_("wm")), .value = *info.windowMgr };
-        }},
+      if (!value)
+        return None;
+
+      RowInfo row {
+        .icon     = std::move(icon),
+        .label    = std::move(label),
+        .value    = *std::move(value),
+        .color    = layoutRow.color,
+        .autoWrap = layoutRow.autoWrap
       };
-      // clang-format on
 
-      const auto builderIt = K_ROW_BUILDERS.find(keyLower);
-      if (builderIt == K_ROW_BUILDERS.end())
+      if (layoutRow.icon)
+        row.icon = *layoutRow.icon;
+      if (layoutRow.label)
+        row.label = *layoutRow.label;
+
+      return row;
+#else
+      (void)layoutRow;
+      (void)iconType;
+      (void)data;
+      return None;
+#endif
+    }
+
+    auto BuildRowFromLayout(
+      const UILayoutRow& layoutRow,
+      const Icons&       iconType,
+      const SystemInfo&  data,
+      Option<StringView> distroIcon
+    ) -> Option<RowInfo> {
+      // The row's kind was resolved when the layout was loaded, so this is a table load, not a key lookup.
+      if (layoutRow.kind == RowKind::Plugin)
+        return BuildPluginRow(layoutRow, iconType, data);
+
+      const RowBuilder builder = K_ROW_BUILDERS[Index(layoutRow.kind)];
+
+      if (!builder)
         return None;
 
-      Option<RowInfo> rowOpt = builderIt->second(iconType, data, distroIcon);
+      Option<RowInfo> rowOpt = builder(iconType, data, distroIcon);
       if (!rowOpt)
         return None;
 
@@ -1347,10 +1211,18 @@ namespace draconis::ui {
 
       return row;
     }
-
   } // namespace
 
-  auto CreateUI(const Config& config, const SystemInfo& data, bool noAscii) -> String {
+  auto RenderUI(
+    CacheManager&              cache,
+    const Config&              config,
+    const SystemInfo&          data,
+    bool                       noAscii,
+    String&                    out,
+    std::pmr::memory_resource* scratch
+  ) -> Unit {
+    DRAC_TRACE_SCOPE("ui", "RenderUI");
+
     const String& name     = config.general.getName();
     const Icons&  iconType = ICON_TYPE;
 
@@ -1368,20 +1240,19 @@ namespace draconis::ui {
       layoutGroups  = &defaultLayout;
     }
 
-    Vec<UIGroup> groups;
+    std::pmr::vector<UIGroup> groups(scratch);
     groups.reserve(layoutGroups->size());
 
     for (const auto& groupCfg : *layoutGroups) {
-      UIGroup group;
+      UIGroup& group = groups.emplace_back(scratch);
       group.rows.reserve(groupCfg.rows.size());
 
       for (const auto& rowCfg : groupCfg.rows)
         if (auto row = BuildRowFromLayout(rowCfg, iconType, data, distroIcon))
           group.rows.push_back(std::move(*row));
-
-      groups.push_back(std::move(group));
     }
 
+    // Measure everything before writing anything, so the frame can be sized once.
     usize maxContentWidth = 0;
 
     for (UIGroup& group : groups) {
@@ -1391,184 +1262,175 @@ namespace draconis::ui {
       maxContentWidth = std::max(maxContentWidth, ProcessGroup(group));
     }
 
-    String greetingLine = std::format("{}{}", iconType.user, _format_f("hello", name));
-    maxContentWidth     = std::max(maxContentWidth, GetVisualWidth(greetingLine));
+    const String greetingLine  = std::format("{}{}", iconType.user, _format_f("hello"_key, name));
+    const usize  greetingWidth = GetVisualWidth(greetingLine);
+    maxContentWidth            = std::max(maxContentWidth, greetingWidth);
 
     // Calculate width needed for color circles (including minimum spacing)
-    const usize circleWidth       = GetVisualWidth(COLOR_CIRCLES[0]);
-    const usize totalCirclesWidth = COLOR_CIRCLES.size() * circleWidth;
+    const usize paletteIconWidth  = GetVisualWidth(iconType.palette);
+    const usize totalCirclesWidth = COLOR_CIRCLES.size() * COLOR_CIRCLE_WIDTH;
     const usize minSpacingPerGap  = 1;
     const usize totalMinSpacing   = (COLOR_CIRCLES.size() - 1) * minSpacingPerGap;
-    const usize colorCirclesWidth = GetVisualWidth(iconType.palette) + totalCirclesWidth + totalMinSpacing;
+    const usize colorCirclesWidth = paletteIconWidth + totalCirclesWidth + totalMinSpacing;
     maxContentWidth               = std::max(maxContentWidth, colorCirclesWidth);
 
-    String out;
-
-    usize estimatedLines = 4;
-
-    for (const UIGroup& grp : groups)
-      estimatedLines += grp.rows.empty() ? 0 : (grp.rows.size() + 1);
-
-    out.reserve(estimatedLines * (maxContentWidth + 4));
-
     const usize innerWidth = maxContentWidth + 1;
 
-    String hBorder;
-    hBorder.reserve(innerWidth * 3);
-    for (usize i = 0; i < innerWidth; ++i) hBorder += "─";
-
-    const auto createLine = [&](const String& left, const String& right = "") -> void {
-      const usize leftWidth  = GetVisualWidth(left);
-      const usize rightWidth = GetVisualWidth(right);
-      const usize padding    = (maxContentWidth >= leftWidth + rightWidth) ? maxContentWidth - (leftWidth + rightWidth) : 0;
-
-      out += "│";
-      out += left;
-      out.append(padding, ' ');
-      out += right;
-      out += " │\n";
-    };
-
-    const auto createLeftAlignedLine =
-      [&](const String& content) -> void { createLine(content, ""); };
-
-    // Top border and greeting
-    out += "╭";
-    out += hBorder;
-    out += "╮\n";
-
-    createLeftAlignedLine(Stylize(greetingLine, { .color = DEFAULT_THEME.icon }));
-
-    // Palette line
-    out += "├";
-    out += hBorder;
-    out += "┤\n";
-
-    const String paletteIcon    = Stylize(iconType.palette, { .color = DEFAULT_THEME.icon });
-    const usize  availableWidth = maxContentWidth - GetVisualWidth(paletteIcon);
-    createLeftAlignedLine(paletteIcon + CreateDistributedColorCircles(availableWidth));
-
-    bool hasRenderedContent = true;
+    // Top border, greeting, separator, palette and bottom border, plus each group's separator and rows.
+    usize boxHeight = 5;
+    usize textBytes = greetingLine.size() + iconType.palette.size() + (COLOR_CIRCLES.size() * COLOR_CIRCLES[0].size()) + (2 * STYLE_OVERHEAD_BYTES);
 
-    for (const UIGroup& group : groups)
-      RenderGroup(out, group, maxContentWidth, hBorder, hasRenderedContent);
-
-    out += "╰";
-    out += hBorder;
-    out += "╯\n";
-
-    Vec<String>       boxLines;
-    std::stringstream stream(out);
-    String            line;
-
-    while (std::getline(stream, line, '\n'))
-      boxLines.push_back(line);
+    for (UIGroup& group : groups) {
+      if (group.rows.empty())
+        continue;
 
-    if (!boxLines.empty() && boxLines.back().empty())
-      boxLines.pop_back();
+      boxHeight += 1 + WrapGroup(group, maxContentWidth);
 
-    usize  boxWidth = GetVisualWidth(boxLines[0]);
-    String emptyBox = "│" + String(boxWidth - 2, ' ') + "│";
+      for (const RowInfo& row : group.rows)
+        textBytes += row.icon.size() + row.label.size() + row.value.size() + (3 * STYLE_OVERHEAD_BYTES);
+    }
 
-    Vec<String> logoLines;
-    usize       maxLogoW      = 0;
-    usize       logoHeightOpt = 0;
-    String      inlineSequence;
-    bool        isInlineLogo = false;
+    Vec<StringView>         logoLines;
+    std::pmr::vector<usize> logoLineWidths(scratch);
+    usize                   maxLogoW      = 0;
+    usize                   maxLogoBytes  = 0;
+    usize                   logoHeightOpt = 0;
+    String                  inlineSequence;
+    bool                    isInlineLogo = false;
 
     if (!noAscii) {
-      if (const Option<LogoRender> inlineLogo = BuildInlineLogo(config.logo, boxLines.size())) {
-        logoLines      = inlineLogo->lines;
+      if (Option<LogoRender> inlineLogo = BuildInlineLogo(cache, config.logo, boxHeight)) {
         maxLogoW       = inlineLogo->width;
         logoHeightOpt  = inlineLogo->height;
         isInlineLogo   = inlineLogo->isInline;
-        inlineSequence = inlineLogo->sequence;
+        inlineSequence = std::move(inlineLogo->sequence);
       }
 
-      if (!isInlineLogo && logoLines.empty()) {
-        const Vec<StringView> asciiLines = ascii::GetAsciiArt(data.operatingSystem->id);
+      if (!isInlineLogo) {
+        logoLines = ascii::GetAsciiArt(data.operatingSystem->id);
+        logoLineWidths.reserve(logoLines.size());
 
-        for (const auto& aLine : asciiLines) {
-          logoLines.emplace_back(aLine);
-          maxLogoW = std::max(maxLogoW, GetVisualWidth(aLine));
+        for (const StringView aLine : logoLines) {
+          logoLineWidths.push_back(GetVisualWidth(aLine));
+          maxLogoW     = std::max(maxLogoW, logoLineWidths.back());
+          maxLogoBytes = std::max(maxLogoBytes, aLine.size());
         }
       }
     }
 
-    if (!isInlineLogo && logoLines.empty())
-      return out;
+    const usize
+      logoHeight  = isInlineLogo ? (logoHeightOpt ? logoHeightOpt : boxHeight) : logoLines.size(),
+      totalHeight = std::max(logoHeight, boxHeight),
+      logoPadTop  = (totalHeight > logoHeight) ? (totalHeight - logoHeight) / 2 : 0,
+      boxPadTop   = (totalHeight > boxHeight) ? (totalHeight - boxHeight) / 2 : 0;
+
+    // Every box line carries at most its borders, padding and the row text; the logo column adds its own bytes per row.
+    usize prefixBytes = 0;
+
+    if (isInlineLogo)
+      prefixBytes = 16;
+    else if (!logoLines.empty())
+      prefixBytes = maxLogoBytes + maxLogoW + 8;
+
+    out.reserve(out.size() + inlineSequence.size() + 32 + (totalHeight * (prefixBytes + 8 + (3 * innerWidth))) + textBytes);
+
+    // The image is drawn once with the cursor saved; each row then skips past it.
+    if (isInlineLogo && !inlineSequence.empty()) {
+      out += "\033[s"; // save cursor
+      if (logoPadTop > 0)
+        std::format_to(std::back_inserter(out), "\033[{}B", logoPadTop); // move down to vertically center logo
+      out += inlineSequence;
+      if (logoPadTop > 0)
+        std::format_to(std::back_inserter(out), "\033[{}A", logoPadTop); // move back up
+      out += "\033[u";                                                     // restore cursor
+    }
 
-    const usize logoHeight = isInlineLogo ? (logoHeightOpt ? logoHeightOpt : boxLines.size()) : logoLines.size();
-    String      emptyLogo(maxLogoW, ' ');
-
-    // Inline logo: emit the image to stdout once, then print the box shifted right by logo width.
-    if (isInlineLogo) {
-      const usize shift       = maxLogoW + 2 /* logo width plus gap */,
-                  totalHeight = std::max(logoHeight, boxLines.size()),
-                  logoPadTop  = (totalHeight > logoHeight) ? (totalHeight - logoHeight) / 2 : 0,
-                  boxPadTop   = (totalHeight > boxLines.size()) ? (totalHeight - boxLines.size()) / 2 : 0;
-
-      if (!inlineSequence.empty()) {
-        std::cout << "\033[s"; // save cursor
-        if (logoPadTop > 0)
-          std::cout << std::format("\033[{}B", logoPadTop); // move down to vertically center logo
-        std::cout << inlineSequence;
-        if (logoPadTop > 0)
-          std::cout << std::format("\033[{}A", logoPadTop); // move back up
-        std::cout << "\033[u" << std::flush;                // restore cursor
-      }
+    FrameWriter frame {
+      .out            = out,
+      .logoLines      = logoLines,
+      .logoLineWidths = logoLineWidths,
+      .logoWidth      = maxLogoW,
+      .logoPadTop     = logoPadTop,
+      .inlineShift    = maxLogoW + 2 /* logo width plus gap */,
+      .isInlineLogo   = isInlineLogo,
+    };
 
-      String newOut;
+    for (usize i = 0; i < boxPadTop; ++i)
+      frame.emptyBoxLine(innerWidth);
 
-      for (usize i = 0; i < totalHeight; ++i) {
-        const bool    isBoxLine = i >= boxPadTop && i < boxPadTop + boxLines.size();
-        const String& line      = isBoxLine ? boxLines[i - boxPadTop] : emptyBox;
+    // Top border and greeting
+    frame.border("╭", "╮", innerWidth);
 
-        newOut += "\r";
-        newOut += std::format("\033[{}C", shift);
-        newOut += line;
-        newOut += "\n";
-      }
+    frame.beginLine();
+    out += "│";
+    AppendStyled(out, greetingLine, DEFAULT_THEME.icon);
+    out.append(maxContentWidth - greetingWidth, ' ');
+    out += " │\n";
 
-      return newOut;
-    }
+    // Palette line
+    frame.border("├", "┤", innerWidth);
 
-    // ASCII logo: center relative to box height
-    const usize totalHeight = std::max(logoHeight, boxLines.size()),
-                logoPadTop  = (totalHeight > logoHeight) ? (totalHeight - logoHeight) / 2 : 0,
-                boxPadTop   = (totalHeight > boxLines.size()) ? (totalHeight - boxLines.size()) / 2 : 0;
+    frame.beginLine();
+    out += "│";
+    AppendStyled(out, iconType.palette, DEFAULT_THEME.icon);
+    const usize circlesWidth = AppendDistributedColorCircles(out, maxContentWidth - paletteIconWidth);
+    out.append(maxContentWidth >= paletteIconWidth + circlesWidth ? maxContentWidth - (paletteIconWidth + circlesWidth) : 0, ' ');
+    out += " │\n";
 
-    String newOut;
+    for (const UIGroup& group : groups)
+      RenderGroup(frame, group, maxContentWidth, innerWidth);
 
-    for (usize i = 0; i < totalHeight; ++i) {
-      String outputLine;
+    frame.border("╰", "╯", innerWidth);
 
-      if (i < logoPadTop || i >= logoPadTop + logoHeight) {
-        outputLine += emptyLogo;
-      } else {
-        const String& logoLine = logoLines[i - logoPadTop];
+    while (frame.row < totalHeight)
+      frame.emptyBoxLine(innerWidth);
+  }
 
-        const usize logoLineWidth = GetVisualWidth(logoLine);
-        const usize logoPadding =
-          maxLogoW > logoLineWidth
-          ? maxLogoW - logoLineWidth
-          : 0;
+  auto CreateUI(CacheManager& cache, const Config& config, const SystemInfo& data, bool noAscii) -> String {
+    String out;
+    RenderUI(cache, config, data, noAscii, out);
+    return out;
+  }
 
-        outputLine.append(logoLine.data(), logoLine.size());
-        outputLine.append(logoPadding, ' ');
-        outputLine += "\033[0m";
+  auto GetCollectionPlan(const Config& config) -> system::CollectionPlan {
+    using system::Readout;
+
+    // The default layout is built from whatever was collected, so it needs everything.
+    if (config.ui.layout.empty())
+      return {};
+
+    // The distro icon and ASCII art are picked from the operating system ID.
+    system::CollectionPlan plan { .readouts = Readout::OperatingSystem, .pluginIds = Vec<String> {} };
+
+    // Readouts each built-in row needs, by RowKind.
+    constexpr Array<Readout, ROW_KIND_COUNT> K_ROW_READOUTS = [] {
+      Array<Readout, ROW_KIND_COUNT> readouts {};
+
+      readouts[Index(RowKind::Date)]            = Readout::Date;
+      readouts[Index(RowKind::Host)]            = Readout::Host;
+      readouts[Index(RowKind::OperatingSystem)] = Readout::OperatingSystem;
+      readouts[Index(RowKind::Kernel)]          = Readout::Kernel;
+      readouts[Index(RowKind::Memory)]          = Readout::Memory;
+      readouts[Index(RowKind::Disk)]            = Readout::DiskUsage;
+      readouts[Index(RowKind::CPU)]             = Readout::CPUModel;
+      readouts[Index(RowKind::GPU)]             = Readout::GPUModel;
+      readouts[Index(RowKind::Uptime)]          = Readout::Uptime;
+      readouts[Index(RowKind::Shell)]           = Readout::Shell;
+      readouts[Index(RowKind::Packages)]        = Readout::Packages;
+      readouts[Index(RowKind::DesktopEnv)]      = Readout::DesktopEnv | Readout::WindowMgr;
+      readouts[Index(RowKind::WindowMgr)]       = Readout::WindowMgr;
+
+      return readouts;
+    }();
+
+    for (const UILayoutGroup& group : config.ui.layout)
+      for (const UILayoutRow& row : group.rows) {
+        if (row.kind == RowKind::Plugin)
+          plan.requirePlugin(row.pluginId);
+        else
+          plan.readouts |= K_ROW_READOUTS[Index(row.kind)];
       }
 
-      outputLine += "  ";
-
-      if (i < boxPadTop || i >= boxPadTop + boxLines.size())
-        outputLine += emptyBox;
-      else
-        outputLine += boxLines[i - boxPadTop];
-
-      newOut += outputLine + "\n";
-    }
-
-    return newOut;
+    return plan;
   }
 } // namespace draconis::ui
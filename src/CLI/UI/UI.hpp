@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory_resource> // std::pmr::memory_resource
+
+#include <Drac++/Utils/CacheManager.hpp>
 #include <Drac++/Utils/Logging.hpp>
 #include <Drac++/Utils/Types.hpp>
 
@@ -44,10 +47,42 @@ namespace draconis::ui {
 
   /**
    * @brief Creates the main UI element based on system data and configuration.
+   * @param cache Cache for the encoded inline-image logo.
    * @param config The application configuration.
    * @param data The collected system data.
    * @param noAscii Whether to disable ASCII art.
    * @return A string containing the formatted UI.
    */
-  auto CreateUI(const config::Config& config, const system::SystemInfo& data, bool noAscii) -> types::String;
+  auto CreateUI(utils::cache::CacheManager& cache, const config::Config& config, const system::SystemInfo& data, bool noAscii) -> types::String;
+
+  /**
+   * @brief Renders the UI into a caller-owned buffer.
+   * @details The whole frame, including any inline-image escape sequence, is
+   * appended to @p out in one pass after every row has been measured, so a
+   * buffer reused across watch-mode refreshes stops reallocating after the
+   * first frame and can be written to the terminal in a single call.
+   * @param cache Cache for the encoded inline-image logo.
+   * @param config The application configuration.
+   * @param data The collected system data.
+   * @param noAscii Whether to disable ASCII art.
+   * @param out Buffer the frame is appended to; existing contents are kept.
+   * @param scratch Resource for the per-frame row and width tables. Watch mode
+   * passes a FrameArena it resets after each frame; nothing allocated from it
+   * outlives the call.
+   */
+  auto RenderUI(
+    utils::cache::CacheManager& cache,
+    const config::Config&       config,
+    const system::SystemInfo&   data,
+    bool                        noAscii,
+    types::String&              out,
+    std::pmr::memory_resource*  scratch = std::pmr::get_default_resource()
+  ) -> types::Unit;
+
+  /**
+   * @brief Works out which readouts CreateUI() will need for the configured layout.
+   * @param config The application configuration.
+   * @return A plan covering every row in the layout, or everything for the default layout.
+   */
+  auto GetCollectionPlan(const config::Config& config) -> system::CollectionPlan;
 } // namespace draconis::ui
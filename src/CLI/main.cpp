@@ -9,11 +9,19 @@
   #include <objbase.h> // CoInitializeEx, COINIT_MULTITHREADED
 #endif
 
+#if DRAC_ENABLE_TRACING
+  #include <Drac++/Utils/Tracing.hpp>
+#endif
+
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 
+#include <Drac++/Utils/Arena.hpp>
 #include <Drac++/Utils/ArgumentParser.hpp>
+#include <Drac++/Utils/AsyncLogging.hpp>
 #include <Drac++/Utils/CacheManager.hpp>
+#include <Drac++/Utils/Env.hpp>
 #include <Drac++/Utils/Error.hpp>
 #include <Drac++/Utils/Localization.hpp>
 #include <Drac++/Utils/Logging.hpp>
@@ -38,10 +46,16 @@ struct CliOptions {
   bool   benchmarkMode = false;
   bool   listPlugins   = false;
   String pluginInfo;
+  f64    watchInterval = 0.0;
+
+  // Benchmark options
+  u32 benchmarkIterations = 20;
+  u32 benchmarkWarmup     = 3;
 
   // Cache control
   bool clearCache     = false;
   bool ignoreCacheRun = false;
+  bool warmCache      = false;
 
   // Output options
   bool   noAscii    = false;
@@ -50,6 +64,10 @@ struct CliOptions {
   String outputFormat;
   String compactFormat;
 
+  // Logging
+  bool   asyncLog = false;
+  String logFile;
+
   // Localization
   String language;
 
@@ -62,18 +80,53 @@ struct CliOptions {
   // Misc
   bool   showConfigPath = false;
   String generateCompletions;
+  String tracePath;
 };
 
+#if DRAC_ENABLE_TRACING
+namespace {
+  // Records spans for the lifetime of main() and writes them out on every exit
+  // path, including the early returns for --doctor, --benchmark, etc.
+  class TraceSession {
+   public:
+    explicit TraceSession(String path) : m_path(std::move(path)) {
+      draconis::utils::tracing::Start();
+    }
+
+    ~TraceSession() {
+      draconis::utils::tracing::Stop();
+
+      if (Result<> result = draconis::utils::tracing::WriteChromeTrace(m_path); !result)
+        error_at(result.error());
+      else
+        debug_log("Wrote trace to '{}'", m_path);
+    }
+
+    TraceSession(const TraceSession&)                    = delete;
+    TraceSession(TraceSession&&)                         = delete;
+    auto operator=(const TraceSession&) -> TraceSession& = delete;
+    auto operator=(TraceSession&&) -> TraceSession&      = delete;
+
+   private:
+    String m_path;
+  };
+} // namespace
+#endif
+
 auto main(const i32 argc, CStr* argv[]) -> i32 try {
 #ifdef _WIN32
   CoInitializeEx(nullptr, COINIT_MULTITHREADED);
 #endif
 
+  // Read the environment before any readout or worker thread does.
+  static_cast<void>(draconis::utils::env::GetEnvSnapshot());
+
   CliOptions opts;
 
   {
     using draconis::utils::argparse::Argument;
     using draconis::utils::argparse::ArgumentParser;
+    using draconis::utils::argparse::EnumTraits;
 
     // Build enhanced version string with build date and git hash
 #if defined(DRAC_BUILD_DATE) && defined(DRAC_GIT_HASH)
@@ -102,6 +155,18 @@ auto main(const i32 argc, CStr* argv[]) -> i32 try {
       .help("Set the minimum log level.")
       .defaultValue(LogLevel::Info);
 
+    parser
+      .addArguments("--async-log")
+      .help("Write log messages from a background thread instead of blocking the caller.")
+      .flag()
+      .bindTo(opts.asyncLog);
+
+    parser
+      .addArguments("--log-file")
+      .help("Append log messages to this file (without colors) instead of the terminal. Implies --async-log.")
+      .defaultValue(String(""))
+      .bindTo(opts.logFile);
+
     parser
       .addArguments("--clear-cache")
       .help("Clears the cache. This will remove all cached data, including in-memory and on-disk copies.")
@@ -120,6 +185,12 @@ auto main(const i32 argc, CStr* argv[]) -> i32 try {
       .flag()
       .bindTo(opts.ignoreCacheRun);
 
+    parser
+      .addArguments("--warm-cache")
+      .help("Refetch every readout and plugin into the cache, then exit without output. For package manager hooks and timers.")
+      .flag()
+      .bindTo(opts.warmCache);
+
     parser
       .addArguments("--no-ascii")
       .help("Disable ASCII art display.")
@@ -140,7 +211,7 @@ auto main(const i32 argc, CStr* argv[]) -> i32 try {
 
     parser
       .addArguments("--format")
-      .help("Output system information in the specified format (e.g., 'markdown', 'json', 'yaml').")
+      .help("Output system information in the specified format: 'beve' (binary JSON) or one provided by a plugin (e.g., 'markdown', 'yaml').")
       .defaultValue(String(""))
       .bindTo(opts.outputFormat);
 
@@ -149,7 +220,7 @@ auto main(const i32 argc, CStr* argv[]) -> i32 try {
       .help(
         "Output a single line using a template string (e.g., '{host} | {cpu} | {ram}'). "
         "Available placeholders: {date}, {host}, {os}, {kernel}, {cpu}, {gpu}, {ram}, {disk}, "
-        "{uptime}, {shell}, {de}, {wm}, {packages}, {weather}, {playing}."
+        "{uptime}, {shell}, {de}, {wm}, {packages}, {battery} and plugin fields as {plugin_<id>_<field>}."
       )
       .defaultValue(String(""))
       .bindTo(opts.compactFormat);
@@ -194,10 +265,28 @@ auto main(const i32 argc, CStr* argv[]) -> i32 try {
 
     parser
       .addArguments("--benchmark")
-      .help("Print timing information for each data source.")
+      .help("Benchmark each data source (cold and warm cache). Combine with --json for machine-readable output.")
       .flag()
       .bindTo(opts.benchmarkMode);
 
+    parser
+      .addArguments("--benchmark-iterations")
+      .help("Number of timed iterations per benchmark phase.")
+      .defaultValue(i32(20))
+      .bindTo(opts.benchmarkIterations, [](const Argument& arg) -> u32 { return static_cast<u32>(std::max(1, arg.get<i32>())); });
+
+    parser
+      .addArguments("--benchmark-warmup")
+      .help("Number of untimed warmup iterations before each benchmark phase.")
+      .defaultValue(i32(3))
+      .bindTo(opts.benchmarkWarmup, [](const Argument& arg) -> u32 { return static_cast<u32>(std::max(0, arg.get<i32>())); });
+
+    parser
+      .addArguments("-w", "--watch")
+      .help("Keep running and refresh volatile readouts (memory, uptime, battery, disk, plugins) every N seconds.")
+      .defaultValue(f64(0.0))
+      .bindTo(opts.watchInterval);
+
     parser
       .addArguments("--show-config-path")
       .help("Display the active configuration file location.")
@@ -210,26 +299,69 @@ auto main(const i32 argc, CStr* argv[]) -> i32 try {
       .defaultValue(String(""))
       .bindTo(opts.generateCompletions);
 
+#if DRAC_ENABLE_TRACING
+    parser
+      .addArguments("--trace")
+      .help("Write a Chrome trace-event JSON file (open in Perfetto or chrome://tracing).")
+      .defaultValue(String(""))
+      .bindTo(opts.tracePath);
+#endif
+
     if (Result<> result = parser.parseInto({ argv, static_cast<usize>(argc) }); !result) {
       error_at(result.error());
       return EXIT_FAILURE;
     }
 
+    // Zero would leave watch mode off and a negative interval would spin the refresh loop.
+    if (parser.isUsed("--watch") && !(opts.watchInterval > 0.0 && std::isfinite(opts.watchInterval))) {
+      using draconis::utils::error::DracError, draconis::utils::error::DracErrorCode;
+
+      error_at(DracError(DracErrorCode::InvalidArgument, std::format("Invalid value '{}' for argument '--watch'. Expected a positive number of seconds", opts.watchInterval)));
+      return EXIT_FAILURE;
+    }
+
     SetRuntimeLogLevel(
       parser.get<bool>("-V") || parser.get<bool>("--verbose")
         ? LogLevel::Debug
         : parser.getEnum<LogLevel>("--log-level")
     );
+
+    // Only worth mentioning when the level was asked for; the default Info is below a release build's floor.
+    const bool levelRequested = parser.get<bool>("-V") || parser.get<bool>("--verbose") || parser.isUsed("--log-level");
+
+    if (levelRequested && GetRuntimeLogLevel() < MIN_LOG_LEVEL)
+      warn_log("This build only includes log messages at level {} and above", EnumTraits<LogLevel>::enumToString(MIN_LOG_LEVEL));
+
+    if (opts.asyncLog || !opts.logFile.empty()) {
+      AsyncLogOptions logOptions;
+
+      if (!opts.logFile.empty())
+        logOptions.file = std::filesystem::path(opts.logFile);
+
+      if (Result<> started = StartAsyncLogging(logOptions); !started)
+        error_at(started.error());
+    }
   }
 
+#if DRAC_ENABLE_TRACING
+  Option<TraceSession> traceSession;
+
+  if (!opts.tracePath.empty())
+    traceSession.emplace(opts.tracePath);
+#endif
+
   using draconis::utils::cache::CacheManager, draconis::utils::cache::CachePolicy;
+  using draconis::utils::memory::FrameArena;
 
   CacheManager cache;
 
   if (opts.ignoreCacheRun)
     CacheManager::ignoreCache = true;
 
-  cache.setGlobalPolicy(CachePolicy::tempDirectory());
+  if (opts.warmCache)
+    CacheManager::revalidate = true;
+
+  cache.setGlobalPolicy(CachePolicy::pack());
 
   if (opts.clearCache) {
     const u8 removedCount = cache.invalidateAll(true);
@@ -259,7 +391,7 @@ auto main(const i32 argc, CStr* argv[]) -> i32 try {
   }
 
   {
-    Config config = Config::getInstance();
+    Config config = Config::getInstance(cache);
 
     // Initialize translation manager with language from command line or config
     if (opts.language.empty() && config.general.language)
@@ -310,33 +442,115 @@ auto main(const i32 argc, CStr* argv[]) -> i32 try {
       return HandlePluginInfoCommand(pluginManager, opts.pluginInfo);
 #endif
 
+    // Collect everything fresh and let the cache keep it; the next interactive run only reads.
+    if (opts.warmCache) {
+#if DRAC_ENABLE_PLUGINS
+      // Nobody is waiting on the output, so slow plugins get as long as they need.
+      config.plugins.collectTimeoutMs = 0;
+      config.plugins.collectTimeoutsMs.clear();
+#endif
+
+      static_cast<void>(SystemInfo(cache, config));
+
+      return EXIT_SUCCESS;
+    }
+
     // Handle benchmark mode (runs timing for each data source)
     if (opts.benchmarkMode) {
-      Vec<BenchmarkResult> results = RunBenchmark(cache, config);
-      PrintBenchmarkReport(results);
+      const BenchmarkOptions benchmarkOptions { .iterations = opts.benchmarkIterations, .warmup = opts.benchmarkWarmup };
+
+      Vec<BenchmarkResult> results = RunBenchmark(cache, config, benchmarkOptions);
+
+      FlushLogs();
+
+      if (opts.jsonOutput)
+        PrintBenchmarkJson(results, benchmarkOptions, opts.prettyJson);
+      else
+        PrintBenchmarkReport(results, benchmarkOptions);
+
       return EXIT_SUCCESS;
     }
 
-    SystemInfo data(cache, config);
+    const bool fullUI = opts.outputFormat.empty() && opts.compactFormat.empty() && !opts.jsonOutput;
+
+    // Only collect what the chosen output will show. The doctor report, JSON,
+    // BEVE and plugin formatters see every field, so they keep the full plan.
+    CollectionPlan plan;
+
+    // Parsed once; watch mode re-renders it on every refresh.
+    const CompactTemplate compact(opts.compactFormat);
+
+    if (!opts.doctorMode) {
+      if (fullUI)
+        plan = GetCollectionPlan(config);
+      else if (!opts.compactFormat.empty() && opts.outputFormat.empty())
+        plan = compact.getCollectionPlan();
+    }
+
+    SystemInfo data(cache, config, plan);
 
     if (opts.doctorMode) {
+      FlushLogs();
       PrintDoctorReport(data);
 
       return EXIT_SUCCESS;
     }
 
-    if (!opts.outputFormat.empty()) {
+    // Reused across watch-mode refreshes so each frame is rendered without reallocating.
+    String frame;
+
+    // The renderer's per-frame tables; after the first few refreshes they fit the arena's block.
+    FrameArena arena;
+
+    auto render = [&](const SystemInfo& info) -> Unit {
+      // With --async-log, warnings from collection may still be queued; write
+      // them out now so none land in the middle of the frame or the JSON.
+      FlushLogs();
+
+      if (opts.outputFormat == "beve")
+        PrintBeveOutput(info, frame);
+      else if (!opts.outputFormat.empty()) {
 #if DRAC_ENABLE_PLUGINS
-      FormatOutputViaPlugin(opts.outputFormat, data);
+        FormatOutputViaPlugin(opts.outputFormat, info);
 #else
-      Print("Plugin output formats require plugin support to be enabled.\n");
+        Print("Plugin output formats require plugin support to be enabled.\n");
 #endif
-    } else if (!opts.compactFormat.empty())
-      PrintCompactOutput(opts.compactFormat, data);
-    else if (opts.jsonOutput)
-      PrintJsonOutput(data, opts.prettyJson);
-    else
-      Print(CreateUI(config, data, opts.noAscii));
+      } else if (!opts.compactFormat.empty())
+        PrintCompactOutput(compact, info, frame);
+      else if (opts.jsonOutput)
+        PrintJsonOutput(info, opts.prettyJson, frame);
+      else {
+        RenderUI(cache, config, info, opts.noAscii, frame, arena.resource());
+        Print(frame);
+        arena.reset();
+      }
+
+      frame.clear();
+    };
+
+    if (opts.watchInterval > 0.0) {
+      // Whatever was served stale refreshes in the background for the rest of the watch.
+      cache.refreshInBackground();
+
+      return RunWatchMode(cache, data, opts.watchInterval, [&](const SystemInfo& info) -> Unit {
+        // Redraw the full UI in place; line-oriented outputs emit one record per refresh.
+        // The clear goes into the frame buffer so each refresh reaches the terminal in one write.
+        if (fullUI)
+          frame = "\033[H\033[2J";
+
+        render(info);
+
+        if (opts.jsonOutput)
+          Println();
+      });
+    }
+
+    render(data);
+
+    // The output is already out; refresh what it showed stale without keeping the prompt waiting.
+    if (cache.staleHits() > 0)
+      if (Result<> spawned = SpawnCacheWarmer(argv[0]); !spawned)
+        debug_at(spawned.error());
   }
 
   return EXIT_SUCCESS;
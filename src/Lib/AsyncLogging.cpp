@@ -0,0 +1,334 @@
+#include <Drac++/Utils/AsyncLogging.hpp>
+
+#include <atomic>    // std::atomic
+#include <cstdlib>   // std::atexit
+#include <exception> // std::set_terminate, std::terminate_handler
+#include <fstream>   // std::ofstream
+#include <mutex>     // std::unique_lock, std::try_to_lock
+#include <thread>    // std::thread, std::this_thread::yield
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Logging.hpp>
+
+namespace draconis::utils::logging {
+  using namespace types;
+  using enum error::DracErrorCode;
+
+  namespace {
+    // Must be a power of two.
+    constexpr usize QUEUE_CAPACITY = 4096;
+
+    // Records are written once this many bytes have been batched up.
+    constexpr usize BATCH_BYTES = 64 * 1024;
+
+    /**
+     * @brief Bounded multi-producer queue with per-slot sequence numbers.
+     *
+     * @details Producers claim a slot by advancing the enqueue position with a
+     * CAS and publish it by bumping the slot's sequence; nothing ever takes a
+     * lock. There is exactly one consumer (the writer thread, or the thread
+     * stopping the sink once the writer has exited), so popping needs no CAS.
+     */
+    class RecordQueue {
+     public:
+      RecordQueue() {
+        for (usize i = 0; i < QUEUE_CAPACITY; ++i)
+          m_slots[i].sequence.store(i, std::memory_order_relaxed);
+      }
+
+      auto tryPush(const LogLevel level, String& record) -> bool {
+        usize pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+        while (true) {
+          Slot&       slot     = m_slots[pos & (QUEUE_CAPACITY - 1)];
+          const usize sequence = slot.sequence.load(std::memory_order_acquire);
+
+          if (sequence == pos) {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+              slot.level  = level;
+              slot.record = std::move(record);
+              slot.sequence.store(pos + 1, std::memory_order_release);
+              return true;
+            }
+          } else if (sequence < pos)
+            return false; // Full: the slot still holds a record from the previous lap.
+          else
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+      }
+
+      auto tryPop(LogLevel& level, String& record) -> bool {
+        Slot& slot = m_slots[m_dequeuePos & (QUEUE_CAPACITY - 1)];
+
+        if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1)
+          return false;
+
+        level  = slot.level;
+        record = std::move(slot.record);
+        slot.sequence.store(m_dequeuePos + QUEUE_CAPACITY, std::memory_order_release);
+        m_dequeuePos++;
+
+        return true;
+      }
+
+     private:
+      struct Slot {
+        std::atomic<usize> sequence;
+        LogLevel           level = LogLevel::Info;
+        String             record;
+      };
+
+      Array<Slot, QUEUE_CAPACITY> m_slots;
+
+      alignas(64) std::atomic<usize> m_enqueuePos = 0;
+      alignas(64) usize m_dequeuePos              = 0;
+    };
+
+    struct Sink {
+      RecordQueue queue;
+
+      std::atomic<bool> running   = false;
+      std::atomic<bool> stopping  = false;
+      std::atomic<u32>  producers = 0; // Threads currently inside Enqueue()
+      std::atomic<u64>  wake      = 0; // Bumped to wake the writer
+      std::atomic<u64>  pushed    = 0;
+      std::atomic<u64>  written   = 0;
+
+      Option<std::ofstream> file;
+      std::thread           worker;
+      Mutex                 control; // Serialises start/stop
+
+      std::atomic<std::thread::id> controlOwner; // Thread holding `control`, for OnTerminate
+    };
+
+    auto GetSink() -> Sink& {
+      static Sink SinkInstance;
+      return SinkInstance;
+    }
+
+    // Holds `control` and records the owner so OnTerminate never relocks it on the same thread.
+    class ControlLock {
+     public:
+      explicit ControlLock(Sink& sink)
+        : m_sink(sink), m_lock(sink.control) {
+        m_sink.controlOwner.store(std::this_thread::get_id());
+      }
+
+      ControlLock(const ControlLock&)                    = delete;
+      ControlLock(ControlLock&&)                         = delete;
+      auto operator=(const ControlLock&) -> ControlLock& = delete;
+      auto operator=(ControlLock&&) -> ControlLock&      = delete;
+
+      ~ControlLock() {
+        m_sink.controlOwner.store(std::thread::id {});
+      }
+
+     private:
+      Sink&     m_sink;
+      LockGuard m_lock;
+    };
+
+    // Removes ANSI escapes using the same terminators the UI's width measurement recognises.
+    auto AppendWithoutEscapes(String& out, const StringView text) -> Unit {
+      bool inEscape = false;
+
+      for (const char chr : text) {
+        if (inEscape) {
+          inEscape = !(chr == 'm' || chr == '\\' || chr == '\a');
+          continue;
+        }
+
+        if (chr == '\033')
+          inEscape = true;
+        else
+          out += chr;
+      }
+    }
+
+    // Writes everything currently queued, preserving order across stdout and stderr.
+    auto Drain(Sink& sink) -> Unit {
+      String   batch;
+      LogLevel level       = LogLevel::Info;
+      bool     batchStderr = false;
+      u64      batched     = 0;
+      String   record;
+
+      const auto flush = [&] {
+        if (batch.empty())
+          return;
+
+        if (sink.file) {
+          sink.file->write(batch.data(), static_cast<std::streamsize>(batch.size()));
+          sink.file->flush();
+        } else {
+          const LockGuard lock(GetLogMutex());
+          WriteToConsole(batch, batchStderr);
+        }
+
+        batch.clear();
+
+        sink.written.fetch_add(batched, std::memory_order_release);
+        sink.written.notify_all();
+        batched = 0;
+      };
+
+      while (sink.queue.tryPop(level, record)) {
+        const bool toStderr = !sink.file && ShouldUseStderr(level);
+
+        if (toStderr != batchStderr || batch.size() >= BATCH_BYTES)
+          flush();
+
+        batchStderr = toStderr;
+
+        if (sink.file)
+          AppendWithoutEscapes(batch, record);
+        else
+          batch += record;
+
+        batched++;
+      }
+
+      flush();
+    }
+
+    auto RunWriter(Sink& sink) -> Unit {
+      while (true) {
+        const u64 ticket = sink.wake.load(std::memory_order_acquire);
+
+        Drain(sink);
+
+        if (sink.stopping.load(std::memory_order_acquire))
+          return;
+
+        sink.wake.wait(ticket, std::memory_order_acquire);
+      }
+    }
+
+    auto Enqueue(const LogLevel level, String& record) -> bool {
+      Sink& sink = GetSink();
+
+      // Registering before re-checking `running` (both seq_cst) means StopAsyncLogging()
+      // either sees this producer and waits for it, or this producer sees the sink stopped.
+      sink.producers.fetch_add(1);
+
+      if (!sink.running.load()) {
+        sink.producers.fetch_sub(1);
+        return false;
+      }
+
+      // Backpressure rather than dropping: wait for the writer to free a slot.
+      while (!sink.queue.tryPush(level, record))
+        std::this_thread::yield();
+
+      sink.pushed.fetch_add(1, std::memory_order_release);
+      sink.producers.fetch_sub(1);
+
+      sink.wake.fetch_add(1, std::memory_order_release);
+      sink.wake.notify_one();
+
+      return true;
+    }
+
+    // Expects `sink.control` to be held by the caller.
+    auto StopLocked(Sink& sink) -> Unit {
+      if (!sink.running.load())
+        return;
+
+      GetLogSinkStorage().store(nullptr, std::memory_order_release);
+      sink.running.store(false);
+
+      // Anyone who got in before the sink stopped finishes pushing first.
+      while (sink.producers.load() != 0)
+        std::this_thread::yield();
+
+      sink.stopping.store(true, std::memory_order_release);
+      sink.wake.fetch_add(1, std::memory_order_release);
+      sink.wake.notify_one();
+
+      if (sink.worker.joinable())
+        sink.worker.join();
+
+      // The writer drains once more after seeing `stopping`, but pushes can race its last pass.
+      Drain(sink);
+
+      sink.file.reset();
+    }
+
+    std::terminate_handler PreviousTerminateHandler = nullptr;
+
+    auto OnTerminate() -> void {
+      Sink& sink = GetSink();
+
+      // A crash on the writer thread can't wait for itself to drain. If Start/Stop hold
+      // `control`, blocking on it could hang forever, so the flush is skipped instead.
+      const std::thread::id self = std::this_thread::get_id();
+
+      if (sink.worker.get_id() != self && sink.controlOwner.load() != self) {
+        const std::unique_lock lock(sink.control, std::try_to_lock);
+
+        if (lock.owns_lock())
+          StopLocked(sink);
+      }
+
+      if (PreviousTerminateHandler)
+        PreviousTerminateHandler();
+
+      std::abort();
+    }
+  } // namespace
+
+  auto StartAsyncLogging(const AsyncLogOptions& options) -> Result<> {
+    Sink& sink = GetSink();
+
+    const ControlLock lock(sink);
+
+    if (sink.running.load())
+      return {};
+
+    sink.file.reset();
+
+    if (options.file) {
+      sink.file.emplace(*options.file, std::ios::binary | std::ios::app);
+
+      if (!*sink.file) {
+        sink.file.reset();
+        ERR_FMT(IoError, "Failed to open log file '{}' for writing", options.file->string());
+      }
+    }
+
+    static const bool HooksInstalled = [] {
+      std::atexit([] { StopAsyncLogging(); });
+      PreviousTerminateHandler = std::set_terminate(OnTerminate);
+      return true;
+    }();
+    static_cast<void>(HooksInstalled);
+
+    sink.stopping.store(false);
+    sink.worker = std::thread(RunWriter, std::ref(sink));
+    sink.running.store(true);
+
+    GetLogSinkStorage().store(Enqueue, std::memory_order_release);
+
+    return {};
+  }
+
+  auto FlushLogs() -> Unit {
+    Sink& sink = GetSink();
+
+    if (!sink.running.load())
+      return;
+
+    const u64 target = sink.pushed.load(std::memory_order_acquire);
+
+    for (u64 written = sink.written.load(std::memory_order_acquire); written < target; written = sink.written.load(std::memory_order_acquire))
+      sink.written.wait(written, std::memory_order_acquire);
+  }
+
+  auto StopAsyncLogging() -> Unit {
+    Sink& sink = GetSink();
+
+    const ControlLock lock(sink);
+
+    StopLocked(sink);
+  }
+} // namespace draconis::utils::logging
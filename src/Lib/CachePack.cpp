@@ -0,0 +1,418 @@
+#include <cerrno>     // errno, EINTR
+#include <cstring>    // std::memcpy
+#include <filesystem> // std::filesystem
+#include <format>     // std::format
+#include <fstream>    // std::ofstream
+#include <random>     // std::random_device
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <fcntl.h>    // open, O_RDONLY, O_CLOEXEC
+  #include <sys/file.h> // flock
+  #include <sys/mman.h> // mmap, munmap
+  #include <sys/stat.h> // fstat, lstat
+  #include <unistd.h>   // close, geteuid
+#endif
+
+#include <Drac++/Utils/CachePack.hpp>
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Logging.hpp>
+
+namespace draconis::utils::cache {
+  namespace {
+    namespace fs = std::filesystem;
+
+    using namespace types;
+    using enum error::DracErrorCode;
+
+    constexpr StringView PACK_MAGIC   = "DRACPACK";
+    constexpr u32        PACK_VERSION = 1;
+    constexpr usize      HEADER_SIZE  = PACK_MAGIC.size() + (2 * sizeof(u32));
+
+    struct Mapping {
+      RawPointer data = nullptr;
+      usize      size = 0;
+    };
+
+    auto MapFile(const fs::path& path) -> Mapping {
+#ifdef _WIN32
+      HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+      if (file == INVALID_HANDLE_VALUE)
+        return {};
+
+      LARGE_INTEGER fileSize {};
+
+      if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+        CloseHandle(file);
+        return {};
+      }
+
+      HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      CloseHandle(file);
+
+      if (mapping == nullptr)
+        return {};
+
+      RawPointer view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      CloseHandle(mapping);
+
+      if (view == nullptr)
+        return {};
+
+      return { .data = view, .size = static_cast<usize>(fileSize.QuadPart) };
+#else
+      const i32 fileDesc = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+      if (fileDesc < 0)
+        return {};
+
+      struct stat statBuf {};
+
+      if (fstat(fileDesc, &statBuf) != 0 || statBuf.st_size <= 0) {
+        close(fileDesc);
+        return {};
+      }
+
+      RawPointer view = mmap(nullptr, static_cast<usize>(statBuf.st_size), PROT_READ, MAP_PRIVATE, fileDesc, 0);
+      close(fileDesc);
+
+      if (view == MAP_FAILED)
+        return {};
+
+      return { .data = view, .size = static_cast<usize>(statBuf.st_size) };
+#endif
+    }
+
+    auto UnmapFile(const Mapping& mapping) -> Unit {
+      if (mapping.data == nullptr)
+        return;
+
+#ifdef _WIN32
+      UnmapViewOfFile(mapping.data);
+#else
+      munmap(mapping.data, mapping.size);
+#endif
+    }
+
+    // Holds an exclusive advisory lock on a sidecar file for as long as it lives.
+    // Serialises flushes from every process sharing the pack; the pack itself
+    // can't carry the lock, since each flush replaces it by rename.
+    class FlushLock {
+     public:
+      explicit FlushLock(const fs::path& lockPath) {
+#ifdef _WIN32
+        m_file = CreateFileW(lockPath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (m_file == INVALID_HANDLE_VALUE)
+          return;
+
+        OVERLAPPED overlapped {};
+
+        if (!LockFileEx(m_file, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+          CloseHandle(m_file);
+          m_file = INVALID_HANDLE_VALUE;
+        }
+#else
+        m_fileDesc = open(lockPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+
+        if (m_fileDesc < 0)
+          return;
+
+        while (flock(m_fileDesc, LOCK_EX) != 0)
+          if (errno != EINTR) {
+            close(m_fileDesc);
+            m_fileDesc = -1;
+            return;
+          }
+#endif
+      }
+
+      FlushLock(const FlushLock&)                    = delete;
+      FlushLock(FlushLock&&)                         = delete;
+      auto operator=(const FlushLock&) -> FlushLock& = delete;
+      auto operator=(FlushLock&&) -> FlushLock&      = delete;
+
+      ~FlushLock() {
+#ifdef _WIN32
+        if (m_file != INVALID_HANDLE_VALUE) {
+          OVERLAPPED overlapped {};
+          UnlockFileEx(m_file, 0, MAXDWORD, MAXDWORD, &overlapped);
+          CloseHandle(m_file);
+        }
+#else
+        // Closing the descriptor releases the lock.
+        if (m_fileDesc >= 0)
+          close(m_fileDesc);
+#endif
+      }
+
+      [[nodiscard]] auto held() const -> bool {
+#ifdef _WIN32
+        return m_file != INVALID_HANDLE_VALUE;
+#else
+        return m_fileDesc >= 0;
+#endif
+      }
+
+     private:
+#ifdef _WIN32
+      HANDLE m_file = INVALID_HANDLE_VALUE;
+#else
+      i32 m_fileDesc = -1;
+#endif
+    };
+
+    auto ReadU32(const StringView image, const usize offset) -> u32 {
+      u32 value = 0;
+      std::memcpy(&value, image.data() + offset, sizeof(value));
+      return value;
+    }
+
+    auto AppendU32(String& out, const u32 value) -> Unit {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    // Builds a key -> value index pointing into the image. Returns None if the image is malformed.
+    auto ParsePack(const StringView image) -> Option<UnorderedMap<String, StringView>> {
+      if (image.size() < HEADER_SIZE || !image.starts_with(PACK_MAGIC))
+        return None;
+
+      if (ReadU32(image, PACK_MAGIC.size()) != PACK_VERSION)
+        return None;
+
+      const u32 entryCount = ReadU32(image, PACK_MAGIC.size() + sizeof(u32));
+
+      UnorderedMap<String, StringView> index;
+      index.reserve(entryCount);
+
+      usize offset = HEADER_SIZE;
+
+      for (u32 i = 0; i < entryCount; ++i) {
+        if (image.size() - offset < 2 * sizeof(u32))
+          return None;
+
+        const usize keyLength   = ReadU32(image, offset);
+        const usize valueLength = ReadU32(image, offset + sizeof(u32));
+        offset += 2 * sizeof(u32);
+
+        if (image.size() - offset < keyLength + valueLength)
+          return None;
+
+        index.insert_or_assign(String(image.substr(offset, keyLength)), image.substr(offset + keyLength, valueLength));
+        offset += keyLength + valueLength;
+      }
+
+      return index;
+    }
+  } // namespace
+
+  CachePack::CachePack(fs::path path, const bool privateDirectory) : m_path(std::move(path)), m_privateDirectory(privateDirectory) {}
+
+  CachePack::~CachePack() {
+    if (Result<> result = flush(); !result)
+      debug_at(result.error());
+
+    unmap();
+  }
+
+  auto CachePack::get(const StringView key) -> Option<String> {
+    LockGuard lock(m_mutex);
+
+    if (const auto iter = m_pending.find(String(key)); iter != m_pending.end())
+      return iter->second;
+
+    ensureLoaded();
+
+    if (const auto iter = m_index.find(String(key)); iter != m_index.end())
+      return String(iter->second);
+
+    return None;
+  }
+
+  auto CachePack::put(const StringView key, String value) -> Unit {
+    LockGuard lock(m_mutex);
+    m_pending.insert_or_assign(String(key), std::move(value));
+  }
+
+  auto CachePack::erase(const StringView key) -> Unit {
+    LockGuard lock(m_mutex);
+
+    if (const auto iter = m_pending.find(String(key)); iter != m_pending.end()) {
+      // Already erased; no point rewriting the pack for it again.
+      if (!iter->second)
+        return;
+
+      iter->second = None;
+      return;
+    }
+
+    ensureLoaded();
+
+    // Not in the pack either, so there is nothing to remove.
+    if (!m_index.contains(String(key)))
+      return;
+
+    m_pending.insert_or_assign(String(key), None);
+  }
+
+  auto CachePack::clear() -> bool {
+    LockGuard lock(m_mutex);
+
+    unmap();
+    m_pending.clear();
+    m_loaded = true;
+
+    std::error_code errc;
+    return fs::remove(m_path, errc);
+  }
+
+  auto CachePack::flush() -> Result<> {
+    LockGuard lock(m_mutex);
+
+    if (m_pending.empty())
+      return {};
+
+    std::error_code errc;
+
+    if (m_privateDirectory) {
+      if (Result<> dir = CreatePrivateDirectory(m_path.parent_path()); !dir)
+        return Err(dir.error());
+    } else {
+      fs::create_directories(m_path.parent_path(), errc);
+
+      if (errc)
+        ERR_FMT(IoError, "Failed to create cache pack directory '{}': {}", m_path.parent_path().string(), errc.message());
+    }
+
+    // Merge against what is on disk *now*, not what was mapped at startup.
+    // The lock covers the read, the merge and the rename, so a writer in
+    // another process can't commit in between and have its entries dropped.
+    const FlushLock flushLock(fs::path(m_path).concat(".lock"));
+
+    if (!flushLock.held())
+      debug_log("Flushing cache pack '{}' without a lock", m_path.string());
+
+    const Mapping current = MapFile(m_path);
+
+    Map<String, String> merged;
+
+    if (current.data != nullptr)
+      if (Option<UnorderedMap<String, StringView>> onDisk = ParsePack(StringView(static_cast<PCStr>(current.data), current.size)))
+        for (const auto& [key, value] : *onDisk)
+          merged.emplace(key, String(value));
+
+    UnmapFile(current);
+
+    // Copied rather than moved: the pending writes stay queued until the rename
+    // commits them, so a failed flush can be retried.
+    for (const auto& [key, value] : m_pending)
+      if (value)
+        merged.insert_or_assign(key, *value);
+      else
+        merged.erase(key);
+
+    String image;
+    image.append(PACK_MAGIC);
+    AppendU32(image, PACK_VERSION);
+    AppendU32(image, static_cast<u32>(merged.size()));
+
+    for (const auto& [key, value] : merged) {
+      AppendU32(image, static_cast<u32>(key.size()));
+      AppendU32(image, static_cast<u32>(value.size()));
+      image.append(key);
+      image.append(value);
+    }
+
+    const fs::path tempPath = fs::path(std::format("{}.{:08x}.tmp", m_path.string(), std::random_device {}()));
+
+    {
+      std::ofstream ofs(tempPath, std::ios::binary | std::ios::trunc);
+
+      if (!ofs)
+        ERR_FMT(IoError, "Failed to open '{}' for writing", tempPath.string());
+
+      ofs.write(image.data(), static_cast<std::streamsize>(image.size()));
+
+      if (!ofs) {
+        ofs.close();
+        fs::remove(tempPath, errc);
+        ERR_FMT(IoError, "Failed to write cache pack '{}'", tempPath.string());
+      }
+    }
+
+    // Windows refuses to replace a file that is still mapped.
+    unmap();
+
+    fs::rename(tempPath, m_path, errc);
+
+    if (errc) {
+      fs::remove(tempPath, errc);
+      ERR_FMT(IoError, "Failed to commit cache pack '{}': {}", m_path.string(), errc.message());
+    }
+
+    m_pending.clear();
+
+    return {};
+  }
+
+  auto CachePack::path() const -> const fs::path& {
+    return m_path;
+  }
+
+  auto CachePack::ensureLoaded() -> Unit {
+    if (m_loaded)
+      return;
+
+    m_loaded = true;
+
+    const Mapping mapping = MapFile(m_path);
+
+    if (mapping.data == nullptr)
+      return;
+
+    m_mapping    = mapping.data;
+    m_mappedSize = mapping.size;
+
+    if (Option<UnorderedMap<String, StringView>> index = ParsePack(StringView(static_cast<PCStr>(m_mapping), m_mappedSize))) {
+      m_index = std::move(*index);
+    } else {
+      debug_log("Ignoring malformed cache pack '{}'", m_path.string());
+      unmap();
+    }
+  }
+
+  auto CachePack::unmap() -> Unit {
+    m_index.clear();
+    UnmapFile({ .data = m_mapping, .size = m_mappedSize });
+
+    m_mapping    = nullptr;
+    m_mappedSize = 0;
+    m_loaded     = false;
+  }
+
+  auto CreatePrivateDirectory(const fs::path& dir) -> Result<> {
+    std::error_code errc;
+    fs::create_directories(dir, errc);
+
+    if (errc)
+      ERR_FMT(IoError, "Failed to create cache directory '{}': {}", dir.string(), errc.message());
+
+#ifndef _WIN32
+    struct stat statBuf {};
+
+    if (lstat(dir.c_str(), &statBuf) != 0)
+      ERR_FMT(IoError, "Failed to stat cache directory '{}': {}", dir.string(), std::strerror(errno));
+
+    if (!S_ISDIR(statBuf.st_mode) || statBuf.st_uid != geteuid())
+      ERR_FMT(PermissionDenied, "Cache directory '{}' is not a directory owned by the current user", dir.string());
+
+    if ((statBuf.st_mode & 0777) != 0700 && chmod(dir.c_str(), 0700) != 0)
+      ERR_FMT(PermissionDenied, "Failed to restrict cache directory '{}' to its owner: {}", dir.string(), std::strerror(errno));
+#endif
+
+    return {};
+  }
+} // namespace draconis::utils::cache
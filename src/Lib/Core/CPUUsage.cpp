@@ -0,0 +1,87 @@
+#include <Drac++/Core/CPUUsage.hpp>
+
+#include <algorithm> // std::{max, min}
+#include <utility>   // std::{move, swap}
+
+#include <Drac++/Core/System.hpp>
+
+namespace draconis::core::system {
+  using namespace utils::types;
+  using enum utils::error::DracErrorCode;
+
+  namespace {
+    auto DefaultReader([[maybe_unused]] Vec<CPUTimes>& perCpu) -> Result<CPUTimes> {
+#ifdef __linux__
+      return GetCPUTimes(perCpu);
+#else
+      ERR(NotSupported, "Reading CPU times is not supported on this platform");
+#endif
+    }
+
+    // Busy share of the ticks between two reads. Counters that went backwards
+    // (a CPU brought back online starts from zero) read as an idle period.
+    auto BusyPercent(const CPUTimes& before, const CPUTimes& after) -> f64 {
+      if (after.busy < before.busy || after.idle < before.idle)
+        return 0.0;
+
+      const u64 busy  = after.busy - before.busy;
+      const u64 total = busy + (after.idle - before.idle);
+
+      return total == 0 ? 0.0 : static_cast<f64>(busy) * 100.0 / static_cast<f64>(total);
+    }
+  } // namespace
+
+  CPUUsageSampler::CPUUsageSampler(const usize capacity, Reader reader)
+    : m_reader(reader ? std::move(reader) : Reader(DefaultReader)), m_ring(std::max<usize>(capacity, 1)) {}
+
+  auto CPUUsageSampler::sample() -> Result<CPULoad> {
+    const LockGuard lock(m_mutex);
+
+    const CPUTimes total = TRY(m_reader(m_current));
+
+    // A CPU that only appears now (hotplug, or the first sample) is measured from zero.
+    if (m_previous.size() < m_current.size())
+      m_previous.resize(m_current.size());
+
+    CPUUsageSample& slot = m_ring[m_next];
+
+    slot.at         = std::chrono::steady_clock::now();
+    slot.load.total = BusyPercent(m_previousTotal, total);
+    slot.load.perCpu.resize(m_current.size());
+
+    for (usize i = 0; i < m_current.size(); ++i)
+      slot.load.perCpu[i] = BusyPercent(m_previous[i], m_current[i]);
+
+    std::swap(m_previous, m_current);
+    m_previousTotal = total;
+
+    m_next  = (m_next + 1) % m_ring.size();
+    m_count = std::min(m_count + 1, m_ring.size());
+
+    return slot.load;
+  }
+
+  auto CPUUsageSampler::latest() const -> Option<CPUUsageSample> {
+    const LockGuard lock(m_mutex);
+
+    if (m_count == 0)
+      return None;
+
+    return m_ring[(m_next + m_ring.size() - 1) % m_ring.size()];
+  }
+
+  auto CPUUsageSampler::history(Vec<CPUUsageSample>& out) const -> Unit {
+    const LockGuard lock(m_mutex);
+
+    out.resize(m_count);
+
+    const usize oldest = (m_next + m_ring.size() - m_count) % m_ring.size();
+
+    for (usize i = 0; i < m_count; ++i)
+      out[i] = m_ring[(oldest + i) % m_ring.size()];
+  }
+
+  auto CPUUsageSampler::capacity() const -> usize {
+    return m_ring.size();
+  }
+} // namespace draconis::core::system
@@ -0,0 +1,119 @@
+/**
+ * @file EventLoop.cpp
+ * @brief asio-backed implementation of the plugin event loop
+ */
+
+#if DRAC_ENABLE_PLUGINS
+
+  #include <asio/executor_work_guard.hpp> // asio::executor_work_guard, asio::make_work_guard
+  #include <asio/io_context.hpp>          // asio::io_context
+  #include <asio/post.hpp>                // asio::post
+  #include <asio/steady_timer.hpp>        // asio::steady_timer
+  #include <mutex>                        // std::once_flag, std::call_once
+  #include <thread>                       // std::thread
+
+  #ifndef _WIN32
+    #include <asio/posix/stream_descriptor.hpp> // asio::posix::stream_descriptor
+  #endif
+
+  #include <Drac++/Core/PluginManager.hpp>
+
+  #include <Drac++/Utils/Error.hpp>
+  #include <Drac++/Utils/Logging.hpp>
+
+namespace draconis::core::plugin {
+  namespace {
+    using namespace utils::types;
+    using utils::error::DracError;
+    using enum utils::error::DracErrorCode;
+
+    class AsioEventLoop final : public IEventLoop {
+     public:
+      AsioEventLoop() = default;
+
+      AsioEventLoop(const AsioEventLoop&)                    = delete;
+      AsioEventLoop(AsioEventLoop&&)                         = delete;
+      auto operator=(const AsioEventLoop&) -> AsioEventLoop& = delete;
+      auto operator=(AsioEventLoop&&) -> AsioEventLoop&      = delete;
+
+      ~AsioEventLoop() override {
+        // Outstanding operations are abandoned; their plugins are shutting down too.
+        m_workGuard.reset();
+        m_context.stop();
+
+        if (m_thread.joinable())
+          m_thread.join();
+      }
+
+      auto post(Fn<void()> task) -> Unit override {
+        ensureRunning();
+        asio::post(m_context, std::move(task));
+      }
+
+      auto postAfter(const std::chrono::milliseconds delay, Fn<void()> task) -> Unit override {
+        ensureRunning();
+
+        auto timer = std::make_shared<asio::steady_timer>(m_context, delay);
+
+        timer->async_wait([timer, task = std::move(task)](const asio::error_code& errc) {
+          if (!errc)
+            task();
+        });
+      }
+
+      auto waitReadable(const i64 descriptor, Fn<void(Result<Unit>)> onReadable) -> Unit override {
+        ensureRunning();
+
+  #ifdef _WIN32
+        (void)descriptor;
+
+        asio::post(m_context, [onReadable = std::move(onReadable)] {
+          onReadable(Err(DracError(NotSupported, "Waiting on raw descriptors is not supported on Windows")));
+        });
+  #else
+        auto stream = std::make_shared<asio::posix::stream_descriptor>(m_context, static_cast<int>(descriptor));
+
+        stream->async_wait(
+          asio::posix::stream_descriptor::wait_read,
+          [stream, onReadable = std::move(onReadable)](const asio::error_code& errc) {
+            // The plugin owns the descriptor; don't let the stream close it.
+            stream->release();
+
+            if (errc)
+              onReadable(Err(DracError(IoError, errc.message())));
+            else
+              onReadable({});
+          }
+        );
+  #endif
+      }
+
+      [[nodiscard]] auto nativeHandle() -> void* override {
+        return &m_context;
+      }
+
+     private:
+      asio::io_context                                           m_context { 1 };
+      asio::executor_work_guard<asio::io_context::executor_type> m_workGuard = asio::make_work_guard(m_context);
+      std::once_flag                                             m_started;
+      std::thread                                                m_thread;
+
+      // The loop thread only exists once some plugin actually submits work.
+      auto ensureRunning() -> Unit {
+        std::call_once(m_started, [this] {
+          m_thread = std::thread([this] {
+            debug_log("Plugin event loop started");
+            m_context.run();
+          });
+        });
+      }
+    };
+  } // namespace
+
+  auto GetEventLoop() -> IEventLoop& {
+    static AsioEventLoop Loop;
+    return Loop;
+  }
+} // namespace draconis::core::plugin
+
+#endif // DRAC_ENABLE_PLUGINS
@@ -0,0 +1,386 @@
+#include <Drac++/Core/Invalidation.hpp>
+
+#include <algorithm> // std::ranges::{any_of, find}, std::{min, max}
+#include <ranges>    // std::views::values
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Logging.hpp>
+
+#ifdef __linux__
+  #include <array>             // std::array
+  #include <cerrno>            // errno, EINTR
+  #include <chrono>            // std::chrono::{milliseconds, steady_clock}
+  #include <cstring>           // std::strlen
+  #include <linux/netlink.h>   // sockaddr_nl, NETLINK_ROUTE, NETLINK_KOBJECT_UEVENT
+  #include <linux/rtnetlink.h> // RTMGRP_*
+  #include <poll.h>            // poll, pollfd, POLLIN
+  #include <sys/eventfd.h>     // eventfd, EFD_CLOEXEC
+  #include <sys/inotify.h>     // inotify_init1, inotify_add_watch, inotify_event, IN_*
+  #include <sys/socket.h>      // socket, bind, recv
+  #include <unistd.h>          // close, read, write
+#endif
+
+namespace draconis::core::system {
+  using namespace utils::types;
+  using utils::cache::CacheManager;
+  using enum utils::error::DracErrorCode;
+
+  namespace fs = std::filesystem;
+
+#ifdef __linux__
+  namespace {
+    // A package transaction or a DHCP renewal arrives as a burst of events;
+    // wait this long after the first one so the burst fires its rules once.
+    constexpr std::chrono::milliseconds SETTLE_TIME(50);
+
+    constexpr u32 WATCH_MASK = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_MASK_ADD;
+
+    // One inotify watch serving one rule. `name` is empty when the rule covers
+    // the whole directory, otherwise only events for that entry count.
+    struct PathWatch {
+      i32    descriptor;
+      String name;
+      usize  rule;
+    };
+
+    auto OpenNetlink(const i32 protocol, const u32 groups) -> i32 {
+      const i32 sock = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC | SOCK_NONBLOCK, protocol);
+
+      if (sock < 0)
+        return -1;
+
+      sockaddr_nl addr {};
+      addr.nl_family = AF_NETLINK;
+      addr.nl_groups = groups;
+
+      if (bind(sock, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) < 0) { // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) - sockaddr API
+        close(sock);
+        return -1;
+      }
+
+      return sock;
+    }
+
+    // A uevent datagram is "action@devpath" followed by NUL-separated KEY=value pairs.
+    auto UeventSubsystem(const StringView message) -> StringView {
+      constexpr StringView prefix = "SUBSYSTEM=";
+
+      for (usize pos = 0; pos < message.size();) {
+        const usize      end   = std::min(message.find('\0', pos), message.size());
+        const StringView field = message.substr(pos, end - pos);
+
+        if (field.starts_with(prefix))
+          return field.substr(prefix.size());
+
+        pos = end + 1;
+      }
+
+      return {};
+    }
+  } // namespace
+
+  struct CacheInvalidator::Sources {
+    i32 stopFd    = -1;
+    i32 inotifyFd = -1;
+    i32 routeFd   = -1;
+    i32 ueventFd  = -1;
+
+    Vec<PathWatch> watches;
+
+    Sources() = default;
+
+    Sources(const Sources&)                    = delete;
+    Sources(Sources&&)                         = delete;
+    auto operator=(const Sources&) -> Sources& = delete;
+    auto operator=(Sources&&) -> Sources&      = delete;
+
+    ~Sources() {
+      for (const i32 descriptor : { stopFd, inotifyFd, routeFd, ueventFd })
+        if (descriptor >= 0)
+          close(descriptor);
+    }
+
+    // Watches the directory holding `path`, filtered to its entry, so editors and
+    // package managers that replace the file by renaming over it are still seen.
+    auto watchEntry(const fs::path& path, const usize rule) -> bool {
+      const fs::path parent = path.parent_path();
+      const i32      wd     = inotify_add_watch(inotifyFd, parent.c_str(), WATCH_MASK);
+
+      if (wd < 0)
+        return false;
+
+      watches.push_back({ .descriptor = wd, .name = path.filename().string(), .rule = rule });
+      return true;
+    }
+
+    auto watchPath(const fs::path& path, const usize rule) -> bool {
+      std::error_code errc;
+
+      if (fs::is_directory(path, errc)) {
+        const i32 wd = inotify_add_watch(inotifyFd, path.c_str(), WATCH_MASK);
+
+        if (wd < 0)
+          return false;
+
+        watches.push_back({ .descriptor = wd, .name = {}, .rule = rule });
+        return true;
+      }
+
+      bool watched = watchEntry(path, rule);
+
+      // /etc/os-release is usually a link into /usr/lib, which is where upgrades write.
+      if (fs::is_symlink(path, errc))
+        if (const fs::path target = fs::canonical(path, errc); !errc)
+          watched = watchEntry(target, rule) || watched;
+
+      return watched;
+    }
+  };
+
+  auto DefaultInvalidationRules(const Option<fs::path>& configPath) -> Vec<InvalidationRule> {
+    using enum ChangeSource;
+
+    // Keys must match the ones the Linux readouts and package counters cache under.
+    Vec<InvalidationRule> rules = {
+      { .source = Path, .target = "/var/lib/pacman/local", .keys = { "pkg_count_pacman" }, .fields = { SnapshotField::Packages } },
+      { .source = Path, .target = "/var/lib/dpkg", .keys = { "pkg_count_dpkg" }, .fields = { SnapshotField::Packages } },
+      { .source = Path, .target = "/var/lib/rpm", .keys = { "pkg_count_rpm" }, .fields = { SnapshotField::Packages } },
+      { .source = Path, .target = "/lib/apk/db", .keys = { "pkg_count_apk" }, .fields = { SnapshotField::Packages } },
+      { .source = Path, .target = "/nix/var/nix/db", .keys = { "pkg_count_nix" }, .fields = { SnapshotField::Packages } },
+      { .source = Path, .target = "/etc/os-release", .keys = { "linux_os_version", "linux_distro_id" }, .fields = { SnapshotField::OperatingSystem } },
+      { .source = Network, .target = {}, .keys = { "linux_network_interfaces", "linux_primary_network_interface" }, .fields = { SnapshotField::Network } },
+      { .source = Uevent, .target = "power_supply", .keys = {}, .fields = { SnapshotField::Battery } },
+      { .source = Uevent, .target = "drm", .keys = {}, .fields = { SnapshotField::Outputs } },
+      { .source = Uevent, .target = "pci", .keys = { "linux_gpus", "linux_gpu_model" }, .fields = { SnapshotField::GPUModel, SnapshotField::GPUs } },
+      { .source = Uevent, .target = "cpu", .keys = { "linux_cpu_topology" }, .fields = { SnapshotField::CPUCores } },
+    };
+
+    if (configPath)
+      rules.push_back({ .source = Path, .target = configPath->string(), .keys = {}, .fields = {} });
+
+    return rules;
+  }
+
+  auto CacheInvalidator::start() -> Result<> {
+    const LockGuard lock(m_controlMutex);
+
+    if (m_worker.joinable())
+      return {};
+
+    auto sources = std::make_unique<Sources>();
+
+    sources->stopFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+    if (sources->stopFd < 0)
+      ERR_FMT(ResourceExhausted, "Failed to create eventfd: errno {}", errno);
+
+    usize watched = 0;
+
+    for (usize i = 0; i < m_rules.size(); ++i) {
+      const InvalidationRule& rule = m_rules[i];
+
+      bool opened = false;
+
+      switch (rule.source) {
+        case ChangeSource::Path:
+          if (sources->inotifyFd < 0)
+            sources->inotifyFd = inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+
+          opened = sources->inotifyFd >= 0 && sources->watchPath(rule.target, i);
+          break;
+
+        case ChangeSource::Network:
+          if (sources->routeFd < 0)
+            sources->routeFd = OpenNetlink(NETLINK_ROUTE, RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR | RTMGRP_IPV4_ROUTE | RTMGRP_IPV6_ROUTE);
+
+          opened = sources->routeFd >= 0;
+          break;
+
+        case ChangeSource::Uevent:
+          // Group 1 is the kernel's own broadcast; udev's re-broadcast (group 2) only adds rules-based properties.
+          if (sources->ueventFd < 0)
+            sources->ueventFd = OpenNetlink(NETLINK_KOBJECT_UEVENT, 1);
+
+          opened = sources->ueventFd >= 0;
+          break;
+      }
+
+      if (opened)
+        watched++;
+      else
+        debug_log("Invalidation: not watching '{}' (errno {})", rule.target.empty() ? "rtnetlink" : rule.target, errno);
+    }
+
+    if (watched == 0)
+      ERR(NotFound, "None of the invalidation sources could be opened");
+
+    debug_log("Invalidation: watching {} of {} rules", watched, m_rules.size());
+
+    m_sources = std::move(sources);
+    m_worker  = std::thread([this, &sources = *m_sources] { run(sources); });
+
+    return {};
+  }
+
+  auto CacheInvalidator::stop() -> Unit {
+    const LockGuard lock(m_controlMutex);
+
+    if (!m_worker.joinable())
+      return;
+
+    // A nonblocking eventfd write only fails if the counter would overflow, which one write can't do.
+    constexpr u64                one     = 1;
+    [[maybe_unused]] const isize written = write(m_sources->stopFd, &one, sizeof(one));
+
+    m_worker.join();
+    m_sources.reset();
+  }
+
+  auto CacheInvalidator::run(Sources& sources) -> Unit {
+    using std::chrono::steady_clock, std::chrono::milliseconds, std::chrono::duration_cast;
+
+    std::array<pollfd, 4> fds = { {
+      { .fd = sources.stopFd, .events = POLLIN, .revents = 0 },
+      { .fd = sources.inotifyFd, .events = POLLIN, .revents = 0 },
+      { .fd = sources.routeFd, .events = POLLIN, .revents = 0 },
+      { .fd = sources.ueventFd, .events = POLLIN, .revents = 0 },
+    } };
+
+    // inotify events and uevents are both well under this; recv() truncates anything longer.
+    alignas(inotify_event) std::array<char, 8192> buffer {};
+
+    Vec<bool>                        fired(m_rules.size(), false);
+    Option<steady_clock::time_point> deadline;
+
+    const auto mark = [&](const auto& matches) {
+      for (usize i = 0; i < m_rules.size(); ++i)
+        if (matches(m_rules[i], i))
+          fired[i] = true;
+
+      if (!deadline && std::ranges::find(fired, true) != fired.end())
+        deadline = steady_clock::now() + SETTLE_TIME;
+    };
+
+    while (true) {
+      i32 timeout = -1;
+
+      if (deadline)
+        timeout = static_cast<i32>(std::max<i64>(0, duration_cast<milliseconds>(*deadline - steady_clock::now()).count()));
+
+      // Closed sources have fd -1, which poll() skips.
+      if (poll(fds.data(), fds.size(), timeout) < 0 && errno != EINTR) {
+        error_log("Invalidation: poll failed: errno {}", errno);
+        return;
+      }
+
+      if (fds[0].revents & POLLIN)
+        return;
+
+      if (fds[1].revents & POLLIN)
+        for (isize length = 0; (length = read(sources.inotifyFd, buffer.data(), buffer.size())) > 0;)
+          for (isize offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) - inotify record layout
+
+            offset += static_cast<isize>(sizeof(inotify_event) + event->len);
+
+            // Dropped events mean anything could have changed.
+            if (event->mask & IN_Q_OVERFLOW) {
+              mark([](const InvalidationRule& rule, usize) { return rule.source == ChangeSource::Path; });
+              continue;
+            }
+
+            const StringView name = event->len > 0 ? StringView(event->name, std::strlen(event->name)) : StringView {};
+
+            mark([&](const InvalidationRule&, const usize rule) {
+              return std::ranges::any_of(sources.watches, [&](const PathWatch& watch) {
+                return watch.rule == rule && watch.descriptor == event->wd && (watch.name.empty() || watch.name == name);
+              });
+            });
+          }
+
+      // Any link, address or route message; the readouts re-dump everything anyway.
+      if (fds[2].revents & POLLIN) {
+        while (recv(sources.routeFd, buffer.data(), buffer.size(), 0) > 0 || errno == ENOBUFS) {}
+
+        mark([](const InvalidationRule& rule, usize) { return rule.source == ChangeSource::Network; });
+      }
+
+      if (fds[3].revents & POLLIN)
+        for (isize length = 0; (length = recv(sources.ueventFd, buffer.data(), buffer.size(), 0)) > 0;) {
+          const StringView subsystem = UeventSubsystem(StringView(buffer.data(), static_cast<usize>(length)));
+
+          mark([&](const InvalidationRule& rule, usize) { return rule.source == ChangeSource::Uevent && rule.target == subsystem; });
+        }
+
+      if (deadline && steady_clock::now() >= *deadline) {
+        fire(fired);
+
+        fired.assign(fired.size(), false);
+        deadline.reset();
+      }
+    }
+  }
+#else
+  struct CacheInvalidator::Sources {};
+
+  auto DefaultInvalidationRules(const Option<fs::path>& /*configPath*/) -> Vec<InvalidationRule> {
+    return {};
+  }
+
+  auto CacheInvalidator::start() -> Result<> {
+    ERR(NotSupported, "Event-driven cache invalidation is not available on this platform");
+  }
+
+  auto CacheInvalidator::stop() -> Unit {}
+
+  auto CacheInvalidator::run(Sources& /*sources*/) -> Unit {}
+#endif
+
+  CacheInvalidator::CacheInvalidator(CacheManager& cache, Vec<InvalidationRule> rules)
+    : m_cache(cache), m_rules(std::move(rules)) {}
+
+  CacheInvalidator::~CacheInvalidator() {
+    stop();
+  }
+
+  auto CacheInvalidator::fire(const Vec<bool>& fired) -> Unit {
+    // One copy serves every rule that fired, and leaves listeners free to (un)subscribe while handling one.
+    Vec<Listener> listeners;
+
+    {
+      const LockGuard lock(m_listenerMutex);
+
+      listeners.reserve(m_listeners.size());
+
+      for (const Listener& listener : m_listeners | std::views::values)
+        listeners.push_back(listener);
+    }
+
+    for (usize i = 0; i < m_rules.size(); ++i) {
+      if (!fired[i])
+        continue;
+
+      const InvalidationRule& rule = m_rules[i];
+
+      for (const String& key : rule.keys)
+        m_cache.invalidate(key);
+
+      for (const Listener& listener : listeners)
+        listener(rule);
+    }
+  }
+
+  auto CacheInvalidator::subscribe(Listener listener) -> u64 {
+    const LockGuard lock(m_listenerMutex);
+
+    const u64 id = m_nextListenerId++;
+    m_listeners.emplace(id, std::move(listener));
+
+    return id;
+  }
+
+  auto CacheInvalidator::unsubscribe(const u64 id) -> Unit {
+    const LockGuard lock(m_listenerMutex);
+    m_listeners.erase(id);
+  }
+} // namespace draconis::core::system
@@ -0,0 +1,208 @@
+#include <Drac++/Core/Metrics.hpp>
+
+#include <format>           // std::format_to
+#include <initializer_list> // std::initializer_list
+#include <iterator>         // std::back_inserter
+#include <string>           // std::to_string
+
+namespace draconis::core::system {
+  using namespace utils::types;
+
+  namespace {
+    // Label values escape backslashes, double quotes and newlines.
+    auto AppendLabelValue(String& out, const StringView value) -> Unit {
+      for (const char chr : value)
+        switch (chr) {
+          case '\\': out += R"(\\)"; break;
+          case '"':  out += R"(\")"; break;
+          case '\n': out += R"(\n)"; break;
+          default:   out += chr;
+        }
+    }
+
+    auto AppendHeader(String& out, const StringView name, const StringView type, const StringView help, const StringView unit = {}) -> Unit {
+      std::format_to(std::back_inserter(out), "# TYPE {} {}\n", name, type);
+
+      if (!unit.empty())
+        std::format_to(std::back_inserter(out), "# UNIT {} {}\n", name, unit);
+
+      std::format_to(std::back_inserter(out), "# HELP {} {}\n", name, help);
+    }
+
+    // `labels` is a list of name/value pairs; values are escaped here.
+    auto AppendSample(String& out, const StringView name, const std::initializer_list<Pair<StringView, StringView>> labels, const auto value) -> Unit {
+      out += name;
+
+      if (labels.size() != 0) {
+        out += '{';
+
+        bool first = true;
+
+        for (const auto& [label, labelValue] : labels) {
+          if (!first)
+            out += ',';
+
+          first = false;
+
+          std::format_to(std::back_inserter(out), "{}=\"", label);
+          AppendLabelValue(out, labelValue);
+          out += '"';
+        }
+
+        out += '}';
+      }
+
+      std::format_to(std::back_inserter(out), " {}\n", value);
+    }
+
+    auto BatteryStateName(const Battery::Status status) -> StringView {
+      switch (status) {
+        case Battery::Status::Charging:    return "charging";
+        case Battery::Status::Discharging: return "discharging";
+        case Battery::Status::Full:        return "full";
+        case Battery::Status::NotPresent:  return "not_present";
+        case Battery::Status::Unknown:     break;
+      }
+
+      return "unknown";
+    }
+
+    template <typename T>
+    auto ValueOr(const Result<T>& result, const StringView fallback) -> StringView {
+      return result ? StringView(*result) : fallback;
+    }
+  } // namespace
+
+  auto WriteOpenMetrics(const SystemSnapshot& snapshot, String& out) -> Unit {
+    AppendHeader(out, "drac_system", "info", "Static facts about the host.");
+    AppendSample(
+      out,
+      "drac_system_info",
+      {
+        { "os", snapshot.operatingSystem ? StringView(snapshot.operatingSystem->name) : "" },
+        { "os_version", snapshot.operatingSystem ? StringView(snapshot.operatingSystem->version) : "" },
+        { "kernel", ValueOr(snapshot.kernelVersion, "") },
+        { "host", ValueOr(snapshot.host, "") },
+        { "cpu", ValueOr(snapshot.cpuModel, "") },
+        { "gpu", ValueOr(snapshot.gpuModel, "") },
+      },
+      1
+    );
+
+    if (snapshot.cpuCores) {
+      AppendHeader(out, "drac_cpu_cores", "gauge", "CPU cores by kind.");
+      AppendSample(out, "drac_cpu_cores", { { "kind", "physical" } }, snapshot.cpuCores->physical);
+      AppendSample(out, "drac_cpu_cores", { { "kind", "logical" } }, snapshot.cpuCores->logical);
+    }
+
+    if (snapshot.cpuUsage) {
+      AppendHeader(out, "drac_cpu_busy_percent", "gauge", "Share of time the CPUs were busy since the previous sample.", "percent");
+      AppendSample(out, "drac_cpu_busy_percent", { { "cpu", "all" } }, snapshot.cpuUsage->total);
+
+      for (usize cpu = 0; cpu < snapshot.cpuUsage->perCpu.size(); ++cpu)
+        AppendSample(out, "drac_cpu_busy_percent", { { "cpu", std::to_string(cpu) } }, snapshot.cpuUsage->perCpu[cpu]);
+    }
+
+    if (snapshot.memInfo) {
+      AppendHeader(out, "drac_memory_used_bytes", "gauge", "Memory in use.", "bytes");
+      AppendSample(out, "drac_memory_used_bytes", {}, snapshot.memInfo->usedBytes);
+      AppendHeader(out, "drac_memory_total_bytes", "gauge", "Total memory.", "bytes");
+      AppendSample(out, "drac_memory_total_bytes", {}, snapshot.memInfo->totalBytes);
+    }
+
+    if (snapshot.disks && !snapshot.disks->empty()) {
+      AppendHeader(out, "drac_disk_used_bytes", "gauge", "Space in use per mounted filesystem.", "bytes");
+
+      for (const DiskInfo& disk : *snapshot.disks)
+        AppendSample(out, "drac_disk_used_bytes", { { "device", disk.name }, { "mountpoint", disk.mountPoint }, { "fstype", disk.filesystem } }, disk.usedBytes);
+
+      AppendHeader(out, "drac_disk_total_bytes", "gauge", "Capacity per mounted filesystem.", "bytes");
+
+      for (const DiskInfo& disk : *snapshot.disks)
+        AppendSample(out, "drac_disk_total_bytes", { { "device", disk.name }, { "mountpoint", disk.mountPoint }, { "fstype", disk.filesystem } }, disk.totalBytes);
+    }
+
+    if (snapshot.gpus && !snapshot.gpus->empty()) {
+      const Vec<GPUInfo>& gpus = *snapshot.gpus;
+
+      // Drivers that don't expose a counter get no sample for it.
+      AppendHeader(out, "drac_gpu_busy_percent", "gauge", "Share of time the GPU was busy.", "percent");
+
+      for (const GPUInfo& gpu : gpus)
+        if (gpu.busyPercent)
+          AppendSample(out, "drac_gpu_busy_percent", { { "address", gpu.pciAddress }, { "model", gpu.model } }, *gpu.busyPercent);
+
+      AppendHeader(out, "drac_gpu_memory_used_bytes", "gauge", "Video memory in use.", "bytes");
+
+      for (const GPUInfo& gpu : gpus)
+        if (gpu.vramUsedBytes)
+          AppendSample(out, "drac_gpu_memory_used_bytes", { { "address", gpu.pciAddress }, { "model", gpu.model } }, *gpu.vramUsedBytes);
+
+      AppendHeader(out, "drac_gpu_memory_total_bytes", "gauge", "Dedicated video memory.", "bytes");
+
+      for (const GPUInfo& gpu : gpus)
+        if (gpu.vramTotalBytes)
+          AppendSample(out, "drac_gpu_memory_total_bytes", { { "address", gpu.pciAddress }, { "model", gpu.model } }, *gpu.vramTotalBytes);
+    }
+
+    if (snapshot.uptime) {
+      AppendHeader(out, "drac_uptime_seconds", "gauge", "Time since boot.", "seconds");
+      AppendSample(out, "drac_uptime_seconds", {}, snapshot.uptime->count());
+    }
+
+    if (snapshot.battery && snapshot.battery->status != Battery::Status::NotPresent) {
+      const Battery& battery = *snapshot.battery;
+
+      AppendHeader(out, "drac_battery_state", "stateset", "Battery charging state.");
+
+      for (const Battery::Status status : { Battery::Status::Unknown, Battery::Status::Charging, Battery::Status::Discharging, Battery::Status::Full })
+        AppendSample(out, "drac_battery_state", { { "drac_battery_state", BatteryStateName(status) } }, status == battery.status ? 1 : 0);
+
+      if (battery.percentage) {
+        AppendHeader(out, "drac_battery_charge_percent", "gauge", "Battery charge.", "percent");
+        AppendSample(out, "drac_battery_charge_percent", {}, static_cast<u32>(*battery.percentage));
+      }
+
+      if (battery.timeRemaining) {
+        AppendHeader(out, "drac_battery_time_remaining_seconds", "gauge", "Estimated time until empty or full.", "seconds");
+        AppendSample(out, "drac_battery_time_remaining_seconds", {}, battery.timeRemaining->count());
+      }
+    }
+
+    if (snapshot.networkInterfaces && !snapshot.networkInterfaces->empty()) {
+      const Vec<NetworkInterface>& interfaces = *snapshot.networkInterfaces;
+
+      AppendHeader(out, "drac_network_up", "gauge", "Whether the interface is up.");
+
+      for (const NetworkInterface& iface : interfaces)
+        AppendSample(out, "drac_network_up", { { "interface", iface.name } }, iface.isUp ? 1 : 0);
+
+      // Counter samples carry the _total suffix; interfaces the platform has no counters for are skipped.
+      AppendHeader(out, "drac_network_receive_bytes", "counter", "Bytes received since the interface came up.", "bytes");
+
+      for (const NetworkInterface& iface : interfaces)
+        if (iface.rxBytes)
+          AppendSample(out, "drac_network_receive_bytes_total", { { "interface", iface.name } }, *iface.rxBytes);
+
+      AppendHeader(out, "drac_network_transmit_bytes", "counter", "Bytes transmitted since the interface came up.", "bytes");
+
+      for (const NetworkInterface& iface : interfaces)
+        if (iface.txBytes)
+          AppendSample(out, "drac_network_transmit_bytes_total", { { "interface", iface.name } }, *iface.txBytes);
+    }
+
+#if DRAC_ENABLE_PACKAGECOUNT
+    if (snapshot.packageCounts && !snapshot.packageCounts->empty()) {
+      AppendHeader(out, "drac_packages", "gauge", "Installed packages per package manager.");
+
+      for (const auto& [manager, count] : *snapshot.packageCounts)
+        AppendSample(out, "drac_packages", { { "manager", manager } }, count);
+    }
+#endif
+
+    AppendHeader(out, "drac_snapshot_version", "gauge", "Version of the snapshot these metrics were rendered from.");
+    AppendSample(out, "drac_snapshot_version", {}, snapshot.version);
+
+    out += "# EOF\n";
+  }
+} // namespace draconis::core::system
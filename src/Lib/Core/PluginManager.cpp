@@ -7,9 +7,13 @@
 
 #if DRAC_ENABLE_PLUGINS
 
-  #include <format>   // std::format
-  #include <optional> // std::optional
-  #include <string>   // std::string
+  #include <format>       // std::format
+  #include <fstream>      // std::ifstream, std::ofstream
+  #include <glaze/glaze.hpp>
+  #include <optional>     // std::optional
+  #include <random>       // std::random_device
+  #include <string>       // std::string
+  #include <system_error> // std::error_code
 
   #include <Drac++/Core/PluginManager.hpp>
 
@@ -17,6 +21,7 @@
   #include <Drac++/Utils/Env.hpp>
   #include <Drac++/Utils/Error.hpp>
   #include <Drac++/Utils/Logging.hpp>
+  #include <Drac++/Utils/Tracing.hpp>
 
   // Include static plugins header when using precompiled config
   #if DRAC_PRECOMPILED_CONFIG
@@ -29,9 +34,69 @@
     #include <dlfcn.h> // dlopen, dlsym, dlclose
   #endif
 
+namespace draconis::core::plugin {
+  namespace {
+    // Bump whenever PluginManifestEntry or PluginMetadata change shape.
+    constexpr utils::types::u32 MANIFEST_VERSION = 1;
+
+    struct ManifestFile {
+      utils::types::u32                version = MANIFEST_VERSION;
+      Map<String, PluginManifestEntry> plugins;
+    };
+  } // namespace
+} // namespace draconis::core::plugin
+
+// clang-format off
+template <>
+struct glz::meta<draconis::core::plugin::PluginDependencies> {
+  using T                     = draconis::core::plugin::PluginDependencies;
+  static constexpr auto value = object(
+    "requiresNetwork",    &T::requiresNetwork,
+    "requiresFilesystem", &T::requiresFilesystem,
+    "requiresAdmin",      &T::requiresAdmin,
+    "requiresCaching",    &T::requiresCaching
+  );
+};
+
+template <>
+struct glz::meta<draconis::core::plugin::PluginMetadata> {
+  using T                     = draconis::core::plugin::PluginMetadata;
+  static constexpr auto value = object(
+    "name",         &T::name,
+    "version",      &T::version,
+    "author",       &T::author,
+    "description",  &T::description,
+    "type",         &T::type,
+    "dependencies", &T::dependencies
+  );
+};
+
+template <>
+struct glz::meta<draconis::core::plugin::PluginManifestEntry> {
+  using T                     = draconis::core::plugin::PluginManifestEntry;
+  static constexpr auto value = object(
+    "path",       &T::path,
+    "mtime",      &T::mtime,
+    "size",       &T::size,
+    "metadata",   &T::metadata,
+    "providerId", &T::providerId
+  );
+};
+
+template <>
+struct glz::meta<draconis::core::plugin::ManifestFile> {
+  using T                     = draconis::core::plugin::ManifestFile;
+  static constexpr auto value = object("version", &T::version, "plugins", &T::plugins);
+};
+// clang-format on
+
 namespace draconis::core::plugin {
   namespace {
     using utils::error::DracErrorCode;
+    using utils::types::LockGuard;
+    using utils::types::Mutex;
+    using utils::types::None;
+    using utils::types::Pair;
     using utils::types::StringView;
     using enum DracErrorCode;
 
@@ -49,22 +114,22 @@ namespace draconis::core::plugin {
       static const Vec<fs::path> DEFAULT_PLUGIN_PATHS = []() -> Vec<fs::path> {
         Vec<fs::path> paths;
   #ifdef _WIN32
-        using draconis::utils::env::GetEnv;
+        const draconis::utils::env::EnvSnapshot& env = draconis::utils::env::GetEnvSnapshot();
 
-        if (auto result = GetEnv("LOCALAPPDATA"))
-          paths.push_back(fs::path(*result) / "draconis++" / "plugins");
+        if (env.localAppData)
+          paths.push_back(fs::path(*env.localAppData) / "draconis++" / "plugins");
 
-        if (auto result = GetEnv("APPDATA"))
-          paths.push_back(fs::path(*result) / "draconis++" / "plugins");
+        if (env.appData)
+          paths.push_back(fs::path(*env.appData) / "draconis++" / "plugins");
 
-        if (auto result = GetEnv("USERPROFILE"))
-          paths.push_back(fs::path(*result) / ".config" / "draconis++" / "plugins");
+        if (env.userProfile)
+          paths.push_back(fs::path(*env.userProfile) / ".config" / "draconis++" / "plugins");
 
         paths.push_back(fs::current_path() / "plugins");
   #else
         paths.push_back(fs::path("/usr/local/lib/draconis++/plugins"));
         paths.push_back(fs::path("/usr/lib/draconis++/plugins"));
-        paths.push_back(fs::path(getenv("HOME") ? getenv("HOME") : "") / ".local/lib/draconis++/plugins");
+        paths.push_back(fs::path(draconis::utils::env::GetEnvSnapshot().home.value_or("")) / ".local/lib/draconis++/plugins");
         paths.push_back(fs::current_path() / "plugins");
   #endif
         return paths;
@@ -73,54 +138,92 @@ namespace draconis::core::plugin {
       return DEFAULT_PLUGIN_PATHS;
     }
 
-    // Get the base config directory for draconis++
-    auto GetConfigDir() -> fs::path {
-  #ifdef _WIN32
-      using draconis::utils::env::GetEnv;
-      if (auto result = GetEnv("LOCALAPPDATA"))
-        return fs::path(*result) / "draconis++";
-      if (auto result = GetEnv("USERPROFILE"))
-        return fs::path(*result) / ".config" / "draconis++";
-      return fs::current_path();
-  #else
-      if (const char* xdgConfig = getenv("XDG_CONFIG_HOME"))
-        return fs::path(xdgConfig) / "draconis++";
-      if (const char* home = getenv("HOME"))
-        return fs::path(home) / ".config" / "draconis++";
-      return fs::current_path();
-  #endif
+    // The directories are resolved once, in the environment snapshot.
+    auto GetConfigDir() -> const fs::path& {
+      return draconis::utils::env::GetEnvSnapshot().configDir;
     }
 
-    // Get the cache directory for draconis++
-    auto GetCacheDir() -> fs::path {
-  #ifdef _WIN32
-      using draconis::utils::env::GetEnv;
-      if (auto result = GetEnv("LOCALAPPDATA"))
-        return fs::path(*result) / "draconis++" / "cache";
-      return GetConfigDir() / "cache";
-  #else
-      if (const char* xdgCache = getenv("XDG_CACHE_HOME"))
-        return fs::path(xdgCache) / "draconis++";
-      if (const char* home = getenv("HOME"))
-        return fs::path(home) / ".cache" / "draconis++";
-      return GetConfigDir() / "cache";
-  #endif
+    auto GetCacheDir() -> const fs::path& {
+      return draconis::utils::env::GetEnvSnapshot().cacheDir;
     }
 
-    // Get the data directory for draconis++
-    auto GetDataDir() -> fs::path {
-  #ifdef _WIN32
-      using draconis::utils::env::GetEnv;
-      if (auto result = GetEnv("LOCALAPPDATA"))
-        return fs::path(*result) / "draconis++" / "data";
-      return GetConfigDir() / "data";
-  #else
-      if (const char* xdgData = getenv("XDG_DATA_HOME"))
-        return fs::path(xdgData) / "draconis++";
-      if (const char* home = getenv("HOME"))
-        return fs::path(home) / ".local" / "share" / "draconis++";
-      return GetConfigDir() / "data";
-  #endif
+    auto GetDataDir() -> const fs::path& {
+      return draconis::utils::env::GetEnvSnapshot().dataDir;
+    }
+
+    auto GetManifestPath() -> fs::path {
+      return GetCacheDir() / "plugin_manifest.beve";
+    }
+
+    auto EncodeManifest(const Map<String, PluginManifestEntry>& entries) -> Result<String> {
+      const ManifestFile manifest { .version = MANIFEST_VERSION, .plugins = entries };
+      String             buffer;
+
+      if (glz::write_beve(manifest, buffer))
+        ERR(ParseError, "Failed to serialize plugin manifest");
+
+      return buffer;
+    }
+
+    auto ReplaceManifest(const fs::path& path, const String& buffer) -> Result<Unit> {
+      // Unique per writer, so two processes saving at once don't write into the same file.
+      const fs::path tmpPath = fs::path(std::format("{}.{:08x}.tmp", path.string(), std::random_device {}()));
+
+      std::error_code errc;
+      fs::create_directories(path.parent_path(), errc);
+
+      {
+        std::ofstream ofs(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!ofs)
+          ERR_FMT(IoError, "Failed to write plugin manifest to '{}'", tmpPath.string());
+
+        ofs.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+        if (!ofs) {
+          ofs.close();
+          fs::remove(tmpPath, errc);
+          ERR_FMT(IoError, "Failed to write plugin manifest to '{}'", tmpPath.string());
+        }
+      }
+
+      // Rename so concurrent readers never see a half-written manifest.
+      fs::rename(tmpPath, path, errc);
+
+      if (errc) {
+        const String message = errc.message();
+        fs::remove(tmpPath, errc);
+        ERR_FMT(IoError, "Failed to replace plugin manifest: {}", message);
+      }
+
+      return {};
+    }
+
+    // Path, mtime and size identify a library build well enough to trust cached metadata.
+    auto StatLibrary(const fs::path& path) -> Option<Pair<i64, u64>> {
+      std::error_code errc;
+
+      const auto mtime = fs::last_write_time(path, errc);
+      if (errc)
+        return None;
+
+      const auto size = fs::file_size(path, errc);
+      if (errc)
+        return None;
+
+      return Pair<i64, u64> { static_cast<i64>(mtime.time_since_epoch().count()), static_cast<u64>(size) };
+    }
+
+    // Plugins with collections still running on another thread, and how many.
+    struct Collections {
+      Mutex                    mutex;
+      Map<const IPlugin*, u64> counts;
+    };
+
+    // Never destroyed: a late collection thread can finish after the static
+    // PluginManager has been torn down at exit.
+    auto GetCollections() -> Collections& {
+      static auto* Instance = new Collections(); // NOLINT(cppcoreguidelines-owning-memory) - intentionally leaked
+      return *Instance;
     }
   } // namespace
 
@@ -129,6 +232,7 @@ namespace draconis::core::plugin {
       .configDir = GetConfigDir() / "plugins",
       .cacheDir  = GetCacheDir() / "plugins",
       .dataDir   = GetDataDir() / "plugins",
+      .eventLoop = &GetEventLoop(),
     };
   }
 
@@ -145,6 +249,8 @@ namespace draconis::core::plugin {
     if (m_initialized)
       return {};
 
+    DRAC_TRACE_SCOPE("plugins", "PluginManager::initialize");
+
     debug_log("Initializing PluginManager...");
 
     // Check if plugins are enabled in config
@@ -236,10 +342,121 @@ namespace draconis::core::plugin {
         }
     }
 
+    loadManifest();
+
     return {};
   }
 
+  auto ReadPluginManifest(const fs::path& path) -> Result<Map<String, PluginManifestEntry>> {
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs)
+      ERR_FMT(NotFound, "No plugin manifest at '{}'", path.string());
+
+    const String contents((std::istreambuf_iterator<char>(ifs)), {});
+    ManifestFile manifest;
+
+    if (glz::read_beve(manifest, contents) || manifest.version != MANIFEST_VERSION)
+      ERR_FMT(ParseError, "Plugin manifest '{}' is unreadable or outdated", path.string());
+
+    return std::move(manifest.plugins);
+  }
+
+  auto WritePluginManifest(const fs::path& path, const Map<String, PluginManifestEntry>& entries) -> Result<Unit> {
+    Result<String> buffer = EncodeManifest(entries);
+    if (!buffer)
+      return std::unexpected(buffer.error());
+
+    return ReplaceManifest(path, *buffer);
+  }
+
+  auto PluginManager::loadManifest() -> Unit {
+    m_manifest.clear();
+
+    Result<Map<String, PluginManifestEntry>> manifest = ReadPluginManifest(GetManifestPath());
+
+    if (!manifest) {
+      if (manifest.error().code != NotFound) {
+        debug_at(manifest.error());
+        m_manifestDirty = true;
+      }
+
+      return;
+    }
+
+    // Keep only entries whose library is still discovered and unchanged.
+    for (auto& [name, entry] : *manifest) {
+      const auto discovered = m_discoveredPlugins.find(name);
+
+      if (discovered != m_discoveredPlugins.end() && discovered->second.string() == entry.path)
+        if (const auto stat = StatLibrary(discovered->second); stat && stat->first == entry.mtime && stat->second == entry.size) {
+          m_manifest.emplace(name, std::move(entry));
+          continue;
+        }
+
+      debug_log("Plugin manifest entry for '{}' is stale", name);
+      m_manifestDirty = true;
+    }
+  }
+
+  auto PluginManager::saveManifest() -> Unit {
+    // Held across the write so saves land in the order they were serialised.
+    const LockGuard writeLock(m_manifestWriteMutex);
+
+    Result<String> buffer;
+
+    {
+      std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+      if (!m_manifestDirty)
+        return;
+
+      buffer          = EncodeManifest(m_manifest);
+      m_manifestDirty = false;
+    }
+
+    Result<Unit> written = buffer ? ReplaceManifest(GetManifestPath(), *buffer) : std::unexpected(buffer.error());
+
+    if (!written) {
+      debug_at(written.error());
+
+      std::unique_lock<std::shared_mutex> lock(m_mutex);
+      m_manifestDirty = true;
+    }
+  }
+
+  auto PluginManager::recordManifestEntry(const String& pluginName, const LoadedPlugin& loadedPlugin) -> Unit {
+    const auto stat = StatLibrary(loadedPlugin.path);
+    if (!stat)
+      return;
+
+    PluginManifestEntry entry {
+      .path       = loadedPlugin.path.string(),
+      .mtime      = stat->first,
+      .size       = stat->second,
+      .metadata   = loadedPlugin.metadata,
+      .providerId = {},
+    };
+
+    if (const auto* infoProvider = dynamic_cast<const IInfoProviderPlugin*>(loadedPlugin.instance.get()))
+      entry.providerId = infoProvider->getProviderId();
+
+    m_manifest.insert_or_assign(pluginName, std::move(entry));
+    m_manifestDirty = true;
+  }
+
   auto PluginManager::loadPlugin(const String& pluginName, CacheManager& cache) -> Result<Unit> {
+    DRAC_TRACE_SCOPE_DETAIL("plugins", "load", pluginName);
+
+    Result<Unit> result = loadPluginImpl(pluginName, cache);
+
+    // Written after loadPluginImpl() has released m_mutex, so the file I/O doesn't block readers.
+    saveManifest();
+
+    return result;
+  }
+
+  auto PluginManager::loadPluginImpl(const String& pluginName, CacheManager& cache) -> Result<Unit> {
+
     std::unique_lock<std::shared_mutex> lock(m_mutex);
 
     if (m_plugins.contains(pluginName) && m_plugins.at(pluginName).isLoaded) {
@@ -345,6 +562,9 @@ namespace draconis::core::plugin {
     loadedPlugin.metadata = loadedPlugin.instance->getMetadata();
     loadedPlugin.isLoaded = true;
 
+    if (!m_manifest.contains(pluginName))
+      recordManifestEntry(pluginName, loadedPlugin);
+
     if (auto initResult = initializePluginInstance(loadedPlugin, cache); !initResult) {
       warn_log("Plugin '{}' failed to initialize: {}", pluginName, initResult.error().message);
       m_plugins.emplace(pluginName, std::move(loadedPlugin));
@@ -378,7 +598,13 @@ namespace draconis::core::plugin {
 
     LoadedPlugin& loadedPlugin = m_plugins.at(pluginName);
 
-    if (loadedPlugin.isReady) {
+    const bool collecting = [&] {
+      Collections& collections = GetCollections();
+      LockGuard    collectionsLock(collections.mutex);
+      return collections.counts.contains(loadedPlugin.instance.get());
+    }();
+
+    if (loadedPlugin.isReady && !collecting) {
       debug_log("Shutting down plugin instance '{}'", pluginName);
       loadedPlugin.instance->shutdown();
       loadedPlugin.isReady = false;
@@ -398,6 +624,15 @@ namespace draconis::core::plugin {
         break;
     }
 
+    // A late collection is still running plugin code, so the instance and its
+    // library have to outlive it; the process teardown reclaims both.
+    if (collecting) {
+      debug_log("Plugin '{}' is still collecting; leaving it loaded", pluginName);
+      static_cast<void>(loadedPlugin.instance.release());
+      m_plugins.erase(pluginName);
+      return {};
+    }
+
     debug_log("Destroying plugin instance '{}'", pluginName);
 
   #if DRAC_PRECOMPILED_CONFIG
@@ -426,6 +661,21 @@ namespace draconis::core::plugin {
     return {};
   }
 
+  auto PluginManager::beginCollection(const IPlugin* plugin) -> Unit {
+    Collections& collections = GetCollections();
+    LockGuard    lock(collections.mutex);
+
+    collections.counts[plugin]++;
+  }
+
+  auto PluginManager::endCollection(const IPlugin* plugin) -> Unit {
+    Collections& collections = GetCollections();
+    LockGuard    lock(collections.mutex);
+
+    if (const auto iter = collections.counts.find(plugin); iter != collections.counts.end() && --iter->second == 0)
+      collections.counts.erase(iter);
+  }
+
   auto PluginManager::getPlugin(const String& pluginName) const -> Option<IPlugin*> {
     std::shared_lock<std::shared_mutex> lock(m_mutex);
     if (m_plugins.contains(pluginName))
@@ -484,7 +734,18 @@ namespace draconis::core::plugin {
     return m_plugins.contains(pluginName) && m_plugins.at(pluginName).isLoaded;
   }
 
+  auto PluginManager::getManifestEntry(const String& pluginName) const -> Option<PluginManifestEntry> {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    if (const auto iter = m_manifest.find(pluginName); iter != m_manifest.end())
+      return iter->second;
+
+    return None;
+  }
+
   auto PluginManager::loadDynamicLibrary(const fs::path& path) -> Result<DynamicLibraryHandle> {
+    DRAC_TRACE_SCOPE_DETAIL("plugins", "dlopen", path.string());
+
   #ifdef _WIN32
     HMODULE handle = LoadLibraryA(path.string().c_str());
     if (!handle)
@@ -560,6 +821,8 @@ namespace draconis::core::plugin {
       return {};
     }
 
+    DRAC_TRACE_SCOPE_DETAIL("plugins", "initialize", loadedPlugin.metadata.name);
+
     debug_log("Initializing plugin instance '{}'", loadedPlugin.metadata.name);
 
     // Create plugin context with paths
@@ -571,8 +834,8 @@ namespace draconis::core::plugin {
     fs::create_directories(ctx.cacheDir, errc);
     fs::create_directories(ctx.dataDir, errc);
 
-    // Create a PluginCache using the plugin's cache directory
-    PluginCache pluginCache(ctx.cacheDir);
+    // Create a PluginCache using the plugin's cache directory; writes land when it goes out of scope
+    PluginCache pluginCache(ctx.cacheDir, PluginCache::WriteMode::WriteBehind);
 
     if (auto initResult = loadedPlugin.instance->initialize(ctx, pluginCache); !initResult) {
       debug_log("Plugin '{}' initialization failed: {}", loadedPlugin.metadata.name, initResult.error().message);
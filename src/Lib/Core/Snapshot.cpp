@@ -0,0 +1,380 @@
+#include <Drac++/Core/Snapshot.hpp>
+
+#include <algorithm> // std::ranges::{any_of, find, min}
+#include <format>    // std::format
+#include <ranges>    // std::views::values
+
+#include <Drac++/Core/Collector.hpp>
+#include <Drac++/Core/System.hpp>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Logging.hpp>
+
+namespace draconis::core::system {
+  using namespace utils::types;
+  using utils::cache::CacheManager;
+  using enum utils::error::DracErrorCode;
+
+  using std::chrono::steady_clock, std::chrono::milliseconds;
+
+  namespace {
+    // Errors compare by code only; messages often embed errno text or paths
+    // that don't say anything new about the readout.
+    template <typename T>
+    auto Same(const Result<T>& lhs, const Result<T>& rhs) -> bool {
+      if (lhs.has_value() != rhs.has_value())
+        return false;
+
+      return lhs ? *lhs == *rhs : lhs.error().code == rhs.error().code;
+    }
+
+    template <typename T>
+    auto Assign(Result<T>& dest, Result<T> value) -> bool {
+      const bool changed = !Same(dest, value);
+      dest               = std::move(value);
+      return changed;
+    }
+
+    auto GetBattery([[maybe_unused]] CacheManager& cache) -> Result<Battery> {
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+      return GetBatteryInfo(cache);
+#else
+      ERR(NotSupported, "Battery information is not available on this platform");
+#endif
+    }
+
+    auto GetGpuList([[maybe_unused]] CacheManager& cache) -> Result<Vec<GPUInfo>> {
+#ifdef __linux__
+      return GetGPUs(cache);
+#else
+      ERR(NotSupported, "GPU enumeration is not available on this platform");
+#endif
+    }
+
+    auto GetDiskList([[maybe_unused]] CacheManager& cache) -> Result<Vec<DiskInfo>> {
+#if defined(__linux__) || defined(_WIN32)
+      return GetDisks(cache);
+#else
+      ERR(NotSupported, "Disk enumeration is not available on this platform");
+#endif
+    }
+
+    // Re-collects one field group into `snapshot`; returns whether anything in it changed.
+    auto Collect(
+      const SnapshotField                    field,
+      SystemSnapshot&                        snapshot,
+      CacheManager&                          cache,
+      [[maybe_unused]] const SnapshotOptions& options,
+      CPUUsageSampler&                       cpuUsage
+    ) -> bool {
+      using enum SnapshotField;
+
+      switch (field) {
+        case OperatingSystem: return Assign(snapshot.operatingSystem, GetOperatingSystem(cache));
+        case Kernel:          return Assign(snapshot.kernelVersion, GetKernelVersion(cache));
+        case Host:            return Assign(snapshot.host, GetHost(cache));
+        case Shell:           return Assign(snapshot.shell, GetShell(cache));
+        case DesktopEnv:      return Assign(snapshot.desktopEnv, GetDesktopEnvironment(cache));
+        case WindowMgr:       return Assign(snapshot.windowMgr, GetWindowManager(cache));
+        case CPUModel:        return Assign(snapshot.cpuModel, GetCPUModel(cache));
+        case CPUCores:        return Assign(snapshot.cpuCores, GetCPUCores(cache));
+        case CPUUsage:        return Assign(snapshot.cpuUsage, cpuUsage.sample());
+        case GPUModel:        return Assign(snapshot.gpuModel, GetGPUModel(cache));
+        case GPUs:            return Assign(snapshot.gpus, GetGpuList(cache));
+        case Memory:          return Assign(snapshot.memInfo, GetMemInfo(cache));
+        case Uptime:          return Assign(snapshot.uptime, GetUptime());
+        case Battery:         return Assign(snapshot.battery, GetBattery(cache));
+
+        case DiskUsage: {
+          const bool usage = Assign(snapshot.diskUsage, GetDiskUsage(cache));
+          const bool disks = Assign(snapshot.disks, GetDiskList(cache));
+          return usage || disks;
+        }
+
+        case Network: {
+          const bool interfaces = Assign(snapshot.networkInterfaces, GetNetworkInterfaces(cache));
+          const bool primary    = Assign(snapshot.primaryNetworkInterface, GetPrimaryNetworkInterface(cache));
+          return interfaces || primary;
+        }
+
+        case Outputs: {
+          const bool outputs = Assign(snapshot.outputs, GetOutputs(cache));
+          const bool primary = Assign(snapshot.primaryOutput, GetPrimaryOutput(cache));
+          return outputs || primary;
+        }
+
+        case Packages:
+#if DRAC_ENABLE_PACKAGECOUNT
+          return Assign(snapshot.packageCounts, services::packages::GetIndividualCounts(cache, options.packageManagers));
+#else
+          return false;
+#endif
+      }
+
+      return false;
+    }
+
+    // Calls `func(name, snapshotMember, deltaMember)` for every readout SystemSnapshot and SnapshotDelta share.
+    template <typename Func>
+    constexpr auto ForEachMember(Func&& func) -> Unit {
+      func("operatingSystem", &SystemSnapshot::operatingSystem, &SnapshotDelta::operatingSystem);
+      func("kernelVersion", &SystemSnapshot::kernelVersion, &SnapshotDelta::kernelVersion);
+      func("host", &SystemSnapshot::host, &SnapshotDelta::host);
+      func("shell", &SystemSnapshot::shell, &SnapshotDelta::shell);
+      func("desktopEnv", &SystemSnapshot::desktopEnv, &SnapshotDelta::desktopEnv);
+      func("windowMgr", &SystemSnapshot::windowMgr, &SnapshotDelta::windowMgr);
+      func("cpuModel", &SystemSnapshot::cpuModel, &SnapshotDelta::cpuModel);
+      func("cpuCores", &SystemSnapshot::cpuCores, &SnapshotDelta::cpuCores);
+      func("cpuUsage", &SystemSnapshot::cpuUsage, &SnapshotDelta::cpuUsage);
+      func("gpuModel", &SystemSnapshot::gpuModel, &SnapshotDelta::gpuModel);
+      func("gpus", &SystemSnapshot::gpus, &SnapshotDelta::gpus);
+      func("memInfo", &SystemSnapshot::memInfo, &SnapshotDelta::memInfo);
+      func("diskUsage", &SystemSnapshot::diskUsage, &SnapshotDelta::diskUsage);
+      func("disks", &SystemSnapshot::disks, &SnapshotDelta::disks);
+      func("uptime", &SystemSnapshot::uptime, &SnapshotDelta::uptime);
+      func("battery", &SystemSnapshot::battery, &SnapshotDelta::battery);
+      func("networkInterfaces", &SystemSnapshot::networkInterfaces, &SnapshotDelta::networkInterfaces);
+      func("primaryNetworkInterface", &SystemSnapshot::primaryNetworkInterface, &SnapshotDelta::primaryNetworkInterface);
+      func("outputs", &SystemSnapshot::outputs, &SnapshotDelta::outputs);
+      func("primaryOutput", &SystemSnapshot::primaryOutput, &SnapshotDelta::primaryOutput);
+#if DRAC_ENABLE_PACKAGECOUNT
+      func("packageCounts", &SystemSnapshot::packageCounts, &SnapshotDelta::packageCounts);
+#endif
+    }
+
+    // With no `previous`, every member counts as changed.
+    auto MakeDelta(const SystemSnapshot* previous, const SystemSnapshot& next) -> SnapshotDelta {
+      SnapshotDelta delta;
+
+      if (previous)
+        delta.baseVersion = previous->version;
+
+      delta.version     = next.version;
+      delta.collectedAt = next.collectedAt;
+
+      ForEachMember([&](const StringView name, const auto snapshotMember, const auto deltaMember) {
+        const auto& value = next.*snapshotMember;
+
+        if (previous && Same(previous->*snapshotMember, value))
+          return;
+
+        if (value)
+          delta.*deltaMember = *value;
+        else
+          delta.errors.push_back({ .member = String(name), .code = value.error().code, .message = value.error().message });
+      });
+
+      return delta;
+    }
+
+    constexpr auto ALL_FIELDS = [] {
+      Array<SnapshotField, SNAPSHOT_FIELD_COUNT> fields {};
+
+      for (usize i = 0; i < SNAPSHOT_FIELD_COUNT; ++i)
+        fields[i] = static_cast<SnapshotField>(i);
+
+      return fields;
+    }();
+  } // namespace
+
+  auto Diff(const SystemSnapshot& previous, const SystemSnapshot& next) -> SnapshotDelta {
+    return MakeDelta(&previous, next);
+  }
+
+  auto Diff(const SystemSnapshot& snapshot) -> SnapshotDelta {
+    return MakeDelta(nullptr, snapshot);
+  }
+
+  auto Apply(SystemSnapshot& target, const SnapshotDelta& delta) -> Result<> {
+    if (delta.baseVersion && *delta.baseVersion != target.version)
+      ERR_FMT(InvalidArgument, "Delta applies on top of version {}, but the snapshot is at version {}", *delta.baseVersion, target.version);
+
+    ForEachMember([&](const StringView name, const auto snapshotMember, const auto deltaMember) {
+      if (const auto& value = delta.*deltaMember) {
+        target.*snapshotMember = *value;
+        return;
+      }
+
+      const auto error = std::ranges::find(delta.errors, name, &SnapshotError::member);
+
+      if (error != delta.errors.end())
+        target.*snapshotMember = Err(utils::error::DracError(error->code, error->message));
+    });
+
+    target.version     = delta.version;
+    target.collectedAt = delta.collectedAt;
+
+    return {};
+  }
+
+  auto WriteSnapshotDelta(const SnapshotDelta& delta, String& out) -> Result<> {
+    if (const glz::error_ctx errc = glz::write_beve(delta, out); errc)
+      ERR_FMT(InternalError, "Failed to encode snapshot delta: {}", glz::format_error(errc, out));
+
+    return {};
+  }
+
+  auto ReadSnapshotDelta(const StringView data) -> Result<SnapshotDelta> {
+    SnapshotDelta delta;
+
+    if (const glz::error_ctx errc = glz::read_beve(delta, data); errc)
+      ERR_FMT(ParseError, "Failed to decode snapshot delta: {}", glz::format_error(errc, data));
+
+    return delta;
+  }
+
+  SnapshotService::SnapshotService(CacheManager& cache, SnapshotOptions options)
+    : m_cache(cache), m_options(options), m_snapshot(std::make_shared<const SystemSnapshot>()) {
+    refresh(ALL_FIELDS);
+  }
+
+  SnapshotService::~SnapshotService() {
+    stop();
+  }
+
+  auto SnapshotService::current() const -> SharedPointer<const SystemSnapshot> {
+    const LockGuard lock(m_snapshotMutex);
+    return m_snapshot;
+  }
+
+  auto SnapshotService::refresh(const std::span<const SnapshotField> fields) -> SharedPointer<const SystemSnapshot> {
+    const LockGuard refreshLock(m_refreshMutex);
+
+    // Only this function replaces m_snapshot, so the copy can't go stale while we collect.
+    const SharedPointer<const SystemSnapshot> previous = current();
+
+    SystemSnapshot next = *previous;
+
+    Array<bool, SNAPSHOT_FIELD_COUNT> changed {};
+
+    if (fields.size() == 1)
+      changed[0] = Collect(fields[0], next, m_cache, m_options, m_cpuUsage);
+    else {
+      // Each task writes its own field group and flag, so they can run side by side.
+      collector::Collector collector;
+
+      for (usize i = 0; i < fields.size() && i < SNAPSHOT_FIELD_COUNT; ++i)
+        collector.add(std::format("snapshot_{}", static_cast<u8>(fields[i])), [this, &next, &changed, field = fields[i], i] {
+          changed[i] = Collect(field, next, m_cache, m_options, m_cpuUsage);
+        });
+
+      collector.run();
+    }
+
+    if (!std::ranges::any_of(changed, [](const bool value) { return value; }))
+      return current();
+
+    next.version++;
+    next.collectedAt = steady_clock::now();
+
+    auto published = std::make_shared<const SystemSnapshot>(std::move(next));
+
+    {
+      const LockGuard lock(m_snapshotMutex);
+      m_snapshot = published;
+    }
+
+    // Listeners run without m_listenerMutex held, so one can unsubscribe itself once it has seen the snapshot it waited for.
+    Vec<Listener> listeners;
+
+    {
+      const LockGuard lock(m_listenerMutex);
+
+      listeners.reserve(m_listeners.size());
+
+      for (const Listener& listener : m_listeners | std::views::values)
+        listeners.push_back(listener);
+    }
+
+    for (const Listener& listener : listeners)
+      listener(*previous, published);
+
+    return published;
+  }
+
+  auto SnapshotService::subscribe(Listener listener) -> u64 {
+    const LockGuard lock(m_listenerMutex);
+
+    const u64 id = m_nextListenerId++;
+    m_listeners.emplace(id, std::move(listener));
+
+    return id;
+  }
+
+  auto SnapshotService::unsubscribe(const u64 id) -> Unit {
+    const LockGuard lock(m_listenerMutex);
+    m_listeners.erase(id);
+  }
+
+  auto SnapshotService::start() -> Unit {
+    const LockGuard lock(m_controlMutex);
+
+    if (m_worker.joinable() || std::ranges::all_of(m_options.intervals, [](const milliseconds interval) { return interval <= milliseconds::zero(); }))
+      return;
+
+    m_stopping = false;
+    m_worker   = std::thread([this] { run(); });
+  }
+
+  auto SnapshotService::stop() -> Unit {
+    {
+      const LockGuard lock(m_controlMutex);
+
+      if (!m_worker.joinable())
+        return;
+
+      m_stopping = true;
+    }
+
+    m_wake.notify_all();
+    m_worker.join();
+  }
+
+  auto SnapshotService::run() -> Unit {
+    const steady_clock::time_point startedAt = steady_clock::now();
+
+    Array<steady_clock::time_point, SNAPSHOT_FIELD_COUNT> due {};
+
+    for (usize i = 0; i < SNAPSHOT_FIELD_COUNT; ++i)
+      due[i] = m_options.intervals[i] > milliseconds::zero() ? startedAt + m_options.intervals[i] : steady_clock::time_point::max();
+
+    Vec<SnapshotField> dueFields;
+    dueFields.reserve(SNAPSHOT_FIELD_COUNT);
+
+    std::unique_lock lock(m_controlMutex);
+
+    while (!m_stopping) {
+      const steady_clock::time_point nextDue = std::ranges::min(due);
+
+      if (m_wake.wait_until(lock, nextDue, [this] { return m_stopping; }))
+        break;
+
+      const steady_clock::time_point now = steady_clock::now();
+
+      dueFields.clear();
+
+      for (usize i = 0; i < SNAPSHOT_FIELD_COUNT; ++i)
+        if (due[i] <= now) {
+          dueFields.push_back(static_cast<SnapshotField>(i));
+
+          // Schedule from now rather than from the missed deadline, so a slow
+          // readout can't make the loop spin catching up.
+          due[i] = now + m_options.intervals[i];
+        }
+
+      if (dueFields.empty())
+        continue;
+
+      // Collect without holding the control lock, so stop() can signal us meanwhile.
+      lock.unlock();
+
+      try {
+        refresh(dueFields);
+      } catch (const Exception& e) {
+        error_log("Snapshot refresh failed: {}", e.what());
+      }
+
+      lock.lock();
+    }
+  }
+} // namespace draconis::core::system
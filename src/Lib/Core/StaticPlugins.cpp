@@ -5,41 +5,60 @@
  * @version 1.0.0
  *
  * @details This file provides the static plugin registry infrastructure.
- * Plugins self-register at static initialization time using the DRAC_PLUGIN macro.
- * No hardcoded plugin data is needed here - the registry is populated automatically
- * when plugin object files are linked into the binary.
+ * The plugin list comes from StaticPluginTable.hpp, which meson generates from
+ * the static_plugins option; it is sorted here at compile time so lookups can
+ * binary search it. No hardcoded plugin data is needed here.
  */
 
 #include <Drac++/Core/StaticPlugins.hpp>
 
 #if DRAC_ENABLE_PLUGINS && DRAC_PRECOMPILED_CONFIG
 
+  #include <algorithm> // std::ranges::sort, std::ranges::lower_bound, std::ranges::adjacent_find
+
+  #include "StaticPluginTable.hpp"
+
 namespace draconis::core::plugin {
   using namespace utils::types;
 
-  auto GetStaticPluginRegistry() -> UnorderedMap<String, StaticPluginEntry>& {
-    static UnorderedMap<String, StaticPluginEntry> Registry;
-    return Registry;
+  namespace {
+    constexpr auto STATIC_PLUGINS = [] {
+      auto table = generated::STATIC_PLUGINS;
+      std::ranges::sort(table, {}, &StaticPluginEntry::name);
+      return table;
+    }();
+
+    static_assert(
+      std::ranges::adjacent_find(STATIC_PLUGINS, {}, &StaticPluginEntry::name) == STATIC_PLUGINS.end(),
+      "static_plugins lists the same plugin twice"
+    );
+
+    constexpr auto FindStaticPlugin(const StringView name) -> const StaticPluginEntry* {
+      const auto iter = std::ranges::lower_bound(STATIC_PLUGINS, name, {}, &StaticPluginEntry::name);
+      return iter != STATIC_PLUGINS.end() && iter->name == name ? &*iter : nullptr;
+    }
+  } // namespace
+
+  auto GetStaticPlugins() -> Span<const StaticPluginEntry> {
+    return STATIC_PLUGINS;
   }
 
-  auto IsStaticPlugin(const String& name) -> bool {
-    return GetStaticPluginRegistry().contains(name);
+  auto IsStaticPlugin(const StringView name) -> bool {
+    return FindStaticPlugin(name) != nullptr;
   }
 
-  auto CreateStaticPlugin(const String& name) -> IPlugin* {
-    const auto& registry = GetStaticPluginRegistry();
-    if (auto iter = registry.find(name); iter != registry.end())
-      return iter->second.createFunc();
+  auto CreateStaticPlugin(const StringView name) -> IPlugin* {
+    if (const StaticPluginEntry* entry = FindStaticPlugin(name))
+      return entry->createFunc();
     return nullptr;
   }
 
-  auto DestroyStaticPlugin(const String& name, IPlugin* plugin) -> void {
+  auto DestroyStaticPlugin(const StringView name, IPlugin* plugin) -> void {
     if (!plugin)
       return;
 
-    const auto& registry = GetStaticPluginRegistry();
-    if (auto iter = registry.find(name); iter != registry.end())
-      iter->second.destroyFunc(plugin);
+    if (const StaticPluginEntry* entry = FindStaticPlugin(name))
+      entry->destroyFunc(plugin);
   }
 } // namespace draconis::core::plugin
 
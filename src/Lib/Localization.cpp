@@ -5,18 +5,14 @@
 
 namespace draconis::utils::localization {
   namespace {
-    // Helper function to find translation by hash (much faster than linear search)
-    auto FindTranslation(u64 keyHash, const data::TranslationMap<19>& map) -> StringView {
-      return map.find(keyHash);
-    }
-
-    // Fallback helper function using linear search (only when hash fails)
-    auto FindTranslationLinear(StringView key, const Array<data::TranslationEntry, 19>& translations) -> String {
-      for (const auto& entry : translations)
+    // Value for an English key in another table, matched by key rather than position so
+    // tables don't have to list keys in the same order. Empty if the table lacks it.
+    auto FindValue(const StringView key, const Array<data::TranslationEntry, data::TRANSLATION_COUNT>& translations) -> StringView {
+      for (const data::TranslationEntry& entry : translations)
         if (entry.key == key)
-          return String(entry.value);
+          return entry.value;
 
-      return String(key); // Return key if not found
+      return {};
     }
 
     // Helper function to find language info by code
@@ -30,10 +26,10 @@ namespace draconis::utils::localization {
   } // namespace
 
   TranslationManager::TranslationManager()
-    : m_currentLanguage(DRAC_DEFAULT_LANGUAGE),
-      m_englishTranslations(&data::ENGLISH_TRANSLATIONS),
-      m_currentTranslations(&data::ENGLISH_TRANSLATIONS),
-      m_currentMap(&data::ENGLISH_MAP) {
+    : m_currentLanguage("en") {
+    // Start from English so setLanguage() below really loads the default language
+    loadTranslations("en");
+
     // Try to load default language first, then system language, then fallback to English
     bool languageSet = false;
 
@@ -52,16 +48,12 @@ namespace draconis::utils::localization {
   }
 
   TranslationManager::TranslationManager(StringView languageCode)
-    : m_currentLanguage(languageCode),
-      m_englishTranslations(&data::ENGLISH_TRANSLATIONS),
-      m_currentTranslations(&data::ENGLISH_TRANSLATIONS),
-      m_currentMap(&data::ENGLISH_MAP) {
-    // Load English fallback first
-    loadTranslations("en");
-
-    // Load requested language
-    if (!loadTranslations(languageCode))
+    : m_currentLanguage(languageCode) {
+    // Load requested language, staying on English if it isn't available
+    if (!loadTranslations(languageCode)) {
       m_currentLanguage = "en";
+      loadTranslations("en");
+    }
   }
 
   auto TranslationManager::setLanguage(StringView languageCode) -> bool {
@@ -84,56 +76,20 @@ namespace draconis::utils::localization {
     return m_currentLanguage;
   }
 
-  auto TranslationManager::get(StringView key) const -> String {
-    // Use hash-based lookup for O(1) performance (much faster than linear search)
-    if (m_currentMap) {
-      uint64_t         keyHash = hashKey(key);
-      std::string_view result  = FindTranslation(keyHash, *m_currentMap);
-      if (!result.empty()) { // Found translation
-        debug_log("Translation found for key '{}' in current language: '{}'", key, String(result));
-        return String(result);
-      }
-    }
-
-    // Fallback to linear search if hash lookup fails (should rarely happen)
-    if (m_currentTranslations) {
-      String result = FindTranslationLinear(key, *m_currentTranslations);
-      if (result != String(key)) { // Found translation
-        debug_log("Translation found (linear) for key '{}' in current language: '{}'", key, result);
-        return result;
-      }
-    }
+  auto TranslationManager::get(StringView key) const -> StringView {
+    if (const Option<usize> index = data::FindKeyIndex(key))
+      return m_labels[*index];
 
-    debug_log("Translation NOT found for key '{}' in current language, returning key as-is", key);
-    return String(key); // Return key if not found
+    return key; // Return key if not found
   }
 
-  auto TranslationManager::getWithFallback(StringView key) const -> String {
-    // get() already handles current language, so just return that
-    String result = get(key);
-    if (result != String(key)) {
-      return result;
-    }
-
-    debug_log("Translation NOT found for key '{}' anywhere, returning key as-is", key);
-    return String(key); // Return key if not found anywhere
+  auto TranslationManager::getWithFallback(StringView key) const -> StringView {
+    // Resolved labels already fall back to English
+    return get(key);
   }
 
   auto TranslationManager::hasKey(StringView key) const -> bool {
-    // Use hash-based lookup for O(1) performance
-    if (m_currentMap) {
-      uint64_t         keyHash = hashKey(key);
-      std::string_view result  = FindTranslation(keyHash, *m_currentMap);
-      return !result.empty();
-    }
-
-    // Fallback to linear search
-    if (m_currentTranslations) {
-      String result = FindTranslationLinear(key, *m_currentTranslations);
-      return result != String(key);
-    }
-
-    return false;
+    return data::FindKeyIndex(key).has_value();
   }
 
   auto TranslationManager::getAvailableLanguages() -> Vec<Language> {
@@ -184,15 +140,11 @@ namespace draconis::utils::localization {
 
     debug_log("Loading translations for language: {}", languageCode);
 
-    if (languageCode == "en") {
-      m_englishTranslations = &data::ENGLISH_TRANSLATIONS;
-      m_currentTranslations = &data::ENGLISH_TRANSLATIONS; // For English, both point to the same
-      m_currentMap          = &data::ENGLISH_MAP;
-      debug_log("Loaded English translations");
-    } else {
-      m_currentTranslations = langInfo->translations;
-      m_currentMap          = langInfo->map;
-      debug_log("Loaded {} translations for language '{}'", langInfo->translations->size(), languageCode);
+    for (usize i = 0; i < data::TRANSLATION_COUNT; ++i) {
+      const data::TranslationEntry& english = data::ENGLISH_TRANSLATIONS[i];
+      const StringView              value   = FindValue(english.key, *langInfo->translations);
+
+      m_labels[i] = value.empty() ? english.value : value;
     }
 
     return true;
@@ -28,7 +28,7 @@
 
 using namespace draconis::utils::types;
 using draconis::utils::cache::CacheManager;
-using draconis::utils::env::GetEnv;
+using draconis::utils::env::GetEnvSnapshot;
 using draconis::utils::error::DracError;
 using enum draconis::utils::error::DracErrorCode;
 
@@ -259,7 +259,9 @@ namespace draconis::core::system {
 
   auto GetWindowManager(CacheManager& cache) -> Result<String> {
     return cache.getOrSet<String>("bsd_wm", []() -> Result<String> {
-      if (!GetEnv("DISPLAY") && !GetEnv("WAYLAND_DISPLAY") && !GetEnv("XDG_SESSION_TYPE"))
+      const draconis::utils::env::EnvSnapshot& env = GetEnvSnapshot();
+
+      if (!env.display && !env.waylandDisplay && !env.xdgSessionType)
         return Err(DracError(DracErrorCode::NotFound, "Could not find a graphical session"));
 
       if (Result<String> waylandResult = GetWaylandCompositor())
@@ -274,17 +276,19 @@ namespace draconis::core::system {
 
   auto GetDesktopEnvironment(CacheManager& cache) -> Result<String> {
     return cache.getOrSet<String>("bsd_desktop_environment", []() -> Result<String> {
-      if (!GetEnv("DISPLAY") && !GetEnv("WAYLAND_DISPLAY") && !GetEnv("XDG_SESSION_TYPE"))
+      const draconis::utils::env::EnvSnapshot& env = GetEnvSnapshot();
+
+      if (!env.display && !env.waylandDisplay && !env.xdgSessionType)
         return Err(DracError(DracErrorCode::NotFound, "Could not find a graphical session"));
 
-      return GetEnv("XDG_CURRENT_DESKTOP")
+      return draconis::utils::env::ToResult(env.xdgCurrentDesktop)
         .transform([](String xdgDesktop) -> String {
           if (const usize colon = xdgDesktop.find(':'); colon != String::npos)
             xdgDesktop.resize(colon);
 
           return xdgDesktop;
         })
-        .or_else([](const DracError&) -> Result<String> { return GetEnv("DESKTOP_SESSION"); })
+        .or_else([&env](const DracError&) -> Result<String> { return draconis::utils::env::ToResult(env.desktopSession); })
         .transform([](String desktopSession) -> String {
           if (const usize colon = desktopSession.find(':'); colon != String::npos)
             desktopSession.resize(colon);
@@ -297,7 +301,7 @@ namespace draconis::core::system {
 
   auto GetShell(CacheManager& cache) -> Result<String> {
     return cache.getOrSet<String>("bsd_shell", []() -> Result<String> {
-      if (const Result<String> shellPath = GetEnv("SHELL")) {
+      if (const Result<String> shellPath = draconis::utils::env::ToResult(GetEnvSnapshot().shell)) {
         // clang-format off
             constexpr Array<Pair<StringView, StringView>, 5> shellMap {{
                 { "bash",    "Bash" },
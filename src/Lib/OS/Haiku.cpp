@@ -26,7 +26,7 @@
 
 using namespace draconis::utils::types;
 using draconis::utils::cache::CacheManager;
-using draconis::utils::env::GetEnv;
+using draconis::utils::env::GetEnvSnapshot;
 using draconis::utils::error::DracError;
 using enum draconis::utils::error::DracErrorCode;
 
@@ -87,7 +87,7 @@ namespace draconis::core::system {
 
   auto GetShell(CacheManager& cache) -> Result<String> {
     return cache.getOrSet<String>("haiku_shell", []() -> Result<String> {
-      if (const Result<String> shellPath = GetEnv("SHELL")) {
+      if (const Result<String> shellPath = draconis::utils::env::ToResult(GetEnvSnapshot().shell)) {
         // clang-format off
         constexpr Array<Pair<StringView, StringView>, 5> shellMap {{
           { "bash",    "Bash" },
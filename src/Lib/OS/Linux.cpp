@@ -3,7 +3,6 @@
   #include <algorithm>
   #include <arpa/inet.h>          // inet_ntop
   #include <chrono>               // std::chrono::minutes
-  #include <cpuid.h>              // __get_cpuid
   #include <cstring>              // std::strlen
   #include <expected>             // std::{unexpected, expected}
   #include <fcntl.h>              // open, O_RDONLY, O_CLOEXEC
@@ -21,7 +20,6 @@
   #include <netdb.h>              // getnameinfo, NI_NUMERICHOST
   #include <netinet/in.h>         // sockaddr_in
   #include <ranges>               // std::views::{common, split, values}
-  #include <sstream>              // std::istringstream
   #include <string>               // std::{getline, string (String)}
   #include <string_view>          // std::string_view (StringView)
   #include <sys/mman.h>           // mmap, munmap
@@ -31,6 +29,10 @@
   #include <unistd.h>             // readlink
   #include <utility>              // std::move
 
+  #if defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h> // __get_cpuid
+  #endif
+
   #include "Drac++/Core/System.hpp"
   #include "Drac++/Services/Packages.hpp"
 
@@ -39,9 +41,14 @@
   #include "Drac++/Utils/Env.hpp"
   #include "Drac++/Utils/Error.hpp"
   #include "Drac++/Utils/Logging.hpp"
+  #include "Drac++/Utils/Tracing.hpp"
   #include "Drac++/Utils/Types.hpp"
 
+  #include "OS/Netlink.hpp"
+  #include "OS/PciIndex.hpp"
+  #include "OS/SysFs.hpp"
   #include "OS/Unix.hpp"
+  #include "Wrappers/NVML.hpp"
   #include "Wrappers/Wayland.hpp"
   #include "Wrappers/XCB.hpp"
 
@@ -69,57 +76,31 @@ namespace {
     return None;
   }
 
-  auto ReadSysFile(const fs::path& path) -> Result<String> {
-    std::ifstream file(path);
-    if (!file.is_open())
-      ERR_FMT(NotFound, "Failed to open sysfs file: {}", path.string());
-
-    String line;
-
-    if (std::getline(file, line)) {
-      if (const usize pos = line.find_last_not_of(" \t\n\r"); pos != String::npos)
-        line.erase(pos + 1);
-
-      return line;
-    }
-
-    ERR_FMT(IoError, "Failed to read from sysfs file: {}", path.string());
-  }
-
-  auto LookupPciNamesFromBuffer(StringView buffer, const StringView vendorId, const StringView deviceId) -> Result<Pair<String, String>> {
-    using std::views::common;
-    using std::views::split;
-
-    const StringView vendorIdStr = vendorId.starts_with("0x") ? vendorId.substr(2) : vendorId;
-    const StringView deviceIdStr = deviceId.starts_with("0x") ? deviceId.substr(2) : deviceId;
+  // Resolves names through the binary PCI ID index, rebuilding it from `readSource` when
+  // `fingerprint` no longer matches. The index is kept even when caching is ignored,
+  // since it's derived data that is always validated against its source.
+  auto LookupPciNamesIndexed(
+    const StringView            vendorId,
+    const StringView            deviceId,
+    const u64                   fingerprint,
+    const Fn<Result<String>()>& readSource
+  ) -> Result<Pair<String, String>> {
+    using draconis::os::pci::Index;
 
-    bool       vendorFound       = false;
-    StringView currentVendorName = {};
+    const Option<u16> vendor = Index::parseId(vendorId);
+    const Option<u16> device = Index::parseId(deviceId);
 
-    for (auto lineRange : buffer | split('\n') | common) {
-      StringView line(&*lineRange.begin(), lineRange.size());
-
-      if (line.empty() || line.front() == '#')
-        continue;
+    if (!vendor || !device)
+      ERR_FMT(InvalidArgument, "Malformed PCI ID '{}:{}'", vendorId, deviceId);
 
-      if (line.front() != '\t') {
-        vendorFound = false;
+    const fs::path indexPath = draconis::utils::cache::CacheManager::getPersistentCacheDir() / "pci-ids.idx";
 
-        if (line.starts_with(vendorIdStr)) {
-          vendorFound = true;
-          if (const usize namePos = line.find("  "); namePos != String::npos)
-            currentVendorName = line.substr(namePos + 2);
-        }
-      } else if (vendorFound && line.size() > 1 && line[1] != '\t') {
-        const StringView deviceLine = line.substr(1); // skip leading tab
+    const Index index = TRY(Index::load(indexPath, fingerprint, readSource));
 
-        if (deviceLine.starts_with(deviceIdStr))
-          if (const usize namePos = line.find("  "); namePos != String::npos)
-            return Pair(String(currentVendorName), String(line.substr(namePos + 2)));
-      }
-    }
+    if (const Option<Pair<StringView, StringView>> names = index.lookup(*vendor, *device))
+      return Pair(String(names->first), String(names->second));
 
-    ERR_FMT(NotFound, "PCI device with vendor ID '{}' and device ID '{}' not found in PCI IDs buffer", vendorId, deviceId);
+    ERR_FMT(NotFound, "PCI device with vendor ID '{}' and device ID '{}' not found in PCI IDs index", vendorId, deviceId);
   }
 
   #if DRAC_USE_LINKED_PCI_IDS
@@ -131,7 +112,12 @@ namespace {
   auto LookupPciNames(const StringView vendorId, const StringView deviceId) -> Result<Pair<String, String>> {
     const usize pciIdsLen = _binary_pci_ids_end - _binary_pci_ids_start;
 
-    return LookupPciNamesFromBuffer(StringView(_binary_pci_ids_start, pciIdsLen), vendorId, deviceId);
+    // The embedded database only changes along with the binary, so the build identifies it.
+    const u64 fingerprint = std::hash<String> {}(std::format("{}:{}:{}", DRAC_VERSION, DRAC_GIT_HASH, pciIdsLen));
+
+    return LookupPciNamesIndexed(vendorId, deviceId, fingerprint, [pciIdsLen]() -> Result<String> {
+      return String(_binary_pci_ids_start, pciIdsLen);
+    });
   }
   #else
   auto FindPciIDsPath() -> fs::path {
@@ -154,310 +140,129 @@ namespace {
     if (pciIdsPath.empty())
       ERR(NotFound, "Could not find pci.ids");
 
-    const i32 filedesc = open(pciIdsPath.c_str(), O_RDONLY | O_CLOEXEC);
-
-    if (filedesc >= 0) {
-      struct stat statbuf {};
-
-      if (fstat(filedesc, &statbuf) == 0 && statbuf.st_size > 0) {
-        RawPointer mapped = mmap(nullptr, statbuf.st_size, PROT_READ, MAP_PRIVATE, filedesc, 0);
-
-        if (mapped != MAP_FAILED) {
-          Result<Pair<String, String>> result = LookupPciNamesFromBuffer(
-            StringView(static_cast<PCStr>(mapped), static_cast<usize>(statbuf.st_size)),
-            vendorId,
-            deviceId
-          );
-
-          munmap(mapped, statbuf.st_size);
-          close(filedesc);
-
-          return result;
-        }
-      }
-
-      close(filedesc);
-    }
-
-    std::ifstream file(pciIdsPath, std::ios::binary);
+    const u64 fingerprint = draconis::utils::cache::CacheManager::fingerprintSources({ pciIdsPath });
 
-    if (!file)
-      ERR_FMT(NotFound, "Could not open {}", pciIdsPath.string());
+    return LookupPciNamesIndexed(vendorId, deviceId, fingerprint, [&pciIdsPath]() -> Result<String> {
+      std::ifstream file(pciIdsPath, std::ios::binary);
 
-    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+      if (!file)
+        ERR_FMT(NotFound, "Could not open {}", pciIdsPath.string());
 
-    return LookupPciNamesFromBuffer(StringView(contents), vendorId, deviceId);
+      return String((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    });
   }
   #endif
 
-  constexpr auto CleanGpuModelName(String vendor, String device) -> String {
-    if (vendor.find("[AMD/ATI]") != String::npos)
-      vendor = "AMD";
-    else if (const usize pos = vendor.find(' '); pos != String::npos)
-      vendor = vendor.substr(0, pos);
-
-    if (const usize openPos = device.find('['); openPos != String::npos)
-      if (const usize closePos = device.find(']', openPos); closePos != String::npos)
-        device = device.substr(openPos + 1, closePos - openPos - 1);
-
-    constexpr auto trim = [](String& str) {
-      if (const usize pos = str.find_last_not_of(" \t\n\r"); pos != String::npos)
-        str.erase(pos + 1);
-      if (const usize pos = str.find_first_not_of(" \t\n\r"); pos != String::npos)
-        str.erase(0, pos);
-    };
+  #if DRAC_USE_XCB
+  // One session, queried in pipelined batches, serves every X11 readout. A
+  // session whose connection failed is not kept: the next readout reconnects,
+  // so an X server that was down (or restarted) is picked up again.
+  auto GetX11Session() -> SharedPointer<const xcb::Session> {
+    static Mutex                             SessionMutex;
+    static SharedPointer<const xcb::Session> Cached;
+
+    const LockGuard lock(SessionMutex);
+
+    // A missing libxcb won't appear mid-run, so that one failure is kept.
+    if (!Cached || (Cached->connectionError() != 0 && Cached->connectionError() != xcb::LibraryMissing)) {
+      DRAC_TRACE_SCOPE("system", "xcb::Session::Query");
+      Cached = std::make_shared<const xcb::Session>(xcb::Session::Query());
+    }
 
-    trim(vendor);
-    trim(device);
+    return Cached;
+  }
 
-    return std::format("{} {}", vendor, device);
+  auto GetX11ConnectionError(const xcb::Session& session) -> Option<String> {
+    using namespace matchit;
+    using enum xcb::ConnError;
+
+    const i32 err = session.connectionError();
+
+    if (err == 0)
+      return None;
+
+    return match(err)(
+      is | Generic         = String("Stream/Socket/Pipe Error"),
+      is | ExtNotSupported = String("Extension Not Supported"),
+      is | MemInsufficient = String("Insufficient Memory"),
+      is | ReqLenExceed    = String("Request Length Exceeded"),
+      is | ParseErr        = String("Display String Parse Error"),
+      is | InvalidScreen   = String("Invalid Screen"),
+      is | FdPassingFailed = String("FD Passing Failed"),
+      is | LibraryMissing  = String("Library Not Loaded"),
+      is | _               = std::format("Unknown Error Code ({})", err)
+    );
   }
 
-  #if DRAC_USE_XCB
   auto GetX11WindowManager() -> Result<String> {
-    using namespace xcb;
-    using namespace matchit;
-    using enum ConnError;
-
-    const DisplayGuard conn;
-
-    if (!conn)
-      if (const i32 err = ConnectionHasError(conn.get()))
-        ERR(
-          ApiUnavailable,
-          match(err)(
-            is | Generic         = "Stream/Socket/Pipe Error",
-            is | ExtNotSupported = "Extension Not Supported",
-            is | MemInsufficient = "Insufficient Memory",
-            is | ReqLenExceed    = "Request Length Exceeded",
-            is | ParseErr        = "Display String Parse Error",
-            is | InvalidScreen   = "Invalid Screen",
-            is | FdPassingFailed = "FD Passing Failed",
-            is | _               = std::format("Unknown Error Code ({})", err)
-          )
-        );
-
-    const auto internAtom = [&conn](const StringView name) -> Result<Atom> {
-      const ReplyGuard<IntAtomReply> reply(InternAtomReply(conn.get(), InternAtom(conn.get(), 0, static_cast<u16>(name.size()), name.data()), nullptr));
-
-      if (!reply)
-        ERR_FMT(PlatformSpecific, "Failed to get X11 atom reply for '{}'", name);
-
-      return reply->atom;
-    };
+    DRAC_TRACE_SCOPE("system", "GetX11WindowManager");
 
-    const Result<Atom> supportingWmCheckAtom = internAtom("_NET_SUPPORTING_WM_CHECK");
-    const Result<Atom> wmNameAtom            = internAtom("_NET_WM_NAME");
-    const Result<Atom> utf8StringAtom        = internAtom("UTF8_STRING");
+    const SharedPointer<const xcb::Session> session = GetX11Session();
 
-    if (!supportingWmCheckAtom || !wmNameAtom || !utf8StringAtom) {
-      if (!supportingWmCheckAtom)
-        error_log("Failed to get _NET_SUPPORTING_WM_CHECK atom");
+    if (Option<String> connErr = GetX11ConnectionError(*session))
+      ERR(ApiUnavailable, std::move(*connErr));
 
-      if (!wmNameAtom)
-        error_log("Failed to get _NET_WM_NAME atom");
+    if (!session->hasRootScreen())
+      ERR(NotFound, "Failed to get X root screen");
 
-      if (!utf8StringAtom)
-        error_log("Failed to get UTF8_STRING atom");
+    if (!session->missingAtoms().empty()) {
+      for (const PCStr atom : session->missingAtoms())
+        error_log("Failed to get {} atom", atom);
 
       ERR(PlatformSpecific, "Failed to get X11 atoms");
     }
 
-    const ReplyGuard<GetPropReply> wmWindowReply(GetPropertyReply(
-      conn.get(),
-      GetProperty(conn.get(), 0, conn.rootScreen()->root, *supportingWmCheckAtom, ATOM_WINDOW, 0, 1),
-      nullptr
-    ));
-
-    if (!wmWindowReply || wmWindowReply->type != ATOM_WINDOW || wmWindowReply->format != 32 ||
-        GetPropertyValueLength(wmWindowReply.get()) == 0)
+    if (!session->hasWmCheck())
       ERR(NotFound, "Failed to get _NET_SUPPORTING_WM_CHECK property");
 
-    const Window wmRootWindow = *static_cast<Window*>(GetPropertyValue(wmWindowReply.get()));
-
-    const ReplyGuard<GetPropReply> wmNameReply(GetPropertyReply(
-      conn.get(),
-      GetProperty(
-        conn.get(),
-        0,
-        wmRootWindow,
-        *wmNameAtom,
-        *utf8StringAtom,
-        0,
-        1024
-      ),
-      nullptr
-    ));
-
-    if (!wmNameReply || wmNameReply->type != *utf8StringAtom || GetPropertyValueLength(wmNameReply.get()) == 0)
+    if (!session->windowManager())
       ERR(NotFound, "Failed to get _NET_WM_NAME property");
 
-    const char* nameData = static_cast<const char*>(GetPropertyValue(wmNameReply.get()));
-    const usize length   = GetPropertyValueLength(wmNameReply.get());
-
-    return String(nameData, length);
+    return *session->windowManager();
   }
 
   auto GetX11Displays() -> Result<Vec<DisplayInfo>> {
-    using namespace xcb;
+    const SharedPointer<const xcb::Session> session = GetX11Session();
 
-    DisplayGuard conn;
-    if (!conn)
+    if (session->connectionError() != 0)
       ERR(ApiUnavailable, "Failed to connect to X server");
 
-    const Setup* setup = conn.setup();
-    if (!setup)
-      ERR(ApiUnavailable, "Failed to get X server setup");
-
-    const ReplyGuard<QueryExtensionReply> randrQueryReply(
-      GetQueryExtensionReply(conn.get(), QueryExtension(conn.get(), std::strlen("RANDR"), "RANDR"), nullptr)
-    );
-
-    if (!randrQueryReply || !randrQueryReply->present)
-      ERR(NotSupported, "X server does not support RANDR extension");
-
-    Screen* screen = conn.rootScreen();
-    if (!screen)
+    if (!session->hasRootScreen())
       ERR(NotFound, "Failed to get X root screen");
 
-    const ReplyGuard<RandrGetScreenResourcesCurrentReply> screenResourcesReply(
-      GetScreenResourcesCurrentReply(
-        conn.get(), GetScreenResourcesCurrent(conn.get(), screen->root), nullptr
-      )
-    );
+    if (!session->hasRandr())
+      ERR(NotSupported, "X server does not support RANDR extension");
 
-    if (!screenResourcesReply)
+    if (!session->hasScreenResources())
       ERR(ApiUnavailable, "Failed to get screen resources");
 
-    RandrOutput* outputs     = GetScreenResourcesCurrentOutputs(screenResourcesReply.get());
-    const i32    outputCount = GetScreenResourcesCurrentOutputsLength(screenResourcesReply.get());
-
-    if (outputCount == 0)
-      return {};
-
-    Vec<DisplayInfo> displays;
-    i32              primaryIndex = -1;
-
-    const ReplyGuard<RandrGetOutputPrimaryReply> primaryOutputReply(
-      GetOutputPrimaryReply(conn.get(), GetOutputPrimary(conn.get(), screen->root), nullptr)
-    );
-    const RandrOutput primaryOutput = primaryOutputReply ? primaryOutputReply->output : NONE;
-
-    for (i32 i = 0; i < outputCount; ++i) {
-      const ReplyGuard<RandrGetOutputInfoReply> outputInfoReply(
-        GetOutputInfoReply(conn.get(), GetOutputInfo(conn.get(), *std::next(outputs, i), CURRENT_TIME), nullptr)
-      );
-
-      if (!outputInfoReply || outputInfoReply->crtc == NONE)
-        continue;
-
-      const ReplyGuard<RandrGetCrtcInfoReply> crtcInfoReply(
-        GetCrtcInfoReply(conn.get(), GetCrtcInfo(conn.get(), outputInfoReply->crtc, CURRENT_TIME), nullptr)
-      );
-
-      if (!crtcInfoReply)
-        continue;
-
-      f64 refreshRate = 0;
-
-      if (crtcInfoReply->mode != NONE) {
-        RandrModeInfo* modeInfo = nullptr;
-        for (RandrModeInfoIterator modesIter = GetScreenResourcesCurrentModesIterator(screenResourcesReply.get()); modesIter.rem; ModeInfoNext(&modesIter))
-          if (modesIter.data->id == crtcInfoReply->mode) {
-            modeInfo = modesIter.data;
-            break;
-          }
-
-        if (modeInfo && modeInfo->htotal > 0 && modeInfo->vtotal > 0)
-          refreshRate = static_cast<f64>(modeInfo->dot_clock) / (static_cast<f64>(modeInfo->htotal) * static_cast<f64>(modeInfo->vtotal));
-      }
-
-      bool isPrimary = (*std::next(outputs, i) == primaryOutput);
-      if (isPrimary)
-        primaryIndex = static_cast<int>(displays.size());
-
-      displays.emplace_back(
-        *std::next(outputs, i),
-        DisplayInfo::Resolution { .width = crtcInfoReply->width, .height = crtcInfoReply->height },
-        refreshRate,
-        isPrimary
-      );
-    }
+    Vec<DisplayInfo> displays = session->outputs();
 
     // If no display was marked as primary, set the first one as primary
-    if (primaryIndex == -1 && !displays.empty())
-      displays[0].isPrimary = true;
-    else if (primaryIndex > 0)
-      // Ensure only one display is marked as primary
-      for (i32 i = 0; i < static_cast<i32>(displays.size()); ++i)
-        if (i != primaryIndex)
-          displays[i].isPrimary = false;
+    if (!displays.empty() && std::ranges::none_of(displays, &DisplayInfo::isPrimary))
+      displays.front().isPrimary = true;
 
     return displays;
   }
 
   auto GetX11PrimaryDisplay() -> Result<DisplayInfo> {
-    using namespace xcb;
+    const SharedPointer<const xcb::Session> session = GetX11Session();
 
-    DisplayGuard conn;
-    if (!conn)
+    if (session->connectionError() != 0)
       ERR(ApiUnavailable, "Failed to connect to X server");
 
-    Screen* screen = conn.rootScreen();
-    if (!screen)
+    if (!session->hasRootScreen())
       ERR(NotFound, "Failed to get X root screen");
 
-    const ReplyGuard<RandrGetOutputPrimaryReply> primaryOutputReply(
-      GetOutputPrimaryReply(conn.get(), GetOutputPrimary(conn.get(), screen->root), nullptr)
-    );
-
-    const RandrOutput primaryOutput = primaryOutputReply ? primaryOutputReply->output : NONE;
-
-    if (primaryOutput == NONE)
+    if (session->primaryOutput() == xcb::NONE)
       ERR(NotFound, "No primary output found");
 
-    const ReplyGuard<RandrGetOutputInfoReply> outputInfoReply(
-      GetOutputInfoReply(conn.get(), GetOutputInfo(conn.get(), primaryOutput, CURRENT_TIME), nullptr)
-    );
+    const auto primary = std::ranges::find_if(session->outputs(), &DisplayInfo::isPrimary);
 
-    if (!outputInfoReply || outputInfoReply->crtc == NONE)
+    if (primary == session->outputs().end())
       ERR(NotFound, "Failed to get output info for primary display");
 
-    const ReplyGuard<RandrGetCrtcInfoReply> crtcInfoReply(
-      GetCrtcInfoReply(conn.get(), GetCrtcInfo(conn.get(), outputInfoReply->crtc, CURRENT_TIME), nullptr)
-    );
-
-    if (!crtcInfoReply)
-      ERR(NotFound, "Failed to get CRTC info for primary display");
-
-    f64 refreshRate = 0;
-    if (crtcInfoReply->mode != NONE) {
-      const ReplyGuard<RandrGetScreenResourcesCurrentReply> screenResourcesReply(
-        GetScreenResourcesCurrentReply(
-          conn.get(), GetScreenResourcesCurrent(conn.get(), screen->root), nullptr
-        )
-      );
-
-      if (screenResourcesReply) {
-        RandrModeInfo*        modeInfo  = nullptr;
-        RandrModeInfoIterator modesIter = GetScreenResourcesCurrentModesIterator(screenResourcesReply.get());
-        for (; modesIter.rem; ModeInfoNext(&modesIter)) {
-          if (modesIter.data->id == crtcInfoReply->mode) {
-            modeInfo = modesIter.data;
-            break;
-          }
-        }
-        if (modeInfo && modeInfo->htotal > 0 && modeInfo->vtotal > 0)
-          refreshRate = static_cast<f64>(modeInfo->dot_clock) / (static_cast<f64>(modeInfo->htotal) * static_cast<f64>(modeInfo->vtotal));
-      }
-    }
-
-    return DisplayInfo(
-      primaryOutput,
-      DisplayInfo::Resolution { .width = crtcInfoReply->width, .height = crtcInfoReply->height },
-      refreshRate,
-      true
-    );
+    return *primary;
   }
   #else
   auto GetX11WindowManager() -> Result<String> {
@@ -474,25 +279,42 @@ namespace {
   #endif
 
   #if DRAC_USE_WAYLAND
+  // One session serves every Wayland readout. If the compositor couldn't be
+  // reached or the connection broke mid-query, the next readout reconnects.
+  auto GetWaylandSession() -> SharedPointer<const wl::Session> {
+    static Mutex                            SessionMutex;
+    static SharedPointer<const wl::Session> Cached;
+
+    const LockGuard lock(SessionMutex);
+
+    if (!Cached || Cached->connectionError() != 0) {
+      DRAC_TRACE_SCOPE("system", "wl::Session::Query");
+
+      if (Option<wl::Session> session = wl::Session::Query())
+        Cached = std::make_shared<const wl::Session>(std::move(*session));
+      else
+        Cached = nullptr;
+    }
+
+    return Cached;
+  }
+
   auto GetWaylandCompositor() -> Result<String> {
-    const wl::DisplayGuard display;
+    DRAC_TRACE_SCOPE("system", "GetWaylandCompositor");
 
-    if (!display)
-      ERR(ApiUnavailable, "Failed to connect to display (is Wayland running?)");
+    const SharedPointer<const wl::Session> session = GetWaylandSession();
 
-    const i32 fileDescriptor = display.fd();
-    if (fileDescriptor < 0)
-      ERR(ApiUnavailable, "Failed to get Wayland file descriptor");
+    if (!session)
+      ERR(ApiUnavailable, "Failed to connect to display (is Wayland running?)");
 
-    ucred     cred {};
-    socklen_t len = sizeof(cred);
+    const Option<i32> peerPid = session->peerPid();
 
-    if (getsockopt(fileDescriptor, SOL_SOCKET, SO_PEERCRED, &cred, &len) == -1)
+    if (!peerPid)
       ERR(ApiUnavailable, "Failed to get socket credentials (SO_PEERCRED)");
 
     Array<char, 128> exeLinkPathBuf {};
 
-    auto [out, size] = std::format_to_n(exeLinkPathBuf.data(), exeLinkPathBuf.size() - 1, "/proc/{}/exe", cred.pid);
+    auto [out, size] = std::format_to_n(exeLinkPathBuf.data(), exeLinkPathBuf.size() - 1, "/proc/{}/exe", *peerPid);
 
     if (static_cast<usize>(size) >= exeLinkPathBuf.size() - 1)
       ERR(InternalError, "Failed to format /proc path (PID too large?)");
@@ -546,27 +368,30 @@ namespace {
   }
 
   auto GetWaylandDisplays() -> Result<Vec<DisplayInfo>> {
-    const wl::DisplayGuard display;
-    if (!display)
+    const SharedPointer<const wl::Session> session = GetWaylandSession();
+
+    if (!session)
       ERR(ApiUnavailable, "Failed to connect to Wayland display");
 
-    wl::DisplayManager manager(display.get());
-    return manager.getOutputs();
+    return session->outputs();
   }
 
   auto GetWaylandPrimaryDisplay() -> Result<DisplayInfo> {
-    const wl::DisplayGuard display;
+    const SharedPointer<const wl::Session> session = GetWaylandSession();
 
-    if (!display)
+    if (!session)
       ERR(ApiUnavailable, "Failed to connect to Wayland display");
 
-    wl::DisplayManager manager(display.get());
-    DisplayInfo        primaryDisplay = manager.getPrimary();
+    const Vec<DisplayInfo>& outputs = session->outputs();
+
+    const auto primary = std::ranges::find_if(outputs, [](const DisplayInfo& output) -> bool {
+      return output.isPrimary && (output.resolution.width > 0 || output.resolution.height > 0);
+    });
 
-    if (primaryDisplay.resolution.width == 0 && primaryDisplay.resolution.height == 0)
+    if (primary == outputs.end())
       ERR(NotFound, "No primary Wayland display found");
 
-    return primaryDisplay;
+    return *primary;
   }
   #else
   auto GetWaylandCompositor() -> Result<String> {
@@ -582,7 +407,8 @@ namespace {
   }
   #endif
 
-  auto CollectNetworkInterfaces() -> Result<Map<String, NetworkInterface>> {
+  // Fallback for when netlink is unavailable (e.g. seccomp-filtered sandboxes).
+  auto CollectIfaddrsInterfaces() -> Result<Map<String, NetworkInterface>> {
     ifaddrs* ifaddrList = nullptr;
     if (getifaddrs(&ifaddrList) == -1)
       ERR_FMT(InternalError, "getifaddrs failed: {}", strerror(errno));
@@ -639,219 +465,316 @@ namespace {
 
     return interfaceMap;
   }
-} // namespace
-
-namespace draconis::core::system {
-  using draconis::utils::cache::CacheManager;
-  using draconis::utils::env::GetEnv;
-
-  namespace linux {
-    auto GetDistroID(CacheManager& cache) -> Result<String> {
-      return cache.getOrSet<String>("linux_distro_id", []() -> Result<String> {
-        std::ifstream file("/etc/os-release");
 
-        if (!file.is_open())
-          ERR(NotFound, "Failed to open /etc/os-release");
+  auto ReadDefaultRouteInterface() -> Option<String> {
+    namespace sysfs = draconis::os::sysfs;
 
-        String line;
+    Option<String> defaultRoute;
 
-        while (std::getline(file, line)) {
-          if (StringView(line).starts_with("ID=")) {
-            String value = line.substr(3);
+    // Each line is "Iface\tDestination\tGateway\t..."; the default route has destination 00000000.
+    if (Array<char, 16384> routeBuffer; Result<StringView> routes = sysfs::ReadContents("/proc/net/route", routeBuffer)) {
+      bool header = true;
 
-            if ((value.length() >= 2 && value.front() == '"' && value.back() == '"') ||
-                (value.length() >= 2 && value.front() == '\'' && value.back() == '\''))
-              value = value.substr(1, value.length() - 2);
+      sysfs::ForEachLine(*routes, [&](StringView line) -> bool {
+        if (std::exchange(header, false))
+          return true;
 
-            if (value.empty())
-              ERR(ParseError, "ID value is empty or only quotes in /etc/os-release");
+        const StringView iface       = sysfs::NextField(line);
+        const StringView destination = sysfs::NextField(line);
 
-            return String(value);
-          }
-        }
+        if (iface.empty() || destination != "00000000")
+          return true;
 
-        ERR(NotFound, "ID line not found in /etc/os-release");
+        defaultRoute = String(iface);
+        return false;
       });
     }
-  } // namespace linux
 
-  auto GetOperatingSystem(CacheManager& cache) -> Result<OSInfo> {
-    return cache.getOrSet<OSInfo>("linux_os_version", []() -> Result<OSInfo> {
-      std::ifstream file("/etc/os-release");
+    return defaultRoute;
+  }
 
-      if (!file.is_open())
-        ERR(NotFound, "Failed to open /etc/os-release");
+  auto CollectNetworkInterfaces() -> Result<draconis::os::netlink::Snapshot> {
+    DRAC_TRACE_SCOPE("system", "CollectNetworkInterfaces");
 
-      String osName, osVersion, osId;
+    Result<draconis::os::netlink::Snapshot> snapshot = draconis::os::netlink::Dump();
 
-      String line;
+    if (snapshot && !snapshot->interfaces.empty())
+      return snapshot;
 
-      const auto parseValue = [&](String& val) {
-        if (val.length() >= 2 && ((val.front() == '"' && val.back() == '"') || (val.front() == '\'' && val.back() == '\'')))
-          val = val.substr(1, val.length() - 2);
-      };
+    if (!snapshot)
+      debug_at(snapshot.error());
 
-      while (std::getline(file, line)) {
-        const StringView lineView = line;
-
-        if (lineView.starts_with("NAME=")) {
-          osName = lineView.substr(5);
-          parseValue(osName);
-        } else if (lineView.starts_with("VERSION=")) {
-          osVersion = lineView.substr(8);
-          parseValue(osVersion);
-        } else if (lineView.starts_with("ID=")) {
-          osId = lineView.substr(3);
-          parseValue(osId);
-        } else if (lineView.starts_with("PRETTY_NAME=") && osName.empty()) {
-          osName = lineView.substr(12);
-          parseValue(osName);
-        } else if (lineView.starts_with("VERSION_ID=") && osVersion.empty()) {
-          osVersion = lineView.substr(11);
-          parseValue(osVersion);
-        }
-      }
+    return draconis::os::netlink::Snapshot {
+      .interfaces            = TRY(CollectIfaddrsInterfaces()),
+      .defaultRouteInterface = ReadDefaultRouteInterface(),
+    };
+  }
 
-      if (osId.empty())
-        ERR(NotFound, "ID not found in /etc/os-release");
+  struct OsRelease {
+    String name;
+    String version;
+    String id;
+    bool   hasId = false;
+  };
 
-      if (osName.empty())
-        ERR(NotFound, "NAME or PRETTY_NAME not found in /etc/os-release");
+  // os-release is read and parsed once per process; the OS and distro ID
+  // readouts both draw from the same result.
+  auto GetOsRelease() -> const Result<OsRelease>& {
+    static const Result<OsRelease> Release = []() -> Result<OsRelease> {
+      namespace sysfs = draconis::os::sysfs;
 
-      if (osVersion.empty())
-        osVersion = "";
+      Array<char, 4096> buffer;
 
-      return OSInfo(osName, osVersion, osId);
-    });
+      const Result<StringView> contents = sysfs::ReadContents("/etc/os-release", buffer);
+
+      if (!contents)
+        ERR(NotFound, "Failed to open /etc/os-release");
+
+      const sysfs::OsReleaseFields fields = sysfs::ParseOsRelease(*contents);
+
+      return OsRelease {
+        .name    = String(fields.name),
+        .version = String(fields.version),
+        .id      = String(fields.id),
+        .hasId   = fields.hasId,
+      };
+    }();
+
+    return Release;
   }
 
-  auto GetMemInfo(CacheManager& /*cache*/) -> Result<ResourceUsage> {
-    struct sysinfo info;
+  constexpr auto PSEUDO_FILESYSTEMS = std::to_array<StringView>({
+    "autofs", "binfmt_misc", "bpf", "cgroup", "cgroup2", "configfs", "debugfs", "devpts",
+    "devtmpfs", "efivarfs", "fusectl", "hugetlbfs", "mqueue", "nsfs", "proc", "pstore",
+    "ramfs", "rpc_pipefs", "securityfs", "selinuxfs", "squashfs", "sysfs", "tmpfs", "tracefs",
+  });
 
-    if (sysinfo(&info) != 0)
-      ERR(ApiUnavailable, "sysinfo call failed");
+  constexpr auto NETWORK_FILESYSTEMS = std::to_array<StringView>({
+    "9p", "afs", "ceph", "cifs", "fuse.sshfs", "glusterfs", "ncpfs", "nfs", "nfs4", "smb3", "smbfs",
+  });
 
-    if (info.mem_unit == 0)
-      ERR(PlatformSpecific, "sysinfo.mem_unit is 0, cannot calculate memory");
+  auto IsPseudoFilesystem(const StringView filesystem) -> bool {
+    return std::ranges::contains(PSEUDO_FILESYSTEMS, filesystem);
+  }
 
-    return ResourceUsage((info.totalram - info.freeram - info.bufferram) * info.mem_unit, info.totalram * info.mem_unit);
+  auto DriveTypeFor(const StringView filesystem) -> String {
+    if (std::ranges::contains(NETWORK_FILESYSTEMS, filesystem))
+      return "Network";
+
+    if (filesystem == "tmpfs" || filesystem == "ramfs")
+      return "RAM Disk";
+
+    if (filesystem == "iso9660" || filesystem == "udf")
+      return "CD-ROM";
+
+    return "Fixed";
   }
 
-  auto GetWindowManager(CacheManager& cache) -> Result<String> {
-    // NOLINTNEXTLINE(misc-redundant-expression) - compile-time values are not always redundant
-    if constexpr (!DRAC_USE_WAYLAND && !DRAC_USE_XCB)
-      ERR(NotSupported, "Wayland or XCB support not available");
+  // The mount table escapes space, tab, newline and backslash as three-digit octal (e.g. "\040").
+  auto UnescapeMountField(const StringView field) -> String {
+    const auto isOctal = [](const char chr) { return chr >= '0' && chr <= '7'; };
 
-    return cache.getOrSet<String>("linux_wm", [&]() -> Result<String> {
-      if (GetEnv("WAYLAND_DISPLAY"))
-        return GetWaylandCompositor();
+    String out;
+    out.reserve(field.size());
 
-      if (GetEnv("DISPLAY"))
-        return GetX11WindowManager();
+    for (usize i = 0; i < field.size(); ++i) {
+      if (field[i] == '\\' && i + 3 < field.size() && isOctal(field[i + 1]) && isOctal(field[i + 2]) && isOctal(field[i + 3])) {
+        out += static_cast<char>(((field[i + 1] - '0') << 6) | ((field[i + 2] - '0') << 3) | (field[i + 3] - '0'));
+        i += 3;
+      } else {
+        out += field[i];
+      }
+    }
 
-      ERR(NotFound, "No display server detected");
-    });
+    return out;
   }
 
-  auto GetDesktopEnvironment(CacheManager& cache) -> Result<String> {
-    return cache.getOrSet<String>("linux_desktop_environment", []() -> Result<String> {
-      Result<String> xdgEnvResult = GetEnv("XDG_CURRENT_DESKTOP");
+  auto ReadMountTable() -> Result<Vec<draconis::os::unix_shared::MountEntry>> {
+    namespace sysfs = draconis::os::sysfs;
 
-      if (xdgEnvResult) {
-        String xdgDesktopSz = String(*xdgEnvResult);
+    using draconis::os::unix_shared::MountEntry;
 
-        if (const usize colonPos = xdgDesktopSz.find(':'); colonPos != String::npos)
-          xdgDesktopSz.resize(colonPos);
+    // Hosts with many container or bind mounts can outgrow the first buffer.
+    String buffer(65536, '\0');
 
-        return xdgDesktopSz;
+    while (true) {
+      const StringView contents = TRY(sysfs::ReadContents("/proc/self/mounts", buffer));
+
+      if (contents.size() == buffer.size()) {
+        buffer.resize(buffer.size() * 2);
+        continue;
       }
 
-      Result<String> desktopSessionResult = GetEnv("DESKTOP_SESSION");
+      Vec<MountEntry> mounts;
 
-      if (desktopSessionResult)
-        return *desktopSessionResult;
+      sysfs::ForEachLine(contents, [&](StringView line) -> bool {
+        const StringView device     = sysfs::NextField(line);
+        const StringView mountPoint = sysfs::NextField(line);
+        const StringView filesystem = sysfs::NextField(line);
 
-      ERR_FMT(ApiUnavailable, "Failed to get desktop session: {}", desktopSessionResult.error().message);
-    });
+        if (!filesystem.empty())
+          mounts.push_back({ .device = UnescapeMountField(device), .mountPoint = UnescapeMountField(mountPoint), .filesystem = String(filesystem) });
+
+        return true;
+      });
+
+      return mounts;
+    }
   }
 
-  auto GetShell(CacheManager& cache) -> Result<String> {
-    return cache.getOrSet<String>("linux_shell", []() -> Result<String> {
-      return GetEnv("SHELL")
-        .transform([](String shellPath) -> String {
-          // clang-format off
-          constexpr Array<Pair<StringView, StringView>, 5> shellMap {{
-            { "/usr/bin/bash",    "Bash" },
-            {  "/usr/bin/zsh",     "Zsh" },
-            { "/usr/bin/fish",    "Fish" },
-            {   "/usr/bin/nu", "Nushell" },
-            {   "/usr/bin/sh",      "SH" },
-          }};
-          // clang-format on
+  auto StatDisks(const Vec<draconis::os::unix_shared::MountEntry>& mounts, const std::chrono::milliseconds timeout) -> Vec<DiskInfo> {
+    Vec<DiskInfo> disks;
+    disks.reserve(mounts.size());
 
-          for (const auto& [exe, name] : shellMap)
-            if (shellPath == exe)
-              return String(name);
+    for (Result<DiskInfo>& result : draconis::os::unix_shared::StatMounts(mounts, timeout)) {
+      if (!result) {
+        if (result.error().code == Timeout)
+          warn_log("Skipping unresponsive mount: {}", result.error().message);
+        else
+          debug_at(result.error());
 
-          if (const usize lastSlash = shellPath.find_last_of('/'); lastSlash != String::npos)
-            return shellPath.substr(lastSlash + 1);
+        continue;
+      }
 
-          return shellPath;
-        })
-        .transform([](const String& shellPath) -> String {
-          return shellPath;
-        });
-    });
+      result->driveType = DriveTypeFor(result->filesystem);
+      disks.push_back(std::move(*result));
+    }
+
+    return disks;
   }
 
-  auto GetHost(CacheManager& cache) -> Result<String> {
-    return cache.getOrSet<String>("linux_host", []() -> Result<String> {
-      constexpr PCStr primaryPath  = "/sys/class/dmi/id/product_family";
-      constexpr PCStr fallbackPath = "/sys/class/dmi/id/product_name";
+  // Where several mounts share a mount point (bind or stacked mounts), the last one listed is the visible one.
+  auto FindMount(const Vec<draconis::os::unix_shared::MountEntry>& mounts, const StringView mountPoint) -> Option<draconis::os::unix_shared::MountEntry> {
+    for (const auto& mount : mounts | std::views::reverse)
+      if (mount.mountPoint == mountPoint)
+        return mount;
 
-      auto readFirstLine = [&](const String& path) -> Result<String> {
-        std::ifstream file(path);
-        String        line;
+    return None;
+  }
 
-        if (!file.is_open()) {
-          if (errno == EACCES)
-            ERR_FMT(PermissionDenied, "Permission denied when opening DMI product identifier file '{}'", path);
+  // Walks /sys/bus/pci/devices once, keeping what doesn't change while the machine is up.
+  auto ReadDisplayControllers() -> Result<Vec<GPUInfo>> {
+    namespace sysfs = draconis::os::sysfs;
 
-          ERR_FMT(NotFound, "Failed to open DMI product identifier file '{}'", path);
+    const Result<sysfs::Directory> devices = sysfs::Directory::open("/sys/bus/pci/devices");
+
+    if (!devices)
+      ERR(NotFound, "PCI device path '/sys/bus/pci/devices' not found.");
+
+    // clang-format off
+    const Array<Pair<StringView, StringView>, 3> fallbackVendorMap = {{
+      { "0x1002", "AMD" },
+      { "0x10de", "NVIDIA" },
+      { "0x8086", "Intel" },
+    }};
+    // clang-format on
+
+    Vec<GPUInfo> gpus;
+
+    // Only display controllers (class 0x03xxxx) get their vendor/device IDs read.
+    static_cast<void>(devices->forEachEntry([&](const PCStr name) -> bool {
+      const Result<sysfs::Directory> device = devices->openSubdir(name);
+
+      if (!device)
+        return true;
+
+      sysfs::AttributeBuffer classBuffer;
+
+      if (Result<StringView> classId = device->read("class", classBuffer); !classId || !classId->starts_with("0x03"))
+        return true;
+
+      GPUInfo gpu;
+      gpu.pciAddress = name;
+
+      Array<sysfs::AttributeBuffer, 3> buffers;
+
+      const auto [vendorId, deviceId, vramTotal] = device->readAll<3>({ "vendor", "device", "mem_info_vram_total" }, buffers);
+
+      if (vendorId && deviceId)
+        if (Result<Pair<String, String>> pciNames = LookupPciNames(*vendorId, *deviceId)) {
+          gpu.model  = draconis::os::pci::CleanGpuModelName(std::move(pciNames->first), std::move(pciNames->second));
+          gpu.vendor = gpu.model.substr(0, gpu.model.find(' '));
         }
 
-        if (!std::getline(file, line) || line.empty())
-          ERR_FMT(ParseError, "DMI product identifier file ('{}') is empty", path);
+      if (vendorId && gpu.model.empty()) {
+        const auto* iter = std::ranges::find_if(fallbackVendorMap, [&](const auto& pair) {
+          return pair.first == *vendorId;
+        });
 
-        return line;
-      };
+        if (iter != fallbackVendorMap.end())
+          gpu.vendor = gpu.model = String(iter->second);
+      }
 
-      Result<String> primaryResult = readFirstLine(primaryPath);
+      if (vramTotal)
+        gpu.vramTotalBytes = TryParse<u64>(*vramTotal);
 
-      if (primaryResult)
-        return primaryResult;
+      if (sysfs::AttributeBuffer driverBuffer; Result<StringView> driver = device->readLinkName("driver", driverBuffer))
+        gpu.driver = *driver;
 
-      DracError primaryError = primaryResult.error();
+      gpus.push_back(std::move(gpu));
 
-      Result<String> fallbackResult = readFirstLine(fallbackPath);
+      return true;
+    }));
 
-      if (fallbackResult)
-        return fallbackResult;
+    if (gpus.empty())
+      ERR(NotFound, "No display controllers found in /sys/bus/pci/devices.");
 
-      DracError fallbackError = fallbackResult.error();
+    std::ranges::sort(gpus, {}, &GPUInfo::pciAddress);
 
-      ERR_FMT(
-        NotFound,
-        "Failed to get host identifier. Primary ('{}'): {}. Fallback ('{}'): {}",
-        primaryPath,
-        primaryError.message,
-        fallbackPath,
-        fallbackError.message
-      );
-    });
+    return gpus;
   }
 
-  auto GetCPUModel(CacheManager& /*cache*/) -> Result<String> {
+  // The PCI pass shared by every GPU readout. Devices don't come and go between
+  // runs often enough to re-walk the bus, so it lives in the temp-directory cache.
+  auto GetDisplayControllers(draconis::utils::cache::CacheManager& cache) -> Result<Vec<GPUInfo>> {
+    using draconis::utils::cache::CachePolicy;
+
+    return cache.getOrSet<Vec<GPUInfo>>("linux_gpus", CachePolicy::tempDirectory(), ReadDisplayControllers);
+  }
+
+  // Fills in the counters that change between reads. amdgpu exposes them as sysfs
+  // attributes; the proprietary NVIDIA driver only through NVML.
+  auto ReadGpuCounters(GPUInfo& gpu) -> Unit {
+    namespace sysfs = draconis::os::sysfs;
+
+    if (gpu.driver == "nvidia") {
+      if (const Option<nvml::Counters> counters = nvml::ReadCounters(gpu.pciAddress.c_str())) {
+        gpu.vramTotalBytes = counters->vramTotalBytes;
+        gpu.vramUsedBytes  = counters->vramUsedBytes;
+        gpu.busyPercent    = counters->busyPercent;
+      }
+
+      return;
+    }
+
+    Array<char, 64> pathBuf {};
+
+    auto [out, size] = std::format_to_n(pathBuf.data(), pathBuf.size() - 1, "/sys/bus/pci/devices/{}", gpu.pciAddress);
+
+    if (static_cast<usize>(size) >= pathBuf.size() - 1)
+      return;
+
+    *out = '\0';
+
+    const Result<sysfs::Directory> device = sysfs::Directory::open(pathBuf.data());
+
+    if (!device)
+      return;
+
+    Array<sysfs::AttributeBuffer, 2> buffers;
+
+    const auto [busy, vramUsed] = device->readAll<2>({ "gpu_busy_percent", "mem_info_vram_used" }, buffers);
+
+    if (busy)
+      if (const Option<u32> percent = TryParse<u32>(*busy))
+        gpu.busyPercent = static_cast<f64>(*percent);
+
+    if (vramUsed)
+      gpu.vramUsedBytes = TryParse<u64>(*vramUsed);
+  }
+
+#if defined(__x86_64__) || defined(__i386__)
+  auto CpuidBrandString() -> Result<String> {
     Array<u32, 4>   cpuInfo;
     Array<char, 49> brandString = { 0 };
 
@@ -876,7 +799,8 @@ namespace draconis::core::system {
     return result;
   }
 
-  auto GetCPUCores(CacheManager& /*cache*/) -> Result<CPUCores> {
+  // Counts for the package the calling thread runs on; only used when sysfs can't be read.
+  auto CpuidCoreCounts() -> Result<CPUCores> {
     u32 eax = 0, ebx = 0, ecx = 0, edx = 0;
 
     __get_cpuid(0x0, &eax, &ebx, &ecx, &edx);
@@ -939,63 +863,709 @@ namespace draconis::core::system {
 
     return CPUCores(physicalCores, logicalCores);
   }
+#else
+  // Names for the "CPU implementer" / "CPU part" pairs arm64 kernels report
+  // instead of a brand string. Only parts seen in servers and desktops are listed.
+  auto ArmPartName(const u32 implementer, const u32 part) -> Option<StringView> {
+    struct Part {
+      u32        implementer;
+      u32        part;
+      StringView name;
+    };
 
-  auto GetGPUModel(CacheManager& cache) -> Result<String> {
-    return cache.getOrSet<String>("linux_gpu_model", []() -> Result<String> {
-      const fs::path pciPath = "/sys/bus/pci/devices";
-
-      if (!fs::exists(pciPath))
-        ERR(NotFound, "PCI device path '/sys/bus/pci/devices' not found.");
-
-      // clang-format off
-      const Array<Pair<StringView, StringView>, 3> fallbackVendorMap = {{
-        { "0x1002", "AMD" },
-        { "0x10de", "NVIDIA" },
-        { "0x8086", "Intel" },
-      }};
-      // clang-format on
-
-      for (const fs::directory_entry& entry : fs::directory_iterator(pciPath)) {
-        if (Result<String> classIdRes = ReadSysFile(entry.path() / "class"); !classIdRes || !classIdRes->starts_with("0x03"))
-          continue;
-
-        Result<String> vendorIdRes = ReadSysFile(entry.path() / "vendor");
-        Result<String> deviceIdRes = ReadSysFile(entry.path() / "device");
-
-        if (vendorIdRes && deviceIdRes)
-          if (Result<Pair<String, String>> pciNames = LookupPciNames(*vendorIdRes, *deviceIdRes))
-            return CleanGpuModelName(std::move(pciNames->first), std::move(pciNames->second));
-
-        if (vendorIdRes) {
-          const auto* iter = std::ranges::find_if(fallbackVendorMap, [&](const auto& pair) {
-            return pair.first == *vendorIdRes;
-          });
-
-          if (iter != fallbackVendorMap.end())
-            return String(iter->second);
-        }
-      }
-
-      ERR(NotFound, "No compatible GPU found in /sys/bus/pci/devices.");
+    // clang-format off
+    constexpr Array<Part, 30> parts = {{
+      { 0x41, 0xd03, "ARM Cortex-A53" },      { 0x41, 0xd04, "ARM Cortex-A35" },
+      { 0x41, 0xd05, "ARM Cortex-A55" },      { 0x41, 0xd07, "ARM Cortex-A57" },
+      { 0x41, 0xd08, "ARM Cortex-A72" },      { 0x41, 0xd09, "ARM Cortex-A73" },
+      { 0x41, 0xd0a, "ARM Cortex-A75" },      { 0x41, 0xd0b, "ARM Cortex-A76" },
+      { 0x41, 0xd0c, "ARM Neoverse-N1" },     { 0x41, 0xd0d, "ARM Cortex-A77" },
+      { 0x41, 0xd40, "ARM Neoverse-V1" },     { 0x41, 0xd41, "ARM Cortex-A78" },
+      { 0x41, 0xd44, "ARM Cortex-X1" },       { 0x41, 0xd46, "ARM Cortex-A510" },
+      { 0x41, 0xd47, "ARM Cortex-A710" },     { 0x41, 0xd48, "ARM Cortex-X2" },
+      { 0x41, 0xd49, "ARM Neoverse-N2" },     { 0x41, 0xd4d, "ARM Cortex-A715" },
+      { 0x41, 0xd4e, "ARM Cortex-X3" },       { 0x41, 0xd4f, "ARM Neoverse-V2" },
+      { 0x41, 0xd80, "ARM Cortex-A520" },     { 0x41, 0xd81, "ARM Cortex-A720" },
+      { 0x41, 0xd82, "ARM Cortex-X4" },       { 0x41, 0xd84, "ARM Neoverse-V3" },
+      { 0x41, 0xd8e, "ARM Neoverse-N3" },     { 0x48, 0xd01, "HiSilicon Kunpeng-920" },
+      { 0x51, 0x001, "Qualcomm Oryon" },      { 0x61, 0x022, "Apple Icestorm" },
+      { 0x61, 0x023, "Apple Firestorm" },     { 0xc0, 0xac3, "Ampere Ampere-1" },
+    }};
+    // clang-format on
+
+    const auto* iter = std::ranges::find_if(parts, [&](const Part& entry) {
+      return entry.implementer == implementer && entry.part == part;
     });
+
+    if (iter == parts.end())
+      return None;
+
+    return iter->name;
+  }
+
+  // arm64 has no brand string; /proc/cpuinfo repeats each core's implementer and
+  // part instead, so hybrid SoCs come out as e.g. "ARM Cortex-A55 + ARM Cortex-A76".
+  auto ReadCpuInfoModel() -> Result<String> {
+    namespace sysfs = draconis::os::sysfs;
+
+    constexpr auto parseHex = [](StringView text) -> Option<u32> {
+      if (text.starts_with("0x"))
+        text.remove_prefix(2);
+
+      u32 value = 0;
+
+      auto [ptr, ec] = std::from_chars(text.begin(), text.end(), value, 16);
+
+      if (ec == std::errc() && ptr == text.end())
+        return value;
+
+      return None;
+    };
+
+    Array<char, 16384> buffer;
+
+    const StringView contents = TRY(sysfs::ReadContents("/proc/cpuinfo", buffer));
+
+    String      modelName;
+    Option<u32> implementer;
+    Vec<String> parts;
+
+    sysfs::ForEachKeyValue(contents, ':', [&](const StringView key, const StringView value) -> bool {
+      if ((key == "model name" || key == "Processor") && modelName.empty())
+        modelName = value;
+      else if (key == "CPU implementer")
+        implementer = parseHex(value);
+      else if (key == "CPU part" && implementer) {
+        const Option<u32> part = parseHex(value);
+
+        if (!part)
+          return true;
+
+        String name = ArmPartName(*implementer, *part)
+                        .transform([](const StringView known) { return String(known); })
+                        .value_or(std::format("CPU 0x{:02x}/0x{:03x}", *implementer, *part));
+
+        if (std::ranges::find(parts, name) == parts.end())
+          parts.push_back(std::move(name));
+      }
+
+      return true;
+    });
+
+    if (!modelName.empty())
+      return modelName;
+
+    if (parts.empty())
+      ERR(NotFound, "No model name or CPU part in /proc/cpuinfo");
+
+    String result = std::move(parts.front());
+
+    for (const String& part : parts | std::views::drop(1))
+      result += std::format(" + {}", part);
+
+    return result;
+  }
+#endif
+
+  // Calls visit with every CPU number in a kernel cpulist such as "0-3,8,10-11".
+  template <typename Visitor>
+  auto ForEachInCpuList(const StringView list, Visitor&& visit) -> bool {
+    for (const auto chunk : list | std::views::split(',')) {
+      const StringView range(chunk.begin(), chunk.end());
+
+      if (range.empty())
+        continue;
+
+      const usize       dash  = range.find('-');
+      const Option<u32> first = TryParse<u32>(range.substr(0, dash));
+      const Option<u32> last  = dash == StringView::npos ? first : TryParse<u32>(range.substr(dash + 1));
+
+      if (!first || !last || *last < *first)
+        return false;
+
+      for (u32 cpu = *first; cpu <= *last; ++cpu)
+        visit(cpu);
+    }
+
+    return true;
+  }
+
+  auto ReadCpuTopology() -> Result<CPUTopology> {
+    namespace sysfs = draconis::os::sysfs;
+    using Kind       = CPUTopology::CoreKind;
+    using LogicalCPU = CPUTopology::LogicalCPU;
+
+    const Result<sysfs::Directory> cpuRoot = sysfs::Directory::open("/sys/devices/system/cpu");
+
+    if (!cpuRoot)
+      ERR_FROM(cpuRoot.error());
+
+    CPUTopology topology;
+
+    {
+      sysfs::AttributeBuffer   buffer;
+      const Result<StringView> online = cpuRoot->read("online", buffer);
+
+      if (!online)
+        ERR_FROM(online.error());
+
+      const bool parsed = ForEachInCpuList(*online, [&](const u32 cpu) {
+        topology.cpus.push_back({ .id = cpu, .package = 0, .core = cpu, .node = None, .maxFrequencyKHz = None, .kind = Kind::Uniform });
+      });
+
+      if (!parsed || topology.cpus.empty())
+        ERR_FMT(ParseError, "Unrecognised CPU list '{}' in /sys/devices/system/cpu/online", *online);
+    }
+
+    Vec<u64> capacities(topology.cpus.size(), 0);
+
+    for (usize i = 0; i < topology.cpus.size(); ++i) {
+      LogicalCPU& cpu = topology.cpus[i];
+
+      Array<char, 16> name {};
+      std::format_to_n(name.data(), name.size() - 1, "cpu{}", cpu.id);
+
+      const Result<sysfs::Directory> cpuDir = cpuRoot->openSubdir(name.data());
+
+      if (!cpuDir)
+        continue;
+
+      // Some arm64 firmware leaves physical_package_id at -1; TryParse<u32> rejects it and package 0 stands.
+      if (const Result<sysfs::Directory> topologyDir = cpuDir->openSubdir("topology")) {
+        Array<sysfs::AttributeBuffer, 2> buffers;
+
+        const auto [package, core] = topologyDir->readAll<2>({ "physical_package_id", "core_id" }, buffers);
+
+        if (package)
+          cpu.package = TryParse<u32>(*package).value_or(cpu.package);
+
+        if (core)
+          cpu.core = TryParse<u32>(*core).value_or(cpu.core);
+      }
+
+      if (const Result<sysfs::Directory> cpufreqDir = cpuDir->openSubdir("cpufreq")) {
+        sysfs::AttributeBuffer buffer;
+
+        if (const Result<StringView> maxFreq = cpufreqDir->read("cpuinfo_max_freq", buffer))
+          cpu.maxFrequencyKHz = TryParse<u64>(*maxFreq);
+      }
+
+      if (sysfs::AttributeBuffer buffer; const Result<StringView> capacity = cpuDir->read("cpu_capacity", buffer))
+        capacities[i] = TryParse<u64>(*capacity).value_or(0);
+
+      // With NUMA, each cpuN holds a nodeM link to its node.
+      static_cast<void>(cpuDir->forEachEntry([&](const PCStr entry) -> bool {
+        const StringView entryName(entry);
+
+        if (entryName.starts_with("node"))
+          cpu.node = TryParse<u32>(entryName.substr(4));
+
+        return !cpu.node;
+      }));
+    }
+
+    // Intel hybrid parts register one PMU per core type, each listing its CPUs.
+    const auto markPmuCpus = [&](const PCStr path, const Kind kind) -> bool {
+      sysfs::AttributeBuffer   buffer;
+      const Result<StringView> list = sysfs::ReadAttribute(path, buffer);
+
+      return list && ForEachInCpuList(*list, [&](const u32 id) {
+               if (auto iter = std::ranges::find(topology.cpus, id, &LogicalCPU::id); iter != topology.cpus.end())
+                 iter->kind = kind;
+             });
+    };
+
+    const bool intelHybrid = markPmuCpus("/sys/devices/cpu_core/cpus", Kind::Performance) &&
+      markPmuCpus("/sys/devices/cpu_atom/cpus", Kind::Efficiency);
+
+    if (!intelHybrid) {
+      // big.LITTLE: only the highest-capacity cores count as performance cores,
+      // so the middle tier of a three-tier SoC is counted with the little ones.
+      const auto [lowest, highest] = std::ranges::minmax(capacities);
+      const bool armHybrid         = lowest > 0 && lowest != highest;
+
+      for (usize i = 0; i < topology.cpus.size(); ++i)
+        topology.cpus[i].kind = !armHybrid ? Kind::Uniform : capacities[i] == highest ? Kind::Performance : Kind::Efficiency;
+    }
+
+    const auto countDistinct = []<typename T>(Vec<T>& values) -> usize {
+      std::ranges::sort(values);
+      return static_cast<usize>(std::ranges::unique(values).begin() - values.begin());
+    };
+
+    Vec<u32>            packages;
+    Vec<u32>            nodes;
+    Vec<Pair<u32, u32>> cores;
+    Vec<Pair<u32, u32>> performanceCores;
+    Vec<Pair<u32, u32>> efficiencyCores;
+
+    for (const LogicalCPU& cpu : topology.cpus) {
+      packages.push_back(cpu.package);
+      cores.emplace_back(cpu.package, cpu.core);
+
+      if (cpu.node)
+        nodes.push_back(*cpu.node);
+
+      if (cpu.kind == Kind::Performance)
+        performanceCores.emplace_back(cpu.package, cpu.core);
+      else if (cpu.kind == Kind::Efficiency)
+        efficiencyCores.emplace_back(cpu.package, cpu.core);
+    }
+
+    topology.packages         = countDistinct(packages);
+    topology.physicalCores    = countDistinct(cores);
+    topology.numaNodes        = countDistinct(nodes);
+    topology.performanceCores = countDistinct(performanceCores);
+    topology.efficiencyCores  = countDistinct(efficiencyCores);
+
+    return topology;
+  }
+} // namespace
+
+namespace draconis::core::system {
+  using draconis::utils::cache::CacheManager;
+  using draconis::utils::env::GetEnvSnapshot;
+
+  namespace linux {
+    auto GetDistroID(CacheManager& cache) -> Result<String> {
+      DRAC_TRACE_SCOPE("system", "GetDistroID");
+
+      return cache.getOrSet<String>("linux_distro_id", []() -> Result<String> {
+        const Result<OsRelease>& release = GetOsRelease();
+
+        if (!release)
+          ERR_FROM(release.error());
+
+        if (!release->hasId)
+          ERR(NotFound, "ID line not found in /etc/os-release");
+
+        if (release->id.empty())
+          ERR(ParseError, "ID value is empty or only quotes in /etc/os-release");
+
+        return release->id;
+      });
+    }
+  } // namespace linux
+
+  auto GetOperatingSystem(CacheManager& cache) -> Result<OSInfo> {
+    DRAC_TRACE_SCOPE("system", "GetOperatingSystem");
+
+    return cache.getOrSet<OSInfo>("linux_os_version", []() -> Result<OSInfo> {
+      const Result<OsRelease>& release = GetOsRelease();
+
+      if (!release)
+        ERR_FROM(release.error());
+
+      if (release->id.empty())
+        ERR(NotFound, "ID not found in /etc/os-release");
+
+      if (release->name.empty())
+        ERR(NotFound, "NAME or PRETTY_NAME not found in /etc/os-release");
+
+      return OSInfo(release->name, release->version, release->id);
+    });
+  }
+
+  auto GetMemInfo(CacheManager& /*cache*/) -> Result<ResourceUsage> {
+    DRAC_TRACE_SCOPE("system", "GetMemInfo");
+
+    namespace sysfs = draconis::os::sysfs;
+
+    // MemAvailable accounts for reclaimable page cache and slab, which
+    // sysinfo() lumps in with used memory.
+    if (Array<char, 8192> buffer; Result<StringView> meminfo = sysfs::ReadContents("/proc/meminfo", buffer)) {
+      Option<u64> totalKiB, availableKiB, freeKiB, buffersKiB, cachedKiB;
+
+      sysfs::ForEachKeyValue(*meminfo, ':', [&](const StringView key, StringView value) -> bool {
+        const StringView number = sysfs::NextField(value);
+
+        if (key == "MemTotal")
+          totalKiB = TryParse<u64>(number);
+        else if (key == "MemAvailable")
+          availableKiB = TryParse<u64>(number);
+        else if (key == "MemFree")
+          freeKiB = TryParse<u64>(number);
+        else if (key == "Buffers")
+          buffersKiB = TryParse<u64>(number);
+        else if (key == "Cached")
+          cachedKiB = TryParse<u64>(number);
+
+        // The fields we need all precede SwapCached.
+        return key != "SwapCached";
+      });
+
+      // Kernels before 3.14 have no MemAvailable; approximate it the way procps did.
+      if (!availableKiB && freeKiB && buffersKiB && cachedKiB)
+        availableKiB = *freeKiB + *buffersKiB + *cachedKiB;
+
+      if (totalKiB && availableKiB && *availableKiB <= *totalKiB)
+        return ResourceUsage((*totalKiB - *availableKiB) * 1024, *totalKiB * 1024);
+    }
+
+    struct sysinfo info;
+
+    if (sysinfo(&info) != 0)
+      ERR(ApiUnavailable, "sysinfo call failed");
+
+    if (info.mem_unit == 0)
+      ERR(PlatformSpecific, "sysinfo.mem_unit is 0, cannot calculate memory");
+
+    return ResourceUsage((info.totalram - info.freeram - info.bufferram) * info.mem_unit, info.totalram * info.mem_unit);
+  }
+
+  auto GetWindowManager(CacheManager& cache) -> Result<String> {
+    DRAC_TRACE_SCOPE("system", "GetWindowManager");
+
+    // NOLINTNEXTLINE(misc-redundant-expression) - compile-time values are not always redundant
+    if constexpr (!DRAC_USE_WAYLAND && !DRAC_USE_XCB)
+      ERR(NotSupported, "Wayland or XCB support not available");
+
+    return cache.getOrSet<String>("linux_wm", [&]() -> Result<String> {
+      if (GetEnvSnapshot().waylandDisplay)
+        return GetWaylandCompositor();
+
+      if (GetEnvSnapshot().display)
+        return GetX11WindowManager();
+
+      ERR(NotFound, "No display server detected");
+    });
+  }
+
+  auto GetDesktopEnvironment(CacheManager& cache) -> Result<String> {
+    DRAC_TRACE_SCOPE("system", "GetDesktopEnvironment");
+
+    return cache.getOrSet<String>("linux_desktop_environment", []() -> Result<String> {
+      const draconis::utils::env::EnvSnapshot& env = GetEnvSnapshot();
+
+      if (env.xdgCurrentDesktop) {
+        String xdgDesktopSz = *env.xdgCurrentDesktop;
+
+        if (const usize colonPos = xdgDesktopSz.find(':'); colonPos != String::npos)
+          xdgDesktopSz.resize(colonPos);
+
+        return xdgDesktopSz;
+      }
+
+      if (env.desktopSession)
+        return *env.desktopSession;
+
+      ERR(ApiUnavailable, "Failed to get desktop session: neither XDG_CURRENT_DESKTOP nor DESKTOP_SESSION is set");
+    });
+  }
+
+  auto GetShell(CacheManager& cache) -> Result<String> {
+    DRAC_TRACE_SCOPE("system", "GetShell");
+
+    return cache.getOrSet<String>("linux_shell", []() -> Result<String> {
+      return draconis::utils::env::ToResult(GetEnvSnapshot().shell)
+        .transform([](String shellPath) -> String {
+          // clang-format off
+          constexpr Array<Pair<StringView, StringView>, 5> shellMap {{
+            { "/usr/bin/bash",    "Bash" },
+            {  "/usr/bin/zsh",     "Zsh" },
+            { "/usr/bin/fish",    "Fish" },
+            {   "/usr/bin/nu", "Nushell" },
+            {   "/usr/bin/sh",      "SH" },
+          }};
+          // clang-format on
+
+          for (const auto& [exe, name] : shellMap)
+            if (shellPath == exe)
+              return String(name);
+
+          if (const usize lastSlash = shellPath.find_last_of('/'); lastSlash != String::npos)
+            return shellPath.substr(lastSlash + 1);
+
+          return shellPath;
+        })
+        .transform([](const String& shellPath) -> String {
+          return shellPath;
+        });
+    });
+  }
+
+  auto GetHost(CacheManager& cache) -> Result<String> {
+    DRAC_TRACE_SCOPE("system", "GetHost");
+
+    return cache.getOrSet<String>("linux_host", []() -> Result<String> {
+      constexpr PCStr primaryPath  = "/sys/class/dmi/id/product_family";
+      constexpr PCStr fallbackPath = "/sys/class/dmi/id/product_name";
+
+      auto readFirstLine = [&](const PCStr path) -> Result<String> {
+        namespace sysfs = draconis::os::sysfs;
+
+        sysfs::AttributeBuffer buffer;
+
+        Result<StringView> line = sysfs::ReadAttribute(path, buffer);
+
+        if (!line) {
+          if (line.error().code == PermissionDenied)
+            ERR_FMT(PermissionDenied, "Permission denied when opening DMI product identifier file '{}'", path);
+
+          ERR_FMT(NotFound, "Failed to open DMI product identifier file '{}'", path);
+        }
+
+        if (line->empty())
+          ERR_FMT(ParseError, "DMI product identifier file ('{}') is empty", path);
+
+        return String(*line);
+      };
+
+      Result<String> primaryResult = readFirstLine(primaryPath);
+
+      if (primaryResult)
+        return primaryResult;
+
+      DracError primaryError = primaryResult.error();
+
+      Result<String> fallbackResult = readFirstLine(fallbackPath);
+
+      if (fallbackResult)
+        return fallbackResult;
+
+      DracError fallbackError = fallbackResult.error();
+
+      ERR_FMT(
+        NotFound,
+        "Failed to get host identifier. Primary ('{}'): {}. Fallback ('{}'): {}",
+        primaryPath,
+        primaryError.message,
+        fallbackPath,
+        fallbackError.message
+      );
+    });
+  }
+
+  auto GetCPUModel(CacheManager& /*cache*/) -> Result<String> {
+    DRAC_TRACE_SCOPE("system", "GetCPUModel");
+
+#if defined(__x86_64__) || defined(__i386__)
+    return CpuidBrandString();
+#else
+    return ReadCpuInfoModel();
+#endif
+  }
+
+  auto GetCPUCores(CacheManager& cache) -> Result<CPUCores> {
+    DRAC_TRACE_SCOPE("system", "GetCPUCores");
+
+    const Result<CPUTopology> topology = GetCPUTopology(cache);
+
+    if (topology)
+      return CPUCores(topology->physicalCores, topology->cpus.size());
+
+#if defined(__x86_64__) || defined(__i386__)
+    debug_at(topology.error());
+
+    return CpuidCoreCounts();
+#else
+    ERR_FROM(topology.error());
+#endif
+  }
+
+  auto GetCPUTopology(CacheManager& cache) -> Result<CPUTopology> {
+    DRAC_TRACE_SCOPE("system", "GetCPUTopology");
+
+    using draconis::utils::cache::CachePolicy;
+
+    return cache.getOrSet<CPUTopology>("linux_cpu_topology", CachePolicy::tempDirectory(), ReadCpuTopology);
+  }
+
+  auto GetCPUTimes(Vec<CPUTimes>& perCpu) -> Result<CPUTimes> {
+    namespace sysfs = draconis::os::sysfs;
+
+    // The cpu lines come first, so the buffer only has to reach past them; it
+    // grows until it does and is then reused by every later sample.
+    thread_local String StatBuffer(8192, '\0');
+
+    while (true) {
+      const StringView contents = TRY(sysfs::ReadContents("/proc/stat", Span<char>(StatBuffer.data(), StatBuffer.size())));
+
+      CPUTimes total;
+      bool     sawTotal = false;
+      bool     complete = false;
+
+      std::ranges::fill(perCpu, CPUTimes {});
+
+      sysfs::ForEachLine(contents, [&](const StringView line) -> bool {
+        if (!line.starts_with("cpu")) {
+          complete = true;
+          return false;
+        }
+
+        StringView       rest  = line;
+        const StringView label = sysfs::NextField(rest);
+
+        // user nice system idle iowait irq softirq steal; older kernels stop early.
+        Array<u64, 8> ticks {};
+
+        for (u64& tick : ticks)
+          tick = TryParse<u64>(sysfs::NextField(rest)).value_or(0);
+
+        const CPUTimes times {
+          .busy = ticks[0] + ticks[1] + ticks[2] + ticks[5] + ticks[6] + ticks[7],
+          .idle = ticks[3] + ticks[4],
+        };
+
+        if (label == "cpu") {
+          total    = times;
+          sawTotal = true;
+        } else if (const Option<u32> index = TryParse<u32>(label.substr(3))) {
+          if (*index >= perCpu.size())
+            perCpu.resize(*index + 1);
+
+          perCpu[*index] = times;
+        }
+
+        return true;
+      });
+
+      if (!complete && contents.size() == StatBuffer.size()) {
+        StatBuffer.resize(StatBuffer.size() * 2);
+        continue;
+      }
+
+      if (!sawTotal)
+        ERR(ParseError, "No aggregate cpu line in /proc/stat");
+
+      return total;
+    }
+  }
+
+  auto GetGPUModel(CacheManager& cache) -> Result<String> {
+    DRAC_TRACE_SCOPE("system", "GetGPUModel");
+
+    return cache.getOrSet<String>("linux_gpu_model", [&cache]() -> Result<String> {
+      const Vec<GPUInfo> gpus = TRY(GetDisplayControllers(cache));
+
+      const auto iter = std::ranges::find_if(gpus, [](const GPUInfo& gpu) { return !gpu.model.empty(); });
+
+      if (iter == gpus.end())
+        ERR(NotFound, "No compatible GPU found in /sys/bus/pci/devices.");
+
+      return iter->model;
+    });
+  }
+
+  auto GetGPUs(CacheManager& cache) -> Result<Vec<GPUInfo>> {
+    DRAC_TRACE_SCOPE("system", "GetGPUs");
+
+    Vec<GPUInfo> gpus = TRY(GetDisplayControllers(cache));
+
+    for (GPUInfo& gpu : gpus)
+      ReadGpuCounters(gpu);
+
+    return gpus;
   }
 
   auto GetUptime() -> Result<std::chrono::seconds> {
+    DRAC_TRACE_SCOPE("system", "GetUptime");
+
     return os::unix_shared::GetUptimeLinux();
   }
 
   auto GetKernelVersion(CacheManager& cache) -> Result<String> {
+    DRAC_TRACE_SCOPE("system", "GetKernelVersion");
+
     return cache.getOrSet<String>("linux_kernel_version", []() -> Result<String> {
       return os::unix_shared::GetKernelRelease();
     });
   }
 
   auto GetDiskUsage(CacheManager& /*cache*/) -> Result<ResourceUsage> {
+    DRAC_TRACE_SCOPE("system", "GetDiskUsage");
+
     return os::unix_shared::GetRootDiskUsage();
   }
 
+  auto GetDisks(CacheManager& /*cache*/, const DiskQueryOptions& options) -> Result<Vec<DiskInfo>> {
+    DRAC_TRACE_SCOPE("system", "GetDisks");
+
+    using os::unix_shared::MountEntry;
+
+    Vec<MountEntry> mounts = TRY(ReadMountTable());
+
+    // Filter before stat'ing, so excluded (possibly hung) mounts are never touched.
+    std::erase_if(mounts, [&options](const MountEntry& mount) {
+      return !options.selects(mount.filesystem, IsPseudoFilesystem(mount.filesystem));
+    });
+
+    // Keep only the visible (last-listed) mount for each mount point.
+    Vec<MountEntry> visible;
+    visible.reserve(mounts.size());
+
+    for (MountEntry& mount : mounts) {
+      std::erase_if(visible, [&mount](const MountEntry& seen) { return seen.mountPoint == mount.mountPoint; });
+      visible.push_back(std::move(mount));
+    }
+
+    return StatDisks(visible, options.statTimeout);
+  }
+
+  auto GetSystemDisk(CacheManager& /*cache*/) -> Result<DiskInfo> {
+    DRAC_TRACE_SCOPE("system", "GetSystemDisk");
+
+    using os::unix_shared::MountEntry;
+
+    const Vec<MountEntry> mounts = ReadMountTable().value_or(Vec<MountEntry> {});
+
+    const MountEntry root = FindMount(mounts, "/").value_or(MountEntry { .device = "/", .mountPoint = "/", .filesystem = {} });
+
+    Vec<DiskInfo> disks = StatDisks({ root }, DiskQueryOptions {}.statTimeout);
+
+    if (disks.empty())
+      ERR(IoError, "Failed to query the root filesystem");
+
+    return std::move(disks.front());
+  }
+
+  auto GetDiskByPath(const String& path, CacheManager& /*cache*/) -> Result<DiskInfo> {
+    DRAC_TRACE_SCOPE("system", "GetDiskByPath");
+
+    using os::unix_shared::MountEntry;
+
+    if (path.empty())
+      ERR(InvalidArgument, "Path cannot be empty");
+
+    std::error_code errc;
+
+    const fs::path target = fs::weakly_canonical(fs::absolute(path, errc), errc);
+
+    if (errc)
+      ERR_FMT(InvalidArgument, "Failed to resolve path '{}': {}", path, errc.message());
+
+    const Vec<MountEntry> mounts = TRY(ReadMountTable());
+
+    // The longest mount point that contains the path wins; later entries shadow earlier ones.
+    const MountEntry* best = nullptr;
+
+    for (const MountEntry& mount : mounts) {
+      const fs::path mountPath(mount.mountPoint);
+
+      const auto [mountEnd, targetEnd] = std::ranges::mismatch(mountPath, target);
+
+      if (mountEnd != mountPath.end() && !mountEnd->empty())
+        continue;
+
+      if (!best || mount.mountPoint.size() >= best->mountPoint.size())
+        best = &mount;
+    }
+
+    if (!best)
+      ERR_FMT(NotFound, "No mount found containing '{}'", path);
+
+    Vec<DiskInfo> disks = StatDisks({ *best }, DiskQueryOptions {}.statTimeout);
+
+    if (disks.empty())
+      ERR_FMT(IoError, "Failed to query the filesystem containing '{}'", path);
+
+    return std::move(disks.front());
+  }
+
   auto GetOutputs(CacheManager& /*cache*/) -> Result<Vec<DisplayInfo>> {
-    if (GetEnv("WAYLAND_DISPLAY")) {
+    DRAC_TRACE_SCOPE("system", "GetOutputs");
+
+    if (GetEnvSnapshot().waylandDisplay) {
       Result<Vec<DisplayInfo>> displays = GetWaylandDisplays();
 
       if (displays)
@@ -1004,7 +1574,7 @@ namespace draconis::core::system {
       debug_at(displays.error());
     }
 
-    if (GetEnv("DISPLAY")) {
+    if (GetEnvSnapshot().display) {
       Result<Vec<DisplayInfo>> displays = GetX11Displays();
 
       if (displays)
@@ -1017,7 +1587,9 @@ namespace draconis::core::system {
   }
 
   auto GetPrimaryOutput(CacheManager& /*cache*/) -> Result<DisplayInfo> {
-    if (GetEnv("WAYLAND_DISPLAY")) {
+    DRAC_TRACE_SCOPE("system", "GetPrimaryOutput");
+
+    if (GetEnvSnapshot().waylandDisplay) {
       Result<DisplayInfo> display = GetWaylandPrimaryDisplay();
 
       if (display)
@@ -1026,7 +1598,7 @@ namespace draconis::core::system {
       debug_at(display.error());
     }
 
-    if (GetEnv("DISPLAY")) {
+    if (GetEnvSnapshot().display) {
       Result<DisplayInfo> display = GetX11PrimaryDisplay();
 
       if (display)
@@ -1039,8 +1611,10 @@ namespace draconis::core::system {
   }
 
   auto GetNetworkInterfaces(CacheManager& cache) -> Result<Vec<NetworkInterface>> {
+    DRAC_TRACE_SCOPE("system", "GetNetworkInterfaces");
+
     return cache.getOrSet<Vec<NetworkInterface>>("linux_network_interfaces", []() -> Result<Vec<NetworkInterface>> {
-      Map<String, NetworkInterface> interfaceMap = TRY(CollectNetworkInterfaces());
+      Map<String, NetworkInterface> interfaceMap = TRY(CollectNetworkInterfaces()).interfaces;
 
       Vec<NetworkInterface> interfaces;
       interfaces.reserve(interfaceMap.size());
@@ -1052,28 +1626,13 @@ namespace draconis::core::system {
   }
 
   auto GetPrimaryNetworkInterface(CacheManager& cache) -> Result<NetworkInterface> {
-    return cache.getOrSet<NetworkInterface>("linux_primary_network_interface", []() -> Result<NetworkInterface> {
-      // Gather full interface list first
-      Map<String, NetworkInterface> interfaces = TRY(CollectNetworkInterfaces());
-
-      // Attempt to determine primary interface via default route
-      String        primaryInterfaceName;
-      std::ifstream routeFile("/proc/net/route");
-
-      if (routeFile.is_open()) {
-        String line;
-        std::getline(routeFile, line); // skip header
+    DRAC_TRACE_SCOPE("system", "GetPrimaryNetworkInterface");
 
-        while (std::getline(routeFile, line)) {
-          std::istringstream iss(line);
-          String             iface, dest, gateway, flags, refcnt, use, metric, mask, mtu, window, irtt;
+    return cache.getOrSet<NetworkInterface>("linux_primary_network_interface", []() -> Result<NetworkInterface> {
+      // Interfaces and the default route come from the same snapshot
+      auto [interfaces, defaultRoute] = TRY(CollectNetworkInterfaces());
 
-          if (iss >> iface >> dest >> gateway >> flags >> refcnt >> use >> metric >> mask >> mtu >> window >> irtt && dest == "00000000") {
-            primaryInterfaceName = iface;
-            break;
-          }
-        }
-      }
+      String primaryInterfaceName = defaultRoute.value_or("");
 
       // Fallback: first non-loopback interface that is up (Ranges style)
       if (primaryInterfaceName.empty())
@@ -1100,38 +1659,54 @@ namespace draconis::core::system {
   }
 
   auto GetBatteryInfo(CacheManager& /*cache*/) -> Result<Battery> {
+    DRAC_TRACE_SCOPE("system", "GetBatteryInfo");
+
     using matchit::match, matchit::is, matchit::_;
     using enum Battery::Status;
 
-    PCStr powerSupplyPath = "/sys/class/power_supply";
+    namespace sysfs = draconis::os::sysfs;
 
-    if (!fs::exists(powerSupplyPath))
+    const Result<sysfs::Directory> powerSupplies = sysfs::Directory::open("/sys/class/power_supply");
+
+    if (!powerSupplies)
       ERR(NotFound, "Power supply directory not found");
 
     // Find the first battery device
-    fs::path batteryPath;
-    for (const fs::directory_entry& entry : fs::directory_iterator(powerSupplyPath))
-      if (Result<String> typeResult = ReadSysFile(entry.path() / "type");
-          typeResult && *typeResult == "Battery") {
-        batteryPath = entry.path();
-        break;
+    Option<sysfs::Directory> battery;
+
+    static_cast<void>(powerSupplies->forEachEntry([&](const PCStr name) -> bool {
+      Result<sysfs::Directory> supply = powerSupplies->openSubdir(name);
+
+      if (!supply)
+        return true;
+
+      sysfs::AttributeBuffer typeBuffer;
+
+      if (Result<StringView> type = supply->read("type", typeBuffer); type && *type == "Battery") {
+        battery = std::move(*supply);
+        return false;
       }
 
-    if (batteryPath.empty())
+      return true;
+    }));
+
+    if (!battery)
       ERR(NotFound, "No battery found in power supply directory");
 
+    Array<sysfs::AttributeBuffer, 4> buffers;
+
+    const auto [capacity, statusValue, timeToEmpty, timeToFull] =
+      battery->readAll<4>({ "capacity", "status", "time_to_empty_now", "time_to_full_now" }, buffers);
+
     // Read battery percentage
-    Option<u8> percentage =
-      ReadSysFile(batteryPath / "capacity")
-        .transform([](const String& capacityStr) -> Option<u8> {
-          return TryParse<u8>(capacityStr);
-        })
-        .value_or(None);
+    const Option<u8> percentage = capacity.and_then([](const StringView capacityStr) -> Option<u8> {
+      return TryParse<u8>(capacityStr);
+    });
 
     // Read battery status
-    Battery::Status status =
-      ReadSysFile(batteryPath / "status")
-        .transform([percentage](const String& statusStr) -> Battery::Status {
+    const Battery::Status status =
+      statusValue
+        .transform([percentage](const StringView statusStr) -> Battery::Status {
           return match(statusStr)(
             is | "Charging"     = Charging,
             is | "Discharging"  = Discharging,
@@ -1148,16 +1723,14 @@ namespace draconis::core::system {
     return Battery(
       status,
       percentage,
-      ReadSysFile(
-        batteryPath / std::format("/time_to_{}now", status == Discharging ? "empty" : "full")
-      )
-        .transform([](const String& timeStr) -> Option<std::chrono::seconds> {
-          if (Option<i32> timeMinutes = TryParse<i32>(timeStr); timeMinutes && *timeMinutes > 0)
-            return std::chrono::minutes(*timeMinutes);
+      (status == Discharging ? timeToEmpty : timeToFull)
+        .and_then([](const StringView timeStr) -> Option<std::chrono::seconds> {
+          // power_supply reports time_to_{empty,full}_now in seconds.
+          if (Option<i32> timeSeconds = TryParse<i32>(timeStr); timeSeconds && *timeSeconds > 0)
+            return std::chrono::seconds(*timeSeconds);
 
           return None;
         })
-        .value_or(None)
     );
   }
 } // namespace draconis::core::system
@@ -1167,40 +1740,8 @@ namespace draconis::services::packages {
   using draconis::utils::cache::CacheManager;
 
   auto CountApk(CacheManager& cache) -> Result<u64> {
-    const String   pmID      = "apk";
-    const fs::path apkDbPath = "/lib/apk/db/installed";
-
-    return cache.getOrSet<u64>(std::format("pkg_count_{}", pmID), [&]() -> Result<u64> {
-      if (std::error_code fsErrCode; !fs::exists(apkDbPath, fsErrCode)) {
-        if (fsErrCode) {
-          warn_log("Filesystem error checking for Apk DB at '{}': {}", apkDbPath.string(), fsErrCode.message());
-          ERR_FMT(IoError, "Filesystem error checking Apk DB: {}", fsErrCode.message());
-        }
-
-        ERR_FMT(NotFound, "Apk database path '{}' does not exist", apkDbPath.string());
-      }
-
-      std::ifstream file(apkDbPath);
-      if (!file.is_open())
-        ERR(IoError, std::format("Failed to open Apk database file '{}'", apkDbPath.string()));
-
-      u64 count = 0;
-
-      try {
-        String line;
-
-        while (std::getline(file, line))
-          if (line.empty())
-            count++;
-      } catch (const std::ios_base::failure& e) {
-        ERR_FMT(IoError, "Error reading Apk database file '{}': {}", apkDbPath.string(), e.what());
-      }
-
-      if (file.bad())
-        ERR_FMT(IoError, "IO error while reading Apk database file '{}'", apkDbPath.string());
-
-      return count;
-    });
+    // Each installed package is one blank-line-terminated stanza.
+    return GetCountFromRecordFile(cache, "apk", "/lib/apk/db/installed", "\n\n");
   }
 
   auto CountDpkg(CacheManager& cache) -> Result<u64> {
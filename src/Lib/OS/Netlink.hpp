@@ -0,0 +1,292 @@
+/**
+ * @file Netlink.hpp
+ * @brief rtnetlink snapshot of network interfaces, addresses and the default route.
+ *
+ * @details getifaddrs() builds a linked list with one node per address and
+ * family, and each address then needs getnameinfo() to be printed. With
+ * hundreds of veth interfaces on a container host that is a lot of small
+ * allocations before the default route is even looked at.
+ *
+ * Dump() instead runs RTM_GETLINK, RTM_GETADDR and RTM_GETROUTE dumps over one
+ * NETLINK_ROUTE socket into a single reused receive buffer. The link dump also
+ * carries IFLA_STATS64, so rx/tx byte counters come for free, and the route
+ * dump yields the default-route interface from the same snapshot.
+ */
+
+#pragma once
+
+#ifdef __linux__
+
+  #include <arpa/inet.h>       // inet_ntop, INET6_ADDRSTRLEN
+  #include <cerrno>            // errno, EINTR
+  #include <cstring>           // std::memcpy, std::strerror
+  #include <format>            // std::format
+  #include <linux/netlink.h>   // nlmsghdr, nlmsgerr, sockaddr_nl, NETLINK_ROUTE, NLM_F_*, NLMSG_*
+  #include <linux/rtnetlink.h> // ifinfomsg, ifaddrmsg, rtmsg, rtattr, rtnl_link_stats64, RTM_*, IFLA_*, IFA_*, RTA_*
+  #include <net/if.h>          // IFF_UP, IFF_LOOPBACK
+  #include <sys/socket.h>      // socket, sendto, recv
+  #include <unistd.h>          // close
+
+  #include <Drac++/Utils/DataTypes.hpp>
+  #include <Drac++/Utils/Error.hpp>
+  #include <Drac++/Utils/Types.hpp>
+
+namespace draconis::os::netlink {
+  namespace types = ::draconis::utils::types;
+
+  using enum ::draconis::utils::error::DracErrorCode;
+
+  /**
+   * @brief Every interface keyed by name, plus the interface carrying the IPv4 default route.
+   */
+  struct Snapshot {
+    types::Map<types::String, types::NetworkInterface> interfaces;
+    types::Option<types::String>                        defaultRouteInterface;
+  };
+
+  namespace detail {
+    // Large enough for the kernel's biggest dump batches (it caps them at 32 KiB),
+    // so no message is ever truncated.
+    constexpr types::usize RECEIVE_BUFFER_SIZE = 32768;
+
+    class Socket {
+     public:
+      Socket()
+        : m_fd(socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE)) {}
+
+      ~Socket() {
+        if (m_fd >= 0)
+          close(m_fd);
+      }
+
+      Socket(const Socket&)                    = delete;
+      Socket(Socket&&)                         = delete;
+      auto operator=(const Socket&) -> Socket& = delete;
+      auto operator=(Socket&&) -> Socket&      = delete;
+
+      [[nodiscard]] auto get() const -> types::i32 {
+        return m_fd;
+      }
+
+     private:
+      types::i32 m_fd;
+    };
+
+    template <typename Payload>
+    auto SendDump(const types::i32 socketFd, const types::u16 type, const types::u32 seq, const Payload& payload) -> types::Result<> {
+      struct Request {
+        nlmsghdr header;
+        Payload  payload;
+      } request {};
+
+      request.header.nlmsg_len   = NLMSG_LENGTH(sizeof(Payload));
+      request.header.nlmsg_type  = type;
+      request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+      request.header.nlmsg_seq   = seq;
+      request.payload            = payload;
+
+      sockaddr_nl kernel {};
+      kernel.nl_family = AF_NETLINK;
+
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) - sockaddr API
+      if (sendto(socketFd, &request, request.header.nlmsg_len, 0, reinterpret_cast<const sockaddr*>(&kernel), sizeof(kernel)) < 0)
+        ERR_FMT(IoError, "netlink sendto failed: {}", std::strerror(errno));
+
+      return {};
+    }
+
+    // Calls `handle` for every message of the dump tagged `seq` until NLMSG_DONE.
+    template <typename Handler>
+    auto ReceiveDump(const types::i32 socketFd, const types::u32 seq, const types::Span<char> buffer, Handler&& handle) -> types::Result<> {
+      while (true) {
+        const types::isize received = recv(socketFd, buffer.data(), buffer.size(), 0);
+
+        if (received < 0 && errno == EINTR)
+          continue;
+
+        if (received < 0)
+          ERR_FMT(IoError, "netlink recv failed: {}", std::strerror(errno));
+
+        if (received == 0)
+          ERR(IoError, "netlink socket closed mid-dump");
+
+        auto remaining = static_cast<types::i32>(received);
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-cstyle-cast) - netlink macros
+        for (auto* header = reinterpret_cast<nlmsghdr*>(buffer.data()); NLMSG_OK(header, remaining); header = NLMSG_NEXT(header, remaining)) {
+          if (header->nlmsg_seq != seq)
+            continue;
+
+          if (header->nlmsg_type == NLMSG_DONE)
+            return {};
+
+          if (header->nlmsg_type == NLMSG_ERROR) {
+            const auto* error = static_cast<const nlmsgerr*>(NLMSG_DATA(header));
+
+            if (error->error == 0)
+              continue;
+
+            ERR_FMT(ApiUnavailable, "netlink dump failed: {}", std::strerror(-error->error));
+          }
+
+          handle(header);
+        }
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-cstyle-cast)
+      }
+    }
+
+    template <typename Handler>
+    auto ForEachAttribute(const rtattr* attr, types::i32 length, Handler&& handle) -> types::Unit {
+      // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-cstyle-cast) - netlink macros
+      for (; RTA_OK(attr, length); attr = RTA_NEXT(attr, length))
+        handle(attr);
+      // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-cstyle-cast)
+    }
+
+    inline auto FormatAddress(const types::i32 family, const types::RawPointer data) -> types::Option<types::String> {
+      types::Array<char, INET6_ADDRSTRLEN> text {};
+
+      if (!inet_ntop(family, data, text.data(), text.size()))
+        return types::None;
+
+      return types::String(text.data());
+    }
+  } // namespace detail
+
+  /**
+   * @brief Takes a snapshot of every link, its addresses and counters, and the default route.
+   * @return The snapshot, or an error if the netlink socket is unavailable (e.g. sandboxed).
+   */
+  inline auto Dump() -> types::Result<Snapshot> {
+    using namespace detail;
+
+    const Socket sock;
+
+    if (sock.get() < 0)
+      ERR_FMT(ApiUnavailable, "Failed to open netlink socket: {}", std::strerror(errno));
+
+    alignas(nlmsghdr) types::Array<char, RECEIVE_BUFFER_SIZE> buffer;
+
+    Snapshot                                       snapshot;
+    types::UnorderedMap<types::i32, types::String> namesByIndex;
+
+    // Dumps on one socket must run one at a time; the kernel rejects a second
+    // dump request while one is still in progress.
+    TRY_VOID(SendDump(sock.get(), RTM_GETLINK, 1, ifinfomsg { .ifi_family = AF_UNSPEC }));
+    TRY_VOID(ReceiveDump(sock.get(), 1, buffer, [&](nlmsghdr* header) {
+      const auto* info = static_cast<const ifinfomsg*>(NLMSG_DATA(header));
+
+      types::NetworkInterface interface;
+      interface.isUp       = (info->ifi_flags & IFF_UP) != 0;
+      interface.isLoopback = (info->ifi_flags & IFF_LOOPBACK) != 0;
+
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-cstyle-cast) - netlink macros
+      ForEachAttribute(IFLA_RTA(info), static_cast<types::i32>(IFLA_PAYLOAD(header)), [&](const rtattr* attr) {
+        const types::usize payload = RTA_PAYLOAD(attr);
+
+        switch (attr->rta_type) {
+          case IFLA_IFNAME:
+            interface.name = types::String(static_cast<types::PCStr>(RTA_DATA(attr)), strnlen(static_cast<types::PCStr>(RTA_DATA(attr)), payload));
+            break;
+          case IFLA_ADDRESS:
+            if (payload == 6) {
+              const auto* mac      = static_cast<const types::u8*>(RTA_DATA(attr));
+              interface.macAddress = std::format("{:02x}:{:02x}:{:02x}:{:02x}:{:02x}:{:02x}", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+            }
+            break;
+          case IFLA_STATS64:
+            if (payload >= sizeof(rtnl_link_stats64)) {
+              rtnl_link_stats64 stats;
+              std::memcpy(&stats, RTA_DATA(attr), sizeof(stats)); // attribute data is only 4-byte aligned
+              interface.rxBytes = stats.rx_bytes;
+              interface.txBytes = stats.tx_bytes;
+            }
+            break;
+          default: break;
+        }
+      });
+
+      if (interface.name.empty())
+        return;
+
+      namesByIndex[info->ifi_index] = interface.name;
+      snapshot.interfaces.insert_or_assign(interface.name, std::move(interface));
+    }));
+
+    TRY_VOID(SendDump(sock.get(), RTM_GETADDR, 2, ifaddrmsg { .ifa_family = AF_UNSPEC }));
+    TRY_VOID(ReceiveDump(sock.get(), 2, buffer, [&](nlmsghdr* header) {
+      const auto* info = static_cast<const ifaddrmsg*>(NLMSG_DATA(header));
+
+      const auto nameIter = namesByIndex.find(static_cast<types::i32>(info->ifa_index));
+
+      if (nameIter == namesByIndex.end() || (info->ifa_family != AF_INET && info->ifa_family != AF_INET6))
+        return;
+
+      types::NetworkInterface& interface = snapshot.interfaces[nameIter->second];
+
+      // For IPv4, IFA_LOCAL is the interface's own address (IFA_ADDRESS is the
+      // peer on point-to-point links); IPv6 only sends IFA_ADDRESS.
+      types::RawPointer local   = nullptr;
+      types::RawPointer address = nullptr;
+
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-cstyle-cast) - netlink macros
+      ForEachAttribute(IFA_RTA(info), static_cast<types::i32>(IFA_PAYLOAD(header)), [&](const rtattr* attr) {
+        if (attr->rta_type == IFA_LOCAL)
+          local = RTA_DATA(attr);
+        else if (attr->rta_type == IFA_ADDRESS)
+          address = RTA_DATA(attr);
+      });
+
+      const types::RawPointer chosen = local ? local : address;
+
+      if (!chosen)
+        return;
+
+      types::Option<types::String>& slot = info->ifa_family == AF_INET ? interface.ipv4Address : interface.ipv6Address;
+
+      if (!slot)
+        slot = FormatAddress(info->ifa_family, chosen);
+    }));
+
+    types::Option<types::u32> bestMetric;
+
+    TRY_VOID(SendDump(sock.get(), RTM_GETROUTE, 3, rtmsg { .rtm_family = AF_INET }));
+    TRY_VOID(ReceiveDump(sock.get(), 3, buffer, [&](nlmsghdr* header) {
+      const auto* route = static_cast<const rtmsg*>(NLMSG_DATA(header));
+
+      if (route->rtm_dst_len != 0 || route->rtm_type != RTN_UNICAST)
+        return;
+
+      types::u32                table     = route->rtm_table;
+      types::u32                metric    = 0;
+      types::Option<types::i32> outIfIndex;
+
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-cstyle-cast) - netlink macros
+      ForEachAttribute(RTM_RTA(route), static_cast<types::i32>(RTM_PAYLOAD(header)), [&](const rtattr* attr) {
+        switch (attr->rta_type) {
+          case RTA_TABLE:    std::memcpy(&table, RTA_DATA(attr), sizeof(table)); break;
+          case RTA_PRIORITY: std::memcpy(&metric, RTA_DATA(attr), sizeof(metric)); break;
+          case RTA_OIF: {
+            types::i32 index = 0;
+            std::memcpy(&index, RTA_DATA(attr), sizeof(index));
+            outIfIndex = index;
+            break;
+          }
+          default: break;
+        }
+      });
+
+      if (table != RT_TABLE_MAIN || !outIfIndex || (bestMetric && *bestMetric <= metric))
+        return;
+
+      if (const auto nameIter = namesByIndex.find(*outIfIndex); nameIter != namesByIndex.end()) {
+        snapshot.defaultRouteInterface = nameIter->second;
+        bestMetric                     = metric;
+      }
+    }));
+
+    return snapshot;
+  }
+} // namespace draconis::os::netlink
+
+#endif // __linux__
@@ -0,0 +1,434 @@
+/**
+ * @file PciIndex.hpp
+ * @brief Compact, binary-searchable index over the pci.ids database.
+ *
+ * @details pci.ids is a ~1.3 MB text file, and scanning it linearly for every
+ * GPU lookup faults in the whole database. This header converts it once into a
+ * small sorted index of (vendor, device) -> name offsets that is persisted next
+ * to the cache and memory-mapped on later runs, so a lookup is two binary
+ * searches over a few pages.
+ *
+ * The index header records a fingerprint of the source it was built from; a
+ * mismatch (pci.ids updated, different embedded database) triggers a rebuild.
+ *
+ * Layout (native byte order, all records 8-byte aligned):
+ * - Header   { "DRACPCI1", u64 fingerprint, u32 vendorCount, u32 deviceCount, u32 stringsSize, u32 reserved }
+ * - Vendors  vendorCount × { u16 id, u16 reserved, u32 nameOffset, u32 firstDevice, u32 deviceCount }, sorted by id
+ * - Devices  deviceCount × { u16 id, u16 reserved, u32 nameOffset }, sorted by id within each vendor
+ * - Strings  NUL-terminated names referenced by the offsets above
+ */
+
+#pragma once
+
+#ifdef __linux__
+
+  #include <algorithm>    // std::ranges::{sort, stable_sort, unique}
+  #include <charconv>     // std::from_chars
+  #include <cstring>      // std::memcpy
+  #include <fcntl.h>      // open, O_RDONLY, O_CLOEXEC
+  #include <filesystem>   // std::filesystem
+  #include <format>       // std::format
+  #include <fstream>      // std::ofstream
+  #include <ranges>       // std::views::{common, split}
+  #include <sys/mman.h>   // mmap, munmap
+  #include <sys/stat.h>   // fstat
+  #include <system_error> // std::error_code
+  #include <unistd.h>     // close, getpid
+  #include <utility>      // std::exchange
+
+  #include <Drac++/Utils/Error.hpp>
+  #include <Drac++/Utils/Types.hpp>
+
+namespace draconis::os::pci {
+  namespace types = ::draconis::utils::types;
+  namespace fs    = std::filesystem;
+
+  using enum ::draconis::utils::error::DracErrorCode;
+
+  namespace detail {
+    constexpr types::StringView INDEX_MAGIC = "DRACPCI1";
+
+    struct Header {
+      types::Array<char, 8> magic;
+      types::u64            fingerprint;
+      types::u32            vendorCount;
+      types::u32            deviceCount;
+      types::u32            stringsSize;
+      types::u32            reserved;
+    };
+
+    struct VendorRecord {
+      types::u16 id;
+      types::u16 reserved;
+      types::u32 nameOffset;
+      types::u32 firstDevice;
+      types::u32 deviceCount;
+    };
+
+    struct DeviceRecord {
+      types::u16 id;
+      types::u16 reserved;
+      types::u32 nameOffset;
+    };
+
+    template <typename T>
+    auto Read(const types::StringView image, const types::usize offset) -> T {
+      T value;
+      std::memcpy(&value, image.data() + offset, sizeof(T));
+      return value;
+    }
+
+    template <typename T>
+    auto Append(types::String& out, const T& value) -> types::Unit {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    inline auto ParseId(const types::StringView text) -> types::Option<types::u16> {
+      const types::StringView digits = text.starts_with("0x") ? text.substr(2) : text;
+
+      types::u16 value = 0;
+
+      if (digits.size() != 4)
+        return types::None;
+
+      const auto [ptr, errc] = std::from_chars(digits.data(), digits.data() + digits.size(), value, 16);
+
+      if (errc != std::errc() || ptr != digits.data() + digits.size())
+        return types::None;
+
+      return value;
+    }
+
+    // Parses "<4 hex digits>  <name>" and returns the id and name.
+    inline auto ParseEntry(const types::StringView line) -> types::Option<types::Pair<types::u16, types::StringView>> {
+      if (line.size() < 7 || line[4] != ' ')
+        return types::None;
+
+      const types::Option<types::u16> entryId = ParseId(line.substr(0, 4));
+
+      if (!entryId)
+        return types::None;
+
+      const types::usize namePos = line.find_first_not_of(' ', 4);
+
+      if (namePos == types::StringView::npos)
+        return types::None;
+
+      return types::Pair(*entryId, line.substr(namePos));
+    }
+  } // namespace detail
+
+  /**
+   * @brief Builds a serialized index from the text of a pci.ids database.
+   * @param source Contents of pci.ids.
+   * @param fingerprint Value identifying @p source, stored in the header.
+   * @return The serialized index.
+   */
+  inline auto BuildIndex(const types::StringView source, const types::u64 fingerprint) -> types::String {
+    using namespace detail;
+    using std::views::common;
+    using std::views::split;
+
+    struct PendingVendor {
+      types::u16                                              id;
+      types::StringView                                       name;
+      types::Vec<types::Pair<types::u16, types::StringView>> devices;
+    };
+
+    types::Vec<PendingVendor> vendors;
+    bool                      inVendor = false;
+
+    for (auto lineRange : source | split('\n') | common) {
+      types::StringView line(&*lineRange.begin(), lineRange.size());
+
+      if (line.ends_with('\r'))
+        line.remove_suffix(1);
+
+      if (line.empty() || line.front() == '#')
+        continue;
+
+      if (line.front() != '\t') {
+        // Class lines ("C 03  Display controller") fail to parse and end the vendor section.
+        const types::Option<types::Pair<types::u16, types::StringView>> vendor = ParseEntry(line);
+
+        inVendor = vendor.has_value();
+
+        if (inVendor)
+          vendors.push_back({ .id = vendor->first, .name = vendor->second, .devices = {} });
+      } else if (inVendor && line.size() > 1 && line[1] != '\t') {
+        if (const types::Option<types::Pair<types::u16, types::StringView>> device = ParseEntry(line.substr(1)))
+          vendors.back().devices.push_back(*device);
+      }
+    }
+
+    // pci.ids is sorted already; make sure of it and keep the first of any duplicates.
+    std::ranges::stable_sort(vendors, {}, &PendingVendor::id);
+    vendors.erase(std::ranges::unique(vendors, {}, &PendingVendor::id).begin(), vendors.end());
+
+    types::String strings;
+
+    const auto intern = [&strings](const types::StringView name) -> types::u32 {
+      const auto offset = static_cast<types::u32>(strings.size());
+      strings.append(name);
+      strings.push_back('\0');
+      return offset;
+    };
+
+    types::Vec<VendorRecord> vendorRecords;
+    types::Vec<DeviceRecord> deviceRecords;
+    vendorRecords.reserve(vendors.size());
+
+    for (PendingVendor& vendor : vendors) {
+      std::ranges::stable_sort(vendor.devices, {}, &types::Pair<types::u16, types::StringView>::first);
+      vendor.devices.erase(std::ranges::unique(vendor.devices, {}, &types::Pair<types::u16, types::StringView>::first).begin(), vendor.devices.end());
+
+      vendorRecords.push_back({
+        .id          = vendor.id,
+        .reserved    = 0,
+        .nameOffset  = intern(vendor.name),
+        .firstDevice = static_cast<types::u32>(deviceRecords.size()),
+        .deviceCount = static_cast<types::u32>(vendor.devices.size()),
+      });
+
+      for (const auto& [deviceId, deviceName] : vendor.devices)
+        deviceRecords.push_back({ .id = deviceId, .reserved = 0, .nameOffset = intern(deviceName) });
+    }
+
+    Header header {
+      .magic       = {},
+      .fingerprint = fingerprint,
+      .vendorCount = static_cast<types::u32>(vendorRecords.size()),
+      .deviceCount = static_cast<types::u32>(deviceRecords.size()),
+      .stringsSize = static_cast<types::u32>(strings.size()),
+      .reserved    = 0,
+    };
+    std::memcpy(header.magic.data(), INDEX_MAGIC.data(), INDEX_MAGIC.size());
+
+    types::String image;
+    image.reserve(sizeof(Header) + (vendorRecords.size() * sizeof(VendorRecord)) + (deviceRecords.size() * sizeof(DeviceRecord)) + strings.size());
+
+    Append(image, header);
+
+    for (const VendorRecord& record : vendorRecords)
+      Append(image, record);
+
+    for (const DeviceRecord& record : deviceRecords)
+      Append(image, record);
+
+    image.append(strings);
+
+    return image;
+  }
+
+  /**
+   * @brief A loaded index, either memory-mapped from disk or held in memory.
+   */
+  class Index {
+   public:
+    Index() = default;
+
+    ~Index() {
+      if (m_mapping != nullptr)
+        munmap(m_mapping, m_image.size());
+    }
+
+    Index(const Index&)                    = delete;
+    auto operator=(const Index&) -> Index& = delete;
+
+    Index(Index&& other) noexcept
+      : m_mapping(std::exchange(other.m_mapping, nullptr)),
+        m_owned(std::move(other.m_owned)),
+        m_image(std::exchange(other.m_image, {})) {
+      if (m_mapping == nullptr)
+        m_image = m_owned;
+    }
+
+    auto operator=(Index&&) -> Index& = delete;
+
+    /**
+     * @brief Loads the index at @p indexPath, rebuilding it if it is missing or stale.
+     * @param indexPath Where the serialized index lives.
+     * @param fingerprint Identifies the current pci.ids source.
+     * @param readSource Returns the pci.ids text; only called when a rebuild is needed.
+     * @return The loaded index, or an error if the source couldn't be read.
+     *
+     * @note Failing to write the rebuilt index is not an error; the in-memory
+     *       copy is used for this run and the build is retried next time.
+     */
+    static auto load(const fs::path& indexPath, const types::u64 fingerprint, const types::Fn<types::Result<types::String>()>& readSource)
+      -> types::Result<Index> {
+      if (Index mapped = mapFile(indexPath); mapped.matches(fingerprint))
+        return mapped;
+
+      const types::String source = TRY(readSource());
+
+      Index built;
+      built.m_owned = BuildIndex(source, fingerprint);
+      built.m_image = built.m_owned;
+
+      if (!built.valid())
+        ERR(ParseError, "Failed to build PCI ID index");
+
+      std::error_code errc;
+      fs::create_directories(indexPath.parent_path(), errc);
+
+      const fs::path tempPath = fs::path(std::format("{}.{}.tmp", indexPath.string(), getpid()));
+
+      if (std::ofstream ofs(tempPath, std::ios::binary | std::ios::trunc); ofs) {
+        ofs.write(built.m_owned.data(), static_cast<std::streamsize>(built.m_owned.size()));
+        ofs.close();
+
+        if (ofs)
+          fs::rename(tempPath, indexPath, errc);
+
+        if (!ofs || errc)
+          fs::remove(tempPath, errc);
+      }
+
+      return built;
+    }
+
+    /**
+     * @brief Looks up the vendor and device names for an id pair.
+     * @return (vendor, device) names, or None if either is unknown.
+     */
+    [[nodiscard]] auto lookup(const types::u16 vendorId, const types::u16 deviceId) const -> types::Option<types::Pair<types::StringView, types::StringView>> {
+      using namespace detail;
+
+      const Header header = Read<Header>(m_image, 0);
+
+      const types::usize vendorsOffset = sizeof(Header);
+      const types::usize devicesOffset = vendorsOffset + (header.vendorCount * sizeof(VendorRecord));
+      const types::usize stringsOffset = devicesOffset + (header.deviceCount * sizeof(DeviceRecord));
+
+      const auto name = [&](const types::u32 offset) -> types::StringView {
+        return { m_image.data() + stringsOffset + offset };
+      };
+
+      // Binary search the vendor table...
+      types::usize low = 0, high = header.vendorCount;
+
+      while (low < high) {
+        const types::usize mid    = low + ((high - low) / 2);
+        const auto         vendor = Read<VendorRecord>(m_image, vendorsOffset + (mid * sizeof(VendorRecord)));
+
+        if (vendor.id < vendorId) {
+          low = mid + 1;
+        } else if (vendor.id > vendorId) {
+          high = mid;
+        } else {
+          if (static_cast<types::usize>(vendor.firstDevice) + vendor.deviceCount > header.deviceCount || vendor.nameOffset >= header.stringsSize)
+            return types::None;
+
+          // ...then that vendor's slice of the device table.
+          types::usize devLow = vendor.firstDevice, devHigh = static_cast<types::usize>(vendor.firstDevice) + vendor.deviceCount;
+
+          while (devLow < devHigh) {
+            const types::usize devMid = devLow + ((devHigh - devLow) / 2);
+            const auto         device = Read<DeviceRecord>(m_image, devicesOffset + (devMid * sizeof(DeviceRecord)));
+
+            if (device.id < deviceId)
+              devLow = devMid + 1;
+            else if (device.id > deviceId)
+              devHigh = devMid;
+            else if (device.nameOffset < header.stringsSize)
+              return types::Pair(name(vendor.nameOffset), name(device.nameOffset));
+            else
+              return types::None;
+          }
+
+          return types::None;
+        }
+      }
+
+      return types::None;
+    }
+
+    /**
+     * @brief Parses a sysfs-style id ("0x10de") for use with lookup().
+     */
+    static auto parseId(const types::StringView text) -> types::Option<types::u16> {
+      return detail::ParseId(text);
+    }
+
+   private:
+    types::RawPointer m_mapping = nullptr;
+    types::String     m_owned;
+    types::StringView m_image;
+
+    static auto mapFile(const fs::path& path) -> Index {
+      Index index;
+
+      const types::i32 fileDesc = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+      if (fileDesc < 0)
+        return index;
+
+      struct stat statBuf {};
+
+      if (fstat(fileDesc, &statBuf) == 0 && statBuf.st_size > 0) {
+        types::RawPointer mapped = mmap(nullptr, static_cast<types::usize>(statBuf.st_size), PROT_READ, MAP_PRIVATE, fileDesc, 0);
+
+        if (mapped != MAP_FAILED) {
+          index.m_mapping = mapped;
+          index.m_image   = types::StringView(static_cast<types::PCStr>(mapped), static_cast<types::usize>(statBuf.st_size));
+        }
+      }
+
+      close(fileDesc);
+
+      return index;
+    }
+
+    // Checks that the image is structurally sound, so lookup() can't read out of bounds.
+    [[nodiscard]] auto valid() const -> bool {
+      using namespace detail;
+
+      if (m_image.size() < sizeof(Header) || !m_image.starts_with(INDEX_MAGIC))
+        return false;
+
+      const Header header = Read<Header>(m_image, 0);
+
+      const types::usize expected = sizeof(Header) + (static_cast<types::usize>(header.vendorCount) * sizeof(VendorRecord)) +
+        (static_cast<types::usize>(header.deviceCount) * sizeof(DeviceRecord)) + header.stringsSize;
+
+      return m_image.size() == expected && (header.stringsSize == 0 || m_image.back() == '\0');
+    }
+
+    [[nodiscard]] auto matches(const types::u64 fingerprint) const -> bool {
+      return valid() && detail::Read<detail::Header>(m_image, 0).fingerprint == fingerprint;
+    }
+  };
+
+  /**
+   * @brief Shortens pci.ids names into the model shown for a GPU.
+   * @details Keeps the first word of the vendor ("AMD" for "[AMD/ATI]") and the
+   * bracketed marketing name of the device when there is one, e.g.
+   * "Navi 31 [Radeon RX 7900 XT/7900 XTX]" becomes "AMD Radeon RX 7900 XT/7900 XTX".
+   */
+  constexpr auto CleanGpuModelName(types::String vendor, types::String device) -> types::String {
+    if (vendor.find("[AMD/ATI]") != types::String::npos)
+      vendor = "AMD";
+    else if (const types::usize pos = vendor.find(' '); pos != types::String::npos)
+      vendor = vendor.substr(0, pos);
+
+    if (const types::usize openPos = device.find('['); openPos != types::String::npos)
+      if (const types::usize closePos = device.find(']', openPos); closePos != types::String::npos)
+        device = device.substr(openPos + 1, closePos - openPos - 1);
+
+    constexpr auto trim = [](types::String& str) {
+      if (const types::usize pos = str.find_last_not_of(" \t\n\r"); pos != types::String::npos)
+        str.erase(pos + 1);
+      if (const types::usize pos = str.find_first_not_of(" \t\n\r"); pos != types::String::npos)
+        str.erase(0, pos);
+    };
+
+    trim(vendor);
+    trim(device);
+
+    return std::format("{} {}", vendor, device);
+  }
+} // namespace draconis::os::pci
+
+#endif // __linux__
@@ -0,0 +1,388 @@
+/**
+ * @file SysFs.hpp
+ * @brief Allocation-free reader and single-pass parsers for sysfs and procfs files.
+ *
+ * @details Attributes under /sys are tiny single-line files, and the readouts
+ * that walk them (PCI devices, power supplies, DMI) used to pay for a
+ * std::ifstream, a std::filesystem::path and a std::string per attribute. A
+ * Directory instead holds one O_DIRECTORY descriptor and reads each attribute
+ * with openat() + pread() into a caller-provided buffer, handing back a view
+ * into that buffer. Nothing touches the heap on the success path; error
+ * results still carry a formatted message.
+ *
+ * ForEachLine(), NextField() and ForEachKeyValue() then scan the buffer in
+ * place, so table files (/proc/net/route) and key/value files (/proc/meminfo,
+ * os-release) are parsed in one pass without building strings per line.
+ *
+ * @code{.cpp}
+ * const sysfs::Directory battery = TRY(sysfs::Directory::open("/sys/class/power_supply/BAT0"));
+ *
+ * sysfs::AttributeBuffer buffer;
+ * if (Result<StringView> status = battery.read("status", buffer))
+ *   ...
+ * @endcode
+ */
+
+#pragma once
+
+#ifdef __linux__
+
+  #include <cerrno>   // errno, EACCES, EINTR, ENOENT, ENOTDIR
+  #include <cstring>  // std::strcmp
+  #include <dirent.h> // fdopendir, readdir, closedir
+  #include <fcntl.h>  // openat, O_RDONLY, O_CLOEXEC, O_DIRECTORY, AT_FDCWD
+  #include <format>   // std::format
+  #include <unistd.h> // pread, close, dup, readlinkat
+  #include <utility>  // std::exchange
+
+  #include <Drac++/Utils/Error.hpp>
+  #include <Drac++/Utils/Types.hpp>
+
+namespace draconis::os::sysfs {
+  namespace types = ::draconis::utils::types;
+
+  using enum ::draconis::utils::error::DracErrorCode;
+
+  /**
+   * @brief Stack buffer large enough for any single-value sysfs attribute.
+   */
+  using AttributeBuffer = types::Array<char, 256>;
+
+  namespace detail {
+    inline auto OpenError(const types::i32 err, const types::PCStr name) -> ::draconis::utils::error::DracError {
+      using ::draconis::utils::error::DracError;
+
+      if (err == EACCES)
+        return DracError(PermissionDenied, std::format("Permission denied when opening '{}'", name));
+
+      if (err == ENOENT || err == ENOTDIR)
+        return DracError(NotFound, std::format("Failed to open '{}'", name));
+
+      return DracError(IoError, std::format("Failed to open '{}': errno {}", name, err));
+    }
+
+    // Reads from offset 0 until EOF or the buffer is full; sysfs attributes
+    // arrive in one pread, larger procfs files may take a few.
+    inline auto ReadAt(const types::i32 dirFd, const types::PCStr name, const types::Span<char> buffer) -> types::Result<types::StringView> {
+      const types::i32 fileDescriptor = openat(dirFd, name, O_RDONLY | O_CLOEXEC);
+
+      if (fileDescriptor < 0)
+        return types::Err(OpenError(errno, name));
+
+      types::usize total = 0;
+
+      while (total < buffer.size()) {
+        const types::isize bytesRead = pread(fileDescriptor, buffer.data() + total, buffer.size() - total, static_cast<off_t>(total));
+
+        if (bytesRead < 0 && errno == EINTR)
+          continue;
+
+        if (bytesRead < 0) {
+          const types::i32 err = errno;
+          close(fileDescriptor);
+          ERR_FMT(IoError, "Failed to read '{}': errno {}", name, err);
+        }
+
+        if (bytesRead == 0)
+          break;
+
+        total += static_cast<types::usize>(bytesRead);
+      }
+
+      close(fileDescriptor);
+
+      return types::StringView(buffer.data(), total);
+    }
+
+    // Attribute semantics: the first line, without trailing whitespace.
+    constexpr auto FirstLine(types::StringView contents) -> types::StringView {
+      if (const types::usize newline = contents.find('\n'); newline != types::StringView::npos)
+        contents = contents.substr(0, newline);
+
+      if (const types::usize end = contents.find_last_not_of(" \t\r"); end != types::StringView::npos)
+        return contents.substr(0, end + 1);
+
+      return {};
+    }
+  } // namespace detail
+
+  /**
+   * @brief Reads the first line of a file by absolute path.
+   * @param path File to read.
+   * @param buffer Storage for the contents; the returned view points into it.
+   * @return The line without trailing whitespace (possibly empty).
+   */
+  inline auto ReadAttribute(const types::PCStr path, const types::Span<char> buffer) -> types::Result<types::StringView> {
+    return detail::ReadAt(AT_FDCWD, path, buffer).transform(detail::FirstLine);
+  }
+
+  /**
+   * @brief Reads as much of a file as fits in the buffer.
+   * @param path File to read.
+   * @param buffer Storage for the contents; the returned view points into it.
+   * @return The contents; equal to the buffer's size if the file was truncated.
+   */
+  inline auto ReadContents(const types::PCStr path, const types::Span<char> buffer) -> types::Result<types::StringView> {
+    return detail::ReadAt(AT_FDCWD, path, buffer);
+  }
+
+  /**
+   * @brief Calls @p visit with every line of @p contents (without the newline).
+   * @param visit Callable taking a StringView; return false to stop early.
+   */
+  template <typename Visitor>
+  constexpr auto ForEachLine(types::StringView contents, Visitor&& visit) -> types::Unit {
+    while (!contents.empty()) {
+      const types::usize      newline = contents.find('\n');
+      const types::StringView line    = contents.substr(0, newline);
+
+      if (!visit(line))
+        return;
+
+      if (newline == types::StringView::npos)
+        return;
+
+      contents.remove_prefix(newline + 1);
+    }
+  }
+
+  /**
+   * @brief Splits the next whitespace-separated field off the front of @p rest.
+   * @return The field, or an empty view once @p rest is exhausted.
+   */
+  constexpr auto NextField(types::StringView& rest) -> types::StringView {
+    const types::usize start = rest.find_first_not_of(" \t");
+
+    if (start == types::StringView::npos) {
+      rest = {};
+      return {};
+    }
+
+    rest.remove_prefix(start);
+
+    const types::usize      end   = rest.find_first_of(" \t");
+    const types::StringView field = rest.substr(0, end);
+
+    rest.remove_prefix(end == types::StringView::npos ? rest.size() : end);
+
+    return field;
+  }
+
+  /**
+   * @brief Single-pass scan of "key<separator>value" lines, as in /proc/meminfo or os-release.
+   *
+   * @details Lines without the separator are skipped. Keys and values are
+   * trimmed of surrounding blanks; values are otherwise passed through as-is.
+   *
+   * @param visit Callable taking (key, value) StringViews; return false to stop early.
+   */
+  template <typename Visitor>
+  constexpr auto ForEachKeyValue(const types::StringView contents, const char separator, Visitor&& visit) -> types::Unit {
+    constexpr auto trim = [](types::StringView text) -> types::StringView {
+      const types::usize start = text.find_first_not_of(" \t\r");
+
+      if (start == types::StringView::npos)
+        return {};
+
+      return text.substr(start, text.find_last_not_of(" \t\r") - start + 1);
+    };
+
+    ForEachLine(contents, [&](const types::StringView line) -> bool {
+      const types::usize pos = line.find(separator);
+
+      if (pos == types::StringView::npos)
+        return true;
+
+      return visit(trim(line.substr(0, pos)), trim(line.substr(pos + 1)));
+    });
+  }
+
+  /**
+   * @brief The os-release fields the OS readouts use, as views into the parsed contents.
+   */
+  struct OsReleaseFields {
+    types::StringView name;          ///< NAME, or PRETTY_NAME if there is no NAME
+    types::StringView version;       ///< VERSION, or VERSION_ID if there is no VERSION
+    types::StringView id;            ///< ID
+    bool              hasId = false; ///< Whether there was an ID line at all, even one with an empty value
+  };
+
+  /**
+   * @brief Single-pass parse of os-release(5) contents; surrounding quotes are stripped.
+   */
+  constexpr auto ParseOsRelease(const types::StringView contents) -> OsReleaseFields {
+    constexpr auto unquote = [](const types::StringView val) -> types::StringView {
+      if (val.length() >= 2 && ((val.front() == '"' && val.back() == '"') || (val.front() == '\'' && val.back() == '\'')))
+        return val.substr(1, val.length() - 2);
+
+      return val;
+    };
+
+    types::StringView name, prettyName, version, versionId, id;
+    bool              hasId = false;
+
+    ForEachKeyValue(contents, '=', [&](const types::StringView key, const types::StringView value) -> bool {
+      if (key == "NAME")
+        name = unquote(value);
+      else if (key == "PRETTY_NAME")
+        prettyName = unquote(value);
+      else if (key == "VERSION")
+        version = unquote(value);
+      else if (key == "VERSION_ID")
+        versionId = unquote(value);
+      else if (key == "ID") {
+        id    = unquote(value);
+        hasId = true;
+      }
+
+      return true;
+    });
+
+    return {
+      .name    = name.empty() ? prettyName : name,
+      .version = version.empty() ? versionId : version,
+      .id      = id,
+      .hasId   = hasId,
+    };
+  }
+
+  /**
+   * @brief An open sysfs (or procfs) directory whose attributes can be read by name.
+   */
+  class Directory {
+   public:
+    /**
+     * @brief Opens a directory by absolute path.
+     */
+    static auto open(const types::PCStr path) -> types::Result<Directory> {
+      return openAt(AT_FDCWD, path);
+    }
+
+    /**
+     * @brief Opens a subdirectory (following symlinks, as sysfs device links require).
+     */
+    [[nodiscard]] auto openSubdir(const types::PCStr name) const -> types::Result<Directory> {
+      return openAt(m_fd, name);
+    }
+
+    ~Directory() {
+      if (m_fd >= 0)
+        close(m_fd);
+    }
+
+    Directory(const Directory&)                    = delete;
+    auto operator=(const Directory&) -> Directory& = delete;
+
+    Directory(Directory&& other) noexcept
+      : m_fd(std::exchange(other.m_fd, -1)) {}
+
+    auto operator=(Directory&& other) noexcept -> Directory& {
+      if (this != &other) {
+        if (m_fd >= 0)
+          close(m_fd);
+
+        m_fd = std::exchange(other.m_fd, -1);
+      }
+
+      return *this;
+    }
+
+    /**
+     * @brief Reads an attribute's first line, without trailing whitespace.
+     * @param name Attribute name relative to this directory.
+     * @param buffer Storage for the value; the returned view points into it.
+     */
+    [[nodiscard]] auto read(const types::PCStr name, const types::Span<char> buffer) const -> types::Result<types::StringView> {
+      return detail::ReadAt(m_fd, name, buffer).transform(detail::FirstLine);
+    }
+
+    /**
+     * @brief Reads several attributes of this directory in one call.
+     * @param names Attribute names.
+     * @param buffers One buffer per attribute; the returned views point into them.
+     * @return Each attribute's value, or None if it couldn't be read.
+     */
+    template <types::usize N>
+    [[nodiscard]] auto readAll(const types::Array<types::PCStr, N>& names, types::Array<AttributeBuffer, N>& buffers) const
+      -> types::Array<types::Option<types::StringView>, N> {
+      types::Array<types::Option<types::StringView>, N> values {};
+
+      for (types::usize i = 0; i < N; ++i)
+        if (types::Result<types::StringView> value = read(names[i], buffers[i]))
+          values[i] = *value;
+
+      return values;
+    }
+
+    /**
+     * @brief Reads the last path component of a symlink in this directory.
+     * @details sysfs links such as a device's `driver` point at a directory named
+     * after what they describe, so the basename is the interesting part.
+     * @param name Link name relative to this directory.
+     * @param buffer Storage for the target; the returned view points into it.
+     */
+    [[nodiscard]] auto readLinkName(const types::PCStr name, const types::Span<char> buffer) const -> types::Result<types::StringView> {
+      const types::isize length = readlinkat(m_fd, name, buffer.data(), buffer.size());
+
+      if (length < 0)
+        return types::Err(detail::OpenError(errno, name));
+
+      const types::StringView target(buffer.data(), static_cast<types::usize>(length));
+
+      return target.substr(target.rfind('/') + 1);
+    }
+
+    /**
+     * @brief Calls @p visit with the name of every entry except "." and "..".
+     * @param visit Callable taking a PCStr; return false to stop early.
+     */
+    template <typename Visitor>
+    auto forEachEntry(Visitor&& visit) const -> types::Result<> {
+      // closedir() closes the descriptor fdopendir() took over, and m_fd has to outlive
+      // the stream. The duplicate shares m_fd's offset, hence the rewind.
+      const types::i32 iterFd = dup(m_fd);
+
+      if (iterFd < 0)
+        ERR_FMT(IoError, "Failed to duplicate directory descriptor: errno {}", errno);
+
+      DIR* dir = fdopendir(iterFd);
+
+      if (!dir) {
+        const types::i32 error = errno;
+        close(iterFd);
+        ERR_FMT(IoError, "Failed to iterate directory: errno {}", error);
+      }
+
+      rewinddir(dir);
+
+      while (const dirent* entry = readdir(dir)) {
+        if (std::strcmp(entry->d_name, ".") == 0 || std::strcmp(entry->d_name, "..") == 0)
+          continue;
+
+        if (!visit(static_cast<types::PCStr>(entry->d_name)))
+          break;
+      }
+
+      closedir(dir);
+
+      return {};
+    }
+
+   private:
+    types::i32 m_fd = -1;
+
+    explicit Directory(const types::i32 fileDescriptor)
+      : m_fd(fileDescriptor) {}
+
+    static auto openAt(const types::i32 dirFd, const types::PCStr name) -> types::Result<Directory> {
+      const types::i32 fileDescriptor = openat(dirFd, name, O_RDONLY | O_CLOEXEC | O_DIRECTORY);
+
+      if (fileDescriptor < 0)
+        return types::Err(detail::OpenError(errno, name));
+
+      return Directory(fileDescriptor);
+    }
+  };
+} // namespace draconis::os::sysfs
+
+#endif // __linux__
@@ -7,7 +7,7 @@
  * inline/constexpr to enable inlining and avoid ODR issues when included in multiple TUs.
  *
  * Key features:
- * - Disk usage via statvfs
+ * - Disk usage via statvfs, optionally concurrent with per-mount deadlines
  * - Kernel version via uname
  * - Network interface enumeration via getifaddrs
  * - Environment variable utilities
@@ -19,10 +19,15 @@
 
   #include <cerrno>
   #include <chrono>
+  #include <condition_variable>
   #include <cstring>
   #include <format>
+  #include <memory>
+  #include <mutex>
   #include <sys/statvfs.h>
   #include <sys/utsname.h>
+  #include <thread>
+  #include <unordered_set>
   #include <utility>
 
   #if defined(__linux__)
@@ -111,6 +116,121 @@ namespace draconis::os::unix_shared {
     };
   }
 
+  /**
+   * @brief A mounted filesystem, as listed by the platform's mount table.
+   */
+  struct MountEntry {
+    types::String device;     ///< Source device or remote (e.g. "/dev/sda1", "server:/export").
+    types::String mountPoint; ///< Where it is mounted.
+    types::String filesystem; ///< Filesystem type (e.g. "ext4", "nfs4").
+  };
+
+  /**
+   * @brief Stats several mounts concurrently, giving up on any that don't answer in time.
+   * @param mounts Mounts to query.
+   * @param timeout Deadline for the whole batch, measured from the call.
+   * @return One result per mount, in order; unanswered mounts are Timeout errors.
+   *
+   * @details statvfs on a hung NFS/CIFS mount sleeps uninterruptibly, so each
+   * call runs on its own detached thread that only touches shared state. A
+   * stuck thread is abandoned (it exits whenever the kernel lets it, or with
+   * the process) and the caller moves on at the deadline.
+   *
+   * At most one stat per mount point is in flight process-wide: a mount whose
+   * earlier stat hasn't returned yet is reported as timed out straight away, so
+   * repeated calls (e.g. watch mode) don't pile up threads behind a dead server.
+   */
+  [[nodiscard]] inline auto StatMounts(const types::Vec<MountEntry>& mounts, const std::chrono::milliseconds timeout)
+    -> types::Vec<types::Result<types::DiskInfo>> {
+    struct PendingStat {
+      types::Mutex                                  mutex;
+      std::condition_variable                       ready;
+      types::Option<types::Result<types::DiskInfo>> result;
+    };
+
+    struct InFlightStats {
+      types::Mutex                      mutex;
+      std::unordered_set<types::String> mountPoints;
+    };
+
+    // Leaked on purpose: abandoned threads may still touch it during static destruction.
+    static InFlightStats& inFlight = *new InFlightStats();
+
+    types::Vec<types::SharedPointer<PendingStat>> pending;
+    pending.reserve(mounts.size());
+
+    // Stacked or bind mounts can list one mount point several times; those share a stat.
+    types::UnorderedMap<types::String, types::SharedPointer<PendingStat>> started;
+
+    for (const MountEntry& mount : mounts) {
+      if (const auto iter = started.find(mount.mountPoint); iter != started.end()) {
+        pending.push_back(iter->second);
+        continue;
+      }
+
+      {
+        const types::LockGuard lock(inFlight.mutex);
+
+        if (!inFlight.mountPoints.insert(mount.mountPoint).second) {
+          pending.emplace_back(nullptr);
+          continue;
+        }
+      }
+
+      auto state = std::make_shared<PendingStat>();
+
+      std::thread([state, mount]() {
+        types::Result<types::DiskInfo> info = GetDiskInfoAt(mount.mountPoint.c_str());
+
+        {
+          const types::LockGuard lock(inFlight.mutex);
+          inFlight.mountPoints.erase(mount.mountPoint);
+        }
+
+        {
+          const types::LockGuard lock(state->mutex);
+          state->result = std::move(info);
+        }
+
+        state->ready.notify_one();
+      }).detach();
+
+      started.emplace(mount.mountPoint, state);
+      pending.push_back(std::move(state));
+    }
+
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+
+    types::Vec<types::Result<types::DiskInfo>> results;
+    results.reserve(mounts.size());
+
+    for (types::usize i = 0; i < mounts.size(); ++i) {
+      if (!pending[i]) {
+        results.emplace_back(types::Err(error::DracError(Timeout, std::format("statvfs('{}') from an earlier call still hasn't returned", mounts[i].mountPoint))));
+        continue;
+      }
+
+      PendingStat& state = *pending[i];
+
+      std::unique_lock lock(state.mutex);
+
+      if (state.ready.wait_until(lock, deadline, [&state] { return state.result.has_value(); })) {
+        types::Result<types::DiskInfo> info = *state.result;
+
+        if (info) {
+          info->name       = mounts[i].device;
+          info->filesystem = mounts[i].filesystem;
+        }
+
+        results.push_back(std::move(info));
+      } else {
+        results.emplace_back(types::Err(error::DracError(Timeout, std::format("statvfs('{}') did not answer within {}ms", mounts[i].mountPoint, timeout.count()))));
+      }
+    }
+
+    return results;
+  }
+
   // ─────────────────────────────────────────────────────────────────────────────
   // Kernel Version (uname)
   // ─────────────────────────────────────────────────────────────────────────────
@@ -12,7 +12,9 @@
  * - NPSM COM API for media session information (now playing).
  *
  * To optimize performance, the implementation caches process snapshots and registry
- * handles. Wide strings are used for all string operations to avoid the overhead of
+ * handles. The process tree comes from a single NtQuerySystemInformation snapshot
+ * shared by shell and window manager detection, and related registry values are
+ * fetched together with RegQueryMultipleValuesW. Wide strings are used for all string operations to avoid the overhead of
  * converting between UTF-8 and UTF-16 until the final result is needed.
  *
  * @see draconis::core::system
@@ -24,11 +26,13 @@
     #include <intrin.h> // __cpuid (MSVC/Clang-cl intrinsic)
   #endif
 
+  #include <cstddef>      // offsetof
   #include <dxgi.h>       // IDXGIFactory, IDXGIAdapter, DXGI_ADAPTER_DESC
   #include <ranges>       // std::ranges::find_if, std::ranges::views::transform
   #include <sysinfoapi.h> // GetLogicalProcessorInformationEx, RelationProcessorCore, PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX, KAFFINITY
   #include <tlhelp32.h>   // CreateToolhelp32Snapshot, PROCESSENTRY32W, Process32FirstW, Process32NextW, TH32CS_SNAPPROCESS
   #include <winerror.h>   // DXGI_ERROR_NOT_FOUND, ERROR_FILE_NOT_FOUND, FAILED
+  #include <winternl.h>   // NtQuerySystemInformation, SystemProcessInformation, NTSTATUS, UNICODE_STRING
   #include <winuser.h>    // EnumDisplayMonitors, GetMonitorInfoW, MonitorFromWindow, EnumDisplaySettingsW
 
   // Core Winsock headers
@@ -146,14 +150,15 @@ namespace {
       // Used to receive information about the found file or directory.
       WIN32_FIND_DATAW findData;
 
-      // Begin searching for files and directories.
-      HANDLE hFind = FindFirstFileW(searchPath.c_str(), &findData);
+      // Begin searching for files and directories. FindExInfoBasic skips the 8.3 short
+      // name lookup, and FIND_FIRST_EX_LARGE_FETCH asks for bigger batches per query.
+      HANDLE hFind = FindFirstFileExW(searchPath.c_str(), FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
 
       if (hFind == INVALID_HANDLE_VALUE) {
         if (GetLastError() == ERROR_FILE_NOT_FOUND)
           return 0;
 
-        ERR(IoError, "FindFirstFileW failed");
+        ERR(IoError, "FindFirstFileExW failed");
       }
 
       u64 count = 0;
@@ -215,6 +220,48 @@ namespace {
       ERR_FMT(ParseError, "Registry value exists but is not a string type. Type is: {}", type);
     }
 
+    // Reads several string values of one key in a single RegQueryMultipleValuesW call.
+    // Values that are missing or not strings come back as None.
+    template <usize N>
+    auto GetRegistryValues(const HKEY& hKey, const Array<PWCStr, N>& valueNames) -> Array<Option<WString>, N> {
+      Array<Option<WString>, N> values {};
+
+      Array<VALENTW, N> entries {};
+
+      for (usize i = 0; i < N; ++i)
+        // NOLINTNEXTLINE(*-pro-type-const-cast) - VALENTW is shared with the write-side APIs, but this call only reads the name.
+        entries[i].ve_valuename = const_cast<LPWSTR>(valueNames[i]);
+
+      // One buffer receives every value; each entry points into it.
+      Array<WCStr, 2048> registryBuffer {};
+
+      DWORD dataSizeInBytes = registryBuffer.size() * sizeof(WCStr);
+
+      if (RegQueryMultipleValuesW(hKey, entries.data(), static_cast<DWORD>(N), registryBuffer.data(), &dataSizeInBytes) == ERROR_SUCCESS) {
+        for (usize i = 0; i < N; ++i) {
+          if (entries[i].ve_type != REG_SZ && entries[i].ve_type != REG_EXPAND_SZ)
+            continue;
+
+          // NOLINTNEXTLINE(*-pro-type-reinterpret-cast, *-no-int-to-ptr) - ve_valueptr is the value's address in registryBuffer.
+          const auto* data   = reinterpret_cast<const WCStr*>(entries[i].ve_valueptr);
+          usize       length = entries[i].ve_valuelen / sizeof(WCStr);
+
+          while (length > 0 && data[length - 1] == L'\0')
+            length--;
+
+          values[i] = WString(data, length);
+        }
+
+        return values;
+      }
+
+      // A single missing value fails the whole batch, so fall back to reading them one at a time.
+      for (usize i = 0; i < N; ++i)
+        if (Result<WString> value = GetRegistryValue(hKey, valueNames[i]))
+          values[i] = *std::move(value);
+
+      return values;
+    }
   } // namespace helpers
 
   namespace cache {
@@ -257,7 +304,7 @@ namespace {
     // Caches registry values, allowing them to only be retrieved once.
     class RegistryCache {
      public:
-      RegistryCache() : m_currentVersionKey(nullptr), m_hardwareConfigKey(nullptr) {
+      RegistryCache() : m_currentVersionKey(nullptr), m_hardwareConfigKey(nullptr), m_biosKey(nullptr) {
         // Attempt to open the registry key for Windows version information.
         HKEY currentVersionKey = nullptr;
         if (RegOpenKeyExW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\Microsoft\\Windows NT\\CurrentVersion", 0, KEY_READ, &currentVersionKey) == ERROR_SUCCESS)
@@ -267,6 +314,11 @@ namespace {
         HKEY hardwareConfigKey = nullptr;
         if (RegOpenKeyExW(HKEY_LOCAL_MACHINE, L"SYSTEM\\CurrentControlSet\\Control\\CrashControl\\MachineCrash", 0, KEY_READ, &hardwareConfigKey) == ERROR_SUCCESS)
           m_hardwareConfigKey = RegistryKey(hardwareConfigKey);
+
+        // Attempt to open the registry key for system (BIOS/SMBIOS) information.
+        HKEY biosKey = nullptr;
+        if (RegOpenKeyExW(HKEY_LOCAL_MACHINE, L"HARDWARE\\DESCRIPTION\\System\\BIOS", 0, KEY_READ, &biosKey) == ERROR_SUCCESS)
+          m_biosKey = RegistryKey(biosKey);
       }
 
       static auto getInstance() -> const RegistryCache& {
@@ -280,6 +332,9 @@ namespace {
       [[nodiscard]] auto getHardwareConfigKey() const -> HKEY {
         return m_hardwareConfigKey.get();
       }
+      [[nodiscard]] auto getBiosKey() const -> HKEY {
+        return m_biosKey.get();
+      }
 
       ~RegistryCache()                                       = default;
       RegistryCache(const RegistryCache&)                    = delete;
@@ -290,6 +345,7 @@ namespace {
      private:
       RegistryKey m_currentVersionKey;
       RegistryKey m_hardwareConfigKey;
+      RegistryKey m_biosKey;
     };
 
     // Caches OS version data for use in other functions.
@@ -465,49 +521,12 @@ namespace {
         std::call_once(m_initFlag, [this, &initSuccess]() {
           debug_log("ProcessTreeCache: Starting initialization...");
 
-          // Use the Toolhelp32Snapshot API to get a snapshot of all running processes.
-          HandleWrapper<HANDLE> hSnap(CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0));
-
-          if (!hSnap) {
-            debug_log("ProcessTreeCache: CreateToolhelp32Snapshot failed, error: {}", GetLastError());
-            return;
-          }
-
-          // This structure must be initialized with its own size before use; it's a WinAPI requirement.
-          PROCESSENTRY32W pe32 {};
-          pe32.dwSize = sizeof(PROCESSENTRY32W);
-
-          // Get the first process from the snapshot.
-          if (!Process32FirstW(hSnap.get(), &pe32)) {
-            debug_log("ProcessTreeCache: Process32FirstW failed, error: {}", GetLastError());
-            return;
-          }
-
           UnorderedMap<DWORD, Data> processMap;
 
-          while (true) {
-            // Extract the executable name from the full path.
-            WStringView exeFileView(pe32.szExeFile);
-
-            // Find the last backslash to get just the executable name.
-            const usize start = exeFileView.find_last_of(L'\\') != WStringView::npos ? exeFileView.find_last_of(L'\\') + 1 : 0;
-            const usize end   = exeFileView.length();
-
-            WStringView stemView = exeFileView.substr(start, end - start);
-
-            // Remove .exe extension if present
-            if (stemView.size() > 4 && stemView.substr(stemView.size() - 4) == L".exe")
-              stemView = stemView.substr(0, stemView.size() - 4);
-
-            WString baseName(stemView);
-            std::ranges::transform(baseName, baseName.begin(), [](const WCStr character) { return towlower(character); });
-
-            if (const Result<String> baseNameUTF8 = helpers::ConvertWStringToUTF8(baseName))
-              processMap[pe32.th32ProcessID] = Data { .parentPid = pe32.th32ParentProcessID, .baseExeNameLower = *baseNameUTF8 };
-
-            if (!Process32NextW(hSnap.get(), &pe32))
-              break;
-          }
+          // One NtQuerySystemInformation call returns every process with its image name and parent,
+          // which is what CreateToolhelp32Snapshot builds on internally before copying it out entry by entry.
+          if (!snapshotWithNtQuery(processMap) && !snapshotWithToolhelp(processMap))
+            return;
 
           // Atomic update of the process map
           {
@@ -542,6 +561,116 @@ namespace {
       mutable Mutex             m_processMutex;
       std::once_flag            m_initFlag;
 
+      // Leading fields of the kernel's SYSTEM_PROCESS_INFORMATION. The SDK header hides
+      // the parent PID behind a reserved member and MinGW names the fields differently,
+      // so the documented layout is spelled out here.
+      struct ProcessInformation {
+        ULONG           nextEntryOffset;
+        ULONG           numberOfThreads;
+        Array<BYTE, 48> reserved;
+        UNICODE_STRING  imageName;
+        LONG            basePriority;
+        HANDLE          uniqueProcessId;
+        HANDLE          inheritedFromUniqueProcessId;
+      };
+
+      static_assert(offsetof(ProcessInformation, uniqueProcessId) == (sizeof(void*) == 8 ? 80 : 68));
+
+      // Stores a process under its lowercase executable name without the ".exe" suffix.
+      static auto addProcess(UnorderedMap<DWORD, Data>& processMap, const DWORD pid, const DWORD parentPid, WStringView exeName) -> Unit {
+        // Find the last backslash to get just the executable name.
+        if (const usize lastSlash = exeName.find_last_of(L'\\'); lastSlash != WStringView::npos)
+          exeName.remove_prefix(lastSlash + 1);
+
+        // Remove .exe extension if present
+        if (exeName.size() > 4 && exeName.substr(exeName.size() - 4) == L".exe")
+          exeName.remove_suffix(4);
+
+        WString baseName(exeName);
+        std::ranges::transform(baseName, baseName.begin(), [](const WCStr character) { return towlower(character); });
+
+        if (const Result<String> baseNameUTF8 = helpers::ConvertWStringToUTF8(baseName))
+          processMap[pid] = Data { .parentPid = parentPid, .baseExeNameLower = *baseNameUTF8 };
+      }
+
+      static auto snapshotWithNtQuery(UnorderedMap<DWORD, Data>& processMap) -> bool {
+        constexpr NTSTATUS statusInfoLengthMismatch = static_cast<NTSTATUS>(0xC0000004L);
+
+        // Typically a few hundred KiB; the kernel reports the size it needs if this is too small.
+        // u64 elements keep the entries 8-byte aligned, as the kernel lays them out.
+        Vec<u64> buffer(256 * 1024 / sizeof(u64));
+
+        NTSTATUS status = 0;
+
+        for (i32 attempt = 0; attempt < 4; ++attempt) {
+          ULONG requiredBytes = 0;
+
+          status = NtQuerySystemInformation(SystemProcessInformation, buffer.data(), static_cast<ULONG>(buffer.size() * sizeof(u64)), &requiredBytes);
+
+          if (status != statusInfoLengthMismatch)
+            break;
+
+          // Leave headroom for processes started between the two calls.
+          buffer.resize((requiredBytes + 64 * 1024) / sizeof(u64) + 1);
+        }
+
+        if (status < 0) {
+          debug_log("ProcessTreeCache: NtQuerySystemInformation failed, status: {:#x}", static_cast<u32>(status));
+          return false;
+        }
+
+        // NOLINTBEGIN(*-pro-type-reinterpret-cast, *-pro-bounds-pointer-arithmetic) - walking the kernel's variable-length entry list.
+        const auto* entryBytes = reinterpret_cast<const BYTE*>(buffer.data());
+
+        while (true) {
+          const auto* entry = reinterpret_cast<const ProcessInformation*>(entryBytes);
+
+          // The image name length is in bytes; the System Idle Process has none.
+          const WStringView exeName = entry->imageName.Buffer ? WStringView(entry->imageName.Buffer, entry->imageName.Length / sizeof(WCHAR)) : WStringView();
+
+          addProcess(
+            processMap,
+            static_cast<DWORD>(reinterpret_cast<ULONG_PTR>(entry->uniqueProcessId)),
+            static_cast<DWORD>(reinterpret_cast<ULONG_PTR>(entry->inheritedFromUniqueProcessId)),
+            exeName
+          );
+
+          if (entry->nextEntryOffset == 0)
+            break;
+
+          entryBytes += entry->nextEntryOffset;
+        }
+        // NOLINTEND(*-pro-type-reinterpret-cast, *-pro-bounds-pointer-arithmetic)
+
+        return true;
+      }
+
+      static auto snapshotWithToolhelp(UnorderedMap<DWORD, Data>& processMap) -> bool {
+        // Use the Toolhelp32Snapshot API to get a snapshot of all running processes.
+        HandleWrapper<HANDLE> hSnap(CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0));
+
+        if (!hSnap) {
+          debug_log("ProcessTreeCache: CreateToolhelp32Snapshot failed, error: {}", GetLastError());
+          return false;
+        }
+
+        // This structure must be initialized with its own size before use; it's a WinAPI requirement.
+        PROCESSENTRY32W pe32 {};
+        pe32.dwSize = sizeof(PROCESSENTRY32W);
+
+        // Get the first process from the snapshot.
+        if (!Process32FirstW(hSnap.get(), &pe32)) {
+          debug_log("ProcessTreeCache: Process32FirstW failed, error: {}", GetLastError());
+          return false;
+        }
+
+        do
+          addProcess(processMap, pe32.th32ProcessID, pe32.th32ParentProcessID, pe32.szExeFile);
+        while (Process32NextW(hSnap.get(), &pe32));
+
+        return true;
+      }
+
       ProcessTreeCache()  = default;
       ~ProcessTreeCache() = default;
     };
@@ -602,7 +731,17 @@ namespace {
     }
   } // namespace shell
 
-  auto GetDiskInfoForDrive(const String& driveRoot, CacheManager& /*cache*/) -> Result<DiskInfo> {
+  // Filesystem name of a drive (e.g. "NTFS"), or "Unknown" if the volume doesn't say.
+  auto GetDriveFilesystem(const String& driveRoot) -> String {
+    Array<char, MAX_PATH> filesystem = {};
+
+    if (GetVolumeInformationA(driveRoot.c_str(), nullptr, 0, nullptr, nullptr, nullptr, filesystem.data(), MAX_PATH))
+      return filesystem.data();
+
+    return "Unknown";
+  }
+
+  auto GetDiskInfoForDrive(const String& driveRoot, String filesystem) -> Result<DiskInfo> {
     DiskInfo disk;
 
     // Set name and mount point (same for Windows drives)
@@ -632,12 +771,7 @@ namespace {
         break;
     }
 
-    // Get filesystem type
-    Array<char, MAX_PATH> filesystem = {};
-    if (GetVolumeInformationA(driveRoot.c_str(), nullptr, 0, nullptr, nullptr, nullptr, filesystem.data(), MAX_PATH))
-      disk.filesystem = filesystem.data();
-    else
-      disk.filesystem = "Unknown";
+    disk.filesystem = std::move(filesystem);
 
     // Get disk space information
     ULARGE_INTEGER freeBytes, totalBytes, totalFreeBytes;
@@ -660,6 +794,10 @@ namespace {
 
     return disk;
   }
+
+  auto GetDiskInfoForDrive(const String& driveRoot, CacheManager& /*cache*/) -> Result<DiskInfo> {
+    return GetDiskInfoForDrive(driveRoot, GetDriveFilesystem(driveRoot));
+  }
 } // namespace
 
 namespace draconis::core::system {
@@ -698,7 +836,13 @@ namespace draconis::core::system {
       if (!currentVersionKey)
         ERR(NotFound, "Failed to open registry key");
 
-      WString productName = TRY(GetRegistryValue(currentVersionKey, PRODUCT_NAME));
+      // Both values live under the same key, so fetch them in one query.
+      auto [productNameOpt, displayVersionOpt] = GetRegistryValues(currentVersionKey, Array<PWCStr, 2> { PRODUCT_NAME, DISPLAY_VERSION });
+
+      if (!displayVersionOpt)
+        ERR(NotFound, "DisplayVersion not found in registry");
+
+      WString productName = std::move(productNameOpt).value_or(WString());
 
       if (productName.empty())
         ERR(NotFound, "ProductName not found in registry");
@@ -717,12 +861,9 @@ namespace draconis::core::system {
               productName.replace(pos, windowsLen, windows11);
           }
 
-      // Append the display version if it exists.
-      WString displayVersion = TRY(GetRegistryValue(currentVersionKey, DISPLAY_VERSION));
-
       String productNameUTF8 = TRY(ConvertWStringToUTF8(productName));
 
-      String displayVersionUTF8 = TRY(ConvertWStringToUTF8(displayVersion));
+      String displayVersionUTF8 = TRY(ConvertWStringToUTF8(*displayVersionOpt));
 
       return OSInfo(productNameUTF8, displayVersionUTF8, "windows");
     });
@@ -731,18 +872,18 @@ namespace draconis::core::system {
   auto GetHost(CacheManager& cache) -> Result<String> {
     return cache.getOrSet<String>("windows_host", draconis::utils::cache::CachePolicy::neverExpire(), []() -> Result<String> {
       // Read from BIOS registry key which contains system product information
-      HKEY biosKey = nullptr;
+      HKEY biosKey = RegistryCache::getInstance().getBiosKey();
 
-      if (RegOpenKeyExW(HKEY_LOCAL_MACHINE, L"HARDWARE\\DESCRIPTION\\System\\BIOS", 0, KEY_READ, &biosKey) != ERROR_SUCCESS)
+      if (!biosKey)
         ERR(NotFound, "Failed to open BIOS registry key");
 
-      RegistryKey biosKeyGuard(biosKey);
+      const auto [systemFamily, productName] = GetRegistryValues(biosKey, Array<PWCStr, 2> { SYSTEM_FAMILY, SYSTEM_PRODUCT_NAME });
 
       // Try SystemFamily first (e.g., "ASUS TUF Gaming F15"), then fall back to SystemProductName
-      if (Result<WString> systemFamily = GetRegistryValue(biosKey, SYSTEM_FAMILY); systemFamily)
+      if (systemFamily)
         return ConvertWStringToUTF8(*systemFamily);
 
-      if (Result<WString> productName = GetRegistryValue(biosKey, SYSTEM_PRODUCT_NAME); productName)
+      if (productName)
         return ConvertWStringToUTF8(*productName);
 
       ERR(NotFound, "Failed to get system family or product name from BIOS registry");
@@ -802,16 +943,18 @@ namespace draconis::core::system {
 
   auto GetShell(CacheManager& cache) -> Result<String> {
     return cache.getOrSet<String>("windows_shell", draconis::utils::cache::CachePolicy::tempDirectory(), []() -> Result<String> {
-      using draconis::utils::env::GetEnv;
+      using draconis::utils::env::EnvSnapshot, draconis::utils::env::GetEnvSnapshot;
       using shell::FindShellInProcessTree;
 
+      const EnvSnapshot& env = GetEnvSnapshot();
+
       // MSYS2 environments automatically set the MSYSTEM environment variable.
-      if (const Result<String> msystemResult = GetEnv("MSYSTEM"); msystemResult && !msystemResult->empty()) {
+      if (env.msystem && !env.msystem->empty()) {
         String shellPath;
 
         // The SHELL environment variable should basically always be set.
-        if (const Result<String> shellResult = GetEnv("SHELL"); shellResult && !shellResult->empty())
-          shellPath = *shellResult;
+        if (env.shell && !env.shell->empty())
+          shellPath = *env.shell;
 
         if (!shellPath.empty()) {
           // Get the executable name from the path.
@@ -872,7 +1015,7 @@ namespace draconis::core::system {
     return ResourceUsage(totalBytes.QuadPart - freeBytes.QuadPart, totalBytes.QuadPart);
   }
 
-  auto GetDisks(CacheManager& cache) -> Result<Vec<DiskInfo>> {
+  auto GetDisks(CacheManager& /*cache*/, const DiskQueryOptions& options) -> Result<Vec<DiskInfo>> {
     Array<char, MAX_PATH> drives = {};
 
     DWORD size = GetLogicalDriveStringsA(MAX_PATH, drives.data());
@@ -886,9 +1029,10 @@ namespace draconis::core::system {
     while (index < MAX_PATH && drives.at(index) != '\0') {
       const char* drive = std::addressof(drives.at(index));
 
-      const Result<DiskInfo> diskInfo = GetDiskInfoForDrive(drive, cache);
-      if (diskInfo)
-        disks.push_back(*diskInfo);
+      // Filter before querying free space, so excluded drives are never asked for it.
+      if (String filesystem = GetDriveFilesystem(drive); options.selects(filesystem))
+        if (Result<DiskInfo> diskInfo = GetDiskInfoForDrive(drive, std::move(filesystem)))
+          disks.push_back(std::move(*diskInfo));
 
       // Move to next drive string (skip null terminator)
       index += static_cast<usize>(strlen(drive)) + 1;
@@ -5,6 +5,10 @@
   #include <CoreGraphics/CGDirectDisplay.h>  // CGDisplayCopyDeviceDescription, CGDisplayCopyDisplayMode, CGDisplayIsMain, CGDisplayModeGetMaximumRefreshRate, CGDisplayModeGetRefreshRate, CGDisplayPixelsHigh, CGDisplayPixelsWide, CGDisplayRef, CGDisplayModeRef, CGDirectDisplayID
   #include <IOKit/ps/IOPSKeys.h>             // kIOPSCurrentCapacityKey, kIOPSInternalBatteryType, kIOPSIsChargingKey, kIOPSTimeToEmptyKey, kIOPSTypeKey
   #include <IOKit/ps/IOPowerSources.h>       // IOPSCopyPowerSourcesInfo, IOPSGetPowerSourceDescription
+  #include <algorithm>                       // std::ranges::{find, replace_if}
+  #include <cerrno>                          // errno, EINTR, ENOENT, ENOTDIR
+  #include <cstring>                         // std::memcpy, std::strerror
+  #include <fcntl.h>                         // open, O_CLOEXEC, O_DIRECTORY, O_RDONLY
   #include <map>                             // std::map
   #include <ifaddrs.h>                       // freeifaddrs, getifaddrs, ifaddrs, sockaddr
   #include <mach/mach_host.h>                // host_statistics64
@@ -15,8 +19,12 @@
   #include <net/route.h>                     // RTA_DST, RTF_GATEWAY, rt_msghdr
   #include <netdb.h>                         // NI_MAXHOST, NI_NUMERICHOST, getnameinfo
   #include <netinet/in.h>                    // sockaddr_in
+  #include <sys/attr.h>                      // attrlist, attribute_set_t, attrreference_t, getattrlistbulk, ATTR_CMN_*
   #include <sys/sysctl.h>                    // {CTL_KERN, KERN_PROC, KERN_PROC_ALL, kinfo_proc, sysctl, sysctlbyname}
+  #include <sys/vnode.h>                     // fsobj_type_t, VDIR
+  #include <unistd.h>                        // close
 
+  #include <Drac++/Core/Collector.hpp>
   #include <Drac++/Core/System.hpp>
   #include <Drac++/Services/Packages.hpp>
 
@@ -402,7 +410,7 @@ namespace draconis::core::system {
 
   auto GetShell(CacheManager& cache) -> Result<String> {
     return cache.getOrSet<String>("macos_shell", CachePolicy::tempDirectory(), []() -> Result<String> {
-      if (const Result<String> shellPath = draconis::utils::env::GetEnv("SHELL")) {
+      if (const Result<String> shellPath = draconis::utils::env::ToResult(draconis::utils::env::GetEnvSnapshot().shell)) {
         // clang-format off
         constexpr Array<Pair<StringView, StringView>, 8> shellMap {{
             { "bash", "Bash"      },
@@ -753,41 +761,147 @@ namespace draconis::core::system {
 namespace draconis::services::packages {
   namespace fs = std::filesystem;
 
-  auto GetHomebrewCount(CacheManager& cache) -> Result<u64> {
-    return cache.getOrSet<u64>("homebrew_total", [&]() -> Result<u64> {
-      Array<fs::path, 2> cellarPaths {
-        "/opt/homebrew/Cellar",
-        "/usr/local/Cellar",
-      };
+  namespace {
+    // Counts the non-hidden subdirectories of `dirPath` (one per formula in a
+    // Cellar, one per cask in a Caskroom). getattrlistbulk returns the name and
+    // type of many entries per call, so no entry needs its own stat.
+    auto CountSubdirectories(const fs::path& dirPath) -> Result<u64> {
+      const i32 dirFd = open(dirPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+      if (dirFd < 0) {
+        if (errno == ENOENT || errno == ENOTDIR)
+          ERR_FMT(NotFound, "Homebrew directory '{}' does not exist", dirPath.string());
+
+        ERR_FMT(ResourceExhausted, "Failed to open Homebrew directory '{}': {} (resource exhausted or API unavailable)", dirPath.string(), std::strerror(errno));
+      }
+
+      attrlist request {};
+      request.bitmapcount = ATTR_BIT_MAP_COUNT;
+      request.commonattr  = ATTR_CMN_RETURNED_ATTRS | ATTR_CMN_NAME | ATTR_CMN_OBJTYPE;
+
+      alignas(u64) Array<char, 65536> buffer;
 
       u64 count = 0;
 
-      for (const fs::path& cellarPath : cellarPaths) {
-        if (std::error_code errc; !fs::exists(cellarPath, errc) || errc) {
-          if (errc && errc != std::errc::no_such_file_or_directory)
-            ERR_FMT(ResourceExhausted, "fs::exists('{}') failed: {} (resource exhausted or API unavailable)", cellarPath.string(), errc.message());
+      while (true) {
+        const i32 entries = getattrlistbulk(dirFd, &request, buffer.data(), buffer.size(), 0);
 
-          continue;
+        if (entries < 0) {
+          if (errno == EINTR)
+            continue;
+
+          const i32 err = errno;
+          close(dirFd);
+          ERR_FMT(IoError, "getattrlistbulk failed for '{}': {}", dirPath.string(), std::strerror(err));
         }
 
-        // Use the non-cached version to avoid nested cache calls
-        Result dirCount = GetCountFromDirectoryNoCache("homebrew_" + cellarPath.filename().string(), cellarPath, None, true);
+        if (entries == 0)
+          break;
 
-        if (!dirCount) {
-          if (dirCount.error().code != NotFound)
-            return dirCount;
+        // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic) - walking packed, variable-length attribute records.
+        const char* record = buffer.data();
 
-          continue;
-        }
+        for (i32 i = 0; i < entries; ++i) {
+          // Each record is: u32 length, the returned-attributes set, then the
+          // requested attributes in bit order (name reference, object type).
+          u32 length = 0;
+          std::memcpy(&length, record, sizeof(length));
 
-        count += *dirCount;
+          const char* field = record + sizeof(length);
+
+          attribute_set_t returned {};
+          std::memcpy(&returned, field, sizeof(returned));
+          field += sizeof(returned);
+
+          StringView name;
+
+          if (returned.commonattr & ATTR_CMN_NAME) {
+            attrreference_t nameRef {};
+            std::memcpy(&nameRef, field, sizeof(nameRef));
+            name = StringView(field + nameRef.attr_dataoffset);
+            field += sizeof(nameRef);
+          }
+
+          fsobj_type_t type = VNON;
+
+          if (returned.commonattr & ATTR_CMN_OBJTYPE)
+            std::memcpy(&type, field, sizeof(type));
+
+          if (type == VDIR && !name.empty() && !name.starts_with('.'))
+            count++;
+
+          record += length;
+        }
+        // NOLINTEND(*-pro-bounds-pointer-arithmetic)
       }
 
-      if (count == 0)
-        ERR(NotFound, "No Homebrew packages found in any Cellar directory");
+      close(dirFd);
 
       return count;
-    });
+    }
+
+    // Every Homebrew prefix that might exist: Apple silicon, Intel (also used
+    // under Rosetta), and a custom HOMEBREW_PREFIX if it's neither.
+    auto HomebrewPrefixes() -> Vec<fs::path> {
+      Vec<fs::path> prefixes { "/opt/homebrew", "/usr/local" };
+
+      if (const Result<String> customPrefix = draconis::utils::env::GetEnv("HOMEBREW_PREFIX"); customPrefix && !customPrefix->empty())
+        if (std::ranges::find(prefixes, fs::path(*customPrefix)) == prefixes.end())
+          prefixes.emplace_back(*customPrefix);
+
+      return prefixes;
+    }
+  } // namespace
+
+  auto GetHomebrewCount(CacheManager& cache) -> Result<u64> {
+    using draconis::core::collector::Collector;
+
+    // Formulae are directories under <prefix>/Cellar, casks under <prefix>/Caskroom.
+    Vec<fs::path> directories;
+
+    for (const fs::path& prefix : HomebrewPrefixes())
+      for (const char* const subdir : { "Cellar", "Caskroom" })
+        directories.push_back(prefix / subdir);
+
+    Vec<Option<Result<u64>>> results(directories.size());
+
+    Collector collector;
+
+    for (usize i = 0; i < directories.size(); ++i)
+      collector.add(directories[i].string(), [&, i] {
+        // Installing or removing a formula or cask adds or removes an entry, bumping the directory's mtime.
+        // Keys double as cache file names, so the path's separators are flattened.
+        String key = std::format("pkg_count_homebrew{}", directories[i].string());
+        std::ranges::replace_if(key, [](const char chr) { return chr == '/' || chr == ' '; }, '_');
+
+        results[i] = cache.getOrSetValidated<u64>(key, { directories[i] }, [&]() -> Result<u64> {
+          return CountSubdirectories(directories[i]);
+        });
+      });
+
+    collector.run();
+
+    u64  count = 0;
+    bool found = false;
+
+    for (usize i = 0; i < directories.size(); ++i) {
+      Result<u64>& dirCount = *results[i];
+
+      if (!dirCount) {
+        if (dirCount.error().code != NotFound)
+          return dirCount;
+
+        continue;
+      }
+
+      found = true;
+      count += *dirCount;
+    }
+
+    if (!found || count == 0)
+      ERR(NotFound, "No Homebrew packages found in any Cellar or Caskroom directory");
+
+    return count;
   }
 
   auto GetMacPortsCount(CacheManager& cache) -> Result<u64> {
@@ -12,10 +12,44 @@
     #include <pugixml.hpp> // pugi::{xml_document, xml_node, xml_parse_result}
   #endif
 
+  #ifdef __linux__
+    #include <dirent.h>      // dirent64, DT_*
+    #include <fcntl.h>       // open, O_RDONLY, O_DIRECTORY, O_CLOEXEC
+    #include <sys/stat.h>    // fstatat, S_ISREG
+    #include <sys/syscall.h> // SYS_getdents64
+    #include <unistd.h>      // syscall, close
+  #elifdef _WIN32
+    #include <windows.h> // FindFirstFileExW, FindNextFileW, FindClose
+  #else
+    #include <dirent.h>   // opendir, readdir, closedir, dirfd, DT_*
+    #include <fcntl.h>    // AT_* for fstatat
+    #include <sys/stat.h> // fstatat, S_ISREG
+  #endif
+
+  #ifndef _WIN32
+    #include <sys/mman.h> // mmap, madvise, munmap
+    #include <sys/stat.h> // fstat
+    #include <unistd.h>   // close
+  #endif
+
+  #if DRAC_ARCH_X86_64
+    #include <immintrin.h> // _mm_*, _mm256_*
+  #elif DRAC_ARCH_AARCH64
+    #include <arm_neon.h> // vld1q_u8, vceqq_u8, vandq_u8, vaddvq_u8
+  #endif
+
+  #include <algorithm>    // std::count
+  #include <array>        // std::to_array
+  #include <bit>          // std::popcount
+  #include <cerrno>       // errno, EACCES, ENOENT, ENOTDIR
+  #include <chrono>       // std::chrono::{duration_cast, seconds, system_clock}
+  #include <cstring>      // std::strerror
   #include <filesystem>   // std::filesystem
+  #include <iterator>     // std::back_inserter
   #include <matchit.hpp>  // matchit::{match, is, or_, _}
   #include <system_error> // std::{errc, error_code}
 
+  #include "Drac++/Core/Collector.hpp"
   #include "Drac++/Utils/Env.hpp"
   #include "Drac++/Utils/Error.hpp"
   #include "Drac++/Utils/Logging.hpp"
@@ -25,69 +59,386 @@ namespace fs = std::filesystem;
 
 using namespace draconis::utils::types;
 using draconis::utils::cache::CacheManager;
+using draconis::utils::cache::CachePolicy;
 using enum draconis::utils::error::DracErrorCode;
 
 namespace {
   constexpr const char* CACHE_KEY_PREFIX = "pkg_count_";
 
-  auto GetCountFromDirectoryImplNoCache(
-    const String&         pmId,
-    const fs::path&       dirPath,
-    const Option<String>& fileExtensionFilter,
-    const bool            subtractOne
-  ) -> Result<u64> {
-    std::error_code fsErrCode;
+  // A count whose source just changed (a package was installed) is shown as it was while
+  // the new one is counted out of band, so the run right after a transaction stays fast.
+  // The fetchers are kept for that refresh, which is why they capture by value.
+  constexpr bool SERVE_STALE_COUNTS = true;
+
+  // Whether a raw directory entry name is counted: "." and ".." never are, and with a
+  // suffix filter only names that have a stem in front of the suffix (as extension() would).
+  constexpr auto NameMatches(const StringView name, const StringView suffix) -> bool {
+    if (name == "." || name == "..")
+      return false;
 
-    fsErrCode.clear();
+    return suffix.empty() || (name.size() > suffix.size() && name.ends_with(suffix));
+  }
+
+  #ifdef __linux__
+  // getdents64 records match glibc's dirent64 and musl's dirent (which is always 64-bit).
+    #ifdef __GLIBC__
+  using KernelDirent = dirent64;
+    #else
+  using KernelDirent = dirent;
+    #endif
 
-    if (!fs::is_directory(dirPath, fsErrCode)) {
-      if (fsErrCode && fsErrCode != std::errc::no_such_file_or_directory)
-        ERR_FMT(ResourceExhausted, "Filesystem error checking if '{}' is a directory: {} (resource exhausted or API unavailable)", dirPath.string(), fsErrCode.message());
+  // getdents64 straight into a 64 KiB buffer: one syscall per few hundred entries,
+  // and d_type answers "regular file?" without a stat on every filesystem that fills it.
+  auto CountDirectoryEntries(const String& pmId, const fs::path& dirPath, const StringView suffix, const bool regularOnly) -> Result<u64> {
+    const i32 dirFd = open(dirPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
 
-      ERR_FMT(NotFound, "{} path is not a directory: {}", pmId, dirPath.string());
+    if (dirFd < 0) {
+      if (errno == ENOENT || errno == ENOTDIR)
+        ERR_FMT(NotFound, "{} path is not a directory: {}", pmId, dirPath.string());
+
+      ERR_FMT(ResourceExhausted, "Failed to open {} directory '{}': {} (resource exhausted or API unavailable)", pmId, dirPath.string(), std::strerror(errno));
     }
 
-    fsErrCode.clear();
+    alignas(KernelDirent) Array<char, 65536> buffer;
 
-    u64              count     = 0;
-    const bool       hasFilter = fileExtensionFilter.has_value();
-    const StringView filter    = fileExtensionFilter ? StringView(*fileExtensionFilter) : StringView();
+    u64 count = 0;
 
-    try {
-      const fs::directory_iterator dirIter(
-        dirPath,
-        fs::directory_options::skip_permission_denied | fs::directory_options::follow_directory_symlink,
-        fsErrCode
-      );
+    while (true) {
+      const isize bytesRead = syscall(SYS_getdents64, dirFd, buffer.data(), buffer.size());
+
+      if (bytesRead < 0) {
+        const i32 err = errno;
+        close(dirFd);
+        ERR_FMT(ResourceExhausted, "getdents64 failed on {} directory '{}': {}", pmId, dirPath.string(), std::strerror(err));
+      }
+
+      if (bytesRead == 0)
+        break;
 
-      if (fsErrCode)
-        ERR_FMT(ResourceExhausted, "Failed to create iterator for {} directory '{}': {} (resource exhausted or API unavailable)", pmId, dirPath.string(), fsErrCode.message());
+      for (isize offset = 0; offset < bytesRead;) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) - kernel record layout
+        const auto* entry = reinterpret_cast<const KernelDirent*>(buffer.data() + offset);
+        offset += entry->d_reclen;
 
-      if (hasFilter) {
-        for (const fs::directory_entry& entry : dirIter) {
-          if (entry.path().empty())
+        if (!NameMatches(entry->d_name, suffix))
+          continue;
+
+        if (regularOnly && entry->d_type != DT_REG) {
+          // Symlinks are followed and DT_UNKNOWN has to be resolved, as is_regular_file() did.
+          if (entry->d_type != DT_LNK && entry->d_type != DT_UNKNOWN)
             continue;
 
-          if (std::error_code isFileErr; entry.is_regular_file(isFileErr) && !isFileErr) {
-            if (entry.path().extension().string() == filter)
-              count++;
-          } else if (isFileErr)
-            warn_log("Error stating entry '{}' in {} directory: {}", entry.path().string(), pmId, isFileErr.message());
-        }
-      } else {
-        for (const fs::directory_entry& entry : dirIter) {
-          if (!entry.path().empty())
-            count++;
+          struct stat info;
+
+          if (fstatat(dirFd, entry->d_name, &info, 0) != 0) {
+            warn_log("Error stating entry '{}' in {} directory: {}", entry->d_name, pmId, std::strerror(errno));
+            continue;
+          }
+
+          if (!S_ISREG(info.st_mode))
+            continue;
         }
+
+        count++;
       }
-    } catch (const fs::filesystem_error& fsCatchErr) {
-      ERR_FMT(ResourceExhausted, "Filesystem error during {} directory iteration: {} (resource exhausted or API unavailable)", pmId, fsCatchErr.what());
-    } catch (const Exception& exc) {
-      ERR_FMT(InternalError, "Internal error during {} directory iteration: {}", pmId, exc.what());
-    } catch (...) {
-      ERR_FMT(Other, "Unknown error iterating {} directory (unexpected exception)", pmId);
     }
 
+    close(dirFd);
+
+    return count;
+  }
+  #elifdef _WIN32
+  // FindExInfoBasic skips the 8.3 short name, and FIND_FIRST_EX_LARGE_FETCH asks
+  // for bigger batches per directory query.
+  auto CountDirectoryEntries(const String& pmId, const fs::path& dirPath, const StringView suffix, const bool regularOnly) -> Result<u64> {
+    const std::wstring searchPath = (dirPath / L"*").wstring();
+
+    WIN32_FIND_DATAW findData;
+
+    const HANDLE hFind = FindFirstFileExW(searchPath.c_str(), FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+
+    if (hFind == INVALID_HANDLE_VALUE) {
+      if (const DWORD err = GetLastError(); err == ERROR_PATH_NOT_FOUND || err == ERROR_DIRECTORY)
+        ERR_FMT(NotFound, "{} path is not a directory: {}", pmId, dirPath.string());
+      else if (err == ERROR_FILE_NOT_FOUND)
+        return 0;
+
+      ERR_FMT(ResourceExhausted, "FindFirstFileExW failed for {} directory '{}'", pmId, dirPath.string());
+    }
+
+    // Suffixes are ASCII, so they compare against the UTF-16 name unit by unit.
+    std::wstring wideSuffix(suffix.begin(), suffix.end());
+
+    u64 count = 0;
+
+    do {
+      const std::wstring_view name = findData.cFileName;
+
+      if (name == L"." || name == L"..")
+        continue;
+
+      if (!wideSuffix.empty() && (name.size() <= wideSuffix.size() || !name.ends_with(wideSuffix)))
+        continue;
+
+      if (regularOnly && (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+        continue;
+
+      count++;
+    } while (FindNextFileW(hFind, &findData));
+
+    FindClose(hFind);
+
+    return count;
+  }
+  #else
+  // readdir on the BSDs and macOS is already a thin wrapper over getdirentries
+  // with a reused buffer, so this only avoids the per-entry path objects.
+  auto CountDirectoryEntries(const String& pmId, const fs::path& dirPath, const StringView suffix, const bool regularOnly) -> Result<u64> {
+    DIR* dir = opendir(dirPath.c_str());
+
+    if (!dir) {
+      if (errno == ENOENT || errno == ENOTDIR)
+        ERR_FMT(NotFound, "{} path is not a directory: {}", pmId, dirPath.string());
+
+      ERR_FMT(ResourceExhausted, "Failed to open {} directory '{}': {} (resource exhausted or API unavailable)", pmId, dirPath.string(), std::strerror(errno));
+    }
+
+    u64 count = 0;
+
+    while (const dirent* entry = readdir(dir)) {
+      if (!NameMatches(entry->d_name, suffix))
+        continue;
+
+    #ifdef DT_REG
+      if (regularOnly && entry->d_type != DT_REG) {
+        if (entry->d_type != DT_LNK && entry->d_type != DT_UNKNOWN)
+          continue;
+
+        struct stat info;
+
+        if (fstatat(dirfd(dir), entry->d_name, &info, 0) != 0 || !S_ISREG(info.st_mode))
+          continue;
+      }
+    #else
+      if (regularOnly)
+        if (struct stat info; fstatat(dirfd(dir), entry->d_name, &info, 0) != 0 || !S_ISREG(info.st_mode))
+          continue;
+    #endif
+
+      count++;
+    }
+
+    closedir(dir);
+
+    return count;
+  }
+  #endif
+
+  // Positions in [pos, size - 1) where the byte pair (first, second) starts.
+  // Matches may overlap, so "\n\n\n" holds two blank-line separators, the same
+  // number of empty lines std::getline() would have produced.
+  constexpr auto CountBytePairsScalar(const u8* data, const usize size, usize pos, const u8 first, const u8 second) -> u64 {
+    u64 count = 0;
+
+    for (; pos + 1 < size; ++pos)
+      count += static_cast<u64>(data[pos] == first && data[pos + 1] == second);
+
+    return count;
+  }
+
+  #if DRAC_ARCH_X86_64
+  // Each block compares the window at pos against `first` and the window at pos + 1
+  // against `second`; both loads come out of the same cache lines, so the loop is
+  // bound by memory bandwidth rather than by the compare.
+  auto CountBytePairsSse2(const u8* data, const usize size, usize& pos, const u8 first, const u8 second) -> u64 {
+    const __m128i firstVec  = _mm_set1_epi8(static_cast<char>(first));
+    const __m128i secondVec = _mm_set1_epi8(static_cast<char>(second));
+
+    u64 count = 0;
+
+    for (; pos + 17 <= size; pos += 16) {
+      const __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+      const __m128i next    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + 1));
+      const __m128i hits    = _mm_and_si128(_mm_cmpeq_epi8(current, firstVec), _mm_cmpeq_epi8(next, secondVec));
+
+      count += static_cast<u64>(std::popcount(static_cast<u32>(_mm_movemask_epi8(hits))));
+    }
+
+    return count;
+  }
+
+    #if defined(__GNUC__) || defined(__AVX2__)
+      #ifdef __AVX2__
+        #define DRAC_AVX2_TARGET
+      #else
+        #define DRAC_AVX2_TARGET [[gnu::target("avx2")]]
+      #endif
+
+  DRAC_AVX2_TARGET auto CountBytePairsAvx2(const u8* data, const usize size, usize& pos, const u8 first, const u8 second) -> u64 {
+    const __m256i firstVec  = _mm256_set1_epi8(static_cast<char>(first));
+    const __m256i secondVec = _mm256_set1_epi8(static_cast<char>(second));
+
+    u64 count = 0;
+
+    for (; pos + 33 <= size; pos += 32) {
+      const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+      const __m256i next    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 1));
+      const __m256i hits    = _mm256_and_si256(_mm256_cmpeq_epi8(current, firstVec), _mm256_cmpeq_epi8(next, secondVec));
+
+      count += static_cast<u64>(std::popcount(static_cast<u32>(_mm256_movemask_epi8(hits))));
+    }
+
+    return count;
+  }
+
+      #undef DRAC_AVX2_TARGET
+
+  auto HasAvx2() -> bool {
+      #ifdef __AVX2__
+    return true;
+      #else
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+      #endif
+  }
+    #endif
+  #elif DRAC_ARCH_AARCH64
+  // NEON has no movemask; shifting each 0xFF lane down to 1 and summing across
+  // the vector gives the number of hits in the block instead.
+  auto CountBytePairsNeon(const u8* data, const usize size, usize& pos, const u8 first, const u8 second) -> u64 {
+    const uint8x16_t firstVec  = vdupq_n_u8(first);
+    const uint8x16_t secondVec = vdupq_n_u8(second);
+
+    u64 count = 0;
+
+    for (; pos + 17 <= size; pos += 16) {
+      const uint8x16_t current = vld1q_u8(data + pos);
+      const uint8x16_t next    = vld1q_u8(data + pos + 1);
+      const uint8x16_t hits    = vandq_u8(vceqq_u8(current, firstVec), vceqq_u8(next, secondVec));
+
+      count += vaddvq_u8(vshrq_n_u8(hits, 7));
+    }
+
+    return count;
+  }
+  #endif
+
+  auto CountBytePairs(const u8* data, const usize size, const u8 first, const u8 second) -> u64 {
+    usize pos   = 0;
+    u64   count = 0;
+
+  #if DRAC_ARCH_X86_64
+    #if defined(__GNUC__) || defined(__AVX2__)
+    if (HasAvx2())
+      count += CountBytePairsAvx2(data, size, pos, first, second);
+    #endif
+    count += CountBytePairsSse2(data, size, pos, first, second);
+  #elif DRAC_ARCH_AARCH64
+    count += CountBytePairsNeon(data, size, pos, first, second);
+  #endif
+
+    return count + CountBytePairsScalar(data, size, pos, first, second);
+  }
+
+  // Maps a file read-only for the duration of `visit`. Empty files are never
+  // mapped (mmap rejects a zero length); `visit` just sees an empty view.
+  template <typename Visitor>
+  auto WithMappedFile(const String& pmId, const fs::path& filePath, Visitor&& visit) -> Result<u64> {
+  #ifdef _WIN32
+    const HANDLE file = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE) {
+      if (const DWORD err = GetLastError(); err == ERROR_FILE_NOT_FOUND || err == ERROR_PATH_NOT_FOUND)
+        ERR_FMT(NotFound, "{} database path '{}' does not exist", pmId, filePath.string());
+      else if (err == ERROR_ACCESS_DENIED)
+        ERR_FMT(PermissionDenied, "Permission denied opening {} database file '{}'", pmId, filePath.string());
+
+      ERR_FMT(IoError, "Failed to open {} database file '{}'", pmId, filePath.string());
+    }
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(file, &fileSize)) {
+      CloseHandle(file);
+      ERR_FMT(IoError, "Failed to get size of {} database file '{}'", pmId, filePath.string());
+    }
+
+    if (fileSize.QuadPart == 0) {
+      CloseHandle(file);
+      return visit(StringView());
+    }
+
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+
+    if (!mapping)
+      ERR_FMT(IoError, "Failed to map {} database file '{}'", pmId, filePath.string());
+
+    const LPVOID view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+
+    if (!view)
+      ERR_FMT(IoError, "Failed to map {} database file '{}'", pmId, filePath.string());
+
+    Result<u64> result = visit(StringView(static_cast<const char*>(view), static_cast<usize>(fileSize.QuadPart)));
+
+    UnmapViewOfFile(view);
+  #else
+    const i32 fileDescriptor = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fileDescriptor < 0) {
+      if (errno == ENOENT || errno == ENOTDIR)
+        ERR_FMT(NotFound, "{} database path '{}' does not exist", pmId, filePath.string());
+      else if (errno == EACCES)
+        ERR_FMT(PermissionDenied, "Permission denied opening {} database file '{}'", pmId, filePath.string());
+
+      ERR_FMT(IoError, "Failed to open {} database file '{}': {}", pmId, filePath.string(), std::strerror(errno));
+    }
+
+    struct stat fileStat {};
+
+    if (fstat(fileDescriptor, &fileStat) != 0) {
+      const i32 err = errno;
+      close(fileDescriptor);
+      ERR_FMT(IoError, "Failed to stat {} database file '{}': {}", pmId, filePath.string(), std::strerror(err));
+    }
+
+    const auto size = static_cast<usize>(fileStat.st_size);
+
+    if (size == 0) {
+      close(fileDescriptor);
+      return visit(StringView());
+    }
+
+    // The mapping holds its own reference to the file, so the descriptor can go right away.
+    void*     view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    const i32 err  = errno;
+    close(fileDescriptor);
+
+    if (view == MAP_FAILED)
+      ERR_FMT(IoError, "Failed to map {} database file '{}': {}", pmId, filePath.string(), std::strerror(err));
+
+    madvise(view, size, MADV_SEQUENTIAL);
+
+    Result<u64> result = visit(StringView(static_cast<const char*>(view), size));
+
+    munmap(view, size);
+  #endif
+
+    return result;
+  }
+
+  auto GetCountFromDirectoryImplNoCache(
+    const String&         pmId,
+    const fs::path&       dirPath,
+    const Option<String>& fileExtensionFilter,
+    const bool            subtractOne
+  ) -> Result<u64> {
+    // The extension filter only ever counted regular files, so it doubles as the file-type filter.
+    const StringView suffix = fileExtensionFilter ? StringView(*fileExtensionFilter) : StringView();
+
+    u64 count = TRY(CountDirectoryEntries(pmId, dirPath, suffix, fileExtensionFilter.has_value()));
+
     if (subtractOne && count > 0)
       count--;
 
@@ -101,13 +452,87 @@ namespace {
     const Option<String>& fileExtensionFilter,
     const bool            subtractOne
   ) -> Result<u64> {
-    return cache.getOrSet<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), [&]() -> Result<u64> {
-      return GetCountFromDirectoryImplNoCache(pmId, dirPath, fileExtensionFilter, subtractOne);
-    });
+    // Adding or removing entries bumps the directory's mtime, which marks the cached count stale.
+    return cache.getOrSetValidated<u64>(
+      std::format("{}{}", CACHE_KEY_PREFIX, pmId),
+      { dirPath },
+      [pmId, dirPath, fileExtensionFilter, subtractOne]() -> Result<u64> {
+        return GetCountFromDirectoryImplNoCache(pmId, dirPath, fileExtensionFilter, subtractOne);
+      },
+      SERVE_STALE_COUNTS
+    );
+  }
+
+  #if !defined(__serenity__) && !defined(_WIN32)
+  // Carried between runs under pkg_count_<id>_state by the incremental counter.
+  struct DbCountState {
+    i64 watermark   = 0; // Highest rowid counted so far.
+    u64 rows        = 0; // COUNT(*) of the whole table at that point.
+    u64 count       = 0; // Rows matching the condition.
+    u64 recountedAt = 0; // UNIX time of the last full recount.
+  };
+
+  // Forces a full recount this often (one day), so rows that started matching
+  // the condition after they were counted don't stay missing forever.
+  constexpr u64 FULL_RECOUNT_INTERVAL_SECS = 24 * 60 * 60;
+
+  // Read-only connection tuned for one-shot counting, with reads served from an
+  // mmap of the file instead of being copied into SQLite's page cache. Package
+  // databases are live (the package manager may be writing to them), so this is
+  // plain mode=ro: immutable=1 would skip the locking that keeps reads consistent.
+  auto OpenCountConnection(const fs::path& dbPath) -> SQLite::Database {
+    String uri = "file:";
+
+    // '?' and '#' would end the path part of the URI, and '%' starts an escape.
+    for (const char chr : dbPath.string())
+      if (chr == '?' || chr == '#' || chr == '%')
+        std::format_to(std::back_inserter(uri), "%{:02X}", static_cast<u8>(chr));
+      else
+        uri += chr;
+
+    uri += "?mode=ro";
+
+    SQLite::Database database(uri, SQLite::OPEN_READONLY | SQLite::OPEN_URI);
+
+    database.exec("PRAGMA mmap_size = 268435456");
+    database.exec("PRAGMA temp_store = MEMORY");
+
+    return database;
   }
 
+  // First column of the first row; NULL (MAX over an empty table) reads as 0.
+  auto QueryInt(const SQLite::Database& database, const String& sql, const Option<i64> bound = None) -> Option<i64> {
+    SQLite::Statement statement(database, sql);
+
+    if (bound)
+      statement.bind(1, *bound);
+
+    if (!statement.executeStep())
+      return None;
+
+    const SQLite::Column column = statement.getColumn(0);
+
+    return column.isNull() ? 0 : column.getInt64();
+  }
+  #endif // __serenity__ || _WIN32
 } // namespace
 
+  #if !defined(__serenity__) && !defined(_WIN32)
+template <>
+struct glz::meta<DbCountState> {
+  using T = DbCountState;
+
+  // clang-format off
+  static constexpr detail::Object value = object(
+    "watermark",   &T::watermark,
+    "rows",        &T::rows,
+    "count",       &T::count,
+    "recountedAt", &T::recountedAt
+  );
+  // clang-format on
+};
+  #endif // __serenity__ || _WIN32
+
 namespace draconis::services::packages {
   auto GetCountFromDirectory(
     CacheManager&   cache,
@@ -140,6 +565,44 @@ namespace draconis::services::packages {
     return GetCountFromDirectoryImplNoCache(pmId, dirPath, fileExtensionFilter, subtractOne);
   }
 
+  auto CountRecordSeparators(const StringView data, const StringView separator) -> u64 {
+    const auto* bytes = reinterpret_cast<const u8*>(data.data());
+
+    if (separator.size() == 2)
+      return CountBytePairs(bytes, data.size(), static_cast<u8>(separator[0]), static_cast<u8>(separator[1]));
+
+    if (separator.size() == 1)
+      return static_cast<u64>(std::count(data.begin(), data.end(), separator[0]));
+
+    if (separator.empty())
+      return 0;
+
+    u64 count = 0;
+
+    for (usize pos = data.find(separator); pos != StringView::npos; pos = data.find(separator, pos + 1))
+      count++;
+
+    return count;
+  }
+
+  auto GetCountFromRecordFile(
+    CacheManager&    cache,
+    const String&    pmId,
+    const fs::path&  filePath,
+    const StringView separator
+  ) -> Result<u64> {
+    return cache.getOrSetValidated<u64>(
+      std::format("{}{}", CACHE_KEY_PREFIX, pmId),
+      { filePath },
+      [pmId, filePath, separator = String(separator)]() -> Result<u64> {
+        return WithMappedFile(pmId, filePath, [&](const StringView contents) -> Result<u64> {
+          return CountRecordSeparators(contents, separator);
+        });
+      },
+      SERVE_STALE_COUNTS
+    );
+  }
+
   #if !defined(__serenity__) && !defined(_WIN32)
   auto GetCountFromDb(
     CacheManager&   cache,
@@ -147,14 +610,17 @@ namespace draconis::services::packages {
     const fs::path& dbPath,
     const String&   countQuery
   ) -> Result<u64> {
-    return cache.getOrSet<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), [&]() -> Result<u64> {
+    // Databases in WAL mode only touch the main file on checkpoint, so the WAL has to be fingerprinted too.
+    const Vec<fs::path> sources = { dbPath, fs::path(dbPath.string() + "-wal") };
+
+    return cache.getOrSetValidated<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), sources, [pmId, dbPath, countQuery]() -> Result<u64> {
       u64 count = 0;
 
       try {
         if (std::error_code existsErr; !fs::exists(dbPath, existsErr) || existsErr)
           ERR_FMT(NotFound, "{} database not found at '{}' (file does not exist or access denied)", pmId, dbPath.string());
 
-        const SQLite::Database database(dbPath.string(), SQLite::OPEN_READONLY);
+        const SQLite::Database database = OpenCountConnection(dbPath);
 
         if (SQLite::Statement queryStmt(database, countQuery); queryStmt.executeStep()) {
           const i64 countInt64 = queryStmt.getColumn(0).getInt64();
@@ -174,7 +640,80 @@ namespace draconis::services::packages {
       }
 
       return count;
-    });
+    }, SERVE_STALE_COUNTS);
+  }
+
+  auto GetCountFromDb(
+    CacheManager&             cache,
+    const String&             pmId,
+    const fs::path&           dbPath,
+    const IncrementalDbCount& spec
+  ) -> Result<u64> {
+    using std::chrono::duration_cast, std::chrono::seconds, std::chrono::system_clock;
+
+    const Vec<fs::path> sources = { dbPath, fs::path(dbPath.string() + "-wal") };
+
+    return cache.getOrSetValidated<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), sources, [&cache, pmId, dbPath, spec]() -> Result<u64> {
+      // The state has to survive the database changing, so it's kept under its own key without sources or expiry.
+      const String      stateKey    = std::format("{}{}_state", CACHE_KEY_PREFIX, pmId);
+      const CachePolicy statePolicy = CachePolicy::neverExpire();
+
+      const u64 now = static_cast<u64>(duration_cast<seconds>(system_clock::now().time_since_epoch()).count());
+
+      try {
+        if (std::error_code existsErr; !fs::exists(dbPath, existsErr) || existsErr)
+          ERR_FMT(NotFound, "{} database not found at '{}' (file does not exist or access denied)", pmId, dbPath.string());
+
+        const SQLite::Database database = OpenCountConnection(dbPath);
+
+        // Both are answered from the b-tree alone: MAX(rowid) is one descent, and a bare COUNT(*) walks pages without decoding rows.
+        const Option<i64> watermark = QueryInt(database, std::format("SELECT MAX(rowid) FROM {}", spec.table));
+        const Option<i64> rows      = QueryInt(database, std::format("SELECT COUNT(*) FROM {}", spec.table));
+
+        if (!watermark || !rows || *rows < 0)
+          ERR_FMT(ParseError, "No rows returned by {} DB COUNT query (empty result set)", pmId);
+
+        DbCountState next { .watermark = *watermark, .rows = static_cast<u64>(*rows), .count = 0, .recountedAt = now };
+
+        // Resume from the previous state only if every row since then was an insert above its watermark.
+        Option<i64> countFrom;
+
+        const Option<DbCountState> previous = cache.get<DbCountState>(stateKey, statePolicy);
+
+        if (previous && previous->watermark <= next.watermark && now - previous->recountedAt < FULL_RECOUNT_INTERVAL_SECS) {
+          const Option<i64> added = QueryInt(database, std::format("SELECT COUNT(*) FROM {} WHERE rowid > ?1", spec.table), previous->watermark);
+
+          if (added && previous->rows + static_cast<u64>(*added) == next.rows) {
+            countFrom        = previous->watermark;
+            next.count       = previous->count;
+            next.recountedAt = previous->recountedAt;
+          }
+        }
+
+        const String filter = spec.condition.empty() ? String() : std::format("({})", spec.condition);
+        const String where  = countFrom ? (filter.empty() ? " WHERE rowid > ?1" : std::format(" WHERE rowid > ?1 AND {}", filter))
+                                        : (filter.empty() ? String() : std::format(" WHERE {}", filter));
+
+        const Option<i64> matched = QueryInt(database, std::format("SELECT COUNT(*) FROM {}{}", spec.table, where), countFrom);
+
+        if (!matched || *matched < 0)
+          ERR_FMT(CorruptedData, "Negative count returned by {} DB COUNT query (corrupt database data)", pmId);
+
+        next.count += static_cast<u64>(*matched);
+
+        debug_log("{}: counted {} rows {}", pmId, *matched, countFrom ? std::format("above rowid {}", *countFrom) : String("in full"));
+
+        cache.set(stateKey, next, statePolicy);
+
+        return next.count;
+      } catch (const SQLite::Exception& e) {
+        ERR_FMT(ApiUnavailable, "SQLite error occurred accessing {} database '{}': {}", pmId, dbPath.string(), e.what());
+      } catch (const Exception& e) {
+        ERR_FMT(InternalError, "Standard exception accessing {} database '{}': {}", pmId, dbPath.string(), e.what());
+      } catch (...) {
+        ERR_FMT(Other, "Unknown error occurred accessing {} database (unexpected exception)", pmId);
+      }
+    }, SERVE_STALE_COUNTS);
   }
   #endif // __serenity__ || _WIN32
 
@@ -184,7 +723,7 @@ namespace draconis::services::packages {
     const String&   pmId,
     const fs::path& plistPath
   ) -> Result<u64> {
-    return cache.getOrSet<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), [&]() -> Result<u64> {
+    return cache.getOrSetValidated<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), { plistPath }, [plistPath]() -> Result<u64> {
       xml_document doc;
 
       if (const xml_parse_result result = doc.load_file(plistPath.c_str()); !result)
@@ -229,25 +768,26 @@ namespace draconis::services::packages {
         ERR_FMT(NotFound, "No installed packages found in plist file '{}' (empty package list)", plistPath.string());
 
       return count;
-    });
+    }, SERVE_STALE_COUNTS);
   }
   #endif // __linux__
 
   #if defined(__linux__) || defined(__APPLE__)
   auto CountNix(CacheManager& cache) -> Result<u64> {
-    return GetCountFromDb(cache, "nix", "/nix/var/nix/db/db.sqlite", "SELECT COUNT(path) FROM ValidPaths WHERE sigs IS NOT NULL");
+    return GetCountFromDb(cache, "nix", "/nix/var/nix/db/db.sqlite", IncrementalDbCount { .table = "ValidPaths", .condition = "sigs IS NOT NULL" });
   }
   #endif // __linux__ || __APPLE__
 
   auto CountCargo(CacheManager& cache) -> Result<u64> {
-    using draconis::utils::env::GetEnv;
+    const draconis::utils::env::EnvSnapshot& env = draconis::utils::env::GetEnvSnapshot();
 
     fs::path cargoPath {};
 
-    if (const Result<String> cargoHome = GetEnv("CARGO_HOME"))
-      cargoPath = fs::path(*cargoHome) / "bin";
-    else if (const Result<String> homeDir = GetEnv("HOME"))
-      cargoPath = fs::path(*homeDir) / ".cargo" / "bin";
+    // Installed binaries live in $CARGO_HOME/bin, which defaults to ~/.cargo.
+    if (env.cargoHome)
+      cargoPath = fs::path(*env.cargoHome) / "bin";
+    else if (env.home)
+      cargoPath = fs::path(*env.home) / ".cargo" / "bin";
 
     if (cargoPath.empty() || !fs::exists(cargoPath))
       ERR(ConfigurationError, "Could not find cargo directory (CARGO_HOME or ~/.cargo/bin not configured)");
@@ -255,150 +795,115 @@ namespace draconis::services::packages {
     return GetCountFromDirectory(cache, "cargo", cargoPath);
   }
 
-  auto GetTotalCount(CacheManager& cache, const Manager enabledPackageManagers) -> Result<u64> {
-    u64  totalCount   = 0;
-    bool oneSucceeded = false;
-
-    const auto processResult = [&](const Result<u64>& result) {
-      using matchit::match, matchit::is, matchit::or_, matchit::_;
-
-      if (result) {
-        totalCount += *result;
-        oneSucceeded = true;
-      } else {
-        match(result.error().code)(
-          is | or_(NotFound, ApiUnavailable, NotSupported) = [&] { debug_at(result.error()); },
-          is | _                                           = [&] { error_at(result.error()); }
-        );
-      }
+  namespace {
+    struct Backend {
+      Manager    manager;
+      StringView name;
+      Result<u64> (*count)(CacheManager&);
     };
 
+    // clang-format off
+    constexpr auto BACKENDS = std::to_array<Backend>({
   #ifdef __linux__
-    if (HasPackageManager(enabledPackageManagers, Manager::Apk))
-      processResult(CountApk(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Dpkg))
-      processResult(CountDpkg(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Moss))
-      processResult(CountMoss(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Pacman))
-      processResult(CountPacman(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Rpm))
-      processResult(CountRpm(cache));
+      Backend { Manager::Apk,        "apk",        &CountApk },
+      Backend { Manager::Dpkg,       "dpkg",       &CountDpkg },
+      Backend { Manager::Moss,       "moss",       &CountMoss },
+      Backend { Manager::Pacman,     "pacman",     &CountPacman },
+      Backend { Manager::Rpm,        "rpm",        &CountRpm },
     #ifdef HAVE_PUGIXML
-    if (HasPackageManager(enabledPackageManagers, Manager::Xbps))
-      processResult(CountXbps(cache));
+      Backend { Manager::Xbps,       "xbps",       &CountXbps },
     #endif
   #elif defined(__APPLE__)
-    if (HasPackageManager(enabledPackageManagers, Manager::Homebrew))
-      processResult(GetHomebrewCount(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Macports))
-      processResult(GetMacPortsCount(cache));
+      Backend { Manager::Homebrew,   "homebrew",   &GetHomebrewCount },
+      Backend { Manager::Macports,   "macports",   &GetMacPortsCount },
   #elif defined(_WIN32)
-    if (HasPackageManager(enabledPackageManagers, Manager::Winget))
-      processResult(CountWinGet(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Chocolatey))
-      processResult(CountChocolatey(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Scoop))
-      processResult(CountScoop(cache));
+      Backend { Manager::Winget,     "winget",     &CountWinGet },
+      Backend { Manager::Chocolatey, "chocolatey", &CountChocolatey },
+      Backend { Manager::Scoop,      "scoop",      &CountScoop },
   #elif defined(__FreeBSD__) || defined(__DragonFly__)
-    if (HasPackageManager(enabledPackageManagers, Manager::PkgNg))
-      processResult(GetPkgNgCount(cache));
+      Backend { Manager::PkgNg,      "pkgng",      &GetPkgNgCount },
   #elif defined(__NetBSD__)
-    if (HasPackageManager(enabledPackageManagers, Manager::PkgSrc))
-      processResult(GetPkgSrcCount(cache));
+      Backend { Manager::PkgSrc,     "pkgsrc",     &GetPkgSrcCount },
   #elif defined(__HAIKU__)
-    if (HasPackageManager(enabledPackageManagers, Manager::HaikuPkg))
-      processResult(GetHaikuCount(cache));
+      Backend { Manager::HaikuPkg,   "haikupkg",   &GetHaikuCount },
   #elif defined(__serenity__)
-    if (HasPackageManager(enabledPackageManagers, Manager::Serenity))
-      processResult(GetSerenityCount(cache));
+      Backend { Manager::Serenity,   "serenity",   &GetSerenityCount },
   #endif
-
   #if defined(__linux__) || defined(__APPLE__)
-    if (HasPackageManager(enabledPackageManagers, Manager::Nix))
-      processResult(CountNix(cache));
+      Backend { Manager::Nix,        "nix",        &CountNix },
   #endif
+      Backend { Manager::Cargo,      "cargo",      &CountCargo },
+    });
+    // clang-format on
 
-    if (HasPackageManager(enabledPackageManagers, Manager::Cargo))
-      processResult(CountCargo(cache));
+    auto LogCountError(const Result<u64>& result) -> Unit {
+      using matchit::match, matchit::is, matchit::or_, matchit::_;
 
-    if (!oneSucceeded && totalCount == 0)
-      ERR(UnavailableFeature, "No package managers found or none reported counts (feature not available)");
+      match(result.error().code)(
+        is | or_(NotFound, ApiUnavailable, NotSupported) = [&] { debug_at(result.error()); },
+        is | _                                           = [&] { error_at(result.error()); }
+      );
+    }
+  } // namespace
 
-    return totalCount;
-  }
+  auto GetCounts(CacheManager& cache, const Manager enabledPackageManagers) -> CountTable {
+    using draconis::core::collector::Collector;
 
-  auto GetIndividualCounts(CacheManager& cache, const Manager enabledPackageManagers) -> Result<Map<String, u64>> {
-    Map<String, u64> individualCounts;
-    bool             oneSucceeded = false;
+    // Results are written into fixed slots so the tasks never touch shared state.
+    Array<Option<Result<u64>>, BACKENDS.size()> results;
 
-    const auto processResult = [&](const String& name, const Result<u64>& result) {
-      using matchit::match, matchit::is, matchit::or_, matchit::_;
+    Collector collector;
+
+    for (usize i = 0; i < BACKENDS.size(); ++i)
+      if (HasPackageManager(enabledPackageManagers, BACKENDS[i].manager))
+        collector.add(String(BACKENDS[i].name), [&, i] { results[i] = BACKENDS[i].count(cache); });
 
+    collector.run();
+
+    CountTable table;
+
+    for (usize i = 0; i < BACKENDS.size(); ++i)
+      if (results[i])
+        table.emplace(BACKENDS[i].name, std::move(*results[i]));
+
+    return table;
+  }
+
+  auto GetTotalCount(CacheManager& cache, const Manager enabledPackageManagers) -> Result<u64> {
+    u64  totalCount   = 0;
+    bool oneSucceeded = false;
+
+    for (const auto& [name, result] : GetCounts(cache, enabledPackageManagers)) {
       if (result) {
-        individualCounts[name] = *result;
-        oneSucceeded           = true;
+        totalCount += *result;
+        oneSucceeded = true;
       } else {
-        match(result.error().code)(
-          is | or_(NotFound, ApiUnavailable, NotSupported) = [&] { debug_at(result.error()); },
-          is | _                                           = [&] { error_at(result.error()); }
-        );
+        LogCountError(result);
       }
-    };
+    }
 
-  #ifdef __linux__
-    if (HasPackageManager(enabledPackageManagers, Manager::Apk))
-      processResult("apk", CountApk(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Dpkg))
-      processResult("dpkg", CountDpkg(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Moss))
-      processResult("moss", CountMoss(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Pacman))
-      processResult("pacman", CountPacman(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Rpm))
-      processResult("rpm", CountRpm(cache));
-    #ifdef HAVE_PUGIXML
-    if (HasPackageManager(enabledPackageManagers, Manager::Xbps))
-      processResult("xbps", CountXbps(cache));
-    #endif
-  #elif defined(__APPLE__)
-    if (HasPackageManager(enabledPackageManagers, Manager::Homebrew))
-      processResult("homebrew", GetHomebrewCount(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Macports))
-      processResult("macports", GetMacPortsCount(cache));
-  #elif defined(_WIN32)
-    if (HasPackageManager(enabledPackageManagers, Manager::Winget))
-      processResult("winget", CountWinGet(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Chocolatey))
-      processResult("chocolatey", CountChocolatey(cache));
-    if (HasPackageManager(enabledPackageManagers, Manager::Scoop))
-      processResult("scoop", CountScoop(cache));
-  #elif defined(__FreeBSD__) || defined(__DragonFly__)
-    if (HasPackageManager(enabledPackageManagers, Manager::PkgNg))
-      processResult("pkgng", GetPkgNgCount(cache));
-  #elif defined(__NetBSD__)
-    if (HasPackageManager(enabledPackageManagers, Manager::PkgSrc))
-      processResult("pkgsrc", GetPkgSrcCount(cache));
-  #elif defined(__HAIKU__)
-    if (HasPackageManager(enabledPackageManagers, Manager::HaikuPkg))
-      processResult("haikupkg", GetHaikuCount(cache));
-  #elif defined(__serenity__)
-    if (HasPackageManager(enabledPackageManagers, Manager::Serenity))
-      processResult("serenity", GetSerenityCount(cache));
-  #endif
+    if (!oneSucceeded && totalCount == 0)
+      ERR(UnavailableFeature, "No package managers found or none reported counts (feature not available)");
 
-  #if defined(__linux__) || defined(__APPLE__)
-    if (HasPackageManager(enabledPackageManagers, Manager::Nix))
-      processResult("nix", CountNix(cache));
-  #endif
+    return totalCount;
+  }
 
-    if (HasPackageManager(enabledPackageManagers, Manager::Cargo))
-      processResult("cargo", CountCargo(cache));
+  auto GetIndividualCounts(CacheManager& cache, const Manager enabledPackageManagers) -> Result<Map<String, u64>> {
+    const CountTable table = GetCounts(cache, enabledPackageManagers);
 
-    if (!oneSucceeded && individualCounts.empty())
+    if (table.empty())
       ERR(UnavailableFeature, "No enabled package managers for this platform.");
 
-    if (!oneSucceeded && individualCounts.empty())
+    Map<String, u64> individualCounts;
+
+    for (const auto& [name, result] : table) {
+      if (result)
+        individualCounts.emplace(name, *result);
+      else
+        LogCountError(result);
+    }
+
+    if (individualCounts.empty())
       ERR(UnavailableFeature, "No package managers found or none reported counts (feature not available)");
 
     return individualCounts;
@@ -0,0 +1,190 @@
+#include <Drac++/Utils/Tracing.hpp>
+
+#if DRAC_ENABLE_TRACING
+  #include <algorithm> // std::max
+  #include <chrono>    // std::chrono::steady_clock
+  #include <format>    // std::format_to
+  #include <fstream>   // std::ofstream
+  #include <iterator>  // std::back_inserter
+  #include <mutex>     // std::lock_guard
+
+  #include <Drac++/Utils/Error.hpp>
+
+namespace draconis::utils::tracing {
+  using namespace types;
+  using enum error::DracErrorCode;
+
+  namespace {
+    struct Event {
+      String name;
+      String category;
+      String detail;
+      u64    startNs = 0;
+      u64    endNs   = 0;
+      char   phase   = 'X';
+    };
+
+    // Each thread appends to its own buffer, so recording never contends with
+    // other recording threads; the mutex only serialises against export.
+    struct ThreadBuffer {
+      Mutex      mutex;
+      Vec<Event> events;
+      u32        threadId = 0;
+    };
+
+    auto SteadyNowNs() noexcept -> i64 {
+      using namespace std::chrono;
+      return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    struct Registry {
+      Mutex                            mutex;
+      Vec<SharedPointer<ThreadBuffer>> buffers;
+      std::atomic<i64>                 epochNs = SteadyNowNs();
+    };
+
+    auto GetRegistry() -> Registry& {
+      static Registry registry;
+      return registry;
+    }
+
+    auto GetThreadBuffer() -> ThreadBuffer& {
+      // Registered on first use and kept alive by the registry after the thread
+      // exits, so worker-thread events survive until export.
+      thread_local const SharedPointer<ThreadBuffer> buffer = [] {
+        auto      created  = std::make_shared<ThreadBuffer>();
+        Registry& registry = GetRegistry();
+
+        LockGuard lock(registry.mutex);
+        created->threadId = static_cast<u32>(registry.buffers.size()) + 1;
+        registry.buffers.push_back(created);
+
+        return created;
+      }();
+
+      return *buffer;
+    }
+
+    auto Append(Event event) -> Unit {
+      ThreadBuffer& buffer = GetThreadBuffer();
+
+      LockGuard lock(buffer.mutex);
+      buffer.events.push_back(std::move(event));
+    }
+
+    auto AppendEscaped(String& out, const StringView text) -> Unit {
+      for (const char chr : text)
+        switch (chr) {
+          case '"':  out += R"(\")"; break;
+          case '\\': out += R"(\\)"; break;
+          case '\n': out += R"(\n)"; break;
+          case '\r': out += R"(\r)"; break;
+          case '\t': out += R"(\t)"; break;
+          default:
+            if (static_cast<unsigned char>(chr) < 0x20)
+              std::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<u32>(chr));
+            else
+              out += chr;
+        }
+    }
+  } // namespace
+
+  namespace detail {
+    auto Now() noexcept -> u64 {
+      return static_cast<u64>(std::max<i64>(SteadyNowNs() - GetRegistry().epochNs.load(std::memory_order_relaxed), 0));
+    }
+
+    auto RecordComplete(const StringView name, const StringView category, String detail, const u64 startNs, const u64 endNs) -> Unit {
+      Append({ .name = String(name), .category = String(category), .detail = std::move(detail), .startNs = startNs, .endNs = endNs, .phase = 'X' });
+    }
+  } // namespace detail
+
+  auto Start() -> Unit {
+    Registry& registry = GetRegistry();
+
+    {
+      LockGuard lock(registry.mutex);
+
+      for (const SharedPointer<ThreadBuffer>& buffer : registry.buffers) {
+        LockGuard bufferLock(buffer->mutex);
+        buffer->events.clear();
+      }
+
+      registry.epochNs.store(SteadyNowNs(), std::memory_order_relaxed);
+    }
+
+    detail::Active.store(true, std::memory_order_relaxed);
+  }
+
+  auto Stop() -> Unit {
+    detail::Active.store(false, std::memory_order_relaxed);
+  }
+
+  auto RecordInstant(const StringView name, const StringView category, const StringView detail) -> Unit {
+    const u64 now = detail::Now();
+    Append({ .name = String(name), .category = String(category), .detail = String(detail), .startNs = now, .endNs = now, .phase = 'i' });
+  }
+
+  auto WriteChromeTrace(const std::filesystem::path& path) -> Result<> {
+    Registry& registry = GetRegistry();
+
+    String out = R"({"displayTimeUnit":"ms","traceEvents":[)";
+    bool   first = true;
+
+    {
+      LockGuard lock(registry.mutex);
+
+      for (const SharedPointer<ThreadBuffer>& buffer : registry.buffers) {
+        LockGuard bufferLock(buffer->mutex);
+
+        for (const Event& event : buffer->events) {
+          if (!first)
+            out += ',';
+          first = false;
+
+          out += R"({"name":")";
+          AppendEscaped(out, event.name);
+          out += R"(","cat":")";
+          AppendEscaped(out, event.category);
+
+          // Trace-event timestamps are in microseconds; keep sub-microsecond precision.
+          std::format_to(
+            std::back_inserter(out),
+            R"(","ph":"{}","pid":1,"tid":{},"ts":{:.3f})",
+            event.phase,
+            buffer->threadId,
+            static_cast<f64>(event.startNs) / 1000.0
+          );
+
+          if (event.phase == 'X')
+            std::format_to(std::back_inserter(out), R"(,"dur":{:.3f})", static_cast<f64>(event.endNs - event.startNs) / 1000.0);
+          else
+            out += R"(,"s":"t")";
+
+          if (!event.detail.empty()) {
+            out += R"(,"args":{"detail":")";
+            AppendEscaped(out, event.detail);
+            out += R"("})";
+          }
+
+          out += '}';
+        }
+      }
+    }
+
+    out += "]}\n";
+
+    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+
+    if (!ofs)
+      ERR_FMT(IoError, "Failed to open trace file '{}' for writing", path.string());
+
+    ofs.write(out.data(), static_cast<std::streamsize>(out.size()));
+
+    if (!ofs)
+      ERR_FMT(IoError, "Failed to write trace file '{}'", path.string());
+
+    return {};
+  }
+} // namespace draconis::utils::tracing
+#endif
@@ -0,0 +1,53 @@
+#pragma once
+
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__DragonFly__) || defined(__NetBSD__)
+
+  #include <dlfcn.h>          // dlopen, dlsym, dlerror
+  #include <initializer_list> // std::initializer_list
+
+  #include <Drac++/Utils/Logging.hpp>
+  #include <Drac++/Utils/Types.hpp>
+
+namespace dynlib {
+  namespace types = draconis::utils::types;
+
+  /**
+   * @brief Open the first library in @p names that loads
+   *
+   * Handles are never closed: the wrappers keep their function tables
+   * for the rest of the process, and libwayland keeps a pointer to our log handler.
+   *
+   * @param names Sonames to try, most specific first
+   * @return The library handle, or nullptr if none of them could be loaded
+   */
+  inline auto Open(const std::initializer_list<types::PCStr> names) -> types::RawPointer {
+    for (const types::PCStr name : names)
+      if (types::RawPointer handle = dlopen(name, RTLD_LAZY | RTLD_LOCAL))
+        return handle;
+
+    const types::PCStr reason = dlerror();
+    debug_log("Failed to load {}: {}", *names.begin(), reason ? reason : "unknown error");
+
+    return nullptr;
+  }
+
+  /**
+   * @brief Look up @p name in @p handle and store it as @p Tp
+   *
+   * @param handle A handle returned by Open()
+   * @param name The symbol to resolve
+   * @param out Function or object pointer to fill in
+   * @return Whether the symbol was found
+   */
+  template <typename Tp>
+  auto Resolve(types::RawPointer handle, const types::PCStr name, Tp& out) -> bool {
+    out = reinterpret_cast<Tp>(dlsym(handle, name)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) - dlsym returns void*
+
+    if (!out)
+      debug_log("Missing symbol {}", name);
+
+    return out != nullptr;
+  }
+} // namespace dynlib
+
+#endif // defined(__linux__) || defined(__FreeBSD__) || defined(__DragonFly__) || defined(__NetBSD__)
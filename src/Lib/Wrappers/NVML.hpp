@@ -0,0 +1,119 @@
+#pragma once
+
+#ifdef __linux__
+
+  #include <Drac++/Utils/Types.hpp>
+
+  #include "DynamicLibrary.hpp"
+
+/**
+ * @brief The few NVML calls GetGPUs() needs, declared here so the NVIDIA SDK
+ * isn't a build dependency
+ *
+ * The layouts below match nvml.h; NVML has kept them stable since the `_v2`
+ * entry points were introduced.
+ */
+namespace nvml {
+  namespace types = draconis::utils::types;
+
+  using Return = types::i32; // nvmlReturn_t
+  using Device = struct nvmlDevice_st*;
+
+  constexpr Return SUCCESS = 0;
+
+  struct Memory {
+    unsigned long long total; // NOLINT(google-runtime-int) - matches nvmlMemory_t
+    unsigned long long free;  // NOLINT(google-runtime-int)
+    unsigned long long used;  // NOLINT(google-runtime-int)
+  };
+
+  struct Utilization {
+    unsigned int gpu;    ///< Percent of the last sample period a kernel was running.
+    unsigned int memory; ///< Percent of the last sample period memory was being read or written.
+  };
+
+  struct Api {
+    Return (*init)()                                           = nullptr;
+    Return (*deviceGetHandleByPciBusId)(types::PCStr, Device*) = nullptr;
+    Return (*deviceGetMemoryInfo)(Device, Memory*)             = nullptr;
+    Return (*deviceGetUtilizationRates)(Device, Utilization*)  = nullptr;
+  };
+
+  /**
+   * @brief Load and initialise libnvidia-ml on first use
+   *
+   * Only called once an `nvidia`-bound device has been found, so machines
+   * without the proprietary driver never try to load it.
+   *
+   * @return The entry points, or nullptr if the library or its init failed
+   */
+  inline auto LoadApi() -> const Api* {
+    static const Api* Loaded = [] -> const Api* {
+      static Api api;
+
+      types::RawPointer handle = dynlib::Open({ "libnvidia-ml.so.1", "libnvidia-ml.so" });
+
+      if (!handle)
+        return nullptr;
+
+      const bool resolved =
+        dynlib::Resolve(handle, "nvmlInit_v2", api.init) &&
+        dynlib::Resolve(handle, "nvmlDeviceGetHandleByPciBusId_v2", api.deviceGetHandleByPciBusId) &&
+        dynlib::Resolve(handle, "nvmlDeviceGetMemoryInfo", api.deviceGetMemoryInfo) &&
+        dynlib::Resolve(handle, "nvmlDeviceGetUtilizationRates", api.deviceGetUtilizationRates);
+
+      if (!resolved)
+        return nullptr;
+
+      if (const Return status = api.init(); status != SUCCESS) {
+        debug_log("nvmlInit_v2 failed: {}", status);
+        return nullptr;
+      }
+
+      return &api;
+    }();
+
+    return Loaded;
+  }
+
+  /**
+   * @brief Current VRAM use and utilisation of one device
+   */
+  struct Counters {
+    types::u64                vramTotalBytes;
+    types::u64                vramUsedBytes;
+    types::Option<types::f64> busyPercent;
+  };
+
+  /**
+   * @brief Query a device's counters by its PCI address
+   *
+   * @param pciAddress The sysfs form, e.g. "0000:03:00.0"; NVML accepts it as is
+   * @return The counters, or None if NVML is unavailable or doesn't know the device
+   */
+  inline auto ReadCounters(const types::PCStr pciAddress) -> types::Option<Counters> {
+    const Api* api = LoadApi();
+
+    if (!api)
+      return types::None;
+
+    Device device = nullptr;
+
+    if (api->deviceGetHandleByPciBusId(pciAddress, &device) != SUCCESS)
+      return types::None;
+
+    Memory memory {};
+
+    if (api->deviceGetMemoryInfo(device, &memory) != SUCCESS)
+      return types::None;
+
+    Counters counters { .vramTotalBytes = memory.total, .vramUsedBytes = memory.used, .busyPercent = types::None };
+
+    if (Utilization utilization {}; api->deviceGetUtilizationRates(device, &utilization) == SUCCESS)
+      counters.busyPercent = static_cast<types::f64>(utilization.gpu);
+
+    return counters;
+  }
+} // namespace nvml
+
+#endif // __linux__
@@ -2,27 +2,119 @@
 
 #if (defined(__linux__) || defined(__FreeBSD__) || defined(__DragonFly__) || defined(__NetBSD__)) && DRAC_USE_WAYLAND
 
+  #include <algorithm>        // std::min
   #include <cstring>          // std::strcmp
-  #include <wayland-client.h> // Wayland client library
+  #include <wayland-client.h> // Wayland client types and opcodes
+
+  #ifdef __linux__
+    #include <sys/socket.h> // getsockopt, ucred, SO_PEERCRED
+  #endif
 
   #include <Drac++/Utils/DataTypes.hpp>
   #include <Drac++/Utils/Logging.hpp>
   #include <Drac++/Utils/Types.hpp>
 
+  #include "DynamicLibrary.hpp"
+
 namespace wl {
   namespace types = draconis::utils::types;
 
   using Display          = wl_display;
   using Registry         = wl_registry;
   using Output           = wl_output;
+  using Proxy            = wl_proxy;
   using RegistryListener = wl_registry_listener;
   using OutputListener   = wl_output_listener;
   using Interface        = wl_interface;
 
-  inline const Interface wl_output_interface = ::wl_output_interface;
-
   constexpr types::u32 OUTPUT_MODE_CURRENT = WL_OUTPUT_MODE_CURRENT;
 
+  /**
+   * @brief The libwayland-client entry points the wrappers use
+   *
+   * The protocol helpers in wayland-client-protocol.h are inline calls into
+   * wl_proxy_*, so those plus the two interface descriptors cover everything.
+   */
+  struct Api {
+    decltype(&::wl_display_connect)        displayConnect    = nullptr;
+    decltype(&::wl_display_disconnect)     displayDisconnect = nullptr;
+    decltype(&::wl_display_get_fd)         displayGetFd      = nullptr;
+    decltype(&::wl_display_get_error)      displayGetError   = nullptr;
+    decltype(&::wl_display_roundtrip)      displayRoundtrip  = nullptr;
+    decltype(&::wl_log_set_handler_client) logSetHandler     = nullptr;
+    decltype(&::wl_proxy_marshal_flags)    proxyMarshalFlags = nullptr;
+    decltype(&::wl_proxy_add_listener)     proxyAddListener  = nullptr;
+    decltype(&::wl_proxy_destroy)          proxyDestroy      = nullptr;
+    decltype(&::wl_proxy_get_version)      proxyGetVersion   = nullptr;
+    const Interface*                       registryInterface = nullptr;
+    const Interface*                       outputInterface   = nullptr;
+  };
+
+  /**
+   * @brief Resolve the libwayland-client entry points on first use
+   *
+   * With DRAC_LAZY_DISPLAY_LIBS the library is dlopened the first time a
+   * connection is attempted, which only happens when WAYLAND_DISPLAY is set, so
+   * headless and TTY runs never load it. Otherwise it is linked and the table
+   * just points at the linked symbols.
+   *
+   * @return The entry points, or nullptr if the library is unavailable
+   */
+  inline auto LoadApi() -> const Api* {
+    static const Api* Loaded = [] -> const Api* {
+      static Api api;
+
+  #if DRAC_LAZY_DISPLAY_LIBS
+      types::RawPointer handle = dynlib::Open({ "libwayland-client.so.0", "libwayland-client.so" });
+
+      if (!handle)
+        return nullptr;
+
+      const bool resolved =
+        dynlib::Resolve(handle, "wl_display_connect", api.displayConnect) &&
+        dynlib::Resolve(handle, "wl_display_disconnect", api.displayDisconnect) &&
+        dynlib::Resolve(handle, "wl_display_get_fd", api.displayGetFd) &&
+        dynlib::Resolve(handle, "wl_display_get_error", api.displayGetError) &&
+        dynlib::Resolve(handle, "wl_display_roundtrip", api.displayRoundtrip) &&
+        dynlib::Resolve(handle, "wl_log_set_handler_client", api.logSetHandler) &&
+        dynlib::Resolve(handle, "wl_proxy_marshal_flags", api.proxyMarshalFlags) &&
+        dynlib::Resolve(handle, "wl_proxy_add_listener", api.proxyAddListener) &&
+        dynlib::Resolve(handle, "wl_proxy_destroy", api.proxyDestroy) &&
+        dynlib::Resolve(handle, "wl_proxy_get_version", api.proxyGetVersion) &&
+        dynlib::Resolve(handle, "wl_registry_interface", api.registryInterface) &&
+        dynlib::Resolve(handle, "wl_output_interface", api.outputInterface);
+
+      return resolved ? &api : nullptr;
+  #else
+      api = {
+        .displayConnect    = &::wl_display_connect,
+        .displayDisconnect = &::wl_display_disconnect,
+        .displayGetFd      = &::wl_display_get_fd,
+        .displayGetError   = &::wl_display_get_error,
+        .displayRoundtrip  = &::wl_display_roundtrip,
+        .logSetHandler     = &::wl_log_set_handler_client,
+        .proxyMarshalFlags = &::wl_proxy_marshal_flags,
+        .proxyAddListener  = &::wl_proxy_add_listener,
+        .proxyDestroy      = &::wl_proxy_destroy,
+        .proxyGetVersion   = &::wl_proxy_get_version,
+        .registryInterface = &::wl_registry_interface,
+        .outputInterface   = &::wl_output_interface,
+      };
+
+      return &api;
+  #endif
+    }();
+
+    return Loaded;
+  }
+
+  /**
+   * @brief The loaded entry points; only valid once Connect() has succeeded
+   */
+  inline auto GetApi() -> const Api& {
+    return *LoadApi();
+  }
+
   /**
    * @brief Connect to a Wayland display
    *
@@ -30,10 +122,12 @@ namespace wl {
    * display name as an argument.
    *
    * @param name The name of the display to connect to (or nullptr for default)
-   * @return A pointer to the Wayland display object
+   * @return A pointer to the Wayland display object, or nullptr if libwayland-client isn't available
    */
   inline auto Connect(types::PCStr name) -> Display* {
-    return wl_display_connect(name);
+    const Api* api = LoadApi();
+
+    return api ? api->displayConnect(name) : nullptr;
   }
 
   /**
@@ -45,7 +139,7 @@ namespace wl {
    * @return Unit
    */
   inline auto Disconnect(Display* display) -> types::Unit {
-    wl_display_disconnect(display);
+    GetApi().displayDisconnect(display);
   }
 
   /**
@@ -57,7 +151,17 @@ namespace wl {
    * @return The file descriptor for the Wayland display
    */
   inline auto GetFd(Display* display) -> types::i32 {
-    return wl_display_get_fd(display);
+    return GetApi().displayGetFd(display);
+  }
+
+  /**
+   * @brief Get the last fatal error on a Wayland display connection
+   *
+   * @param display The Wayland display object
+   * @return 0 while the connection is healthy, otherwise an errno value
+   */
+  inline auto GetError(Display* display) -> types::i32 {
+    return GetApi().displayGetError(display);
   }
 
   /**
@@ -67,7 +171,12 @@ namespace wl {
    * @return The registry for the Wayland display
    */
   inline auto GetRegistry(Display* display) -> Registry* {
-    return wl_display_get_registry(display);
+    const Api& api   = GetApi();
+    auto*      proxy = reinterpret_cast<Proxy*>(display); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) - every wl_* object is a wl_proxy
+
+    return reinterpret_cast<Registry*>( // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      api.proxyMarshalFlags(proxy, WL_DISPLAY_GET_REGISTRY, api.registryInterface, api.proxyGetVersion(proxy), 0, nullptr)
+    );
   }
 
   /**
@@ -79,7 +188,9 @@ namespace wl {
    * @return 0 on success, -1 on failure
    */
   inline auto AddRegistryListener(Registry* registry, const RegistryListener* listener, types::RawPointer data) -> types::i32 {
-    return wl_registry_add_listener(registry, listener, data);
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-const-cast) - mirrors wl_registry_add_listener
+    return GetApi().proxyAddListener(reinterpret_cast<Proxy*>(registry), reinterpret_cast<void (**)()>(const_cast<RegistryListener*>(listener)), data);
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-const-cast)
   }
 
   /**
@@ -89,7 +200,7 @@ namespace wl {
    * @return The number of events dispatched
    */
   inline auto Roundtrip(Display* display) -> types::i32 {
-    return wl_display_roundtrip(display);
+    return GetApi().displayRoundtrip(display);
   }
 
   /**
@@ -102,7 +213,17 @@ namespace wl {
    * @return A pointer to the bound object
    */
   inline auto BindRegistry(Registry* registry, const types::u32 name, const Interface* interface, const types::u32 version) -> types::RawPointer {
-    return wl_registry_bind(registry, name, interface, version);
+    return GetApi().proxyMarshalFlags(
+      reinterpret_cast<Proxy*>(registry), // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      WL_REGISTRY_BIND,
+      interface,
+      version,
+      0,
+      name,
+      interface->name,
+      version,
+      nullptr
+    );
   }
 
   /**
@@ -114,7 +235,9 @@ namespace wl {
    * @return 0 on success, -1 on failure
    */
   inline auto AddOutputListener(Output* output, const OutputListener* listener, types::RawPointer data) -> types::i32 {
-    return wl_output_add_listener(output, listener, data);
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-const-cast) - mirrors wl_output_add_listener
+    return GetApi().proxyAddListener(reinterpret_cast<Proxy*>(output), reinterpret_cast<void (**)()>(const_cast<OutputListener*>(listener)), data);
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-const-cast)
   }
 
   /**
@@ -123,7 +246,7 @@ namespace wl {
    * @param output The Wayland output object
    */
   inline auto DestroyOutput(Output* output) -> types::Unit {
-    wl_output_destroy(output);
+    GetApi().proxyDestroy(reinterpret_cast<Proxy*>(output)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
   }
 
   /**
@@ -132,7 +255,7 @@ namespace wl {
    * @param registry The Wayland registry object
    */
   inline auto DestroyRegistry(Registry* registry) -> types::Unit {
-    wl_registry_destroy(registry);
+    GetApi().proxyDestroy(reinterpret_cast<Proxy*>(registry)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
   }
 
   /**
@@ -142,17 +265,23 @@ namespace wl {
    * handles resource acquisition and cleanup.
    */
   class DisplayGuard {
-    Display* m_display; ///< The Wayland display object
+    Display* m_display = nullptr; ///< The Wayland display object
 
    public:
     /**
      * @brief Constructor
      *
      * This constructor sets up a custom logging handler for Wayland and
-     * establishes a connection to the Wayland display.
+     * establishes a connection to the Wayland display. If libwayland-client
+     * can't be loaded, the guard is simply invalid.
      */
     DisplayGuard() {
-      wl_log_set_handler_client([](types::PCStr fmt, va_list args) -> types::Unit {
+      const Api* api = LoadApi();
+
+      if (!api)
+        return;
+
+      api->logSetHandler([](types::PCStr fmt, va_list args) -> types::Unit {
         va_list argsCopy;
         va_copy(argsCopy, args);
         types::i32 size = std::vsnprintf(nullptr, 0, fmt, argsCopy);
@@ -181,7 +310,7 @@ namespace wl {
       });
 
       // NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer) - needs to come after wl_log_set_handler_client
-      m_display = Connect(nullptr);
+      m_display = api->displayConnect(nullptr);
     }
 
     /**
@@ -272,288 +401,183 @@ namespace wl {
     [[nodiscard]] auto roundtrip() const -> types::i32 {
       return Roundtrip(m_display);
     }
-  };
 
-  class DisplayManager {
-   public:
     /**
-     * @brief Constructor
+     * @brief Get the last fatal error on the connection
      *
-     * @param display The Wayland display object
+     * @return 0 while the connection is healthy, otherwise an errno value
      */
-    explicit DisplayManager(Display* display)
-      : m_display(display) {}
+    [[nodiscard]] auto error() const -> types::i32 {
+      return GetError(m_display);
+    }
+  };
 
+  /**
+   * @brief Everything the display readouts need from one compositor connection
+   *
+   * Query() connects once, reads the peer credentials off the socket, binds
+   * every wl_output from the registry, and then does a single further
+   * roundtrip that delivers all outputs' mode events together. Callers keep
+   * the result instead of reconnecting per readout, and only query again once
+   * connectionError() reports that the connection broke.
+   */
+  class Session {
+   public:
     /**
-     * @brief Get information about all displays
+     * @brief Connect to the compositor and gather the session snapshot
      *
-     * @return A vector of DisplayInfo objects
+     * @return The snapshot, or None if no Wayland display could be reached
      */
-    [[nodiscard]] auto getOutputs() -> types::Vec<types::DisplayInfo> {
-      m_callbackData     = {};
-      Registry* registry = GetRegistry(m_display);
-      if (!registry)
-        return {};
+    static auto Query() -> types::Option<Session> {
+      const DisplayGuard display;
 
-      const static RegistryListener REGISTRY_LISTENER = {
-        .global        = registryHandler,
-        .global_remove = nullptr,
-      };
+      if (!display)
+        return types::None;
 
-      AddRegistryListener(registry, &REGISTRY_LISTENER, this);
-      Roundtrip(m_display);
-      DestroyRegistry(registry);
+      Session session;
 
-      types::Vec<types::DisplayInfo> displays;
-      for (const auto& output : m_callbackData.outputs) {
-        displays.emplace_back(
-          output.id,
-          types::DisplayInfo::Resolution { .width = output.width, .height = output.height },
-          output.refreshRate / 1000.0,
-          displays.empty()
-        );
+  #ifdef __linux__
+      if (const types::i32 fileDescriptor = display.fd(); fileDescriptor >= 0) {
+        ucred     cred {};
+        socklen_t len = sizeof(cred);
+
+        if (getsockopt(fileDescriptor, SOL_SOCKET, SO_PEERCRED, &cred, &len) == 0)
+          session.m_peerPid = cred.pid;
       }
+  #endif
 
-      return displays;
-    }
+      Registry* registry = display.registry();
 
-    /**
-     * @brief Get information about the primary display
-     *
-     * @return A DisplayInfo object for the primary display
-     */
-    [[nodiscard]] auto getPrimary() -> types::DisplayInfo {
-      m_primaryDisplayData = {};
-      Registry* registry   = GetRegistry(m_display);
       if (!registry)
-        return {};
+        return session;
 
       const static RegistryListener REGISTRY_LISTENER = {
-        .global        = primaryRegistry,
-        .global_remove = nullptr,
+        .global        = registryGlobal,
+        .global_remove = registryGlobalRemove,
       };
 
-      AddRegistryListener(registry, &REGISTRY_LISTENER, this);
-      while (!m_primaryDisplayData.done) {
-        if (Roundtrip(m_display) < 0)
-          break;
-      }
-      DestroyRegistry(registry);
-      return m_primaryDisplayData.display;
-    }
+      AddRegistryListener(registry, &REGISTRY_LISTENER, &session);
 
-   private:
-    Display* m_display; ///< The Wayland display object
+      // First roundtrip: registry globals (and the wl_output binds they trigger).
+      // Second: every bound output's geometry/mode/done events in one batch.
+      const bool connected = display.roundtrip() >= 0 && (session.m_pendingOutputs.empty() || display.roundtrip() >= 0);
 
-    /**
-     * @brief Data for display callbacks
-     */
-    struct CallbackData {
-      struct Inner {
-        types::usize id;
-        types::usize width;
-        types::usize height;
-        types::f64   refreshRate;
-      };
+      if (!connected)
+        session.m_connectionError = display.error();
 
-      types::Vec<Inner> outputs;
-    };
+      for (const types::UniquePointer<PendingOutput>& pending : session.m_pendingOutputs) {
+        session.m_outputs.emplace_back(
+          pending->id,
+          types::DisplayInfo::Resolution { .width = pending->width, .height = pending->height },
+          pending->refreshRate / 1000.0,
+          session.m_outputs.empty()
+        );
 
-    CallbackData m_callbackData; ///< Data for all outputs
+        DestroyOutput(pending->output);
+      }
 
-    /**
-     * @brief Data for primary display callbacks
-     */
-    struct PrimaryDisplayData {
-      Output*            output = nullptr;
-      types::DisplayInfo display;
-      bool               done = false;
-    };
+      session.m_pendingOutputs.clear();
+      DestroyRegistry(registry);
 
-    PrimaryDisplayData m_primaryDisplayData; ///< Data for the primary output
+      return session;
+    }
 
     /**
-     * @brief Wayland output mode callback
-     *
-     * @param flags The output mode flags
-     * @param width The width of the output
-     * @param height The height of the output
-     * @param refresh The refresh rate of the output
+     * @brief All outputs advertised by the compositor; the first is the primary
      */
-    auto outputMode(types::u32 flags, types::i32 width, types::i32 height, types::i32 refresh) -> types::Unit {
-      if (!(flags & WL_OUTPUT_MODE_CURRENT))
-        return;
-
-      if (!m_callbackData.outputs.empty()) {
-        CallbackData::Inner& currentOutput = m_callbackData.outputs.back();
-        currentOutput.width                = width > 0 ? width : 0;
-        currentOutput.height               = height > 0 ? height : 0;
-        currentOutput.refreshRate          = refresh > 0 ? refresh : 0;
-      }
+    [[nodiscard]] auto outputs() const -> const types::Vec<types::DisplayInfo>& {
+      return m_outputs;
     }
 
     /**
-     * @brief Static Wayland output mode callback
+     * @brief PID of the process on the other end of the Wayland socket
      *
-     * @param data The user data
-     * @param output The Wayland output object
-     * @param flags The output mode flags
-     * @param width The width of the output
-     * @param height The height of the output
-     * @param refresh The refresh rate of the output
+     * @return The compositor's PID, or None where peer credentials are unavailable
      */
-    static auto outputMode(types::RawPointer data, wl_output* /*output*/, types::u32 flags, types::i32 width, types::i32 height, types::i32 refresh) -> types::Unit {
-      static_cast<DisplayManager*>(data)->outputMode(flags, width, height, refresh);
+    [[nodiscard]] auto peerPid() const -> types::Option<types::i32> {
+      return m_peerPid;
     }
 
     /**
-     * @brief Wayland registry handler
+     * @brief The connection error that cut the query short
      *
-     * @param registry The Wayland registry object
-     * @param objectId The object ID
-     * @param interface The interface name
-     * @param version The interface version
+     * @return 0 if every roundtrip succeeded, otherwise the errno reported by wl_display_get_error
      */
-    auto registryHandler(Registry* registry, types::u32 objectId, types::PCStr interface, types::u32 version) -> types::Unit {
-      if (std::strcmp(interface, "wl_output") != 0)
-        return;
-
-      auto* output = static_cast<Output*>(BindRegistry(
-        registry,
-        objectId,
-        &wl_output_interface,
-        std::min(version, 2U)
-      ));
-
-      if (!output)
-        return;
-
-      const static OutputListener OUTPUT_LISTENER = {
-        .geometry    = nullptr,
-        .mode        = outputMode,
-        .done        = nullptr,
-        .scale       = nullptr,
-        .name        = nullptr,
-        .description = nullptr
-      };
-
-      m_callbackData.outputs.push_back({ .id = objectId, .width = 0, .height = 0, .refreshRate = 0.0 });
-      AddOutputListener(output, &OUTPUT_LISTENER, this);
+    [[nodiscard]] auto connectionError() const -> types::i32 {
+      return m_connectionError;
     }
 
     /**
-     * @brief Static Wayland registry handler
-     *
-     * @param data The user data
-     * @param registry The Wayland registry object
-     * @param name The name of the object
-     * @param interface The interface name
-     * @param version The interface version
+     * @brief Interface names of every registry global, in advertisement order
      */
-    static auto registryHandler(types::RawPointer data, wl_registry* registry, types::u32 name, types::PCStr interface, types::u32 version) -> types::Unit {
-      static_cast<DisplayManager*>(data)->registryHandler(registry, name, interface, version);
+    [[nodiscard]] auto globals() const -> const types::Vec<types::String>& {
+      return m_globals;
     }
 
-    /**
-     * @brief Wayland primary display mode callback
-     *
-     * @param flags The output mode flags
-     * @param width The width of the output
-     * @param height The height of the output
-     * @param refresh The refresh rate of the output
-     */
-    auto primaryMode(types::u32 flags, types::i32 width, types::i32 height, types::i32 refresh) -> types::Unit {
-      if (!(flags & WL_OUTPUT_MODE_CURRENT) || m_primaryDisplayData.done)
-        return;
+   private:
+    struct PendingOutput {
+      Output*      output      = nullptr;
+      types::usize id          = 0;
+      types::usize width       = 0;
+      types::usize height      = 0;
+      types::f64   refreshRate = 0.0;
+    };
 
-      m_primaryDisplayData.display.resolution  = { .width = static_cast<types::usize>(width), .height = static_cast<types::usize>(height) };
-      m_primaryDisplayData.display.refreshRate = refresh > 0 ? refresh / 1000 : 0;
-    }
+    types::Vec<types::DisplayInfo> m_outputs;
+    types::Vec<types::String>      m_globals;
+    types::Option<types::i32>      m_peerPid;
+    types::i32                     m_connectionError = 0;
 
-    /**
-     * @brief Static Wayland primary display mode callback
-     *
-     * @param data The user data
-     * @param output The Wayland output object
-     * @param flags The output mode flags
-     * @param width The width of the output
-     * @param height The height of the output
-     * @param refresh The refresh rate of the output
-     */
-    static auto primaryMode(types::RawPointer data, wl_output* /*output*/, types::u32 flags, types::i32 width, types::i32 height, types::i32 refresh) -> types::Unit {
-      static_cast<DisplayManager*>(data)->primaryMode(flags, width, height, refresh);
-    }
+    // Heap-allocated so listener user data stays valid as more outputs are bound.
+    types::Vec<types::UniquePointer<PendingOutput>> m_pendingOutputs;
 
-    /**
-     * @brief Wayland primary display done callback
-     */
-    auto primaryDone() -> types::Unit {
-      if (m_primaryDisplayData.display.resolution.width > 0)
-        m_primaryDisplayData.done = true;
-    }
+    Session() = default;
 
-    /**
-     * @brief Static Wayland primary display done callback
-     *
-     * @param data The user data
-     * @param wl_output The Wayland output object
-     */
-    static auto primaryDone(types::RawPointer data, wl_output* /*wl_output*/) -> types::Unit {
-      static_cast<DisplayManager*>(data)->primaryDone();
-    }
+    static auto registryGlobal(types::RawPointer data, wl_registry* registry, types::u32 name, types::PCStr interface, types::u32 version) -> types::Unit {
+      auto* session = static_cast<Session*>(data);
 
-    static auto primaryScale(types::RawPointer /*data*/, wl_output* /*wl_output*/, types::i32 /*scale*/) -> types::Unit {}
-    static auto primaryGeometry(void* /*data*/, struct wl_output* /*wl_output*/, int32_t /*x*/, int32_t /*y*/, int32_t /*physical_width*/, int32_t /*physical_height*/, int32_t /*subpixel*/, const char* /*make*/, const char* /*model*/, int32_t /*transform*/) -> types::Unit {}
+      session->m_globals.emplace_back(interface);
 
-    /**
-     * @brief Wayland primary display registry handler
-     *
-     * @param registry The Wayland registry object
-     * @param name The name of the object
-     * @param interface The interface name
-     * @param version The interface version
-     */
-    auto primaryRegistry(Registry* registry, types::u32 name, types::PCStr interface, types::u32 version) -> types::Unit {
-      if (m_primaryDisplayData.output != nullptr || std::strcmp(interface, "wl_output") != 0)
+      if (std::strcmp(interface, "wl_output") != 0)
         return;
 
-      m_primaryDisplayData.display.id        = name;
-      m_primaryDisplayData.display.isPrimary = true;
-
-      m_primaryDisplayData.output = static_cast<Output*>(BindRegistry(
-        registry,
-        name,
-        &wl_output_interface,
-        std::min(version, 2U)
-      ));
+      auto* output = static_cast<Output*>(BindRegistry(registry, name, GetApi().outputInterface, std::min(version, 2U)));
 
-      if (!m_primaryDisplayData.output)
+      if (!output)
         return;
 
-      const static OutputListener LISTENER = {
-        .geometry    = primaryGeometry,
-        .mode        = primaryMode,
-        .done        = primaryDone,
-        .scale       = primaryScale,
+      // libwayland calls every handler for events the bound version can send, so none may be null.
+      const static OutputListener OUTPUT_LISTENER = {
+        .geometry    = outputGeometry,
+        .mode        = outputMode,
+        .done        = outputDone,
+        .scale       = outputScale,
         .name        = nullptr,
-        .description = nullptr
+        .description = nullptr,
       };
 
-      AddOutputListener(m_primaryDisplayData.output, &LISTENER, this);
+      auto& pending  = session->m_pendingOutputs.emplace_back(std::make_unique<PendingOutput>());
+      pending->output = output;
+      pending->id     = name;
+
+      AddOutputListener(output, &OUTPUT_LISTENER, pending.get());
     }
 
-    /**
-     * @brief Static Wayland primary display registry handler
-     *
-     * @param data The user data
-     * @param registry The Wayland registry object
-     * @param name The name of the object
-     * @param interface The interface name
-     * @param version The interface version
-     */
-    static auto primaryRegistry(types::RawPointer data, wl_registry* registry, types::u32 name, types::PCStr interface, types::u32 version) -> types::Unit {
-      static_cast<DisplayManager*>(data)->primaryRegistry(registry, name, interface, version);
+    static auto registryGlobalRemove(types::RawPointer /*data*/, wl_registry* /*registry*/, types::u32 /*name*/) -> types::Unit {}
+
+    static auto outputMode(types::RawPointer data, wl_output* /*output*/, types::u32 flags, types::i32 width, types::i32 height, types::i32 refresh) -> types::Unit {
+      if (!(flags & OUTPUT_MODE_CURRENT))
+        return;
+
+      auto* pending        = static_cast<PendingOutput*>(data);
+      pending->width       = width > 0 ? static_cast<types::usize>(width) : 0;
+      pending->height      = height > 0 ? static_cast<types::usize>(height) : 0;
+      pending->refreshRate = refresh > 0 ? refresh : 0;
     }
+
+    static auto outputGeometry(types::RawPointer /*data*/, wl_output* /*output*/, types::i32 /*x*/, types::i32 /*y*/, types::i32 /*physicalWidth*/, types::i32 /*physicalHeight*/, types::i32 /*subpixel*/, types::PCStr /*make*/, types::PCStr /*model*/, types::i32 /*transform*/) -> types::Unit {}
+    static auto outputDone(types::RawPointer /*data*/, wl_output* /*output*/) -> types::Unit {}
+    static auto outputScale(types::RawPointer /*data*/, wl_output* /*output*/, types::i32 /*scale*/) -> types::Unit {}
   };
 } // namespace wl
 
@@ -2,9 +2,12 @@
 
 #if (defined(__linux__) || defined(__FreeBSD__) || defined(__DragonFly__) || defined(__NetBSD__)) && DRAC_USE_XCB
 
+  #include <cstring>     // std::strlen
+  #include <utility>     // std::exchange
   #include <xcb/randr.h> // XCB RandR extension
   #include <xcb/xcb.h>   // XCB library
 
+  #include <Drac++/Utils/DataTypes.hpp>
   #include <Drac++/Utils/Types.hpp>
 
 namespace xcb {
@@ -15,6 +18,7 @@ namespace xcb {
   using Screen     = xcb_screen_t;
   using Window     = xcb_window_t;
   using Atom       = xcb_atom_t;
+  using Extension  = xcb_extension_t;
 
   using GenericError  = xcb_generic_error_t;
   using IntAtomCookie = xcb_intern_atom_cookie_t;
@@ -57,8 +61,191 @@ namespace xcb {
     ParseErr        = XCB_CONN_CLOSED_PARSE_ERR,        ///< Parse error
     InvalidScreen   = XCB_CONN_CLOSED_INVALID_SCREEN,   ///< Invalid screen
     FdPassingFailed = XCB_CONN_CLOSED_FDPASSING_FAILED, ///< FD passing failed
+    LibraryMissing  = 0xFF,                             ///< libxcb couldn't be loaded (not an XCB code)
   };
 
+  /**
+   * @brief The libxcb entry points the wrappers use
+   */
+  struct Api {
+    decltype(&::xcb_connect)                   connect                = nullptr;
+    decltype(&::xcb_disconnect)                disconnect             = nullptr;
+    decltype(&::xcb_connection_has_error)      connectionHasError     = nullptr;
+    decltype(&::xcb_get_setup)                 getSetup               = nullptr;
+    decltype(&::xcb_setup_roots_iterator)      setupRootsIterator     = nullptr;
+    decltype(&::xcb_intern_atom)               internAtom             = nullptr;
+    decltype(&::xcb_intern_atom_reply)         internAtomReply        = nullptr;
+    decltype(&::xcb_get_property)              getProperty            = nullptr;
+    decltype(&::xcb_get_property_reply)        getPropertyReply       = nullptr;
+    decltype(&::xcb_get_property_value_length) getPropertyValueLength = nullptr;
+    decltype(&::xcb_get_property_value)        getPropertyValue       = nullptr;
+    decltype(&::xcb_query_extension)           queryExtension         = nullptr;
+    decltype(&::xcb_query_extension_reply)     queryExtensionReply    = nullptr;
+    decltype(&::xcb_prefetch_extension_data)   prefetchExtensionData  = nullptr;
+    decltype(&::xcb_get_extension_data)        getExtensionData       = nullptr;
+  };
+
+  /**
+   * @brief The libxcb-randr entry points the wrappers use
+   */
+  struct RandrApi {
+    Extension*                                                         id                             = nullptr;
+    decltype(&::xcb_randr_get_screen_resources_current)                getScreenResourcesCurrent      = nullptr;
+    decltype(&::xcb_randr_get_screen_resources_current_reply)          getScreenResourcesCurrentReply = nullptr;
+    decltype(&::xcb_randr_get_screen_resources_current_outputs)        screenResourcesOutputs         = nullptr;
+    decltype(&::xcb_randr_get_screen_resources_current_outputs_length) screenResourcesOutputsLength   = nullptr;
+    decltype(&::xcb_randr_get_screen_resources_current_crtcs)          screenResourcesCrtcs           = nullptr;
+    decltype(&::xcb_randr_get_screen_resources_current_crtcs_length)   screenResourcesCrtcsLength     = nullptr;
+    decltype(&::xcb_randr_get_screen_resources_current_modes_iterator) screenResourcesModesIterator   = nullptr;
+    decltype(&::xcb_randr_mode_info_next)                              modeInfoNext                   = nullptr;
+    decltype(&::xcb_randr_get_output_primary)                          getOutputPrimary               = nullptr;
+    decltype(&::xcb_randr_get_output_primary_reply)                    getOutputPrimaryReply          = nullptr;
+    decltype(&::xcb_randr_get_output_info)                             getOutputInfo                  = nullptr;
+    decltype(&::xcb_randr_get_output_info_reply)                       getOutputInfoReply             = nullptr;
+    decltype(&::xcb_randr_get_crtc_info)                               getCrtcInfo                    = nullptr;
+    decltype(&::xcb_randr_get_crtc_info_reply)                         getCrtcInfoReply               = nullptr;
+  };
+
+  /**
+   * @brief Resolve the libxcb entry points on first use
+   *
+   * With DRAC_LAZY_DISPLAY_LIBS the library is dlopened the first time a
+   * connection is attempted, which only happens when DISPLAY is set, so
+   * headless and TTY runs never load it. Otherwise it is linked and the table
+   * just points at the linked symbols.
+   *
+   * @return The entry points, or nullptr if the library is unavailable
+   */
+  inline auto LoadApi() -> const Api* {
+    static const Api* Loaded = [] -> const Api* {
+      static Api api;
+
+  #if DRAC_LAZY_DISPLAY_LIBS
+      types::RawPointer handle = dynlib::Open({ "libxcb.so.1", "libxcb.so" });
+
+      if (!handle)
+        return nullptr;
+
+      const bool resolved =
+        dynlib::Resolve(handle, "xcb_connect", api.connect) &&
+        dynlib::Resolve(handle, "xcb_disconnect", api.disconnect) &&
+        dynlib::Resolve(handle, "xcb_connection_has_error", api.connectionHasError) &&
+        dynlib::Resolve(handle, "xcb_get_setup", api.getSetup) &&
+        dynlib::Resolve(handle, "xcb_setup_roots_iterator", api.setupRootsIterator) &&
+        dynlib::Resolve(handle, "xcb_intern_atom", api.internAtom) &&
+        dynlib::Resolve(handle, "xcb_intern_atom_reply", api.internAtomReply) &&
+        dynlib::Resolve(handle, "xcb_get_property", api.getProperty) &&
+        dynlib::Resolve(handle, "xcb_get_property_reply", api.getPropertyReply) &&
+        dynlib::Resolve(handle, "xcb_get_property_value_length", api.getPropertyValueLength) &&
+        dynlib::Resolve(handle, "xcb_get_property_value", api.getPropertyValue) &&
+        dynlib::Resolve(handle, "xcb_query_extension", api.queryExtension) &&
+        dynlib::Resolve(handle, "xcb_query_extension_reply", api.queryExtensionReply) &&
+        dynlib::Resolve(handle, "xcb_prefetch_extension_data", api.prefetchExtensionData) &&
+        dynlib::Resolve(handle, "xcb_get_extension_data", api.getExtensionData);
+
+      return resolved ? &api : nullptr;
+  #else
+      api = {
+        .connect                = &::xcb_connect,
+        .disconnect             = &::xcb_disconnect,
+        .connectionHasError     = &::xcb_connection_has_error,
+        .getSetup               = &::xcb_get_setup,
+        .setupRootsIterator     = &::xcb_setup_roots_iterator,
+        .internAtom             = &::xcb_intern_atom,
+        .internAtomReply        = &::xcb_intern_atom_reply,
+        .getProperty            = &::xcb_get_property,
+        .getPropertyReply       = &::xcb_get_property_reply,
+        .getPropertyValueLength = &::xcb_get_property_value_length,
+        .getPropertyValue       = &::xcb_get_property_value,
+        .queryExtension         = &::xcb_query_extension,
+        .queryExtensionReply    = &::xcb_query_extension_reply,
+        .prefetchExtensionData  = &::xcb_prefetch_extension_data,
+        .getExtensionData       = &::xcb_get_extension_data,
+      };
+
+      return &api;
+  #endif
+    }();
+
+    return Loaded;
+  }
+
+  /**
+   * @brief Resolve the libxcb-randr entry points on first use
+   *
+   * Loaded separately from libxcb: a server without RandR support still
+   * answers the window manager readout.
+   *
+   * @return The entry points, or nullptr if the library is unavailable
+   */
+  inline auto LoadRandrApi() -> const RandrApi* {
+    static const RandrApi* Loaded = [] -> const RandrApi* {
+      static RandrApi api;
+
+  #if DRAC_LAZY_DISPLAY_LIBS
+      types::RawPointer handle = dynlib::Open({ "libxcb-randr.so.0", "libxcb-randr.so" });
+
+      if (!handle)
+        return nullptr;
+
+      const bool resolved =
+        dynlib::Resolve(handle, "xcb_randr_id", api.id) &&
+        dynlib::Resolve(handle, "xcb_randr_get_screen_resources_current", api.getScreenResourcesCurrent) &&
+        dynlib::Resolve(handle, "xcb_randr_get_screen_resources_current_reply", api.getScreenResourcesCurrentReply) &&
+        dynlib::Resolve(handle, "xcb_randr_get_screen_resources_current_outputs", api.screenResourcesOutputs) &&
+        dynlib::Resolve(handle, "xcb_randr_get_screen_resources_current_outputs_length", api.screenResourcesOutputsLength) &&
+        dynlib::Resolve(handle, "xcb_randr_get_screen_resources_current_crtcs", api.screenResourcesCrtcs) &&
+        dynlib::Resolve(handle, "xcb_randr_get_screen_resources_current_crtcs_length", api.screenResourcesCrtcsLength) &&
+        dynlib::Resolve(handle, "xcb_randr_get_screen_resources_current_modes_iterator", api.screenResourcesModesIterator) &&
+        dynlib::Resolve(handle, "xcb_randr_mode_info_next", api.modeInfoNext) &&
+        dynlib::Resolve(handle, "xcb_randr_get_output_primary", api.getOutputPrimary) &&
+        dynlib::Resolve(handle, "xcb_randr_get_output_primary_reply", api.getOutputPrimaryReply) &&
+        dynlib::Resolve(handle, "xcb_randr_get_output_info", api.getOutputInfo) &&
+        dynlib::Resolve(handle, "xcb_randr_get_output_info_reply", api.getOutputInfoReply) &&
+        dynlib::Resolve(handle, "xcb_randr_get_crtc_info", api.getCrtcInfo) &&
+        dynlib::Resolve(handle, "xcb_randr_get_crtc_info_reply", api.getCrtcInfoReply);
+
+      return resolved ? &api : nullptr;
+  #else
+      api = {
+        .id                             = &::xcb_randr_id,
+        .getScreenResourcesCurrent      = &::xcb_randr_get_screen_resources_current,
+        .getScreenResourcesCurrentReply = &::xcb_randr_get_screen_resources_current_reply,
+        .screenResourcesOutputs         = &::xcb_randr_get_screen_resources_current_outputs,
+        .screenResourcesOutputsLength   = &::xcb_randr_get_screen_resources_current_outputs_length,
+        .screenResourcesCrtcs           = &::xcb_randr_get_screen_resources_current_crtcs,
+        .screenResourcesCrtcsLength     = &::xcb_randr_get_screen_resources_current_crtcs_length,
+        .screenResourcesModesIterator   = &::xcb_randr_get_screen_resources_current_modes_iterator,
+        .modeInfoNext                   = &::xcb_randr_mode_info_next,
+        .getOutputPrimary               = &::xcb_randr_get_output_primary,
+        .getOutputPrimaryReply          = &::xcb_randr_get_output_primary_reply,
+        .getOutputInfo                  = &::xcb_randr_get_output_info,
+        .getOutputInfoReply             = &::xcb_randr_get_output_info_reply,
+        .getCrtcInfo                    = &::xcb_randr_get_crtc_info,
+        .getCrtcInfoReply               = &::xcb_randr_get_crtc_info_reply,
+      };
+
+      return &api;
+  #endif
+    }();
+
+    return Loaded;
+  }
+
+  /**
+   * @brief The loaded libxcb entry points; only valid once Connect() has succeeded
+   */
+  inline auto GetApi() -> const Api& {
+    return *LoadApi();
+  }
+
+  /**
+   * @brief The loaded libxcb-randr entry points; only valid once LoadRandrApi() has succeeded
+   */
+  inline auto GetRandrApi() -> const RandrApi& {
+    return *LoadRandrApi();
+  }
+
   /**
    * @brief Connect to an XCB display
    *
@@ -68,10 +255,12 @@ namespace xcb {
    *
    * @param displayname The name of the display to connect to
    * @param screenp Pointer to an integer that will store the screen number
-   * @return A pointer to the connection object
+   * @return A pointer to the connection object, or nullptr if libxcb isn't available
    */
   inline auto Connect(types::PCStr displayname, types::i32* screenp) -> Connection* {
-    return xcb_connect(displayname, screenp);
+    const Api* api = LoadApi();
+
+    return api ? api->connect(displayname, screenp) : nullptr;
   }
 
   /**
@@ -83,7 +272,7 @@ namespace xcb {
    * @param conn The connection object to disconnect from
    */
   inline auto Disconnect(Connection* conn) -> types::Unit {
-    xcb_disconnect(conn);
+    GetApi().disconnect(conn);
   }
 
   /**
@@ -96,7 +285,7 @@ namespace xcb {
    * @return 1 if the connection has an error, 0 otherwise
    */
   inline auto ConnectionHasError(Connection* conn) -> types::i32 {
-    return xcb_connection_has_error(conn);
+    return GetApi().connectionHasError(conn);
   }
 
   /**
@@ -111,7 +300,7 @@ namespace xcb {
    * @return The cookie for the atom
    */
   inline auto InternAtom(Connection* conn, const types::u8 only_if_exists, const types::u16 name_len, types::PCStr name) -> IntAtomCookie {
-    return xcb_intern_atom(conn, only_if_exists, name_len, name);
+    return GetApi().internAtom(conn, only_if_exists, name_len, name);
   }
 
   /**
@@ -126,7 +315,7 @@ namespace xcb {
    * @return The reply for the atom
    */
   inline auto InternAtomReply(Connection* conn, const IntAtomCookie cookie, GenericError** err) -> IntAtomReply* {
-    return xcb_intern_atom_reply(conn, cookie, err);
+    return GetApi().internAtomReply(conn, cookie, err);
   }
 
   /**
@@ -150,7 +339,7 @@ namespace xcb {
     const types::u32 long_offset,
     const types::u32 long_length
   ) -> GetPropCookie {
-    return xcb_get_property(conn, _delete, window, property, type, long_offset, long_length);
+    return GetApi().getProperty(conn, _delete, window, property, type, long_offset, long_length);
   }
 
   /**
@@ -165,7 +354,7 @@ namespace xcb {
    * @return The reply for the property
    */
   inline auto GetPropertyReply(Connection* conn, const GetPropCookie cookie, GenericError** err) -> GetPropReply* {
-    return xcb_get_property_reply(conn, cookie, err);
+    return GetApi().getPropertyReply(conn, cookie, err);
   }
 
   /**
@@ -175,7 +364,7 @@ namespace xcb {
    * @return The value length for the property
    */
   inline auto GetPropertyValueLength(const GetPropReply* reply) -> types::i32 {
-    return xcb_get_property_value_length(reply);
+    return GetApi().getPropertyValueLength(reply);
   }
 
   /**
@@ -185,7 +374,7 @@ namespace xcb {
    * @return The value for the property
    */
   inline auto GetPropertyValue(const GetPropReply* reply) -> types::RawPointer {
-    return xcb_get_property_value(reply);
+    return GetApi().getPropertyValue(reply);
   }
 
   /**
@@ -197,7 +386,7 @@ namespace xcb {
    * @return The cookie for the extension query
    */
   inline auto QueryExtension(Connection* conn, const types::u16 len, types::PCStr name) -> QueryExtensionCookie {
-    return xcb_query_extension(conn, len, name);
+    return GetApi().queryExtension(conn, len, name);
   }
 
   /**
@@ -209,7 +398,31 @@ namespace xcb {
    * @return The reply for the extension query
    */
   inline auto GetQueryExtensionReply(Connection* conn, const QueryExtensionCookie cookie, GenericError** err) -> QueryExtensionReply* {
-    return xcb_query_extension_reply(conn, cookie, err);
+    return GetApi().queryExtensionReply(conn, cookie, err);
+  }
+
+  /**
+   * @brief Queue a query for an extension's data without waiting for the reply
+   *
+   * Extension requests look up their opcode through the extension data, which
+   * is a blocking roundtrip unless it has been prefetched in an earlier batch.
+   *
+   * @param conn The connection object
+   * @param ext The extension (e.g. RandrApi::id)
+   */
+  inline auto PrefetchExtensionData(Connection* conn, Extension* ext) -> types::Unit {
+    GetApi().prefetchExtensionData(conn, ext);
+  }
+
+  /**
+   * @brief Get an extension's data, waiting for a prefetched query if needed
+   *
+   * @param conn The connection object
+   * @param ext The extension (e.g. RandrApi::id)
+   * @return The cached extension reply (owned by the connection; do not free), or nullptr
+   */
+  inline auto GetExtensionData(Connection* conn, Extension* ext) -> const QueryExtensionReply* {
+    return GetApi().getExtensionData(conn, ext);
   }
 
   /**
@@ -220,7 +433,7 @@ namespace xcb {
    * @return The cookie for the screen resources query
    */
   inline auto GetScreenResourcesCurrent(Connection* conn, const Window window) -> RandrGetScreenResourcesCurrentCookie {
-    return xcb_randr_get_screen_resources_current(conn, window);
+    return GetRandrApi().getScreenResourcesCurrent(conn, window);
   }
 
   /**
@@ -232,7 +445,7 @@ namespace xcb {
    * @return The reply for the screen resources query
    */
   inline auto GetScreenResourcesCurrentReply(Connection* conn, const RandrGetScreenResourcesCurrentCookie cookie, GenericError** err) -> RandrGetScreenResourcesCurrentReply* {
-    return xcb_randr_get_screen_resources_current_reply(conn, cookie, err);
+    return GetRandrApi().getScreenResourcesCurrentReply(conn, cookie, err);
   }
 
   /**
@@ -242,7 +455,7 @@ namespace xcb {
    * @return The outputs from the screen resources reply
    */
   inline auto GetScreenResourcesCurrentOutputs(const RandrGetScreenResourcesCurrentReply* reply) -> RandrOutput* {
-    return xcb_randr_get_screen_resources_current_outputs(reply);
+    return GetRandrApi().screenResourcesOutputs(reply);
   }
 
   /**
@@ -252,7 +465,27 @@ namespace xcb {
    * @return The length of the outputs from the screen resources reply
    */
   inline auto GetScreenResourcesCurrentOutputsLength(const RandrGetScreenResourcesCurrentReply* reply) -> types::i32 {
-    return xcb_randr_get_screen_resources_current_outputs_length(reply);
+    return GetRandrApi().screenResourcesOutputsLength(reply);
+  }
+
+  /**
+   * @brief Get the CRTCs from the screen resources reply
+   *
+   * @param reply The reply for the screen resources query
+   * @return The CRTCs from the screen resources reply
+   */
+  inline auto GetScreenResourcesCurrentCrtcs(const RandrGetScreenResourcesCurrentReply* reply) -> RandrCrtc* {
+    return GetRandrApi().screenResourcesCrtcs(reply);
+  }
+
+  /**
+   * @brief Get the length of the CRTCs from the screen resources reply
+   *
+   * @param reply The reply for the screen resources query
+   * @return The length of the CRTCs from the screen resources reply
+   */
+  inline auto GetScreenResourcesCurrentCrtcsLength(const RandrGetScreenResourcesCurrentReply* reply) -> types::i32 {
+    return GetRandrApi().screenResourcesCrtcsLength(reply);
   }
 
   /**
@@ -262,7 +495,7 @@ namespace xcb {
    * @return The modes iterator from the screen resources reply
    */
   inline auto GetScreenResourcesCurrentModesIterator(const RandrGetScreenResourcesCurrentReply* reply) -> RandrModeInfoIterator {
-    return xcb_randr_get_screen_resources_current_modes_iterator(reply);
+    return GetRandrApi().screenResourcesModesIterator(reply);
   }
 
   /**
@@ -271,7 +504,7 @@ namespace xcb {
    * @param iter The modes iterator
    */
   inline auto ModeInfoNext(RandrModeInfoIterator* iter) -> types::Unit {
-    xcb_randr_mode_info_next(iter);
+    GetRandrApi().modeInfoNext(iter);
   }
 
   /**
@@ -282,7 +515,7 @@ namespace xcb {
    * @return The cookie for the primary output query
    */
   inline auto GetOutputPrimary(Connection* conn, const Window window) -> RandrGetOutputPrimaryCookie {
-    return xcb_randr_get_output_primary(conn, window);
+    return GetRandrApi().getOutputPrimary(conn, window);
   }
 
   /**
@@ -294,7 +527,7 @@ namespace xcb {
    * @return The reply for the primary output query
    */
   inline auto GetOutputPrimaryReply(Connection* conn, const RandrGetOutputPrimaryCookie cookie, GenericError** err) -> RandrGetOutputPrimaryReply* {
-    return xcb_randr_get_output_primary_reply(conn, cookie, err);
+    return GetRandrApi().getOutputPrimaryReply(conn, cookie, err);
   }
 
   /**
@@ -306,7 +539,7 @@ namespace xcb {
    * @return The cookie for the output info query
    */
   inline auto GetOutputInfo(Connection* conn, const RandrOutput output, const Timestamp timestamp) -> RandrGetOutputInfoCookie {
-    return xcb_randr_get_output_info(conn, output, timestamp);
+    return GetRandrApi().getOutputInfo(conn, output, timestamp);
   }
 
   /**
@@ -318,7 +551,7 @@ namespace xcb {
    * @return The reply for the output info query
    */
   inline auto GetOutputInfoReply(Connection* conn, const RandrGetOutputInfoCookie cookie, GenericError** err) -> RandrGetOutputInfoReply* {
-    return xcb_randr_get_output_info_reply(conn, cookie, err);
+    return GetRandrApi().getOutputInfoReply(conn, cookie, err);
   }
 
   /**
@@ -330,7 +563,7 @@ namespace xcb {
    * @return The cookie for the CRTC info query
    */
   inline auto GetCrtcInfo(Connection* conn, const RandrCrtc crtc, const Timestamp timestamp) -> RandrGetCrtcInfoCookie {
-    return xcb_randr_get_crtc_info(conn, crtc, timestamp);
+    return GetRandrApi().getCrtcInfo(conn, crtc, timestamp);
   }
 
   /**
@@ -342,7 +575,7 @@ namespace xcb {
    * @return The reply for the CRTC info query
    */
   inline auto GetCrtcInfoReply(Connection* conn, const RandrGetCrtcInfoCookie cookie, GenericError** err) -> RandrGetCrtcInfoReply* {
-    return xcb_randr_get_crtc_info_reply(conn, cookie, err);
+    return GetRandrApi().getCrtcInfoReply(conn, cookie, err);
   }
 
   /**
@@ -409,7 +642,7 @@ namespace xcb {
      * @return The setup for the display
      */
     [[nodiscard]] auto setup() const -> const Setup* {
-      return m_connection ? xcb_get_setup(m_connection) : nullptr;
+      return m_connection ? GetApi().getSetup(m_connection) : nullptr;
     }
 
     /**
@@ -419,7 +652,7 @@ namespace xcb {
     [[nodiscard]] auto rootScreen() const -> Screen* {
       const Setup* setup = this->setup();
 
-      return setup ? xcb_setup_roots_iterator(setup).data : nullptr;
+      return setup ? GetApi().setupRootsIterator(setup).data : nullptr;
     }
   };
 
@@ -507,6 +740,275 @@ namespace xcb {
       return *m_reply;
     }
   };
+
+  /**
+   * @brief One-shot snapshot of everything the window manager and display readouts need
+   *
+   * Requests are issued in dependency batches and every reply of a batch is
+   * collected only after the whole batch has been queued, so the X server is
+   * reached three times regardless of how many outputs there are:
+   *
+   * 1. The three EWMH atoms and the RandR extension data.
+   * 2. _NET_SUPPORTING_WM_CHECK on the root window, the current screen resources
+   *    and the primary output.
+   * 3. _NET_WM_NAME on the WM's check window, plus output info for every output
+   *    and CRTC info for every CRTC listed in the screen resources.
+   */
+  class Session {
+   public:
+    /**
+     * @brief Connect to the X server and gather the session snapshot
+     *
+     * @return The snapshot; check connectionError() before using anything else
+     */
+    static auto Query() -> Session {
+      Session session;
+
+      const DisplayGuard conn;
+
+      if (!conn) {
+        if (!LoadApi())
+          session.m_connectionError = LibraryMissing;
+        else
+          session.m_connectionError = conn.get() ? ConnectionHasError(conn.get()) : Generic;
+        return session;
+      }
+
+      const Screen* screen = conn.rootScreen();
+
+      if (!screen)
+        return session;
+
+      session.m_hasRootScreen = true;
+
+      Connection*  connection = conn.get();
+      const Window root       = screen->root;
+
+      // Batch 1: atoms and the RandR extension data.
+      constexpr types::Array<types::PCStr, 3> ATOM_NAMES = { "_NET_SUPPORTING_WM_CHECK", "_NET_WM_NAME", "UTF8_STRING" };
+
+      types::Array<IntAtomCookie, 3> atomCookies {};
+
+      for (types::usize i = 0; i < ATOM_NAMES.size(); ++i)
+        atomCookies[i] = InternAtom(connection, 0, static_cast<types::u16>(std::strlen(ATOM_NAMES[i])), ATOM_NAMES[i]);
+
+      const RandrApi* randr = LoadRandrApi();
+
+      if (randr)
+        PrefetchExtensionData(connection, randr->id);
+
+      types::Array<Atom, 3> atoms {};
+
+      for (types::usize i = 0; i < ATOM_NAMES.size(); ++i)
+        if (const ReplyGuard<IntAtomReply> reply(InternAtomReply(connection, atomCookies[i], nullptr)); reply)
+          atoms[i] = reply->atom;
+        else
+          session.m_missingAtoms.push_back(ATOM_NAMES[i]);
+
+      const auto [supportingWmCheckAtom, wmNameAtom, utf8StringAtom] = atoms;
+
+      const QueryExtensionReply* randrData = randr ? GetExtensionData(connection, randr->id) : nullptr;
+      session.m_hasRandr                   = randrData && randrData->present;
+
+      // Batch 2: the WM check window and the RandR screen layout.
+      types::Option<GetPropCookie>                        wmCheckCookie;
+      types::Option<RandrGetScreenResourcesCurrentCookie> resourcesCookie;
+      types::Option<RandrGetOutputPrimaryCookie>          primaryCookie;
+
+      if (session.m_missingAtoms.empty())
+        wmCheckCookie = GetProperty(connection, 0, root, supportingWmCheckAtom, ATOM_WINDOW, 0, 1);
+
+      if (session.m_hasRandr) {
+        resourcesCookie = GetScreenResourcesCurrent(connection, root);
+        primaryCookie   = GetOutputPrimary(connection, root);
+      }
+
+      types::Option<Window> wmWindow;
+
+      if (wmCheckCookie) {
+        const ReplyGuard<GetPropReply> reply(GetPropertyReply(connection, *wmCheckCookie, nullptr));
+
+        if (reply && reply->type == ATOM_WINDOW && reply->format == 32 && GetPropertyValueLength(reply.get()) > 0)
+          wmWindow = *static_cast<Window*>(GetPropertyValue(reply.get()));
+      }
+
+      session.m_hasWmCheck = wmWindow.has_value();
+
+      ReplyGuard<RandrGetScreenResourcesCurrentReply> resources;
+
+      if (resourcesCookie)
+        resources = ReplyGuard<RandrGetScreenResourcesCurrentReply>(GetScreenResourcesCurrentReply(connection, *resourcesCookie, nullptr));
+
+      if (primaryCookie)
+        if (const ReplyGuard<RandrGetOutputPrimaryReply> reply(GetOutputPrimaryReply(connection, *primaryCookie, nullptr)); reply)
+          session.m_primaryOutput = reply->output;
+
+      session.m_hasScreenResources = static_cast<bool>(resources);
+
+      // Batch 3: the WM name plus every output and CRTC at once. CRTC IDs come
+      // from the screen resources, so they don't have to wait for output info.
+      types::Option<GetPropCookie> wmNameCookie;
+
+      if (wmWindow)
+        wmNameCookie = GetProperty(connection, 0, *wmWindow, wmNameAtom, utf8StringAtom, 0, 1024);
+
+      types::Vec<RandrGetOutputInfoCookie> outputCookies;
+      types::Vec<RandrGetCrtcInfoCookie>   crtcCookies;
+
+      const RandrOutput* outputs     = resources ? GetScreenResourcesCurrentOutputs(resources.get()) : nullptr;
+      const types::i32   outputCount = resources ? GetScreenResourcesCurrentOutputsLength(resources.get()) : 0;
+      const RandrCrtc*   crtcs       = resources ? GetScreenResourcesCurrentCrtcs(resources.get()) : nullptr;
+      const types::i32   crtcCount   = resources ? GetScreenResourcesCurrentCrtcsLength(resources.get()) : 0;
+
+      outputCookies.reserve(outputCount);
+      crtcCookies.reserve(crtcCount);
+
+      for (types::i32 i = 0; i < outputCount; ++i)
+        outputCookies.push_back(GetOutputInfo(connection, outputs[i], CURRENT_TIME));
+
+      for (types::i32 i = 0; i < crtcCount; ++i)
+        crtcCookies.push_back(GetCrtcInfo(connection, crtcs[i], CURRENT_TIME));
+
+      if (wmNameCookie) {
+        const ReplyGuard<GetPropReply> reply(GetPropertyReply(connection, *wmNameCookie, nullptr));
+
+        if (reply && reply->type == utf8StringAtom && GetPropertyValueLength(reply.get()) > 0)
+          session.m_windowManager = types::String(
+            static_cast<types::PCStr>(GetPropertyValue(reply.get())),
+            static_cast<types::usize>(GetPropertyValueLength(reply.get()))
+          );
+      }
+
+      types::Vec<ReplyGuard<RandrGetOutputInfoReply>> outputInfos;
+      types::Vec<ReplyGuard<RandrGetCrtcInfoReply>>   crtcInfos;
+
+      outputInfos.reserve(outputCount);
+      crtcInfos.reserve(crtcCount);
+
+      for (const RandrGetOutputInfoCookie& cookie : outputCookies)
+        outputInfos.emplace_back(GetOutputInfoReply(connection, cookie, nullptr));
+
+      for (const RandrGetCrtcInfoCookie& cookie : crtcCookies)
+        crtcInfos.emplace_back(GetCrtcInfoReply(connection, cookie, nullptr));
+
+      for (types::i32 i = 0; i < outputCount; ++i) {
+        const ReplyGuard<RandrGetOutputInfoReply>& outputInfo = outputInfos[i];
+
+        if (!outputInfo || outputInfo->crtc == NONE)
+          continue;
+
+        const RandrGetCrtcInfoReply* crtcInfo = nullptr;
+
+        for (types::i32 j = 0; j < crtcCount; ++j)
+          if (crtcs[j] == outputInfo->crtc) {
+            crtcInfo = crtcInfos[j].get();
+            break;
+          }
+
+        if (!crtcInfo)
+          continue;
+
+        types::f64 refreshRate = 0;
+
+        if (crtcInfo->mode != NONE)
+          for (RandrModeInfoIterator modesIter = GetScreenResourcesCurrentModesIterator(resources.get()); modesIter.rem; ModeInfoNext(&modesIter))
+            if (modesIter.data->id == crtcInfo->mode) {
+              if (modesIter.data->htotal > 0 && modesIter.data->vtotal > 0)
+                refreshRate = static_cast<types::f64>(modesIter.data->dot_clock) /
+                  (static_cast<types::f64>(modesIter.data->htotal) * static_cast<types::f64>(modesIter.data->vtotal));
+              break;
+            }
+
+        session.m_outputs.emplace_back(
+          outputs[i],
+          types::DisplayInfo::Resolution { .width = crtcInfo->width, .height = crtcInfo->height },
+          refreshRate,
+          outputs[i] == session.m_primaryOutput
+        );
+      }
+
+      // Replies that never came back leave gaps above; a broken connection says so here.
+      session.m_connectionError = ConnectionHasError(connection);
+
+      return session;
+    }
+
+    /**
+     * @brief The error the connection failed with, or 0 if it succeeded
+     */
+    [[nodiscard]] auto connectionError() const -> types::i32 {
+      return m_connectionError;
+    }
+
+    /**
+     * @brief Whether the X server reported a root screen
+     */
+    [[nodiscard]] auto hasRootScreen() const -> bool {
+      return m_hasRootScreen;
+    }
+
+    /**
+     * @brief Names of the EWMH atoms the server didn't return
+     */
+    [[nodiscard]] auto missingAtoms() const -> const types::Vec<types::PCStr>& {
+      return m_missingAtoms;
+    }
+
+    /**
+     * @brief Whether the root window has a usable _NET_SUPPORTING_WM_CHECK property
+     */
+    [[nodiscard]] auto hasWmCheck() const -> bool {
+      return m_hasWmCheck;
+    }
+
+    /**
+     * @brief The WM's _NET_WM_NAME, if it advertised one
+     */
+    [[nodiscard]] auto windowManager() const -> const types::Option<types::String>& {
+      return m_windowManager;
+    }
+
+    /**
+     * @brief Whether the X server supports the RandR extension
+     */
+    [[nodiscard]] auto hasRandr() const -> bool {
+      return m_hasRandr;
+    }
+
+    /**
+     * @brief Whether the RandR screen resources could be read
+     */
+    [[nodiscard]] auto hasScreenResources() const -> bool {
+      return m_hasScreenResources;
+    }
+
+    /**
+     * @brief Every output driving a CRTC; the RandR primary output (if any) is marked
+     */
+    [[nodiscard]] auto outputs() const -> const types::Vec<types::DisplayInfo>& {
+      return m_outputs;
+    }
+
+    /**
+     * @brief The RandR primary output, or NONE if none is set
+     */
+    [[nodiscard]] auto primaryOutput() const -> RandrOutput {
+      return m_primaryOutput;
+    }
+
+   private:
+    types::i32                     m_connectionError    = 0;
+    bool                           m_hasRootScreen      = false;
+    types::Vec<types::PCStr>       m_missingAtoms;
+    bool                           m_hasWmCheck         = false;
+    types::Option<types::String>   m_windowManager;
+    bool                           m_hasRandr           = false;
+    bool                           m_hasScreenResources = false;
+    types::Vec<types::DisplayInfo> m_outputs;
+    RandrOutput                    m_primaryOutput      = NONE;
+
+    Session() = default;
+  };
 } // namespace xcb
 
 #endif // (defined(__linux__) || defined(__FreeBSD__) || defined(__DragonFly__) || defined(__NetBSD__)) && DRAC_USE_XCB
@@ -0,0 +1,436 @@
+/**
+ * @file bench_micro.cpp
+ * @brief Micro-benchmarks for the parsers and kernels on the startup path.
+ *
+ * @details Each case repeats one operation in batches that are doubled until a
+ * batch takes at least a few milliseconds, then keeps the fastest of several
+ * such batches. Heap allocations come from the CLI's counting `operator new`.
+ * The smallest count over the batches is used, so a stray allocation on another
+ * thread doesn't register as a regression.
+ *
+ * @code{.sh}
+ * bench_micro                                          # report only
+ * bench_micro --baseline tests/bench_baseline.json     # fail on regressions
+ * bench_micro --write-baseline tests/bench_baseline.json
+ * @endcode
+ *
+ * A case regresses when it allocates more per operation than its baseline, or
+ * when it is slower than `--tolerance` times its baseline ns/op. Timing only
+ * means something against a baseline recorded on the same machine, so baselines
+ * without `nsPerOp` check allocations alone.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <glaze/glaze.hpp>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+
+#include <Drac++/Services/Packages.hpp>
+
+#include <Drac++/Utils/Arena.hpp>
+#include <Drac++/Utils/ArgumentParser.hpp>
+#include <Drac++/Utils/CacheManager.hpp>
+#include <Drac++/Utils/Env.hpp>
+#include <Drac++/Utils/Localization.hpp>
+#include <Drac++/Utils/Logging.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "Config/Config.hpp"
+#include "Core/Allocations.hpp"
+#include "Core/SystemInfo.hpp"
+#include "OS/PciIndex.hpp"
+#include "OS/SysFs.hpp"
+#include "UI/TextWidth.hpp"
+#include "UI/UI.hpp"
+
+static_assert(DRAC_COUNT_ALLOCATIONS, "bench_micro is built with the counting operator new; see tests/meson.build");
+
+using namespace draconis::utils::types;
+using namespace draconis::utils::logging;
+
+using draconis::utils::env::SetEnv;
+
+namespace fs = std::filesystem;
+
+namespace {
+  struct Measurement {
+    f64 nsPerOp;
+    f64 allocsPerOp;
+  };
+
+  struct Baseline {
+    Option<f64> nsPerOp;
+    f64         allocsPerOp = 0.0;
+  };
+
+  using Baselines = Map<String, Baseline>;
+
+  constexpr auto MIN_BATCH_TIME = std::chrono::milliseconds(5);
+  constexpr u32  BATCHES        = 7;
+
+  // Keeps the compiler from discarding a result, or from assuming an input is still the constant it was.
+  template <typename T>
+  auto Keep(const T& value) -> Unit {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "m"(value) : "memory");
+#else
+    static_cast<void>(value);
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+  }
+
+  template <typename Op>
+  auto TimeBatch(Op& operation, const u64 ops) -> std::chrono::nanoseconds {
+    const auto start = std::chrono::steady_clock::now();
+
+    for (u64 i = 0; i < ops; ++i)
+      operation();
+
+    return std::chrono::steady_clock::now() - start;
+  }
+
+  template <typename Op>
+  auto Measure(Op&& operation) -> Measurement {
+    // The first call also warms caches and lazily built state.
+    u64 ops = 1;
+
+    while (TimeBatch(operation, ops) < MIN_BATCH_TIME && ops < (u64(1) << 24))
+      ops *= 2;
+
+    f64 bestNs     = std::numeric_limits<f64>::max();
+    u64 leastAlloc = std::numeric_limits<u64>::max();
+
+    for (u32 batch = 0; batch < BATCHES; ++batch) {
+      const u64                      before  = *draconis::cli::GetAllocationCount();
+      const std::chrono::nanoseconds elapsed = TimeBatch(operation, ops);
+      const u64                      after   = *draconis::cli::GetAllocationCount();
+
+      bestNs     = std::min(bestNs, static_cast<f64>(elapsed.count()));
+      leastAlloc = std::min(leastAlloc, after - before);
+    }
+
+    return { .nsPerOp = bestNs / static_cast<f64>(ops), .allocsPerOp = static_cast<f64>(leastAlloc) / static_cast<f64>(ops) };
+  }
+
+#ifdef __linux__
+  // A pci.ids-shaped database with fixed contents, so the index cases don't depend on the host's copy.
+  auto SyntheticPciIds(const u32 vendors, const u32 devicesPerVendor) -> String {
+    String text = "# Synthetic PCI ID list\n\n";
+
+    for (u32 vendor = 0; vendor < vendors; ++vendor) {
+      text += std::format("{:04x}  Vendor {} Corporation\n", vendor * 3, vendor);
+
+      for (u32 device = 0; device < devicesPerVendor; ++device)
+        text += std::format("\t{:04x}  Device {} [Model {}-{}]\n", device * 5, device, vendor, device);
+    }
+
+    return text;
+  }
+
+  constexpr StringView OS_RELEASE = R"(NAME="Arch Linux"
+PRETTY_NAME="Arch Linux"
+ID=arch
+BUILD_ID=rolling
+ANSI_COLOR="38;2;23;147;209"
+HOME_URL="https://archlinux.org/"
+DOCUMENTATION_URL="https://wiki.archlinux.org/"
+SUPPORT_URL="https://bbs.archlinux.org/"
+BUG_REPORT_URL="https://gitlab.archlinux.org/groups/archlinux/-/issues"
+PRIVACY_POLICY_URL="https://terms.archlinux.org/docs/privacy-policy/"
+LOGO=archlinux-logo
+)";
+#endif
+
+  // Creates `count` empty files under `dir`, unless a previous run already did.
+  auto PopulateDirectory(const fs::path& dir, const u64 count) -> Unit {
+    std::error_code errc;
+
+    if (fs::exists(dir / std::format("{}.list", count - 1), errc))
+      return;
+
+    fs::create_directories(dir, errc);
+
+    for (u64 i = 0; i < count; ++i)
+      std::ofstream(dir / std::format("{}.list", i));
+  }
+} // namespace
+
+auto main(const i32 argc, CStr* argv[]) -> i32 {
+  using draconis::utils::cache::CacheManager;
+  using draconis::utils::cache::CachePolicy;
+
+  String baselinePath;
+  String writeBaselinePath;
+  f64    tolerance = 2.0;
+  bool   json      = false;
+
+  {
+    using draconis::utils::argparse::ArgumentParser;
+
+    ArgumentParser parser("bench_micro", DRAC_VERSION);
+
+    parser.addArguments("--baseline").help("Fail if a case regresses against this baseline file.").defaultValue(String("")).bindTo(baselinePath);
+    parser.addArguments("--write-baseline").help("Record the results as the new baseline.").defaultValue(String("")).bindTo(writeBaselinePath);
+    parser.addArguments("--tolerance").help("How many times its baseline ns/op a case may take.").defaultValue(f64(2.0)).bindTo(tolerance);
+    parser.addArguments("--json").help("Print the results as JSON.").flag().bindTo(json);
+
+    if (Result<> parsed = parser.parseInto({ argv, static_cast<usize>(argc) }); !parsed) {
+      error_at(parsed.error());
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Keep every cache write out of the user's real cache. The persistent directory
+  // comes from the env snapshot, so this has to happen before anything takes it.
+  const fs::path scratch = fs::temp_directory_path() / "drac-bench";
+
+#ifdef _WIN32
+  SetEnv("TMP", scratch.string().c_str());
+  SetEnv("TEMP", scratch.string().c_str());
+  SetEnv("LOCALAPPDATA", scratch.string().c_str());
+#else
+  SetEnv("TMPDIR", scratch.string().c_str());
+  // The persistent cache lives under $HOME; XDG_CACHE_HOME is set too for anything honouring it.
+  SetEnv("HOME", scratch.string().c_str());
+  SetEnv("XDG_CACHE_HOME", (scratch / ".cache").string().c_str());
+#endif
+
+  Map<String, Measurement> results;
+
+  const auto run = [&](const String& name, auto&& operation) -> Unit {
+    const Measurement measured = Measure(operation);
+
+    results.insert_or_assign(name, measured);
+
+    if (!json)
+      Println("{:<34} {:>14.1f} ns/op {:>10.2f} allocs/op", name, measured.nsPerOp, measured.allocsPerOp);
+  };
+
+#ifdef __linux__
+  {
+    namespace pci = draconis::os::pci;
+
+    const String source = SyntheticPciIds(400, 40);
+
+    run("pci/build_index", [&] { Keep(pci::BuildIndex(source, 1)); });
+
+    const fs::path indexPath = scratch / "pci-ids.idx";
+
+    if (Result<pci::Index> index = pci::Index::load(indexPath, 1, [&]() -> Result<String> { return source; }); index) {
+      // Vendor 200 is 0x0258; its device 20 is 0x0064.
+      run("pci/lookup", [&] { Keep(index->lookup(0x0258, 0x0064)); });
+    } else
+      error_at(index.error());
+
+    const String vendor = "Advanced Micro Devices, Inc. [AMD/ATI]";
+    const String device = "Navi 31 [Radeon RX 7900 XT/7900 XTX/7900M]";
+
+    run("gpu/clean_model_name", [&] { Keep(pci::CleanGpuModelName(vendor, device)); });
+
+    StringView osRelease = OS_RELEASE;
+
+    run("os_release/parse", [&] {
+      Keep(osRelease);
+      Keep(draconis::os::sysfs::ParseOsRelease(osRelease));
+    });
+  }
+#endif
+
+#if DRAC_ENABLE_PACKAGECOUNT
+  for (const u64 count : { 1'000, 10'000, 100'000 }) {
+    const fs::path dir = scratch / std::format("packages-{}", count);
+
+    PopulateDirectory(dir, count);
+
+    run(std::format("packages/count_directory_{}", count), [&] {
+      Keep(draconis::services::packages::GetCountFromDirectoryNoCache("bench", dir, String(".list"), false));
+    });
+  }
+#endif
+
+  if constexpr (DRAC_ENABLE_CACHING) {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::pack());
+
+    const String key   = "bench_get_or_set";
+    const auto   fetch = []() -> Result<OSInfo> { return OSInfo("Arch Linux", "rolling", "arch"); };
+
+    run("cache/get_or_set_hit", [&] { Keep(cache.getOrSet<OSInfo>(key, fetch)); });
+
+    // Includes the invalidate() that forces the miss: a pack erase and a stat per file location.
+    run("cache/get_or_set_miss", [&] {
+      cache.invalidate(key);
+      Keep(cache.getOrSet<OSInfo>(key, fetch));
+    });
+
+    cache.invalidate(key);
+  }
+
+  {
+    using namespace draconis::ui::text;
+
+    StringView mixed = "AMD Ryzen 9 7950X 16-Core Processor 󰍛 内存 16.0 GiB / 64.0 GiB";
+    StringView prose =
+      "Draconis++ collects system information from sysfs, procfs and the platform APIs, "
+      "caches what doesn't change between runs, and renders it next to a logo in a few milliseconds.";
+
+    run("text/visual_width", [&] {
+      Keep(mixed);
+      Keep(GetVisualWidth(mixed));
+    });
+    run("text/word_wrap", [&] {
+      Keep(prose);
+      Keep(WordWrap(prose, 40));
+    });
+  }
+
+  {
+    using draconis::config::Config;
+    using draconis::core::system::Readout;
+    using draconis::core::system::SystemInfo;
+    using draconis::utils::localization::GetTranslationManager;
+    using draconis::utils::memory::FrameArena;
+
+    // Fixed readouts, name and language instead of the host's, so the frame (and
+    // what it allocates) is the same on every machine. Only the rendering is timed.
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    GetTranslationManager().setLanguage("en");
+
+    Config config;
+    config.general.name = "user";
+
+    SystemInfo data(cache, config, { .readouts = Readout::None });
+
+    data.date            = "October 14th";
+    data.host            = "ThinkPad X1 Carbon Gen 11";
+    data.kernelVersion   = "6.18.44-arch1";
+    data.operatingSystem = OSInfo("Arch Linux", "rolling", "arch");
+    data.memInfo         = ResourceUsage(8ULL << 30, 32ULL << 30);
+    data.desktopEnv      = "KDE";
+    data.windowMgr       = "KWin";
+    data.diskUsage       = ResourceUsage(256ULL << 30, 1024ULL << 30);
+    data.shell           = "Zsh";
+    data.cpuModel        = "AMD Ryzen 9 7950X 16-Core Processor";
+    data.cpuCores        = CPUCores(16, 32);
+    data.gpuModel        = "AMD Radeon RX 7900 XTX";
+    data.uptime          = std::chrono::seconds(93'784);
+#if DRAC_ENABLE_PACKAGECOUNT
+    data.packageCount = 1'234;
+#endif
+
+    run("ui/create_ui", [&] { Keep(draconis::ui::CreateUI(cache, config, data, true)); });
+
+    String     frame;
+    FrameArena arena;
+
+    run("ui/render_ui", [&] {
+      draconis::ui::RenderUI(cache, config, data, true, frame, arena.resource());
+      Keep(frame);
+      frame.clear();
+      arena.reset();
+    });
+  }
+
+  {
+    using draconis::utils::argparse::ArgumentParser;
+
+    const Vec<String> args = { "draconis++", "--json", "--pretty", "--lang", "en", "-w", "2.5", "--logo-width", "64" };
+
+    // Built and parsed together, as every run does.
+    run("argparse/parse", [&] {
+      ArgumentParser parser("draconis++", DRAC_VERSION);
+
+      bool   jsonOutput = false, prettyJson = false, noAscii = false;
+      String language, logoPath;
+      f64    watch = 0.0;
+      i32    logoWidth = 0;
+
+      parser.addArguments("--json").help("Output in JSON format.").flag().bindTo(jsonOutput);
+      parser.addArguments("--pretty").help("Pretty-print JSON.").flag().bindTo(prettyJson);
+      parser.addArguments("--no-ascii").help("Disable ASCII art display.").flag().bindTo(noAscii);
+      parser.addArguments("--lang").help("Language.").defaultValue(String("")).bindTo(language);
+      parser.addArguments("--logo-path").help("Logo image.").defaultValue(String("")).bindTo(logoPath);
+      parser.addArguments("-w", "--watch").help("Refresh interval.").defaultValue(f64(0.0)).bindTo(watch);
+      parser.addArguments("--logo-width").help("Logo width.").defaultValue(i32(0)).bindTo(logoWidth);
+
+      Keep(parser.parseInto(args));
+    });
+  }
+
+  if (json) {
+    String buffer;
+
+    if (const glz::error_ctx errc = glz::write<glz::opts { .prettify = true }>(results, buffer); errc)
+      Println("Failed to write JSON output: {}", glz::format_error(errc, buffer));
+    else
+      Println(buffer);
+  }
+
+  if (!writeBaselinePath.empty()) {
+    Baselines recorded;
+
+    for (const auto& [name, measured] : results)
+      recorded.insert_or_assign(name, Baseline { .nsPerOp = measured.nsPerOp, .allocsPerOp = measured.allocsPerOp });
+
+    String buffer;
+
+    if (const glz::error_ctx errc = glz::write<glz::opts { .prettify = true }>(recorded, buffer); errc) {
+      Println("Failed to encode baseline: {}", glz::format_error(errc, buffer));
+      return EXIT_FAILURE;
+    }
+
+    std::ofstream(writeBaselinePath, std::ios::binary | std::ios::trunc) << buffer << '\n';
+  }
+
+  if (baselinePath.empty())
+    return EXIT_SUCCESS;
+
+  std::ifstream file(baselinePath, std::ios::binary);
+
+  if (!file) {
+    Println("Could not open baseline '{}'", baselinePath);
+    return EXIT_FAILURE;
+  }
+
+  const String contents((std::istreambuf_iterator<char>(file)), {});
+
+  Baselines baselines;
+
+  if (const glz::error_ctx errc = glz::read_json(baselines, contents); errc) {
+    Println("Failed to parse baseline '{}': {}", baselinePath, glz::format_error(errc, contents));
+    return EXIT_FAILURE;
+  }
+
+  usize regressions = 0;
+
+  for (const auto& [name, baseline] : baselines) {
+    // Cases that don't run on this platform or build are skipped.
+    const auto iter = results.find(name);
+
+    if (iter == results.end())
+      continue;
+
+    const Measurement& measured = iter->second;
+
+    // Allocation counts are exact; the slack only absorbs rounding in the recorded value.
+    if (measured.allocsPerOp > baseline.allocsPerOp + 0.01) {
+      Println("REGRESSION {}: {:.2f} allocs/op, baseline {:.2f}", name, measured.allocsPerOp, baseline.allocsPerOp);
+      regressions++;
+    }
+
+    if (baseline.nsPerOp && measured.nsPerOp > *baseline.nsPerOp * tolerance) {
+      Println("REGRESSION {}: {:.1f} ns/op, baseline {:.1f} (tolerance {}x)", name, measured.nsPerOp, *baseline.nsPerOp, tolerance);
+      regressions++;
+    }
+  }
+
+  return regressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,70 @@
+#include <boost/ut.hpp>
+#include <memory_resource>
+
+#include <Drac++/Utils/Arena.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+using namespace boost::ut;
+using namespace draconis::utils::types;
+using draconis::utils::memory::CountingResource, draconis::utils::memory::FrameArena;
+
+namespace {
+  // Roughly what a rendered frame asks for: a table of strings too long for SSO.
+  auto FillFrame(std::pmr::memory_resource* resource) -> usize {
+    std::pmr::vector<std::pmr::string> rows(resource);
+
+    for (usize i = 0; i < 64; ++i)
+      rows.emplace_back(48, 'x');
+
+    return rows.size();
+  }
+} // namespace
+
+auto main() -> int {
+  "Counting resource sees every allocation"_test = [] -> void {
+    CountingResource counter;
+
+    {
+      std::pmr::vector<u64> values(&counter);
+      values.reserve(16);
+    }
+
+    expect(counter.allocations() == 1_u);
+    expect(counter.bytes() == 16 * sizeof(u64));
+
+    counter.resetCounts();
+    expect(counter.allocations() == 0_u);
+  };
+
+  "Frames that fit the block never go upstream"_test = [] -> void {
+    CountingResource upstream;
+    FrameArena       arena(64 * 1024, &upstream);
+
+    expect(FillFrame(arena.resource()) == 64_u);
+    expect(arena.spills() == 0_u);
+    expect(upstream.allocations() == 0_u);
+  };
+
+  "A spilled frame grows the block for the next one"_test = [] -> void {
+    CountingResource upstream;
+    FrameArena       arena(256, &upstream);
+
+    static_cast<void>(FillFrame(arena.resource()));
+    expect(arena.spills() > 0_u);
+
+    arena.reset();
+    expect(arena.capacity() > 256_u);
+
+    const u64 afterGrowth = upstream.allocations();
+
+    for (usize frame = 0; frame < 4; ++frame) {
+      static_cast<void>(FillFrame(arena.resource()));
+      expect(arena.spills() == 0_u);
+      arena.reset();
+    }
+
+    expect(upstream.allocations() == afterGrowth);
+  };
+
+  return 0;
+}
@@ -0,0 +1,126 @@
+#include <boost/ut.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include <Drac++/Utils/AsyncLogging.hpp>
+#include <Drac++/Utils/Logging.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+using namespace boost::ut;
+using namespace draconis::utils::types;
+
+namespace {
+  namespace logging = draconis::utils::logging;
+
+  auto TempLogPath(const StringView name) -> std::filesystem::path {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path;
+  }
+
+  auto ReadLines(const std::filesystem::path& path) -> Vec<String> {
+    std::ifstream ifs(path, std::ios::binary);
+    Vec<String>   lines;
+
+    for (String line; std::getline(ifs, line);)
+      lines.push_back(std::move(line));
+
+    return lines;
+  }
+} // namespace
+
+auto main() -> int {
+  // Warn is the lowest level every default build keeps (-Dmin_log_level=auto drops debug/info in release).
+  if constexpr (logging::MIN_LOG_LEVEL > logging::LogLevel::Warn)
+    return 0;
+
+  logging::SetRuntimeLogLevel(logging::LogLevel::Warn);
+
+  "Records from every thread reach the file in per-thread order"_test = [] -> void {
+    constexpr usize THREADS = 8;
+    constexpr usize RECORDS = 2000; // Enough to wrap the queue several times
+
+    const std::filesystem::path path = TempLogPath("draconis_test_async.log");
+
+    expect(logging::StartAsyncLogging({ .file = path }).has_value());
+
+    {
+      Vec<std::thread> threads;
+
+      for (usize thread = 0; thread < THREADS; ++thread)
+        threads.emplace_back([thread] {
+          for (usize i = 0; i < RECORDS; ++i)
+            warn_log("async-test {} {}", thread, i);
+        });
+
+      for (std::thread& thread : threads)
+        thread.join();
+    }
+
+    logging::FlushLogs();
+    logging::StopAsyncLogging();
+
+    Array<usize, THREADS> next {};
+    usize                 count     = 0;
+    bool                  ordered   = true;
+    bool                  hasEscape = false;
+
+    for (const String& line : ReadLines(path)) {
+      hasEscape |= line.find('\033') != String::npos;
+
+      const usize marker = line.find("async-test ");
+
+      if (marker == String::npos)
+        continue; // Debug builds add a source-location line per record
+
+      usize thread = 0, index = 0;
+      std::sscanf(line.c_str() + marker, "async-test %zu %zu", &thread, &index);
+
+      ordered &= thread < THREADS && next[thread]++ == index;
+      count++;
+    }
+
+    expect(count == THREADS * RECORDS);
+    expect(ordered);
+    expect(!hasEscape);
+
+    std::filesystem::remove(path);
+  };
+
+  "The sink can be stopped and started again"_test = [] -> void {
+    const std::filesystem::path first  = TempLogPath("draconis_test_async_first.log");
+    const std::filesystem::path second = TempLogPath("draconis_test_async_second.log");
+
+    expect(logging::StartAsyncLogging({ .file = first }).has_value());
+    expect(logging::StartAsyncLogging({ .file = second }).has_value()); // Already running: no-op
+    warn_log("first run");
+    logging::StopAsyncLogging();
+    logging::StopAsyncLogging(); // Already stopped: no-op
+
+    expect(logging::StartAsyncLogging({ .file = second }).has_value());
+    warn_log("second run");
+    logging::StopAsyncLogging();
+
+    const Vec<String> firstLines  = ReadLines(first);
+    const Vec<String> secondLines = ReadLines(second);
+
+    expect(!firstLines.empty() && firstLines.front().find("first run") != String::npos);
+    expect(!secondLines.empty() && secondLines.front().find("second run") != String::npos);
+
+    std::filesystem::remove(first);
+    std::filesystem::remove(second);
+  };
+
+  "Opening an unwritable file fails without starting the sink"_test = [] -> void {
+    const Result<> started = logging::StartAsyncLogging({ .file = "/nonexistent-dir/draconis.log" });
+
+    expect(!started.has_value());
+
+    // Nothing is running, so this must return immediately.
+    logging::FlushLogs();
+  };
+
+  return 0;
+}
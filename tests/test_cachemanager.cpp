@@ -0,0 +1,236 @@
+#include <atomic>
+#include <boost/ut.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include <Drac++/Utils/CacheManager.hpp>
+
+using namespace boost::ut;
+using namespace draconis::utils::cache;
+using namespace draconis::utils::types;
+
+auto main() -> int {
+  // Everything below exercises the caching layer itself.
+  if constexpr (!DRAC_ENABLE_CACHING)
+    return 0;
+
+  "In-memory hits skip the fetcher"_test = [] -> void {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    i32 calls = 0;
+
+    const auto fetch = [&]() -> Result<String> {
+      calls++;
+      return String("value");
+    };
+
+    expect(cache.getOrSet<String>("test_hit", fetch) == Result<String>("value"));
+    expect(cache.getOrSet<String>("test_hit", fetch) == Result<String>("value"));
+    expect(calls == 1_i);
+  };
+
+  "Failed fetches are not cached"_test = [] -> void {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    i32 calls = 0;
+
+    const auto fetch = [&]() -> Result<u64> {
+      calls++;
+      ERR(draconis::utils::error::DracErrorCode::NotFound, "missing");
+    };
+
+    expect(!cache.getOrSet<u64>("test_fail", fetch).has_value());
+    expect(!cache.getOrSet<u64>("test_fail", fetch).has_value());
+    expect(calls == 2_i);
+  };
+
+  "Invalidate forces a refetch"_test = [] -> void {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    u64 next = 0;
+
+    const auto fetch = [&]() -> Result<u64> { return next++; };
+
+    expect(cache.getOrSet<u64>("test_invalidate", fetch) == Result<u64>(0));
+    cache.invalidate("test_invalidate");
+    expect(cache.getOrSet<u64>("test_invalidate", fetch) == Result<u64>(1));
+  };
+
+  "Validated entries follow their source file"_test = [] -> void {
+    namespace fs = std::filesystem;
+
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    const fs::path source = fs::temp_directory_path() / "drac_test_fingerprint_source";
+
+    const auto writeSource = [&](const StringView contents) {
+      std::ofstream ofs(source, std::ios::binary | std::ios::trunc);
+      ofs << contents;
+    };
+
+    i32 calls = 0;
+
+    const auto fetch = [&]() -> Result<u64> {
+      calls++;
+      return fs::file_size(source);
+    };
+
+    writeSource("abc");
+
+    expect(cache.getOrSetValidated<u64>("test_validated", { source }, fetch) == Result<u64>(3));
+    expect(cache.getOrSetValidated<u64>("test_validated", { source }, fetch) == Result<u64>(3));
+    expect(calls == 1_i);
+
+    writeSource("abcdef");
+
+    expect(cache.getOrSetValidated<u64>("test_validated", { source }, fetch) == Result<u64>(6));
+    expect(calls == 2_i);
+
+    fs::remove(source);
+  };
+
+  "Stale entries are served while a refresh is queued"_test = [] -> void {
+    CacheManager cache;
+
+    // Expires as soon as it is stored, but may be served for an hour after that.
+    const CachePolicy policy { .location = CacheLocation::InMemory, .ttl = std::chrono::seconds(0), .staleFor = std::chrono::hours(1) };
+
+    u64 next = 0;
+
+    const auto fetch = [&]() -> Result<u64> { return next++; };
+
+    expect(cache.getOrSet<u64>("test_stale", policy, fetch) == Result<u64>(0));
+    expect(cache.getOrSet<u64>("test_stale", policy, fetch) == Result<u64>(0));
+    expect(cache.getOrSet<u64>("test_stale", policy, fetch) == Result<u64>(0));
+    expect(next == 1_ull);
+    expect(cache.pendingRefreshes() == 1_ul);
+    expect(cache.staleHits() == 2_ull);
+
+    expect(cache.runPendingRefreshes() == 1_ul);
+    expect(next == 2_ull);
+    expect(cache.getOrSet<u64>("test_stale", policy, fetch) == Result<u64>(1));
+  };
+
+  "A miss during a background refresh waits for it"_test = [] -> void {
+    CacheManager cache;
+
+    const CachePolicy expired { .location = CacheLocation::InMemory, .ttl = std::chrono::seconds(0) };
+    const CachePolicy policy { .location = CacheLocation::InMemory, .ttl = std::chrono::hours(1), .staleFor = std::chrono::hours(1) };
+
+    std::atomic<i32>  calls    = 0;
+    std::atomic<bool> started  = false;
+    std::atomic<bool> released = false;
+
+    const auto fetch = [&]() -> Result<u64> {
+      calls++;
+
+      started.store(true);
+      started.notify_one();
+      released.wait(false);
+
+      return 2;
+    };
+
+    cache.set<u64>("test_refresh_flight", 1, expired);
+    expect(cache.getOrSet<u64>("test_refresh_flight", policy, fetch) == Result<u64>(1));
+
+    cache.refreshInBackground();
+    started.wait(false);
+
+    // With the stale entry gone, the next lookup is a miss while the refresh is still fetching.
+    cache.invalidate("test_refresh_flight");
+
+    Result<u64> result = 0;
+
+    {
+      std::jthread follower([&] { result = cache.getOrSet<u64>("test_refresh_flight", policy, fetch); });
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      released.store(true);
+      released.notify_all();
+    }
+
+    expect(result == Result<u64>(2));
+    expect(calls.load() == 1_i);
+  };
+
+  "Validated entries can be served stale after their source changes"_test = [] -> void {
+    namespace fs = std::filesystem;
+
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    const fs::path source = fs::temp_directory_path() / "drac_test_stale_source";
+
+    const auto writeSource = [&](const StringView contents) {
+      std::ofstream ofs(source, std::ios::binary | std::ios::trunc);
+      ofs << contents;
+    };
+
+    const auto fetch = [source]() -> Result<u64> { return fs::file_size(source); };
+
+    writeSource("abc");
+    expect(cache.getOrSetValidated<u64>("test_validated_stale", { source }, fetch, true) == Result<u64>(3));
+
+    writeSource("abcdef");
+    expect(cache.getOrSetValidated<u64>("test_validated_stale", { source }, fetch, true) == Result<u64>(3));
+
+    expect(cache.runPendingRefreshes() == 1_ul);
+    expect(cache.getOrSetValidated<u64>("test_validated_stale", { source }, fetch, true) == Result<u64>(6));
+    expect(cache.pendingRefreshes() == 0_ul);
+
+    fs::remove(source);
+  };
+
+  "Revalidating refetches but still fills the cache"_test = [] -> void {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    i32 calls = 0;
+
+    const auto fetch = [&]() -> Result<i32> { return ++calls; };
+
+    CacheManager::revalidate = true;
+    expect(cache.getOrSet<i32>("test_revalidate", fetch) == Result<i32>(1));
+    expect(cache.getOrSet<i32>("test_revalidate", fetch) == Result<i32>(2));
+    CacheManager::revalidate = false;
+
+    expect(cache.getOrSet<i32>("test_revalidate", fetch) == Result<i32>(2));
+    expect(calls == 2_i);
+  };
+
+  "Concurrent misses on one key run the fetcher once"_test = [] -> void {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    std::atomic<i32> calls = 0;
+
+    const auto fetch = [&]() -> Result<u64> {
+      calls++;
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      return 42;
+    };
+
+    Array<Result<u64>, 8> results;
+
+    {
+      Vec<std::jthread> threads;
+
+      for (Result<u64>& result : results)
+        threads.emplace_back([&] { result = cache.getOrSet<u64>("test_single_flight", fetch); });
+    }
+
+    expect(calls.load() == 1_i);
+
+    for (const Result<u64>& result : results)
+      expect(result == Result<u64>(42));
+  };
+
+  return 0;
+}
@@ -0,0 +1,194 @@
+#include <boost/ut.hpp>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <thread>
+
+#include <Drac++/Utils/CachePack.hpp>
+
+using namespace boost::ut;
+using namespace draconis::utils::cache;
+using namespace draconis::utils::types;
+
+namespace fs = std::filesystem;
+
+namespace {
+  auto TempPackPath(const StringView name) -> fs::path {
+    return fs::temp_directory_path() / std::format("drac_test_{}.pack", name);
+  }
+} // namespace
+
+auto main() -> int {
+  "Pending writes are visible before flush"_test = [] -> void {
+    const fs::path path = TempPackPath("pending");
+    fs::remove(path);
+
+    CachePack pack(path);
+    pack.put("key", "value");
+
+    expect(pack.get("key") == Option<String>("value"));
+    expect(!pack.get("missing").has_value());
+    expect(!fs::exists(path));
+
+    pack.clear();
+  };
+
+  "Flushed entries survive a reload"_test = [] -> void {
+    const fs::path path = TempPackPath("reload");
+    fs::remove(path);
+
+    {
+      CachePack pack(path);
+      pack.put("alpha", "1");
+      pack.put("beta", String("\0binary\0", 8));
+      expect(pack.flush().has_value());
+    }
+
+    CachePack reloaded(path);
+    expect(reloaded.get("alpha") == Option<String>("1"));
+    expect(reloaded.get("beta") == Option<String>(String("\0binary\0", 8)));
+
+    reloaded.clear();
+    expect(!fs::exists(path));
+  };
+
+  "Flush merges with entries written by another pack"_test = [] -> void {
+    const fs::path path = TempPackPath("merge");
+    fs::remove(path);
+
+    CachePack first(path);
+    CachePack second(path);
+
+    first.put("first", "a");
+    second.put("second", "b");
+
+    expect(first.flush().has_value());
+    expect(second.flush().has_value());
+
+    CachePack reader(path);
+    expect(reader.get("first") == Option<String>("a"));
+    expect(reader.get("second") == Option<String>("b"));
+
+    reader.clear();
+  };
+
+  "Erased keys are dropped on flush"_test = [] -> void {
+    const fs::path path = TempPackPath("erase");
+    fs::remove(path);
+
+    {
+      CachePack pack(path);
+      pack.put("keep", "1");
+      pack.put("drop", "2");
+      expect(pack.flush().has_value());
+
+      pack.erase("drop");
+      expect(!pack.get("drop").has_value());
+      expect(pack.flush().has_value());
+    }
+
+    CachePack reloaded(path);
+    expect(reloaded.get("keep") == Option<String>("1"));
+    expect(!reloaded.get("drop").has_value());
+
+    reloaded.clear();
+  };
+
+  "Erasing an absent key leaves nothing to flush"_test = [] -> void {
+    const fs::path path = TempPackPath("erase_absent");
+    fs::remove(path);
+
+    CachePack pack(path);
+    pack.erase("missing");
+
+    expect(pack.flush().has_value());
+    expect(!fs::exists(path));
+  };
+
+  "Flushes from separate packs don't drop each other's entries"_test = [] -> void {
+    const fs::path path = TempPackPath("concurrent");
+    fs::remove(path);
+
+    constexpr usize WRITERS = 8;
+
+    {
+      Vec<std::thread> writers;
+
+      for (usize i = 0; i < WRITERS; ++i)
+        writers.emplace_back([&path, i] {
+          CachePack pack(path);
+          pack.put(std::format("writer_{}", i), "x");
+          expect(pack.flush().has_value());
+        });
+
+      for (std::thread& writer : writers)
+        writer.join();
+    }
+
+    CachePack reader(path);
+
+    for (usize i = 0; i < WRITERS; ++i)
+      expect(reader.get(std::format("writer_{}", i)) == Option<String>("x"));
+
+    reader.clear();
+  };
+
+  "Malformed pack files are ignored"_test = [] -> void {
+    const fs::path path = TempPackPath("malformed");
+
+    {
+      std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+      ofs << "not a pack";
+    }
+
+    CachePack pack(path);
+    expect(!pack.get("anything").has_value());
+
+    pack.clear();
+  };
+
+  "A failed flush keeps its pending writes"_test = [] -> void {
+    const fs::path path = TempPackPath("retry");
+    fs::remove_all(path);
+
+    // A non-empty directory in the pack's place makes the final rename fail.
+    fs::create_directories(path / "blocker");
+
+    CachePack pack(path);
+    pack.put("key", "value");
+
+    expect(!pack.flush().has_value());
+    expect(pack.get("key") == Option<String>("value"));
+
+    fs::remove_all(path);
+
+    expect(pack.flush().has_value());
+    expect(CachePack(path).get("key") == Option<String>("value"));
+
+    pack.clear();
+  };
+
+#ifndef _WIN32
+  "Private directories are restricted to their owner"_test = [] -> void {
+    const fs::path dir = fs::temp_directory_path() / "drac_test_private_dir";
+    fs::remove_all(dir);
+
+    fs::create_directories(dir);
+    fs::permissions(dir, fs::perms::all);
+
+    expect(CreatePrivateDirectory(dir).has_value());
+    expect(fs::status(dir).permissions() == fs::perms::owner_all);
+
+    const fs::path link = fs::temp_directory_path() / "drac_test_private_link";
+    fs::remove(link);
+    fs::create_directory_symlink(dir, link);
+
+    expect(!CreatePrivateDirectory(link).has_value());
+
+    fs::remove(link);
+    fs::remove_all(dir);
+  };
+#endif
+
+  return 0;
+}
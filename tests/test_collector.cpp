@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <atomic>
+#include <boost/ut.hpp>
+#include <format>
+#include <stdexcept>
+
+#include <Drac++/Core/Collector.hpp>
+
+using namespace boost::ut;
+using namespace draconis::core::collector;
+using namespace draconis::utils::types;
+
+auto main() -> int {
+  "Collector runs every task once"_test = [] -> void {
+    Collector        collector(4);
+    std::atomic<i32> counter = 0;
+    Array<bool, 16>  ran     = {};
+
+    for (usize i = 0; i < ran.size(); ++i)
+      collector.add(std::format("task_{}", i), [&, i] {
+        ran.at(i) = true;
+        counter++;
+      });
+
+    collector.run();
+
+    expect(counter.load() == 16_i);
+    expect(std::ranges::all_of(ran, [](const bool value) { return value; }));
+    expect(collector.timings().size() == 16_ul);
+  };
+
+  "Collector honours dependencies"_test = [] -> void {
+    Collector collector(4);
+
+    std::atomic<i32> sequence = 0;
+    i32              osOrder = -1, logoOrder = -1, iconOrder = -1;
+
+    const TaskId osTask = collector.add("os", [&] { osOrder = sequence++; });
+    collector.add("logo", [&] { logoOrder = sequence++; }, { osTask });
+    collector.add("icon", [&] { iconOrder = sequence++; }, { osTask, osTask });
+
+    collector.run();
+
+    expect(osOrder == 0_i);
+    expect(logoOrder > osOrder);
+    expect(iconOrder > osOrder);
+  };
+
+  "Collector ignores unknown dependencies"_test = [] -> void {
+    Collector collector(2);
+    bool      ran = false;
+
+    collector.add("orphan", [&] { ran = true; }, { 42 });
+    collector.run();
+
+    expect(ran);
+  };
+
+  "Collector continues after a throwing task"_test = [] -> void {
+    Collector collector(2);
+    bool      dependentRan = false;
+
+    const TaskId failing = collector.add("failing", [] { throw std::runtime_error("boom"); });
+    collector.add("dependent", [&] { dependentRan = true; }, { failing });
+
+    collector.run();
+
+    expect(dependentRan);
+  };
+
+  "Single-threaded collector runs in registration order"_test = [] -> void {
+    Collector collector(1);
+    Vec<i32>  order;
+
+    for (i32 i = 0; i < 5; ++i)
+      collector.add(std::format("task_{}", i), [&, i] { order.push_back(i); });
+
+    collector.run();
+
+    expect(order == Vec<i32> { 0, 1, 2, 3, 4 });
+  };
+
+  return 0;
+}
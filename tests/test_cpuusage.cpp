@@ -0,0 +1,149 @@
+#include <boost/ut.hpp>
+
+#include <Drac++/Core/CPUUsage.hpp>
+
+using namespace boost::ut;
+using namespace draconis::core::system;
+using namespace draconis::utils::types;
+using draconis::utils::error::DracErrorCode;
+
+namespace {
+  // Replays a fixed sequence of reads: each entry is the total followed by the per-CPU times.
+  struct FakeReader {
+    Vec<Vec<CPUTimes>>* reads;
+    usize*              next;
+
+    auto operator()(Vec<CPUTimes>& perCpu) const -> Result<CPUTimes> {
+      if (*next >= reads->size())
+        ERR(DracErrorCode::NotFound, "no more reads");
+
+      const Vec<CPUTimes>& read = (*reads)[(*next)++];
+
+      perCpu.assign(read.begin() + 1, read.end());
+
+      return read.front();
+    }
+  };
+} // namespace
+
+auto main() -> int {
+  "the first sample is the average since boot"_test = [] -> void {
+    Vec<Vec<CPUTimes>> reads = {
+      { { .busy = 30, .idle = 70 }, { .busy = 10, .idle = 40 }, { .busy = 20, .idle = 30 } },
+    };
+    usize next = 0;
+
+    CPUUsageSampler sampler(4, FakeReader { &reads, &next });
+
+    const Result<CPULoad> load = sampler.sample();
+
+    expect(fatal(load.has_value()));
+    expect(load->total == 30.0_d);
+    expect(fatal(load->perCpu.size() == 2_ul));
+    expect(load->perCpu[0] == 20.0_d);
+    expect(load->perCpu[1] == 40.0_d);
+  };
+
+  "later samples cover the period since the previous one"_test = [] -> void {
+    Vec<Vec<CPUTimes>> reads = {
+      { { .busy = 100, .idle = 100 }, { .busy = 50, .idle = 50 }, { .busy = 50, .idle = 50 } },
+      { { .busy = 175, .idle = 125 }, { .busy = 100, .idle = 50 }, { .busy = 75, .idle = 75 } },
+    };
+    usize next = 0;
+
+    CPUUsageSampler sampler(4, FakeReader { &reads, &next });
+
+    expect(sampler.sample().has_value());
+
+    const Result<CPULoad> load = sampler.sample();
+
+    expect(fatal(load.has_value()));
+    expect(load->total == 75.0_d);
+    expect(load->perCpu[0] == 100.0_d);
+    expect(load->perCpu[1] == 50.0_d);
+  };
+
+  "a CPU that comes online is measured from zero"_test = [] -> void {
+    Vec<Vec<CPUTimes>> reads = {
+      { { .busy = 10, .idle = 10 }, { .busy = 10, .idle = 10 } },
+      { { .busy = 30, .idle = 30 }, { .busy = 20, .idle = 20 }, { .busy = 1, .idle = 3 } },
+    };
+    usize next = 0;
+
+    CPUUsageSampler sampler(4, FakeReader { &reads, &next });
+
+    expect(sampler.sample().has_value());
+
+    const Result<CPULoad> load = sampler.sample();
+
+    expect(fatal(load.has_value()));
+    expect(fatal(load->perCpu.size() == 2_ul));
+    expect(load->perCpu[1] == 25.0_d);
+  };
+
+  "history keeps the newest samples, oldest first"_test = [] -> void {
+    // Each period spans 100 ticks, so the loads are 10, 50, 20, 80 and 10.
+    Vec<Vec<CPUTimes>> reads = {
+      { { .busy = 10, .idle = 90 } },
+      { { .busy = 60, .idle = 140 } },
+      { { .busy = 80, .idle = 220 } },
+      { { .busy = 160, .idle = 240 } },
+      { { .busy = 170, .idle = 330 } },
+    };
+    usize           next = 0;
+    CPUUsageSampler sampler(3, FakeReader { &reads, &next });
+
+    expect(!sampler.latest().has_value());
+
+    for (usize i = 0; i < reads.size(); ++i)
+      expect(sampler.sample().has_value());
+
+    Vec<CPUUsageSample> history;
+    sampler.history(history);
+
+    expect(fatal(history.size() == 3_ul));
+    expect(history[0].load.total == 20.0_d);
+    expect(history[1].load.total == 80.0_d);
+    expect(history[2].load.total == 10.0_d);
+    expect(history[0].at <= history[1].at && history[1].at <= history[2].at);
+
+    const Option<CPUUsageSample> latest = sampler.latest();
+
+    expect(fatal(latest.has_value()));
+    expect(latest->load.total == 10.0_d);
+    expect(latest->at == history[2].at);
+    expect(sampler.capacity() == 3_ul);
+  };
+
+  "a failed read leaves the history alone"_test = [] -> void {
+    Vec<Vec<CPUTimes>> reads = { { { .busy = 1, .idle = 1 } } };
+    usize              next  = 0;
+
+    CPUUsageSampler sampler(2, FakeReader { &reads, &next });
+
+    expect(sampler.sample().has_value());
+
+    const Result<CPULoad> failed = sampler.sample();
+
+    expect(!failed.has_value() && failed.error().code == DracErrorCode::NotFound);
+
+    Vec<CPUUsageSample> history;
+    sampler.history(history);
+
+    expect(history.size() == 1_ul);
+  };
+
+#ifdef __linux__
+  "the default reader reads /proc/stat"_test = [] -> void {
+    CPUUsageSampler sampler;
+
+    const Result<CPULoad> load = sampler.sample();
+
+    expect(fatal(load.has_value()));
+    expect(load->total >= 0.0 && load->total <= 100.0);
+    expect(!load->perCpu.empty());
+  };
+#endif
+
+  return 0;
+}
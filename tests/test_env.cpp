@@ -34,5 +34,36 @@ auto main() -> int {
     expect(!result.has_value());
   };
 
+#ifndef _WIN32
+  // Must stay the first use of the snapshot in this binary.
+  "the snapshot resolves directories once and ignores later changes"_test = [] -> void {
+    SetEnv("XDG_DATA_HOME", "/tmp/drac_test_env_data");
+    SetEnv("CARGO_HOME", "/tmp/drac_test_env_cargo");
+
+    const EnvSnapshot& env = GetEnvSnapshot();
+
+    expect(env.xdgDataHome == Option<String>("/tmp/drac_test_env_data"));
+    expect(env.cargoHome == Option<String>("/tmp/drac_test_env_cargo"));
+    expect(env.dataDir == std::filesystem::path("/tmp/drac_test_env_data/draconis++"));
+    expect(env.persistentCacheDir.filename() == "draconis++");
+
+    SetEnv("XDG_DATA_HOME", "/tmp/drac_test_env_elsewhere");
+
+    expect(&GetEnvSnapshot() == &env);
+    expect(GetEnvSnapshot().dataDir == std::filesystem::path("/tmp/drac_test_env_data/draconis++"));
+
+    UnsetEnv("XDG_DATA_HOME");
+    UnsetEnv("CARGO_HOME");
+  };
+#endif
+
+  "ToResult mirrors GetEnv"_test = [] -> void {
+    expect(ToResult(String("zsh")) == Result<String>("zsh"));
+
+    const Result<String> missing = ToResult(None);
+
+    expect(!missing.has_value() && missing.error().code == DracErrorCode::NotFound);
+  };
+
   return 0;
 }
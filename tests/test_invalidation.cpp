@@ -0,0 +1,118 @@
+#include <boost/ut.hpp>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#include <Drac++/Core/Invalidation.hpp>
+
+#include <Drac++/Utils/CacheManager.hpp>
+
+using namespace boost::ut;
+using namespace draconis::core::system;
+using namespace draconis::utils::types;
+using draconis::utils::cache::CacheManager, draconis::utils::cache::CachePolicy;
+using draconis::utils::error::DracErrorCode;
+
+namespace fs = std::filesystem;
+
+namespace {
+  auto FreshDir(const StringView name) -> fs::path {
+    const fs::path dir = fs::temp_directory_path() / std::format("drac_test_invalidation_{}", name);
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    return dir;
+  }
+
+  auto Touch(const fs::path& path) -> Unit {
+    std::ofstream(path) << "changed";
+  }
+} // namespace
+
+auto main() -> int {
+  // Everything below checks what ends up in the cache.
+  if constexpr (!DRAC_ENABLE_CACHING)
+    return 0;
+
+#ifdef __linux__
+  "Writing into a watched directory invalidates its keys"_test = [] -> void {
+    const fs::path dir = FreshDir("directory");
+
+    CacheManager cache;
+    cache.set<u64>("test_watched", 1, CachePolicy::inMemory());
+
+    CacheInvalidator invalidator(cache, { { .source = ChangeSource::Path, .target = dir.string(), .keys = { "test_watched" }, .fields = { SnapshotField::Packages } } });
+
+    std::promise<Vec<SnapshotField>> firedPromise;
+    std::once_flag                   firedOnce;
+    Future<Vec<SnapshotField>>       fired = firedPromise.get_future();
+
+    invalidator.subscribe([&](const InvalidationRule& rule) {
+      std::call_once(firedOnce, [&] { firedPromise.set_value(rule.fields); });
+    });
+
+    expect(invalidator.start().has_value());
+
+    // A burst of writes settles into a single notification.
+    for (int i = 0; i < 10; ++i)
+      Touch(dir / std::format("entry{}", i));
+
+    const bool ready = fired.wait_for(std::chrono::seconds(2)) == std::future_status::ready;
+
+    expect(ready);
+    expect(ready && fired.get() == Vec<SnapshotField> { SnapshotField::Packages });
+    expect(!cache.get<u64>("test_watched", CachePolicy::inMemory()).has_value());
+
+    invalidator.stop();
+    fs::remove_all(dir);
+  };
+
+  "A watched file ignores its siblings"_test = [] -> void {
+    const fs::path dir = FreshDir("file");
+
+    CacheManager cache;
+    cache.set<u64>("test_file", 1, CachePolicy::inMemory());
+
+    CacheInvalidator invalidator(cache, { { .source = ChangeSource::Path, .target = (dir / "watched.toml").string(), .keys = { "test_file" }, .fields = {} } });
+    expect(invalidator.start().has_value());
+
+    Touch(dir / "other.toml");
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    expect(cache.get<u64>("test_file", CachePolicy::inMemory()) == Option<u64>(1));
+
+    // Replacing the file by renaming over it still counts.
+    Touch(dir / "watched.toml.tmp");
+    fs::rename(dir / "watched.toml.tmp", dir / "watched.toml");
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    expect(!cache.get<u64>("test_file", CachePolicy::inMemory()).has_value());
+
+    invalidator.stop();
+    fs::remove_all(dir);
+  };
+
+  "Starting with nothing to watch fails"_test = [] -> void {
+    CacheManager     cache;
+    CacheInvalidator invalidator(cache, { { .source = ChangeSource::Path, .target = "/nonexistent/drac/path", .keys = {}, .fields = {} } });
+
+    const Result<> started = invalidator.start();
+
+    expect(!started.has_value() && started.error().code == DracErrorCode::NotFound);
+  };
+#else
+  "Invalidation is unsupported off Linux"_test = [] -> void {
+    CacheManager     cache;
+    CacheInvalidator invalidator(cache);
+
+    const Result<> started = invalidator.start();
+
+    expect(!started.has_value() && started.error().code == DracErrorCode::NotSupported);
+  };
+#endif
+
+  return 0;
+}
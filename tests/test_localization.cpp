@@ -15,12 +15,12 @@ auto main() -> int {
   "Get key fallback"_test = [] -> void {
     TranslationManager& transMgr = GetTranslationManager();
 
-    String val = transMgr.get("NON_EXISTENT_KEY_XYZ_123");
+    StringView val = transMgr.get("NON_EXISTENT_KEY_XYZ_123");
     expect(val == "NON_EXISTENT_KEY_XYZ_123");
   };
 
   "Localization helpers"_test = [] -> void {
-    String val = _("NON_EXISTENT_KEY_HELPER");
+    StringView val = _("NON_EXISTENT_KEY_HELPER");
     expect(val == "NON_EXISTENT_KEY_HELPER");
   };
 
@@ -30,5 +30,40 @@ auto main() -> int {
     expect(val == "KEY_123");
   };
 
+  "Literal keys resolve to table indices at compile time"_test = [] -> void {
+    static_assert("hello"_key .index == 0);
+    static_assert("unknown"_key .index == data::TRANSLATION_COUNT - 1);
+
+    expect(data::FindKeyIndex("NON_EXISTENT_KEY") == None);
+  };
+
+  "Resolved labels follow the current language"_test = [] -> void {
+    TranslationManager transMgr("en");
+
+    expect(transMgr.get("uptime"_key) == "Uptime");
+    expect(transMgr.get("uptime"_key) == transMgr.get("uptime"));
+    expect(transMgr.hasKey("uptime"));
+    expect(!transMgr.hasKey("NON_EXISTENT_KEY"));
+
+    expect(transMgr.setLanguage("es"));
+    expect(transMgr.get("uptime"_key) == "Tiempo de actividad");
+    expect(transMgr.getWithFallback("disk") == "Disco");
+
+    expect(!transMgr.setLanguage("xx"));
+    expect(transMgr.getCurrentLanguage() == "es");
+
+    expect(transMgr.setLanguage("en"));
+    expect(transMgr.get("disk"_key) == "Disk");
+  };
+
+  "Formatting with resolved keys"_test = [] -> void {
+    TranslationManager& transMgr = GetTranslationManager();
+    const String        previous(transMgr.getCurrentLanguage());
+
+    expect(transMgr.setLanguage("de"));
+    expect(_format("hello"_key, "Welt") == "Hallo Welt!");
+    expect(transMgr.setLanguage(previous));
+  };
+
   return 0;
 }
@@ -0,0 +1,104 @@
+#include <boost/ut.hpp>
+#include <chrono>
+
+#include <Drac++/Core/Metrics.hpp>
+
+using namespace boost::ut;
+using namespace draconis::core::system;
+using namespace draconis::utils::types;
+using draconis::utils::error::DracError, draconis::utils::error::DracErrorCode;
+
+namespace {
+  auto Render(const SystemSnapshot& snapshot) -> String {
+    String out;
+    WriteOpenMetrics(snapshot, out);
+    return out;
+  }
+
+  auto Contains(const StringView haystack, const StringView needle) -> bool {
+    return haystack.find(needle) != StringView::npos;
+  }
+} // namespace
+
+auto main() -> int {
+  "Exposition ends with EOF"_test = [] -> void {
+    const String out = Render(SystemSnapshot {});
+
+    expect(out.ends_with("# EOF\n"));
+    expect(Contains(out, "# TYPE drac_system info\n"));
+  };
+
+  "Gauges carry readout values"_test = [] -> void {
+    SystemSnapshot snapshot;
+    snapshot.memInfo = ResourceUsage(1024, 4096);
+    snapshot.uptime  = std::chrono::seconds(90);
+
+    const String out = Render(snapshot);
+
+    expect(Contains(out, "drac_memory_used_bytes 1024\n"));
+    expect(Contains(out, "drac_memory_total_bytes 4096\n"));
+    expect(Contains(out, "drac_uptime_seconds 90\n"));
+  };
+
+  "Failed readouts are omitted"_test = [] -> void {
+    SystemSnapshot snapshot;
+    snapshot.memInfo = Err(DracError(DracErrorCode::NotSupported, "no memory info"));
+
+    expect(!Contains(Render(snapshot), "drac_memory_used_bytes"));
+  };
+
+  "Label values are escaped"_test = [] -> void {
+    SystemSnapshot snapshot;
+    snapshot.host = "a \"quoted\" \\ host\n";
+
+    expect(Contains(Render(snapshot), R"(host="a \"quoted\" \\ host\n")"));
+  };
+
+  "Network traffic is exposed as counters"_test = [] -> void {
+    NetworkInterface iface;
+    iface.name    = "eth0";
+    iface.isUp    = true;
+    iface.rxBytes = 100;
+
+    SystemSnapshot snapshot;
+    snapshot.networkInterfaces = Vec<NetworkInterface> { iface };
+
+    const String out = Render(snapshot);
+
+    expect(Contains(out, "# TYPE drac_network_receive_bytes counter\n"));
+    expect(Contains(out, "drac_network_receive_bytes_total{interface=\"eth0\"} 100\n"));
+    expect(!Contains(out, "drac_network_transmit_bytes_total{"));
+    expect(Contains(out, "drac_network_up{interface=\"eth0\"} 1\n"));
+  };
+
+  "GPU counters are labelled by address"_test = [] -> void {
+    GPUInfo gpu;
+    gpu.pciAddress     = "0000:03:00.0";
+    gpu.model          = "AMD Radeon RX 7900 XTX";
+    gpu.vramTotalBytes = 4096;
+    gpu.busyPercent    = 42.0;
+
+    SystemSnapshot snapshot;
+    snapshot.gpus = Vec<GPUInfo> { gpu };
+
+    const String out = Render(snapshot);
+
+    expect(Contains(out, "drac_gpu_busy_percent{address=\"0000:03:00.0\",model=\"AMD Radeon RX 7900 XTX\"} 42\n"));
+    expect(Contains(out, "drac_gpu_memory_total_bytes{address=\"0000:03:00.0\",model=\"AMD Radeon RX 7900 XTX\"} 4096\n"));
+    expect(!Contains(out, "drac_gpu_memory_used_bytes{"));
+  };
+
+  "CPU load has an overall and a per-CPU series"_test = [] -> void {
+    SystemSnapshot snapshot;
+    snapshot.cpuUsage = CPULoad { .total = 37.5, .perCpu = { 25.0, 50.0 } };
+
+    const String out = Render(snapshot);
+
+    expect(Contains(out, "# UNIT drac_cpu_busy_percent percent\n"));
+    expect(Contains(out, "drac_cpu_busy_percent{cpu=\"all\"} 37.5\n"));
+    expect(Contains(out, "drac_cpu_busy_percent{cpu=\"0\"} 25\n"));
+    expect(Contains(out, "drac_cpu_busy_percent{cpu=\"1\"} 50\n"));
+  };
+
+  return 0;
+}
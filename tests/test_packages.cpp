@@ -0,0 +1,66 @@
+#include <boost/ut.hpp>
+
+#include <Drac++/Utils/Types.hpp>
+
+#if DRAC_ENABLE_PACKAGECOUNT
+  #include <Drac++/Services/Packages.hpp>
+#endif
+
+using namespace boost::ut;
+using namespace draconis::utils::types;
+
+auto main() -> int {
+#if DRAC_ENABLE_PACKAGECOUNT
+  using draconis::services::packages::CountRecordSeparators;
+
+  "Blank-line separators are counted like empty lines"_test = [] -> void {
+    expect(CountRecordSeparators("", "\n\n") == 0_ull);
+    expect(CountRecordSeparators("\n", "\n\n") == 0_ull);
+    expect(CountRecordSeparators("P:musl\nV:1.2\n\nP:busybox\nV:1.36\n\n", "\n\n") == 2_ull);
+
+    // Overlapping matches: two empty lines in a row are two separators.
+    expect(CountRecordSeparators("a\n\n\nb", "\n\n") == 2_ull);
+  };
+
+  "Vector and scalar paths agree across block boundaries"_test = [] -> void {
+    // Sizes straddle the 16- and 32-byte blocks. Besides a pseudo-random mix of
+    // runs, every buffer gets a separator split across 15/16 and 31/32 (where
+    // a block ends on the first newline) and one in its last two bytes, which
+    // the scalar tail handles.
+    for (usize size = 2; size < 200; ++size) {
+      String data(size, 'x');
+
+      u32 state = static_cast<u32>(size) * 2654435761U;
+
+      for (char& byte : data) {
+        state = (state * 1103515245U) + 12345U;
+
+        if ((state >> 16) % 3 == 0)
+          byte = '\n';
+      }
+
+      for (const usize offset : { usize(15), usize(31), size - 2 })
+        if (offset + 1 < size) {
+          data[offset]     = '\n';
+          data[offset + 1] = '\n';
+        }
+
+      u64 expected = 0;
+
+      for (usize i = 0; i + 1 < data.size(); ++i)
+        expected += static_cast<u64>(data[i] == '\n' && data[i + 1] == '\n');
+
+      expect(expected > 0_ull) << "size " << size;
+      expect(CountRecordSeparators(data, "\n\n") == expected) << "size " << size;
+    }
+  };
+
+  "Other separator lengths use the generic search"_test = [] -> void {
+    expect(CountRecordSeparators("a\nb\nc\n", "\n") == 3_ull);
+    expect(CountRecordSeparators("x---y---z", "---") == 2_ull);
+    expect(CountRecordSeparators("anything", "") == 0_ull);
+  };
+#endif
+
+  return 0;
+}
@@ -0,0 +1,162 @@
+#include <boost/ut.hpp>
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#ifdef __linux__
+  #include "PciIndex.hpp"
+#endif
+
+using namespace boost::ut;
+using namespace draconis::utils::error;
+using namespace draconis::utils::types;
+
+namespace fs = std::filesystem;
+
+#ifdef __linux__
+namespace {
+  constexpr StringView PCI_IDS = "# Test list\n"
+                                 "\n"
+                                 "1002  Advanced Micro Devices, Inc. [AMD/ATI]\n"
+                                 "\t744c  Navi 31 [Radeon RX 7900 XT/7900 XTX]\n"
+                                 "\t\t1002 0e3b  Radeon RX 7900 XTX\n"
+                                 "\t15bf  Phoenix1\n"
+                                 "10de  NVIDIA Corporation\n"
+                                 "\t2684  AD102 [GeForce RTX 4090]\n"
+                                 "1234  Vendor Without Devices\n"
+                                 "C 03  Display controller\n"
+                                 "\t00  VGA compatible controller\n";
+
+  auto TempIndexPath(const StringView name) -> fs::path {
+    const fs::path path = fs::temp_directory_path() / std::format("drac_test_pci_{}.idx", name);
+    fs::remove(path);
+    return path;
+  }
+
+  auto ReadFile(const fs::path& path) -> String {
+    std::ifstream ifs(path, std::ios::binary);
+    return { std::istreambuf_iterator<char>(ifs), {} };
+  }
+} // namespace
+#endif
+
+auto main() -> int {
+#ifdef __linux__
+  using draconis::os::pci::BuildIndex;
+  using draconis::os::pci::Index;
+
+  // Counts how often load() had to go back to the source.
+  usize sourceReads = 0;
+
+  const auto readSource = [&sourceReads]() -> Result<String> {
+    ++sourceReads;
+    return String(PCI_IDS);
+  };
+
+  "Lookups find vendors and devices and miss unknown ids"_test = [&] -> void {
+    const fs::path path = TempIndexPath("lookup");
+
+    const Result<Index> index = Index::load(path, 1, readSource);
+    expect(fatal(index.has_value()));
+
+    expect(index->lookup(0x1002, 0x744c) == Option(Pair<StringView, StringView>("Advanced Micro Devices, Inc. [AMD/ATI]", "Navi 31 [Radeon RX 7900 XT/7900 XTX]")));
+    expect(index->lookup(0x1002, 0x15bf) == Option(Pair<StringView, StringView>("Advanced Micro Devices, Inc. [AMD/ATI]", "Phoenix1")));
+    expect(index->lookup(0x10de, 0x2684) == Option(Pair<StringView, StringView>("NVIDIA Corporation", "AD102 [GeForce RTX 4090]")));
+
+    // Unknown device of a known vendor, unknown vendor, and a subsystem id that isn't a device.
+    expect(!index->lookup(0x1002, 0x0001).has_value());
+    expect(!index->lookup(0x8086, 0x744c).has_value());
+    expect(!index->lookup(0x1002, 0x0e3b).has_value());
+
+    fs::remove(path);
+  };
+
+  "A vendor without devices never matches"_test = [&] -> void {
+    const fs::path path = TempIndexPath("empty_vendor");
+
+    const Result<Index> index = Index::load(path, 1, readSource);
+    expect(fatal(index.has_value()));
+
+    expect(!index->lookup(0x1234, 0x0000).has_value());
+    expect(!index->lookup(0x1234, 0xffff).has_value());
+
+    fs::remove(path);
+  };
+
+  "A saved index is reused while the fingerprint matches"_test = [&] -> void {
+    const fs::path path = TempIndexPath("reuse");
+
+    sourceReads = 0;
+    expect(Index::load(path, 7, readSource).has_value());
+    expect(sourceReads == 1_ul);
+    expect(ReadFile(path) == BuildIndex(PCI_IDS, 7));
+
+    const Result<Index> reloaded = Index::load(path, 7, readSource);
+    expect(fatal(reloaded.has_value()));
+    expect(sourceReads == 1_ul);
+    expect(reloaded->lookup(0x10de, 0x2684).has_value());
+
+    fs::remove(path);
+  };
+
+  "A stale fingerprint rebuilds the index"_test = [&] -> void {
+    const fs::path path = TempIndexPath("stale");
+
+    sourceReads = 0;
+    expect(Index::load(path, 1, readSource).has_value());
+
+    const Result<Index> rebuilt = Index::load(path, 2, readSource);
+    expect(fatal(rebuilt.has_value()));
+    expect(sourceReads == 2_ul);
+    expect(rebuilt->lookup(0x1002, 0x744c).has_value());
+    expect(ReadFile(path) == BuildIndex(PCI_IDS, 2));
+
+    fs::remove(path);
+  };
+
+  "Truncated or corrupt index files are rebuilt"_test = [&] -> void {
+    const String image = BuildIndex(PCI_IDS, 3);
+
+    const Array<String, 3> damaged = {
+      image.substr(0, image.size() - 1),   // truncated mid-strings
+      image.substr(0, 20),                 // truncated mid-header
+      String("DRACPCI0") + image.substr(8) // wrong magic
+    };
+
+    for (const String& contents : damaged) {
+      const fs::path path = TempIndexPath("corrupt");
+
+      {
+        std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+        ofs << contents;
+      }
+
+      sourceReads = 0;
+
+      const Result<Index> index = Index::load(path, 3, readSource);
+      expect(fatal(index.has_value()));
+      expect(sourceReads == 1_ul);
+      expect(index->lookup(0x10de, 0x2684).has_value());
+      expect(ReadFile(path) == image);
+
+      fs::remove(path);
+    }
+  };
+
+  "A source that can't be read is an error"_test = [&] -> void {
+    const fs::path path = TempIndexPath("unreadable");
+
+    const Result<Index> index = Index::load(path, 1, []() -> Result<String> {
+      return Err(DracError(DracErrorCode::NotFound, "pci.ids not found"));
+    });
+
+    expect(!index.has_value());
+    expect(!fs::exists(path));
+  };
+#endif
+
+  return 0;
+}
@@ -0,0 +1,107 @@
+#include <boost/ut.hpp>
+#include <filesystem>
+#include <format>
+
+#include <Drac++/Core/Plugin.hpp>
+
+using namespace boost::ut;
+using namespace draconis::utils::types;
+
+namespace fs = std::filesystem;
+
+namespace {
+  auto TempCacheDir(const StringView name) -> fs::path {
+    const fs::path dir = fs::temp_directory_path() / std::format("drac_test_plugincache_{}", name);
+    fs::remove_all(dir);
+    return dir;
+  }
+} // namespace
+
+auto main() -> int {
+  "Immediate mode writes on set"_test = [] -> void {
+    const fs::path dir = TempCacheDir("immediate");
+
+    PluginCache cache(dir);
+    cache.set<String>("key", "value");
+
+    expect(fs::exists(dir / "key"));
+    expect(cache.get<String>("key") == Option<String>("value"));
+
+    fs::remove_all(dir);
+  };
+
+  "Write-behind mode defers writes until flush"_test = [] -> void {
+    const fs::path dir = TempCacheDir("deferred");
+
+    PluginCache cache(dir, PluginCache::WriteMode::WriteBehind);
+    cache.set<String>("key", "value");
+
+    expect(!fs::exists(dir / "key"));
+    expect(cache.get<String>("key") == Option<String>("value"));
+
+    cache.flush();
+    expect(fs::exists(dir / "key"));
+
+    PluginCache reader(dir);
+    expect(reader.get<String>("key") == Option<String>("value"));
+
+    fs::remove_all(dir);
+  };
+
+  "Write-behind changes are flushed on destruction"_test = [] -> void {
+    const fs::path dir = TempCacheDir("destruct");
+
+    {
+      PluginCache cache(dir, PluginCache::WriteMode::WriteBehind);
+      cache.set<u64>("count", 42);
+    }
+
+    PluginCache reader(dir);
+    expect(reader.get<u64>("count") == Option<u64>(42));
+
+    fs::remove_all(dir);
+  };
+
+  "Invalidated keys are removed on flush"_test = [] -> void {
+    const fs::path dir = TempCacheDir("invalidate");
+
+    {
+      PluginCache writer(dir);
+      writer.set<String>("stale", "old");
+    }
+
+    PluginCache cache(dir, PluginCache::WriteMode::WriteBehind);
+    expect(cache.get<String>("stale") == Option<String>("old"));
+
+    cache.invalidate("stale");
+    expect(!cache.get<String>("stale").has_value());
+    expect(fs::exists(dir / "stale"));
+
+    cache.flush();
+    expect(!fs::exists(dir / "stale"));
+
+    fs::remove_all(dir);
+  };
+
+  "No temporary files are left behind"_test = [] -> void {
+    const fs::path dir = TempCacheDir("tmpfiles");
+
+    {
+      PluginCache cache(dir, PluginCache::WriteMode::WriteBehind);
+      for (u32 i = 0; i < 16; ++i)
+        cache.set<u32>(std::format("entry_{}", i), i);
+    }
+
+    usize files = 0;
+    for (const auto& entry : fs::directory_iterator(dir)) {
+      expect(entry.path().extension() != ".tmp");
+      ++files;
+    }
+
+    expect(files == 16_u);
+
+    fs::remove_all(dir);
+  };
+
+  return 0;
+}
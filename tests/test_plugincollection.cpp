@@ -0,0 +1,143 @@
+#include <atomic>
+#include <boost/ut.hpp>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#if DRAC_ENABLE_PLUGINS
+  #include "PluginCollection.hpp"
+#endif
+
+using namespace boost::ut;
+using namespace draconis::utils::types;
+
+namespace fs = std::filesystem;
+
+#if DRAC_ENABLE_PLUGINS
+namespace {
+  using namespace draconis::core::plugin;
+
+  class FakeProvider final : public IInfoProviderPlugin {
+   public:
+    String value = "first";
+
+    [[nodiscard]] auto getMetadata() const -> const PluginMetadata& override {
+      return m_metadata;
+    }
+
+    auto initialize(const PluginContext& /*ctx*/, ::PluginCache& /*cache*/) -> Result<Unit> override {
+      return {};
+    }
+
+    auto shutdown() -> Unit override {}
+
+    [[nodiscard]] auto isReady() const -> bool override {
+      return true;
+    }
+
+    [[nodiscard]] auto getProviderId() const -> String override {
+      return "fake";
+    }
+
+    auto collectData(::PluginCache& /*cache*/) -> Result<Unit> override {
+      return {};
+    }
+
+    [[nodiscard]] auto toJson() const -> Result<String> override {
+      return "{}";
+    }
+
+    [[nodiscard]] auto getFields() const -> Map<String, String> override {
+      return { { "value", value } };
+    }
+
+    [[nodiscard]] auto getDisplayValue() const -> Result<String> override {
+      return value;
+    }
+
+    [[nodiscard]] auto getDisplayIcon() const -> String override {
+      return "";
+    }
+
+    [[nodiscard]] auto getDisplayLabel() const -> String override {
+      return "Fake";
+    }
+
+    [[nodiscard]] auto getLastError() const -> Option<String> override {
+      return None;
+    }
+
+    [[nodiscard]] auto isEnabled() const -> bool override {
+      return true;
+    }
+
+   private:
+    PluginMetadata m_metadata { .name = "Fake", .version = "1.0.0", .author = "", .description = "", .type = PluginType::InfoProvider, .dependencies = {} };
+  };
+} // namespace
+#endif
+
+auto main() -> int {
+#if DRAC_ENABLE_PLUGINS
+  using draconis::core::system::PluginCollection;
+  using draconis::utils::error::DracError;
+  using enum draconis::utils::error::DracErrorCode;
+  using std::chrono::steady_clock, std::chrono::milliseconds;
+
+  const fs::path dir = fs::temp_directory_path() / "drac_test_plugincollection";
+
+  "Only the first completion is recorded"_test = [&] -> void {
+    FakeProvider     plugin;
+    PluginCollection collection(dir);
+
+    PluginManager::beginCollection(&plugin);
+
+    expect(collection.finish(&plugin, {}));
+
+    // Reporting again, or failing after reporting, must not replace the result.
+    plugin.value = "second";
+    expect(!collection.finish(&plugin, {}));
+    expect(!collection.finish(&plugin, Err(DracError(Other, "exception: late"))));
+
+    expect(collection.wait(None));
+    expect(fatal(collection.fields.has_value()));
+    expect(collection.fields->at("value") == "first");
+    expect(collection.displayValue == Option<String>("first"));
+    expect(collection.error.empty());
+  };
+
+  "A collection finishing after its deadline is picked up later"_test = [&] -> void {
+    auto plugin     = std::make_shared<FakeProvider>();
+    auto collection = std::make_shared<PluginCollection>(dir);
+
+    PluginManager::beginCollection(plugin.get());
+
+    std::atomic<bool> release = false;
+
+    std::thread worker([plugin, collection, &release] {
+      release.wait(false);
+      collection->finish(plugin.get(), {});
+    });
+
+    expect(!collection->wait(steady_clock::now() + milliseconds(10)));
+
+    release.store(true);
+    release.notify_one();
+    worker.join();
+
+    // The late result still lands once, and a second report is ignored.
+    expect(!collection->finish(plugin.get(), Err(DracError(Timeout, "deadline"))));
+    expect(collection->wait(steady_clock::now()));
+    expect(fatal(collection->fields.has_value()));
+    expect(collection->fields->at("value") == "first");
+    expect(collection->error.empty());
+  };
+
+  fs::remove_all(dir);
+#endif
+
+  return 0;
+}
@@ -0,0 +1,107 @@
+#include <boost/ut.hpp>
+#include <filesystem>
+#include <fstream>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#if DRAC_ENABLE_PLUGINS
+  #include <Drac++/Core/PluginManager.hpp>
+#endif
+
+using namespace boost::ut;
+using namespace draconis::utils::types;
+
+namespace fs = std::filesystem;
+
+auto main() -> int {
+#if DRAC_ENABLE_PLUGINS
+  using namespace draconis::core::plugin;
+  using draconis::utils::error::DracErrorCode;
+
+  const fs::path dir = fs::temp_directory_path() / "drac_test_pluginmanifest";
+
+  "Manifest entries survive a save and load"_test = [&] -> void {
+    fs::remove_all(dir);
+
+    const Map<String, PluginManifestEntry> entries {
+      { "weather",
+        PluginManifestEntry {
+          .path       = "/usr/lib/draconis++/plugins/weather.so",
+          .mtime      = 1'760'400'000'000'000'000,
+          .size       = 123'456,
+          .metadata   = { .name = "Weather", .version = "1.2.0", .author = "Draconis++ Team", .description = "Current conditions", .type = PluginType::InfoProvider, .dependencies = { .requiresNetwork = true } },
+          .providerId = "weather",
+        } },
+      { "markdown",
+        PluginManifestEntry {
+          .path       = "/usr/lib/draconis++/plugins/markdown.so",
+          .mtime      = 42,
+          .size       = 7,
+          .metadata   = { .name = "Markdown", .version = "0.1.0", .author = "", .description = "", .type = PluginType::OutputFormat, .dependencies = {} },
+          .providerId = "",
+        } },
+    };
+
+    const fs::path path = dir / "plugin_manifest.beve";
+
+    expect(fatal(WritePluginManifest(path, entries).has_value()));
+
+    const Result<Map<String, PluginManifestEntry>> loaded = ReadPluginManifest(path);
+    expect(fatal(loaded.has_value()));
+    expect(loaded->size() == 2_ul);
+
+    for (const auto& [name, entry] : entries) {
+      const auto iter = loaded->find(name);
+      expect(fatal(iter != loaded->end())) << name;
+
+      expect(iter->second.path == entry.path);
+      expect(iter->second.mtime == entry.mtime);
+      expect(iter->second.size == entry.size);
+      expect(iter->second.providerId == entry.providerId);
+      expect(iter->second.metadata.name == entry.metadata.name);
+      expect(iter->second.metadata.version == entry.metadata.version);
+      expect(iter->second.metadata.type == entry.metadata.type);
+      expect(iter->second.metadata.dependencies.requiresNetwork == entry.metadata.dependencies.requiresNetwork);
+    }
+
+    // Only the manifest itself is left behind; the temporary file was renamed over it.
+    usize files = 0;
+
+    for ([[maybe_unused]] const fs::directory_entry& file : fs::directory_iterator(dir))
+      ++files;
+
+    expect(files == 1_ul);
+
+    fs::remove_all(dir);
+  };
+
+  "A missing manifest reads as NotFound"_test = [&] -> void {
+    fs::remove_all(dir);
+
+    const Result<Map<String, PluginManifestEntry>> loaded = ReadPluginManifest(dir / "plugin_manifest.beve");
+    expect(fatal(!loaded.has_value()));
+    expect(loaded.error().code == DracErrorCode::NotFound);
+  };
+
+  "A corrupt manifest is rejected"_test = [&] -> void {
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    const fs::path path = dir / "plugin_manifest.beve";
+
+    {
+      std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+      ofs << "not a manifest";
+    }
+
+    const Result<Map<String, PluginManifestEntry>> loaded = ReadPluginManifest(path);
+    expect(fatal(!loaded.has_value()));
+    expect(loaded.error().code == DracErrorCode::ParseError);
+
+    fs::remove_all(dir);
+  };
+#endif
+
+  return 0;
+}
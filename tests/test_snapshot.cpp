@@ -0,0 +1,240 @@
+#include <boost/ut.hpp>
+#include <chrono>
+
+#include <Drac++/Core/Snapshot.hpp>
+
+#include <Drac++/Utils/CacheManager.hpp>
+
+using namespace boost::ut;
+using namespace draconis::core::system;
+using namespace draconis::utils::types;
+using draconis::utils::cache::CacheManager, draconis::utils::cache::CachePolicy;
+using draconis::utils::error::DracError, draconis::utils::error::DracErrorCode;
+
+// Cache key of the kernel readout, so a test can change what it reports.
+#if defined(__linux__)
+  #define KERNEL_CACHE_KEY "linux_kernel_version"
+#elif defined(__FreeBSD__) || defined(__DragonFly__) || defined(__NetBSD__)
+  #define KERNEL_CACHE_KEY "bsd_kernel_version"
+#endif
+
+namespace {
+  auto MakeSample() -> SystemSnapshot {
+    SystemSnapshot snapshot;
+
+    snapshot.version       = 7;
+    snapshot.kernelVersion = "6.9.0";
+    snapshot.host          = "test-host";
+    snapshot.cpuCores      = CPUCores(8, 16);
+    snapshot.memInfo       = ResourceUsage(4ULL << 30, 16ULL << 30);
+    snapshot.uptime        = std::chrono::seconds(3600);
+    snapshot.battery       = Battery(Battery::Status::Discharging, 80, std::chrono::seconds(5400));
+
+    return snapshot;
+  }
+
+  // No background refreshes, so the tests decide exactly when fields are re-collected.
+  auto ManualOptions() -> SnapshotOptions {
+    SnapshotOptions options;
+    options.intervals.fill(std::chrono::milliseconds::zero());
+    return options;
+  }
+} // namespace
+
+auto main() -> int {
+  "Snapshot is collected on construction"_test = [] -> void {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    SnapshotService snapshots(cache, ManualOptions());
+
+    const SharedPointer<const SystemSnapshot> snapshot = snapshots.current();
+
+    expect(snapshot != nullptr);
+  };
+
+  "current() returns the same snapshot until a refresh"_test = [] -> void {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    SnapshotService snapshots(cache, ManualOptions());
+
+    expect(snapshots.current() == snapshots.current());
+  };
+
+  "Refreshing an unchanged field keeps the version"_test = [] -> void {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    SnapshotService snapshots(cache, ManualOptions());
+
+    const SharedPointer<const SystemSnapshot> before = snapshots.current();
+
+    constexpr Array<SnapshotField, 1> fields = { SnapshotField::Kernel };
+    const SharedPointer<const SystemSnapshot> after = snapshots.refresh(fields);
+
+    expect(after->version == before->version);
+    expect(after == before);
+  };
+
+  "Published snapshots are not modified by later refreshes"_test = [] -> void {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    SnapshotService snapshots(cache, ManualOptions());
+
+    const SharedPointer<const SystemSnapshot> before  = snapshots.current();
+    const u64                                 version = before->version;
+
+    constexpr Array<SnapshotField, 2> fields = { SnapshotField::Uptime, SnapshotField::Memory };
+    const SharedPointer<const SystemSnapshot> after = snapshots.refresh(fields);
+
+    expect(before->version == version);
+    expect(after->version >= version);
+    expect(snapshots.current() == after);
+  };
+
+#if DRAC_ENABLE_CACHING && defined(KERNEL_CACHE_KEY)
+  "Listeners are called once per published snapshot"_test = [] -> void {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+    cache.set<String>(KERNEL_CACHE_KEY, "drac-test-1");
+
+    SnapshotService snapshots(cache, ManualOptions());
+
+    u64 calls = 0;
+    u64 seen  = 0;
+
+    const u64 id = snapshots.subscribe([&](const SystemSnapshot& previous, const SharedPointer<const SystemSnapshot>& next) {
+      calls++;
+      seen = next->version;
+      expect(previous.version < next->version);
+    });
+
+    const u64 before = snapshots.current()->version;
+
+    constexpr Array<SnapshotField, 1> fields = { SnapshotField::Kernel };
+
+    // Changing the cached kernel version makes the next refresh publish.
+    cache.set<String>(KERNEL_CACHE_KEY, "drac-test-2");
+    const SharedPointer<const SystemSnapshot> after = snapshots.refresh(fields);
+
+    expect(after->version == before + 1);
+    expect(calls == 1_ul);
+    expect(seen == after->version);
+
+    // Nothing changed, so nothing is published.
+    snapshots.refresh(fields);
+    expect(calls == 1_ul);
+
+    snapshots.unsubscribe(id);
+    cache.set<String>(KERNEL_CACHE_KEY, "drac-test-3");
+
+    expect(snapshots.refresh(fields)->version == after->version + 1);
+    expect(calls == 1_ul);
+  };
+#endif
+
+  "Diff of identical snapshots is empty"_test = [] -> void {
+    const SystemSnapshot snapshot = MakeSample();
+    const SnapshotDelta  delta    = Diff(snapshot, snapshot);
+
+    expect(delta.baseVersion == Option<u64>(7));
+    expect(!delta.kernelVersion.has_value());
+    expect(!delta.memInfo.has_value());
+    expect(delta.errors.empty());
+  };
+
+  "Diff carries changed values and new failures only"_test = [] -> void {
+    const SystemSnapshot previous = MakeSample();
+    SystemSnapshot       next     = previous;
+
+    next.version++;
+    next.memInfo = ResourceUsage(5ULL << 30, 16ULL << 30);
+    next.host    = Err(DracError(DracErrorCode::NotFound, "gone"));
+
+    const SnapshotDelta delta = Diff(previous, next);
+
+    expect(delta.version == 8_ul);
+    expect(delta.memInfo.has_value() && delta.memInfo->usedBytes == (5ULL << 30));
+    expect(!delta.kernelVersion.has_value());
+    expect(!delta.uptime.has_value());
+    expect(delta.errors.size() == 1_ul);
+    expect(delta.errors.front().member == "host");
+    expect(delta.errors.front().code == DracErrorCode::NotFound);
+  };
+
+  "Apply brings the base snapshot up to date"_test = [] -> void {
+    SystemSnapshot previous = MakeSample();
+    SystemSnapshot next     = previous;
+
+    next.version++;
+    next.uptime = std::chrono::seconds(3700);
+    next.host   = Err(DracError(DracErrorCode::NotFound, "gone"));
+
+    expect(Apply(previous, Diff(previous, next)).has_value());
+
+    expect(previous.version == next.version);
+    expect(previous.uptime && *previous.uptime == *next.uptime);
+    expect(!previous.host && previous.host.error().code == DracErrorCode::NotFound);
+    expect(previous.kernelVersion && *previous.kernelVersion == *next.kernelVersion);
+  };
+
+  "Apply rejects a delta taken against another version"_test = [] -> void {
+    SystemSnapshot previous = MakeSample();
+    SystemSnapshot next     = previous;
+
+    next.version++;
+
+    SystemSnapshot other = previous;
+    other.version        = 3;
+
+    const Result<> applied = Apply(other, Diff(previous, next));
+
+    expect(!applied.has_value());
+    expect(applied.error().code == DracErrorCode::InvalidArgument);
+  };
+
+  "Deltas round-trip through BEVE"_test = [] -> void {
+    const SystemSnapshot snapshot = MakeSample();
+
+    String encoded;
+    expect(WriteSnapshotDelta(Diff(snapshot), encoded).has_value());
+
+    const Result<SnapshotDelta> decoded = ReadSnapshotDelta(encoded);
+    expect(decoded.has_value());
+
+    if (!decoded)
+      return;
+
+    expect(!decoded->baseVersion.has_value());
+
+    SystemSnapshot restored;
+    expect(Apply(restored, *decoded).has_value());
+
+    expect(restored.version == 7_ul);
+    expect(restored.kernelVersion && *restored.kernelVersion == *snapshot.kernelVersion);
+    expect(restored.cpuCores && *restored.cpuCores == *snapshot.cpuCores);
+    expect(restored.memInfo && *restored.memInfo == *snapshot.memInfo);
+    expect(restored.uptime && *restored.uptime == *snapshot.uptime);
+    expect(restored.battery && *restored.battery == *snapshot.battery);
+  };
+
+  "start() and stop() are idempotent"_test = [] -> void {
+    CacheManager cache;
+    cache.setGlobalPolicy(CachePolicy::inMemory());
+
+    SnapshotService snapshots(cache, SnapshotOptions {}.setInterval(SnapshotField::Uptime, std::chrono::milliseconds(10)));
+
+    snapshots.start();
+    snapshots.start();
+    snapshots.stop();
+    snapshots.stop();
+
+    snapshots.start();
+
+    expect(snapshots.current() != nullptr);
+  };
+
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include <boost/ut.hpp>
+
+#include <Drac++/Utils/Types.hpp>
+
+#include "TextWidth.hpp"
+
+using namespace boost::ut;
+using namespace draconis::utils::types;
+
+auto main() -> int {
+  using namespace draconis::ui::text;
+
+  "ASCII is one column per byte"_test = [] -> void {
+    expect(GetVisualWidth("") == 0_ul);
+    expect(GetVisualWidth("hello") == 5_ul);
+
+    // Long enough to take the vector path, with a tail after the last block.
+    expect(GetVisualWidth("AMD Ryzen 9 7950X 16-Core Processor") == 35_ul);
+  };
+
+  "Escape sequences take no columns"_test = [] -> void {
+    expect(GetVisualWidth("\033[38;5;6mcyan\033[0m") == 4_ul);
+    expect(GetVisualWidth("0123456789abcdef\033[1m0123456789abcdef\033[0m") == 32_ul);
+  };
+
+  "Wide characters take two columns"_test = [] -> void {
+    expect(IsWideCharacter(U'日'));
+    expect(IsWideCharacter(U'가'));
+    expect(IsWideCharacter(U'\U00020000'));
+    expect(!IsWideCharacter(U'a'));
+    expect(!IsWideCharacter(U'é'));
+    expect(!IsWideCharacter(U'⿠'));
+
+    expect(GetVisualWidth("日本語") == 6_ul);
+    expect(GetVisualWidth("0123456789abcdef日本") == 20_ul);
+  };
+
+  "Range edges survive the compile-time table"_test = [] -> void {
+    for (const detail::WideRange& range : detail::WIDE_RANGES)
+      expect(IsWideCharacter(range.first) && IsWideCharacter(range.last));
+
+    expect(!IsWideCharacter(0x10FF));
+    expect(!IsWideCharacter(0x1160));
+
+    expect(!IsWideCharacter(0x3FFFE));
+    expect(!IsWideCharacter(0x40000));
+  };
+
+  "Short text isn't wrapped"_test = [] -> void {
+    const Vec<WrappedLine> lines = WordWrap("Song  Title", 20);
+
+    expect(lines.size() == 1_ul);
+    expect(lines[0].text == "Song Title");
+    expect(lines[0].width == 10_ul);
+  };
+
+  "Two lines are balanced"_test = [] -> void {
+    const Vec<WrappedLine> lines = WordWrap("aaaa bb cc dddd", 10);
+
+    expect(lines.size() == 2_ul);
+    expect(lines[0].text == "aaaa bb");
+    expect(lines[1].text == "cc dddd");
+  };
+
+  "Every wrapped line fits"_test = [] -> void {
+    String text;
+
+    for (usize i = 0; i < 200; ++i)
+      text += i % 3 == 0 ? "word " : "日本 ";
+
+    for (const WrappedLine& line : WordWrap(text, 17)) {
+      expect(line.width <= 17_ul);
+      expect(line.width == GetVisualWidth(line.text));
+    }
+  };
+
+  "Whitespace-only text wraps to nothing"_test = [] -> void {
+    expect(WordWrap(" \t ", 10).empty());
+  };
+}
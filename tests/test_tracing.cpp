@@ -0,0 +1,88 @@
+#include <boost/ut.hpp>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include <Drac++/Utils/Tracing.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+using namespace boost::ut;
+using namespace draconis::utils::types;
+
+#if DRAC_ENABLE_TRACING
+namespace {
+  auto ReadTrace() -> String {
+    namespace tracing = draconis::utils::tracing;
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "draconis_test_trace.json";
+
+    expect(tracing::WriteChromeTrace(path).has_value());
+
+    std::ifstream ifs(path, std::ios::binary);
+    String        contents((std::istreambuf_iterator<char>(ifs)), {});
+
+    std::filesystem::remove(path);
+
+    return contents;
+  }
+} // namespace
+#endif
+
+auto main() -> int {
+#if DRAC_ENABLE_TRACING
+  namespace tracing = draconis::utils::tracing;
+
+  "Spans are only recorded while tracing is active"_test = [] -> void {
+    tracing::Stop();
+
+    {
+      DRAC_TRACE_SCOPE("test", "before_start");
+    }
+
+    tracing::Start();
+
+    {
+      DRAC_TRACE_SCOPE_DETAIL("test", "after_start", String("some \"detail\""));
+    }
+
+    tracing::Stop();
+
+    const String trace = ReadTrace();
+
+    expect(trace.find("before_start") == String::npos);
+    expect(trace.find(R"("name":"after_start")") != String::npos);
+    expect(trace.find(R"("ph":"X")") != String::npos);
+    expect(trace.find(R"(some \"detail\")") != String::npos);
+  };
+
+  "Events from other threads are exported"_test = [] -> void {
+    tracing::Start();
+
+    std::thread([] {
+      DRAC_TRACE_INSTANT("test", "worker_instant", "");
+    }).join();
+
+    tracing::Stop();
+
+    const String trace = ReadTrace();
+
+    expect(trace.find(R"("name":"worker_instant")") != String::npos);
+    expect(trace.find(R"("ph":"i")") != String::npos);
+  };
+
+  "Start discards previous events"_test = [] -> void {
+    tracing::Start();
+    tracing::RecordInstant("stale", "test");
+    tracing::Start();
+    tracing::Stop();
+
+    expect(ReadTrace().find("stale") == String::npos);
+  };
+#else
+  // Tracing is compiled out; the macros must still be usable as statements.
+  DRAC_TRACE_SCOPE("test", "disabled");
+  DRAC_TRACE_INSTANT("test", "disabled", "");
+#endif
+
+  return 0;
+}